@@ -0,0 +1,699 @@
+// Generated by bundle_assets.py from web-interface, do not edit
+
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <ESPAsyncWebSrv.h>
+
+// /css/style.css, 1741 bytes, 619 gzipped
+static const uint8_t webAssets_0[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x95,0x54,0xcb,0x6e,0xdb,0x30,
+  0x10,0xbc,0xfb,0x2b,0x08,0x18,0x01,0x9c,0x22,0x0a,0x24,0xbf,0x12,0x4b,0xe8,0xa1,
+  0x28,0xd0,0x2f,0xe8,0xa5,0x28,0x7a,0xa0,0xc8,0x95,0x48,0x84,0x26,0x05,0x8a,0xf2,
+  0x23,0x45,0xfe,0xbd,0xa4,0x44,0xbd,0x6c,0x2b,0x49,0xa5,0x8b,0x44,0xce,0xce,0x2e,
+  0x67,0x67,0xf9,0x05,0xfd,0x9d,0x21,0xfb,0x14,0x98,0x52,0x2e,0xf3,0x18,0x85,0x49,
+  0xfd,0xbf,0xc7,0x3a,0xe7,0xb2,0xfe,0x7d,0x9b,0x31,0xc0,0x14,0xb4,0x47,0xa6,0x98,
+  0xbc,0xe4,0x5a,0x55,0x92,0x06,0x44,0x09,0xa5,0x63,0x34,0x5f,0x3e,0x61,0x02,0x1b,
+  0x87,0x4c,0x15,0x3d,0x7b,0x5c,0xa6,0xa4,0x09,0x32,0xbc,0xe7,0xe2,0x1c,0x23,0x82,
+  0x05,0x4f,0x35,0x1f,0x90,0xb1,0xc8,0xe3,0x0c,0x9c,0x4c,0x60,0xb7,0x73,0x9b,0x8d,
+  0x80,0x34,0xa0,0x93,0x3e,0xbe,0xe4,0xaf,0x10,0xa3,0x35,0xec,0x9b,0x35,0x9f,0xf0,
+  0xc8,0xb8,0x81,0x64,0x5c,0x77,0x14,0x16,0xa7,0x01,0x3d,0xdf,0xe7,0x9e,0xff,0xc8,
+  0xa9,0x61,0x76,0xbf,0x01,0xf4,0x67,0x0b,0x8c,0x2a,0xda,0xb0,0x3a,0x9f,0x50,0xd8,
+  0xc4,0x48,0x40,0x66,0x1c,0x4f,0x25,0x7c,0xbc,0xe0,0xa5,0xad,0xc3,0x9c,0x05,0x04,
+  0xe6,0x5c,0xd8,0x6a,0xa4,0x92,0x70,0x25,0xd2,0x2d,0x0d,0xd5,0x01,0xb4,0x65,0x3d,
+  0xc6,0x88,0x71,0x4a,0x41,0x26,0x53,0xfa,0xad,0x56,0x2b,0x97,0x52,0xf0,0x56,0xba,
+  0x71,0x29,0x76,0x1d,0xfb,0x1d,0xca,0xcb,0x42,0x60,0x2b,0x68,0x2a,0x14,0x79,0x99,
+  0x12,0x65,0x4a,0xd2,0x5e,0xac,0x75,0x71,0x42,0xd1,0xb6,0x3d,0x7a,0x8d,0xa7,0x40,
+  0x94,0xc6,0x86,0x2b,0xd9,0x1e,0xb1,0xc9,0x1c,0x33,0x77,0x8e,0x58,0x2a,0xb3,0x78,
+  0xc4,0xc4,0xf0,0x03,0xdc,0x4f,0x3b,0x21,0x8a,0x22,0x17,0xe7,0x81,0xd3,0xb8,0xf5,
+  0xf7,0x6f,0x3f,0x36,0xb5,0xb7,0x0c,0x4e,0x45,0x07,0x54,0xda,0xf6,0xce,0x81,0x04,
+  0x2e,0x4a,0x2b,0x75,0xfb,0x95,0x8c,0x3a,0x19,0x86,0x77,0x5d,0xe4,0x9c,0xcb,0xa2,
+  0x32,0xe5,0xcf,0xff,0x66,0x79,0xf2,0x24,0xec,0x61,0x66,0xe8,0x0d,0x2b,0x36,0xe2,
+  0x8f,0x54,0x7b,0x6e,0x1c,0x66,0xac,0x18,0x86,0x05,0x84,0x71,0x41,0x17,0x70,0x00,
+  0xf9,0x8e,0x1e,0xd9,0xd2,0xbd,0x75,0x9e,0x8f,0xc5,0xb8,0x6e,0xe6,0xdb,0xac,0x04,
+  0xe2,0x5a,0x32,0xf6,0xf2,0xd6,0xd5,0x3e,0x34,0x60,0x6b,0xfe,0xc7,0xb4,0x32,0xa6,
+  0x43,0x77,0x66,0xe1,0x52,0x70,0x09,0xc1,0xc0,0x33,0xa3,0xb1,0x41,0xd1,0xa6,0x1b,
+  0x82,0x7e,0xe8,0xfa,0x45,0x52,0xe9,0xd2,0x15,0x55,0x28,0xde,0x7b,0x69,0xca,0x63,
+  0x13,0x5e,0xaa,0xe7,0xa1,0x32,0xae,0x8e,0xe1,0x52,0xa7,0x53,0x96,0x25,0x9f,0x91,
+  0xa7,0xe9,0xed,0x90,0xc1,0x77,0x5b,0x63,0xca,0xab,0x72,0x58,0x75,0xaa,0x4e,0x41,
+  0xc9,0x30,0x75,0xf3,0x17,0xa2,0x9d,0x3d,0xe6,0x7c,0xb7,0xdb,0x0d,0x54,0x6a,0x8c,
+  0x3d,0xdd,0x96,0x15,0x3c,0xc3,0x3a,0x1a,0xe0,0x3f,0x32,0x75,0x13,0x70,0x2b,0xfb,
+  0xc6,0x65,0xdf,0x6e,0xb7,0x5e,0x22,0x8d,0x65,0x99,0x29,0xbd,0x8f,0x9b,0x4f,0x81,
+  0x0d,0xfc,0x5a,0xd8,0x91,0xbc,0x77,0xd5,0xd5,0x86,0xfe,0xed,0xae,0x9a,0xaf,0x4e,
+  0xcb,0x3f,0x0f,0xd6,0x03,0xc2,0xba,0x60,0x6c,0x81,0xe5,0xe6,0xee,0xb2,0x93,0x4b,
+  0x9b,0x64,0x79,0x71,0xc9,0xd5,0xa6,0x6d,0xef,0xa3,0x77,0xfc,0xd0,0xea,0x1a,0x59,
+  0x74,0xa9,0x04,0xa7,0x68,0x4e,0x08,0xb9,0xa9,0xf0,0x7a,0x24,0x30,0x7f,0xad,0x93,
+  0x7b,0x8c,0x5d,0xaa,0x05,0x26,0xd6,0x46,0xd8,0xa6,0xd0,0x97,0x45,0x5f,0x95,0x17,
+  0x4e,0xbb,0xc9,0xf2,0xe4,0xb8,0xca,0x61,0xcc,0x31,0x24,0x61,0xc0,0x73,0x66,0x3a,
+  0xde,0xb7,0x7f,0x01,0x60,0x09,0x6b,0xcd,0x06,0x00,0x00,
+};
+
+// /index.html, 4104 bytes, 797 gzipped
+static const uint8_t webAssets_1[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xdd,0x97,0x5b,0x4f,0xdb,0x30,
+  0x14,0x80,0x9f,0xdb,0x5f,0x61,0xac,0x49,0xb4,0x6a,0x49,0x60,0x5c,0x36,0x95,0x24,
+  0x13,0x0c,0xa4,0x21,0x90,0x86,0xb4,0x32,0x69,0x8f,0x6e,0x7c,0xda,0x9a,0x3a,0x17,
+  0xd9,0x4e,0x45,0x57,0xf1,0xdf,0x67,0x3b,0x24,0x6d,0x45,0x56,0xa0,0x34,0x7b,0x58,
+  0xa4,0x26,0xee,0xf1,0xb9,0xf9,0x7c,0x3e,0x96,0xec,0xed,0x5c,0x7c,0xff,0xda,0xff,
+  0x75,0x7b,0x89,0xc6,0x2a,0xe2,0x41,0xd3,0xcb,0x3f,0xfa,0x0b,0x84,0x06,0x4d,0xa4,
+  0x1f,0x4f,0x31,0xc5,0x21,0x00,0x99,0x7a,0x6e,0x3e,0xcc,0xc5,0x9c,0xc5,0x13,0x24,
+  0x80,0xfb,0x58,0xaa,0x19,0x07,0x39,0x06,0x50,0x18,0xa9,0x59,0x0a,0x3e,0x56,0xf0,
+  0xa0,0xdc,0x50,0x4a,0x8c,0xc6,0x02,0x86,0x3e,0xd6,0x43,0xd7,0x6a,0x39,0x1f,0x0f,
+  0x87,0x9f,0x3e,0xef,0x1f,0x1d,0x3b,0x66,0x56,0x07,0xb2,0xae,0x64,0x28,0x58,0xaa,
+  0x90,0x14,0xa1,0x8f,0xef,0xa5,0xfb,0x1b,0x52,0x95,0x38,0x11,0x8b,0x9d,0xa3,0x43,
+  0x0a,0x87,0x47,0x27,0xc7,0xce,0xbd,0x56,0xf6,0xdc,0x5c,0x6f,0xd5,0x2a,0x68,0xd8,
+  0x7f,0xe6,0x19,0x66,0x71,0xa8,0x58,0x12,0x23,0x95,0xc5,0x70,0x4b,0x04,0x89,0x5a,
+  0xa9,0x79,0xf7,0x93,0xbe,0x16,0x74,0x25,0x1b,0xc5,0x6d,0xd4,0x6c,0x34,0xe6,0x53,
+  0x22,0x90,0x4c,0x22,0xb8,0x13,0x1c,0xf9,0x08,0xbb,0x66,0xfa,0x0b,0xee,0x2c,0x29,
+  0x77,0xb0,0x8f,0x3b,0xc6,0xe0,0xb4,0xf4,0x6e,0x9e,0x0f,0x0e,0xb9,0x27,0x0f,0xad,
+  0x79,0x26,0x78,0xaf,0xf0,0xd0,0xa5,0x44,0x91,0xbe,0x5e,0x76,0x0f,0xd9,0x75,0xe3,
+  0xae,0x89,0xd1,0x90,0x59,0x18,0x82,0x94,0xbd,0x32,0xab,0x96,0xd0,0x25,0x4c,0x62,
+  0x09,0x6d,0x34,0x37,0x0a,0x6c,0x88,0x5a,0x3b,0x1f,0x1c,0x25,0x58,0xb4,0x98,0x6a,
+  0xcf,0x75,0x14,0x33,0xdb,0x30,0xaf,0x47,0xf3,0x02,0x2e,0xa1,0x94,0x12,0x0e,0x42,
+  0xb5,0x70,0x98,0xc4,0x43,0x36,0xca,0x04,0x50,0x74,0x7b,0x75,0x81,0x6c,0xe2,0x3d,
+  0x8c,0x3a,0xa8,0x74,0x74,0x9a,0xdb,0x2f,0x27,0xff,0xf8,0xd8,0xb6,0x0e,0xf5,0x6f,
+  0xa5,0x52,0x3f,0x09,0xcf,0x60,0xa5,0x52,0x53,0xc2,0xdf,0x54,0x28,0xad,0xff,0x9f,
+  0xd5,0xc9,0x38,0xb6,0x9b,0xac,0xdc,0x73,0x9e,0x9b,0xb7,0x84,0x37,0x48,0xe8,0xec,
+  0xa9,0x05,0x24,0xd8,0x8c,0x83,0xd2,0xdc,0x53,0x64,0x50,0x34,0xc8,0x42,0x26,0x56,
+  0x05,0xb9,0x70,0x1c,0xd8,0x1d,0x0a,0x0a,0x84,0xee,0xab,0x71,0xb5,0xca,0x55,0x1c,
+  0x0a,0x88,0x20,0x56,0xb9,0x8a,0x59,0x99,0x11,0x5f,0x40,0xa5,0x78,0x6a,0x40,0x3e,
+  0x77,0xa6,0x25,0xe2,0x55,0x29,0xd1,0xa0,0x4f,0xc4,0x08,0x14,0x3a,0x8b,0x47,0x1c,
+  0x8c,0x1d,0xad,0x56,0x7b,0x26,0xb4,0x13,0x83,0x4c,0x29,0xbd,0xa5,0x42,0x4e,0xa4,
+  0xf4,0x71,0xfe,0x0f,0xa3,0x24,0x0e,0x39,0x0b,0x27,0xfa,0x4c,0x28,0x9b,0x72,0x97,
+  0x18,0xff,0xbb,0xdd,0xdd,0x6f,0xbb,0x6d,0x1c,0xd8,0x60,0x9d,0x7d,0xe7,0xd8,0x73,
+  0x73,0x9b,0x8a,0x98,0x36,0x93,0x7c,0x99,0x4f,0x83,0xc6,0x06,0xe1,0x6e,0xca,0x70,
+  0x7b,0x2b,0xe1,0xac,0xbb,0xaa,0x10,0x2c,0x4e,0x33,0xb5,0x74,0xa4,0x61,0xc4,0xa8,
+  0x8f,0xad,0x3b,0x8c,0x22,0xf2,0xc0,0x21,0x1e,0xa9,0xb1,0x8f,0x4f,0x30,0x4a,0x39,
+  0x09,0x61,0x9c,0x70,0x0a,0xc2,0xc7,0x8e,0xe3,0xe0,0x37,0xa4,0x99,0x37,0x60,0x91,
+  0x26,0x4d,0xc2,0xcc,0xb0,0x75,0x34,0x89,0x4b,0x6e,0x31,0x9f,0xcf,0xae,0x68,0x31,
+  0xdf,0x76,0x2c,0xe6,0xf6,0x29,0x0e,0xee,0x52,0xdd,0x52,0x50,0xb5,0x8e,0x0d,0xf1,
+  0x5f,0xa7,0xf5,0x31,0x4f,0x0b,0xde,0xd7,0x69,0xe7,0xa5,0xea,0x6f,0x21,0xd4,0x4d,
+  0x1e,0xea,0x5d,0xa0,0x27,0x69,0x0d,0x94,0xd3,0x35,0x84,0x27,0x69,0xbd,0x78,0x59,
+  0x35,0xde,0x5a,0x78,0xb3,0x92,0x37,0xab,0x9b,0x37,0x2b,0x79,0xb3,0xf7,0xf1,0x66,
+  0x35,0xf0,0x66,0xeb,0x78,0xb3,0x7a,0x79,0xd3,0xfa,0xda,0x99,0x96,0x78,0xa9,0xc6,
+  0xbb,0x7f,0x50,0x27,0x5f,0x5a,0xf2,0xa5,0x7b,0x2f,0xc6,0x5a,0x0b,0x98,0xd6,0x00,
+  0x98,0xae,0x03,0x4c,0x37,0x05,0x6c,0x97,0x23,0x16,0xeb,0x8a,0x12,0x95,0x08,0x74,
+  0xb6,0xe5,0xc2,0x92,0x82,0x22,0xcd,0xd4,0xac,0x53,0x2f,0x44,0x52,0x50,0x34,0xb1,
+  0xf6,0x36,0x87,0x68,0xcc,0x49,0x1d,0x1c,0xb5,0xdf,0xb3,0x35,0x2c,0x6d,0xdc,0xd7,
+  0xe1,0xcc,0x07,0x7f,0xa5,0x78,0xbe,0xe5,0xca,0x0e,0xfe,0x21,0xc5,0xc1,0x16,0x29,
+  0x0e,0x6a,0xa2,0x78,0xfe,0x02,0xc5,0xc1,0x86,0x14,0xab,0xce,0xd1,0x1f,0x64,0x0a,
+  0xf5,0x9d,0xb2,0xc9,0x44,0x97,0xfb,0xc0,0x96,0x3b,0x89,0x5f,0x7f,0x72,0x34,0x97,
+  0x24,0x8b,0x0b,0x89,0xbe,0xcb,0x14,0xf7,0x15,0x7d,0x9b,0xc9,0xaf,0x31,0xe6,0x5a,
+  0x63,0x6e,0xfc,0x7f,0x00,0x82,0xc1,0x28,0x57,0x08,0x10,0x00,0x00,
+};
+
+// /js/zepto.min.js, 25070 bytes, 9329 gzipped
+static const uint8_t webAssets_2[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x7c,0x7b,0x73,0xdb,0xb6,
+  0xb6,0xef,0x57,0x91,0x70,0x72,0x34,0x64,0x05,0xd3,0x76,0xf6,0xfd,0xe7,0x50,0x41,
+  0x38,0x89,0x9b,0xee,0x76,0x4f,0x5e,0x53,0xbb,0xbb,0x6d,0x64,0x35,0x43,0x4b,0x90,
+  0xc5,0x84,0x22,0x55,0x3e,0xfc,0x88,0xa5,0xfb,0xd9,0xcf,0x7a,0x00,0x24,0x28,0xd1,
+  0x49,0xf6,0x9d,0x3b,0x93,0x58,0x24,0x88,0x37,0xd6,0xe3,0xb7,0x16,0x16,0x70,0x13,
+  0x17,0x83,0x0f,0x7a,0x53,0xe5,0x6a,0x59,0x67,0xf3,0x2a,0xc9,0x33,0xcf,0x7f,0xb0,
+  0x8f,0x83,0xd7,0x5e,0xe5,0x3f,0x14,0xba,0xaa,0x8b,0x6c,0x90,0xd5,0x69,0xaa,0x54,
+  0x15,0x9d,0x57,0x45,0x92,0x5d,0xc3,0x87,0xf0,0xd3,0xf4,0x3c,0x98,0xc7,0x69,0x0a,
+  0xcf,0xb3,0xed,0x56,0xe4,0x57,0x9f,0xf4,0xbc,0x12,0xbb,0xa6,0xf4,0x87,0xb6,0xb4,
+  0xb0,0x89,0x42,0x29,0xac,0xb4,0xcd,0xf4,0x71,0xaf,0x89,0xa1,0xaa,0x46,0xa3,0x0a,
+  0x1a,0x0a,0x6e,0x93,0x6c,0x91,0xdf,0xb6,0x39,0x9f,0xf4,0xe6,0x0c,0xb2,0x7c,0xa1,
+  0x2f,0xee,0x37,0x1a,0x8b,0xfc,0xf8,0xee,0xec,0xb7,0x37,0xaf,0xde,0x5e,0x7c,0x7c,
+  0xfb,0xee,0xc7,0x57,0x6d,0xc9,0x1f,0x9d,0x8e,0x98,0x5e,0xee,0x77,0xe3,0x8d,0x53,
+  0x39,0x66,0x1f,0x8d,0x86,0x1f,0xe9,0xe7,0x1d,0xe5,0x0f,0xae,0x75,0xf5,0xbe,0xc8,
+  0xab,0xbc,0x82,0x96,0xde,0x2d,0xe1,0x8b,0x52,0xe6,0xcb,0xc6,0x26,0xb7,0x95,0xfd,
+  0xea,0xb4,0x97,0xd5,0xeb,0x2b,0x5d,0x40,0x7b,0x98,0x25,0x5f,0x0e,0xaa,0x20,0xd5,
+  0xd9,0x75,0xb5,0x6a,0x73,0x7f,0x76,0x9a,0x2e,0xcd,0x84,0xca,0x66,0x35,0x0e,0xc6,
+  0xbc,0x73,0x7a,0xfd,0xc5,0xf9,0x6c,0x2b,0x7e,0x7e,0x12,0x65,0xc1,0x32,0x0b,0xe6,
+  0x79,0x36,0x8f,0xab,0x20,0xde,0x6c,0xd2,0x7b,0x6f,0x3a,0x93,0xb0,0x60,0x55,0x5b,
+  0xf2,0xa7,0x4e,0xc9,0x42,0x6f,0xd2,0x78,0xae,0xbd,0xe3,0x30,0x3c,0xbe,0x96,0xe2,
+  0x58,0xf8,0x6d,0x92,0x37,0x7d,0x71,0xf4,0x61,0x36,0xf6,0xf9,0x77,0x1a,0x1f,0x7d,
+  0x99,0xf9,0x98,0xe9,0xc9,0xe9,0xc7,0x27,0x4f,0xbb,0x19,0xe1,0xdb,0xe5,0x62,0x66,
+  0x72,0xf6,0x67,0xfa,0x88,0xa9,0x47,0x90,0x52,0xe5,0xaf,0xf3,0x5b,0x5d,0x9c,0xc5,
+  0xa5,0xf6,0x9c,0x11,0xfd,0xed,0xf6,0x6b,0x90,0x64,0x83,0x65,0xb4,0x9c,0x56,0xb3,
+  0x10,0xff,0xa8,0x4c,0xdf,0x0e,0x7e,0xd5,0xd7,0xaf,0xee,0x36,0x9e,0xf0,0xfe,0xda,
+  0x5e,0x5e,0x96,0xbe,0x18,0x57,0x63,0xe1,0xc1,0xd3,0xf6,0x89,0x2f,0x9c,0x7a,0x7e,
+  0x86,0x39,0xd4,0xfb,0x8b,0x30,0xb4,0x8b,0xa0,0xb7,0xdb,0xf9,0x14,0xa7,0x60,0x16,
+  0xe9,0x50,0x8f,0xc5,0xe6,0xce,0x21,0xdb,0x5f,0xb0,0x0b,0x37,0xc0,0x17,0x5a,0x66,
+  0x13,0xd3,0x95,0x1a,0x9a,0xdf,0x6e,0x3d,0xad,0xe2,0x60,0x5e,0xe8,0xb8,0xd2,0xaf,
+  0x52,0xbd,0xd6,0x59,0x05,0x59,0x65,0x1c,0x5c,0xe5,0x8b,0x7b,0x9c,0x68,0x9d,0x2d,
+  0xce,0x56,0x49,0xba,0xf0,0xb4,0x2f,0x33,0x05,0x24,0x73,0x96,0xaf,0x37,0x75,0xa5,
+  0x17,0xe7,0xd5,0x7d,0xaa,0x3d,0x2d,0x05,0x0c,0x9c,0x29,0x69,0xa3,0x8b,0xea,0xfe,
+  0xdf,0x71,0x5a,0x6b,0x4f,0x2c,0x92,0x12,0x66,0xe7,0x5e,0xf8,0x52,0x07,0x9b,0xb8,
+  0x80,0x6a,0xdf,0x02,0x4d,0xc3,0x9c,0xad,0xf3,0x1b,0xdd,0x54,0x28,0xb2,0x3c,0xd3,
+  0x40,0x47,0xd9,0x68,0xe4,0x65,0x4a,0x5c,0xa5,0xf9,0xfc,0x33,0x14,0xa9,0x69,0x62,
+  0xf8,0xb7,0x1d,0xc3,0xbf,0x1d,0x0a,0x9c,0x63,0x0d,0x50,0xab,0x80,0xd9,0xac,0xa2,
+  0xdc,0x50,0x58,0x60,0x93,0xfd,0x30,0x0b,0xd6,0xf1,0xc6,0xa6,0x60,0xd3,0x65,0x1f,
+  0xf9,0x9d,0x22,0x83,0x59,0x66,0x8b,0xaa,0xf0,0x26,0x4f,0x16,0x83,0x13,0x97,0x1a,
+  0x5f,0x7a,0x99,0x4c,0x64,0x01,0xf2,0x23,0x2f,0x3c,0x8d,0x8b,0x97,0xf8,0x05,0xf4,
+  0xf6,0x8d,0x97,0x4c,0xf5,0xcc,0xdf,0x6e,0x5f,0xf0,0x83,0x1f,0xd9,0x24,0xe0,0xb2,
+  0x37,0x5e,0xc6,0x4f,0xf4,0xab,0x1e,0x76,0xbe,0x7c,0xd1,0x7c,0x7c,0xd1,0xfd,0x38,
+  0x9d,0xf9,0xf2,0x25,0x3d,0x4a,0xcc,0x01,0x4d,0xf9,0x21,0x3e,0x0c,0x15,0x8a,0x02,
+  0xce,0x43,0x45,0xdb,0x3e,0xfd,0xe6,0xd2,0x81,0x91,0x61,0x3a,0xc2,0x71,0x85,0xf8,
+  0x27,0x58,0x26,0x69,0xa5,0xa1,0xb7,0x4e,0x91,0x7f,0x61,0x11,0x09,0x43,0x69,0x8a,
+  0x7d,0x80,0xef,0x91,0xb6,0xac,0x89,0x5f,0x42,0x87,0xdb,0xff,0xe0,0xfc,0xfe,0x03,
+  0xd7,0x9e,0x45,0x95,0x59,0xba,0x17,0x15,0x88,0xca,0x2b,0x58,0x7f,0x28,0x1e,0x56,
+  0x41,0xa9,0x2b,0x27,0x05,0x0a,0xb4,0x55,0xfc,0x4e,0xef,0x44,0x74,0x89,0x82,0x86,
+  0xd2,0xb8,0x2c,0xdf,0xc6,0x6b,0x20,0x53,0x21,0x64,0xa1,0x92,0xd1,0x28,0x09,0xae,
+  0x80,0x53,0x80,0x60,0x70,0xac,0x96,0x2a,0x33,0x85,0x02,0xb9,0x88,0x9a,0x8f,0x61,
+  0x42,0xcb,0xe2,0x39,0x49,0x2a,0x0b,0x9d,0x0a,0x95,0xdb,0xea,0x9f,0xb8,0xba,0x55,
+  0x71,0xdf,0xf0,0x5b,0x24,0xaa,0xa2,0x46,0x1a,0xab,0x80,0xd6,0xc5,0x32,0x4e,0x4b,
+  0x7a,0x89,0x86,0xa7,0xa1,0xc0,0xc1,0xd1,0x0b,0x3e,0x84,0xc8,0x75,0xf4,0x36,0xae,
+  0xc2,0xe3,0xbf,0xa6,0x97,0xd3,0xcb,0x87,0xd9,0x71,0x50,0xe9,0x12,0x39,0x02,0xe4,
+  0x0f,0x90,0x71,0xa9,0xff,0x75,0xfe,0xee,0x2d,0x4e,0x34,0x49,0x1e,0x90,0x45,0xf3,
+  0x95,0xd7,0x2e,0x45,0xb5,0x6b,0x3b,0xf2,0x4f,0x5e,0x24,0x0d,0x99,0x27,0x48,0x3b,
+  0x38,0x0f,0x99,0x3a,0x91,0x89,0x72,0x89,0xd2,0xc8,0xb7,0x49,0xf2,0x3c,0x9b,0x64,
+  0xe3,0xb1,0xff,0xcf,0x0e,0xc9,0x4e,0xb3,0x19,0xd4,0xb1,0xc3,0xa2,0x66,0xf9,0xe4,
+  0x99,0x7c,0x0b,0x93,0x07,0xa2,0x2f,0x57,0x45,0x50,0xa6,0xc9,0x5c,0xcb,0x12,0x9e,
+  0x78,0xc9,0x65,0xac,0x58,0xc1,0x04,0x8b,0x7c,0x5e,0x23,0x2f,0xcb,0x1a,0xa8,0x4f,
+  0x2e,0xf1,0xcf,0x5c,0x3d,0x88,0x79,0x9e,0xd6,0xeb,0xec,0x68,0x9e,0xd7,0x59,0x25,
+  0xc2,0x53,0xc9,0xef,0x25,0x3c,0x89,0x65,0x9e,0x55,0x47,0xb7,0x3a,0xb9,0x5e,0xd1,
+  0x17,0x91,0x26,0x99,0x3e,0x5a,0x35,0xef,0xf9,0x26,0x9e,0x27,0xd5,0x3d,0x7e,0xf9,
+  0x72,0x04,0x6d,0xe8,0x3b,0x4c,0xfd,0x92,0xe7,0xeb,0xf0,0x74,0x27,0x53,0x75,0xfc,
+  0xd7,0x65,0xf9,0xc3,0x33,0xef,0xf2,0x76,0xbc,0x1d,0xfa,0xd3,0xbf,0x9e,0xcf,0x7e,
+  0x78,0x7e,0x2c,0x57,0x90,0x4c,0x69,0x3e,0x7c,0xbc,0x3c,0x8e,0x9e,0x7b,0x51,0xf8,
+  0xec,0xf2,0xf8,0xf2,0xf4,0xf9,0xd6,0x7f,0x72,0x2c,0x37,0xea,0xf8,0x99,0x17,0x0d,
+  0x41,0x3a,0xc4,0xdb,0xab,0x62,0x0b,0x9d,0xd9,0x6a,0x90,0x69,0x8b,0xed,0xaa,0xd8,
+  0x26,0xeb,0xeb,0x6d,0x92,0x81,0xa0,0xd9,0x42,0x47,0x3e,0x6f,0xd7,0xba,0x8a,0xb7,
+  0xb0,0x00,0xf1,0xda,0xf7,0xbc,0xe9,0xe5,0x6d,0x08,0xc2,0x9b,0x5a,0xf1,0x2f,0x8f,
+  0x9f,0x1f,0x5f,0x27,0x72,0x01,0x4d,0x41,0xed,0x28,0xb5,0xb6,0xab,0x6a,0x9d,0x42,
+  0xfd,0x89,0x5c,0xab,0xe3,0x56,0x6e,0x5f,0xab,0xa9,0xb8,0x89,0x53,0x21,0xc5,0xbc,
+  0x2c,0xe1,0x2f,0xe6,0x82,0x9f,0x4a,0xdf,0x55,0xf0,0xb3,0x88,0xab,0x18,0x7e,0x6e,
+  0x93,0x45,0xb5,0xc2,0x8f,0x3c,0x70,0x29,0xf2,0xe5,0x12,0x68,0x5c,0xcc,0xe4,0x0d,
+  0x14,0x8f,0x97,0x30,0xc9,0x90,0xb8,0x01,0xd1,0x0f,0x72,0x11,0x9e,0xae,0x34,0xac,
+  0xad,0x86,0x07,0x96,0x94,0x90,0xef,0xfe,0x40,0x9c,0x8a,0x2a,0xbe,0x4a,0x35,0x88,
+  0xb5,0xbb,0x9e,0x4f,0x05,0xa4,0x5f,0x29,0xa0,0xd8,0xf0,0xf0,0x1b,0x0e,0x06,0x3e,
+  0xd3,0x6f,0x78,0x2f,0xab,0x95,0x8e,0x17,0xf8,0xbb,0xcc,0xf3,0x0a,0x7f,0x17,0xe1,
+  0x1d,0x24,0xc2,0x1f,0xf1,0x83,0x38,0x2c,0xbe,0x48,0x6e,0x40,0x79,0xc8,0x5b,0x75,
+  0x3c,0x07,0x89,0x9d,0xea,0x4a,0x6f,0xd3,0x3c,0x5e,0xc0,0xf4,0x26,0x19,0x0c,0x23,
+  0x06,0x32,0xbd,0xd1,0xc7,0xf2,0x95,0x42,0x5a,0xbf,0x3d,0x9a,0xfd,0x00,0x2b,0xf2,
+  0x09,0x09,0xe5,0x5c,0x7d,0x02,0x4d,0xc6,0x90,0x48,0x5e,0x60,0xca,0x3b,0xd5,0x5f,
+  0xbb,0x7c,0x0f,0x3d,0x8f,0xaf,0x88,0x1c,0x42,0x1c,0xe6,0x2f,0x44,0x18,0x12,0xb2,
+  0x2e,0xf2,0x2c,0xbd,0x0f,0x05,0x3e,0xbd,0x83,0x27,0x81,0x04,0x56,0x88,0x90,0x66,
+  0xfd,0xa7,0x1c,0x27,0x91,0xf8,0x17,0x52,0x1a,0x3e,0x16,0x72,0x1d,0xdf,0x31,0x3f,
+  0x84,0x02,0x1e,0x5f,0xd3,0xa3,0x90,0x73,0x9d,0xa6,0x25,0x92,0x5f,0x76,0x0d,0xb9,
+  0xe1,0xe5,0x9c,0x5f,0xf8,0xcb,0x26,0x5e,0x2c,0x9a,0x2f,0xef,0xf9,0x05,0x7a,0x90,
+  0xdf,0x42,0x91,0x0c,0x3a,0x90,0xdf,0x42,0xf6,0x4c,0x20,0xa9,0x73,0x0a,0x3c,0x70,
+  0x4a,0x5d,0x6a,0xd0,0x11,0xa1,0x80,0xdf,0x37,0xf1,0x46,0xc8,0x25,0x50,0x97,0xbe,
+  0xca,0x8b,0x85,0x2e,0x42,0x41,0x2f,0x2f,0xe9,0x05,0xcb,0xc2,0x8c,0xc1,0xbf,0x45,
+  0x42,0x4b,0x89,0x75,0x50,0xc2,0x2b,0x93,0x20,0x76,0xf2,0x85,0x7a,0x51,0x14,0xf1,
+  0x7d,0x90,0x94,0xf4,0xbb,0xdd,0xf6,0x68,0x1b,0xd4,0xfd,0x65,0x15,0x67,0x73,0x54,
+  0xd7,0x94,0x6d,0x67,0xa5,0xde,0x05,0xa8,0x2b,0x90,0x25,0xba,0x6c,0x21,0x2b,0x89,
+  0x8f,0x64,0xe9,0x0d,0x41,0x62,0x0e,0x41,0x78,0x9d,0x0e,0x5d,0x65,0xe5,0x73,0xc1,
+  0xe1,0xe9,0x84,0x05,0x0b,0x40,0x4b,0x7d,0xf5,0x39,0xa9,0xde,0x70,0x35,0xe7,0x3a,
+  0x05,0x1c,0x97,0x17,0xdb,0x6d,0x15,0xac,0xf3,0x2f,0x3d,0xa9,0x79,0x5f,0xce,0x6e,
+  0xd2,0x04,0x5a,0xcf,0x7c,0x2b,0x97,0xad,0xaa,0xd0,0x3e,0x35,0x09,0x4a,0x11,0x1a,
+  0x6d,0x55,0x3b,0x08,0xa4,0x61,0x61,0x87,0x93,0x83,0xe6,0x2a,0xd4,0x3b,0xbf,0x03,
+  0x20,0x00,0x56,0x24,0xea,0xff,0x5e,0x04,0x7f,0x97,0xb1,0x57,0x40,0x35,0x01,0xd1,
+  0x0d,0x01,0x4f,0x09,0x05,0xde,0x75,0xc0,0x01,0x66,0xde,0xc9,0x33,0xd5,0x37,0x8d,
+  0x2d,0xf2,0x3a,0x1a,0x7b,0x81,0x1f,0x01,0x73,0x77,0x67,0xcd,0x64,0xd4,0xa0,0xdf,
+  0xaa,0xfc,0x37,0xe8,0x82,0x81,0x64,0xa1,0x10,0xa0,0xdb,0xe5,0xdb,0xbe,0x5a,0x0f,
+  0x51,0x2a,0xa9,0xaf,0xa6,0x4d,0xdb,0x59,0x0d,0x28,0x39,0xc3,0x5a,0x2e,0x02,0xa0,
+  0x91,0x6b,0xe4,0x06,0xe5,0x14,0x21,0xac,0x80,0xf3,0x53,0xca,0x5a,0x2e,0xed,0x7c,
+  0xac,0x58,0x8d,0x68,0xd4,0xfa,0xa5,0xca,0xbc,0x7d,0x76,0x62,0x00,0x18,0x3c,0x39,
+  0xf5,0x7d,0x5f,0x96,0x08,0xca,0xec,0x18,0xa1,0x80,0x56,0xcd,0x9b,0xb7,0x91,0xe2,
+  0xd9,0x93,0xd3,0xe7,0xcf,0x8e,0x9f,0x3c,0x7d,0x2e,0x7c,0x9c,0x50,0x86,0x09,0x89,
+  0x4a,0xdb,0x26,0xda,0xda,0x64,0x82,0x88,0xe5,0x0a,0x2a,0x4c,0x14,0x08,0x09,0x1f,
+  0x34,0xc1,0xd5,0x34,0x99,0xc9,0x25,0x0c,0x27,0xd3,0xc5,0xcf,0x17,0x6f,0x5e,0x2b,
+  0x21,0xc6,0xa8,0x43,0xb2,0x40,0xc7,0xa0,0xcc,0x0c,0x94,0x5a,0x3a,0x5a,0xc8,0x97,
+  0xae,0x19,0xd5,0x5d,0xa5,0x55,0x52,0xfa,0x3b,0xe8,0xc7,0x1b,0xaf,0xc0,0xb1,0xd5,
+  0x30,0x36,0xc8,0x6f,0xea,0x2a,0xf6,0x96,0xe5,0xda,0x59,0xf1,0xe7,0x47,0xa7,0x11,
+  0xc2,0x3b,0x84,0x11,0x75,0x10,0x03,0x86,0xa0,0x3c,0x58,0x57,0x89,0x73,0xfb,0x41,
+  0xf5,0x2e,0x69,0x85,0x6a,0x1c,0x81,0x7f,0xf0,0xf1,0x23,0x19,0x29,0x1f,0x3f,0x2a,
+  0xb4,0x0c,0x24,0x42,0x11,0xa6,0x5a,0xc5,0x08,0xa3,0xc2,0x5a,0x92,0xf2,0x83,0xfa,
+  0x16,0x23,0x42,0x5b,0x94,0x35,0x4b,0xba,0x0b,0xc9,0xcb,0x48,0x4c,0x30,0xb4,0xec,
+  0x86,0x99,0x3d,0x1f,0x93,0x44,0x49,0xf2,0xb1,0xb5,0x81,0xb4,0x0f,0xa9,0xb8,0x54,
+  0x90,0xbe,0xf6,0x00,0xda,0x3e,0x83,0x6f,0x7a,0x7a,0x32,0x1b,0x8d,0x9a,0xa5,0xf1,
+  0x0b,0xd5,0x52,0x0d,0xb4,0xd1,0x2c,0x14,0xb4,0x26,0x01,0xc7,0x00,0x0a,0x99,0x68,
+  0x00,0x28,0xc8,0xf6,0x09,0xb2,0x7b,0xc3,0x7c,0x5e,0x82,0xb0,0x2e,0x43,0xd0,0x3c,
+  0xc1,0x4a,0x90,0x87,0x62,0x9c,0x2f,0x9b,0xfd,0x03,0x55,0x6f,0x73,0xc7,0x68,0x9d,
+  0xc4,0x8b,0x7b,0xcc,0x0e,0x1f,0x69,0x22,0x9c,0x0c,0x1a,0x13,0x5f,0x70,0x87,0x3e,
+  0x63,0x1e,0xac,0x65,0x00,0x69,0x3f,0x72,0x1a,0xe2,0x50,0xa7,0x3b,0xf8,0xe5,0xb1,
+  0x31,0xd8,0xe1,0xfe,0x7f,0x18,0xca,0xce,0x99,0x63,0x94,0x0f,0x3b,0xb0,0x37,0x7a,
+  0x89,0x80,0x17,0x8b,0xe9,0x05,0x69,0xed,0x0e,0x64,0xf1,0xa2,0xb3,0xce,0xc6,0xd2,
+  0x51,0x86,0x9a,0xe3,0xe2,0x9a,0xd0,0x50,0x29,0x4f,0x7d,0xc3,0x92,0xe2,0x2a,0xcf,
+  0x53,0x1d,0x67,0x8e,0x11,0x4b,0xac,0x56,0xc9,0x0a,0x08,0xaa,0x5c,0x25,0xcb,0xca,
+  0xf3,0x91,0x92,0x41,0x6d,0xbd,0x42,0x62,0x6e,0xaa,0x07,0xa1,0xf0,0x92,0x10,0x33,
+  0x52,0x2b,0x93,0x19,0x0c,0x61,0xaf,0xa7,0x24,0x94,0x81,0x3b,0xc5,0x7f,0x19,0x2a,
+  0x00,0x69,0x39,0x04,0xc8,0x2b,0x02,0xfb,0x5e,0xaa,0x64,0xbb,0x2d,0x40,0x42,0x11,
+  0x88,0xf3,0x4e,0x01,0x7e,0x03,0x7c,0x7b,0xc5,0xd3,0x5c,0xda,0x6e,0x92,0x83,0x60,
+  0x34,0x8a,0x01,0x2c,0x47,0x1e,0x4a,0x79,0xb0,0xb4,0x8c,0xd0,0x78,0x79,0xff,0xcb,
+  0x02,0x32,0xfa,0x11,0xa0,0xc4,0x70,0x3a,0x0b,0xbb,0xfa,0x61,0x34,0xfa,0x9f,0xce,
+  0x7b,0x04,0x39,0xec,0x6c,0x80,0x11,0x92,0x00,0xc2,0x76,0x2b,0x2b,0x5f,0xde,0x9f,
+  0x59,0x3d,0x0c,0x95,0x86,0x7b,0xdf,0x2e,0xe2,0x6b,0xfa,0x42,0x98,0xff,0xef,0x5a,
+  0x17,0xf7,0x56,0x47,0xbc,0x80,0x0a,0x81,0x28,0x70,0x1d,0x50,0x29,0xc6,0xc0,0x58,
+  0x00,0x16,0x2c,0xfc,0x34,0x35,0x34,0x9f,0xa2,0x7e,0xa6,0x86,0x9e,0x6a,0x74,0x7b,
+  0xd8,0x6c,0x68,0xba,0x84,0xdd,0xac,0x08,0xa1,0x27,0x56,0x1a,0xb6,0x5a,0xc7,0x9f,
+  0x30,0xdb,0xb5,0x04,0x36,0x3c,0x99,0x58,0xd5,0x88,0x9d,0xc2,0xc5,0x55,0xaf,0xe1,
+  0x21,0x29,0x7f,0x32,0x15,0xaa,0x0f,0xf4,0xfa,0x3b,0x21,0x65,0xf5,0x91,0x5e,0x48,
+  0x1b,0xab,0x17,0xf4,0xfc,0x3e,0x85,0x3e,0xb0,0x23,0x44,0xbd,0xa1,0x94,0x57,0xeb,
+  0x4d,0x75,0x6f,0x52,0x0e,0xc8,0x6c,0xd2,0x58,0x86,0x55,0xab,0x94,0x6d,0x5f,0xb0,
+  0x0b,0x49,0xc6,0xb5,0xbb,0x03,0x72,0x54,0x4b,0x61,0xa5,0x22,0xaf,0x8e,0x96,0x15,
+  0x9a,0x51,0x38,0x9f,0x30,0xe3,0x29,0x2a,0x2e,0x75,0x86,0x03,0x01,0x3e,0x53,0x8f,
+  0x78,0x50,0xd0,0x68,0x11,0x22,0x64,0xc8,0xd6,0x3a,0x6f,0xa8,0x8c,0xf5,0x66,0x61,
+  0x8d,0x75,0x9d,0x2c,0xc0,0x04,0x01,0xfa,0xae,0x37,0x9b,0xbc,0xa8,0x10,0xdb,0x21,
+  0xff,0x6c,0x0a,0x7e,0x02,0x38,0xd4,0x4b,0xc7,0x85,0xcc,0x81,0x96,0xa7,0x33,0x14,
+  0x1b,0xe8,0x07,0xf2,0x71,0xc8,0x85,0x82,0x99,0x7e,0x66,0x3d,0x34,0x93,0x02,0xac,
+  0x97,0x4c,0x81,0xb9,0x33,0x2d,0xd0,0x88,0x95,0xec,0xd9,0xc9,0xd0,0xca,0xdb,0xd4,
+  0xe5,0x0a,0xd8,0x86,0x65,0x09,0x16,0xcd,0x79,0xb6,0x38,0x7b,0x0e,0xb6,0x4c,0x6f,
+  0x76,0x33,0xc0,0x2f,0x20,0x30,0x76,0x46,0xa5,0xf4,0x73,0x59,0xd3,0x2d,0xa2,0x12,
+  0x30,0xb2,0x26,0x59,0xdb,0x2f,0xb4,0xaa,0x90,0x44,0xcc,0x3c,0xa0,0x49,0x05,0xda,
+  0x02,0x7e,0x40,0x8f,0xab,0xe1,0xa9,0xdf,0x98,0x6e,0x4d,0xef,0x12,0xee,0x9d,0x5b,
+  0x08,0x54,0x66,0x22,0xf1,0x67,0xaf,0xd0,0xa4,0x29,0x0d,0x1d,0xbc,0x06,0x25,0xdd,
+  0x2f,0xb0,0xca,0x16,0x3b,0x01,0x20,0x67,0x0b,0x0d,0x0d,0x49,0xb4,0xef,0x5b,0xb3,
+  0x52,0xe1,0x1f,0x7e,0x6d,0x54,0xa8,0x78,0xc9,0x62,0x6a,0xf0,0x96,0xbc,0x3d,0x03,
+  0x5e,0xe2,0x81,0x25,0x65,0x46,0x91,0x83,0x1f,0x01,0x4a,0x18,0x27,0xd2,0x80,0xc9,
+  0x74,0xf0,0xaa,0x28,0x00,0x65,0x07,0xe5,0x26,0x05,0x49,0x29,0x06,0xc2,0xdf,0xd3,
+  0xc5,0x9f,0xa6,0x62,0xca,0x6e,0xc3,0x01,0xe8,0xff,0xb1,0x98,0x89,0x19,0xea,0xae,
+  0x8e,0x03,0x8b,0xc4,0x5f,0xa6,0x1e,0x8c,0x08,0x0c,0x0b,0x2b,0x0c,0x01,0xe0,0x2f,
+  0xea,0xb9,0x86,0x04,0x7e,0x90,0xb8,0x64,0xf0,0x86,0x3f,0xb2,0x04,0xc2,0x82,0x67,
+  0xfc,0x91,0x86,0xb2,0xc3,0x86,0xc6,0x25,0x7b,0xf0,0x20,0x81,0x1f,0x24,0x22,0xf0,
+  0x3e,0xaa,0xf6,0x8c,0x03,0x07,0x00,0xc6,0x63,0x88,0xcc,0xb0,0x0b,0x0b,0x62,0x98,
+  0x58,0x12,0xa4,0xa1,0x83,0x55,0x9a,0xba,0x72,0xe3,0x31,0xa4,0xda,0x1a,0x65,0x80,
+  0x65,0x48,0x4b,0xf6,0x75,0xe0,0x96,0x05,0x71,0xcc,0x7a,0xf4,0xbc,0x82,0x19,0x46,
+  0x39,0x4c,0x6e,0xb1,0xa8,0x02,0xf2,0x04,0x83,0x0b,0x8c,0x8d,0x57,0x37,0x50,0xd3,
+  0xeb,0xa4,0x04,0x0d,0xa4,0x0b,0x4f,0xfc,0xf8,0xee,0xcd,0x19,0x9b,0x06,0xaf,0xc9,
+  0xd4,0x12,0x2e,0x74,0xc2,0x52,0x3b,0x09,0xd4,0x23,0xb1,0x1f,0x3b,0x09,0x12,0xb6,
+  0x6d,0xd9,0x41,0xad,0xe4,0x00,0xb1,0x2e,0x2d,0x04,0x58,0x21,0xfe,0x9d,0xea,0xe7,
+  0xea,0x84,0x3c,0x7b,0xf8,0x66,0xa8,0x7b,0xb6,0x93,0x55,0x4e,0x34,0xd0,0x33,0x6e,
+  0xca,0x07,0x8d,0x78,0x38,0x37,0xc9,0x17,0xfd,0x58,0x16,0xe3,0xbb,0x95,0x0c,0xec,
+  0x1e,0xcb,0xa5,0x3b,0x4a,0x90,0x1d,0x43,0x43,0x45,0x9f,0x5a,0x71,0x0c,0x42,0xbc,
+  0x9b,0xd0,0x87,0x16,0x77,0x12,0xeb,0xea,0x9b,0xf4,0x22,0xd0,0x37,0xa0,0x5b,0xda,
+  0xa1,0x7f,0xc7,0xd2,0x0f,0x91,0x21,0x77,0x76,0x4e,0xd9,0x0f,0xd2,0x57,0x37,0x3a,
+  0xee,0x23,0xea,0x5d,0x96,0x57,0x5e,0xfb,0xe0,0xa3,0xd3,0xac,0xec,0x6d,0xd2,0x01,
+  0x1c,0xc6,0x32,0x42,0xe9,0xcc,0xc4,0x06,0x6b,0x1f,0xf6,0xf2,0x7a,0xe6,0xbd,0xe5,
+  0xda,0x99,0xc0,0x3d,0xfe,0xea,0x63,0x99,0xa4,0xec,0xeb,0x98,0xb3,0x06,0xcf,0x4f,
+  0x46,0xa3,0xb6,0x2d,0x5a,0xf5,0x13,0x74,0x72,0x83,0x74,0xc9,0xbb,0xb4,0xc2,0x5e,
+  0x35,0x96,0xc8,0x1f,0x08,0xf4,0xb3,0xac,0x22,0xa4,0xd5,0xb3,0x5e,0xd0,0x9c,0x76,
+  0xc6,0x58,0xf9,0xdb,0xad,0x11,0xb4,0x66,0x51,0x18,0xac,0x11,0xe2,0x55,0x87,0xd8,
+  0x96,0x27,0xae,0xf1,0x2b,0x86,0xbf,0x52,0x93,0xd0,0x70,0x90,0x54,0x7a,0xed,0x5b,
+  0x6a,0xd5,0x38,0x97,0xa0,0x93,0x39,0xf7,0x3e,0x70,0xc2,0x21,0x3b,0x16,0xc0,0xb3,
+  0x93,0x46,0xd8,0xe3,0x9c,0xee,0x1c,0x7c,0xb8,0x93,0xab,0xf8,0xf1,0xb9,0x32,0xdd,
+  0x38,0xa4,0xd3,0x1f,0xd9,0x4f,0xd7,0xa0,0x08,0x33,0x54,0x74,0x8a,0xe2,0x20,0x19,
+  0x75,0x56,0x7e,0x80,0xcc,0xe0,0x31,0x21,0xfe,0xdd,0xd3,0xca,0xd1,0x29,0x71,0x20,
+  0xb5,0xc5,0xe0,0xac,0x62,0x16,0xb4,0x6f,0x72,0x5c,0x8d,0x4f,0x7d,0x24,0xb6,0xa2,
+  0xac,0x5c,0x7e,0x21,0x47,0x9d,0x32,0xeb,0xd6,0xe8,0x06,0x80,0x5b,0xd4,0xb3,0x8a,
+  0xbc,0xb3,0x3b,0x09,0x38,0xeb,0xb1,0x52,0x0e,0x2d,0x1c,0x9d,0x3e,0x5e,0x03,0x0e,
+  0x24,0x3c,0xc4,0xbb,0x09,0x55,0x32,0x69,0xe4,0x08,0x80,0x82,0x66,0x67,0xc8,0x82,
+  0xdc,0xc8,0xf5,0x10,0xf7,0x76,0x62,0xd2,0x30,0x63,0x99,0xaf,0x0d,0xd1,0x24,0x7d,
+  0x5c,0xe1,0xcc,0x34,0xb3,0xc5,0xce,0x0f,0xd1,0xa1,0xde,0x8e,0x01,0x1a,0x63,0x7c,
+  0xdf,0x92,0xb2,0x99,0x49,0x94,0xed,0x87,0x0b,0xd8,0x66,0xa6,0xfa,0x60,0xb4,0x30,
+  0xd8,0x79,0x9a,0x97,0xda,0x9d,0xb1,0x46,0xf5,0x27,0x76,0xaa,0x11,0x5c,0x9f,0x12,
+  0x0e,0x3b,0x1c,0x30,0x79,0x22,0x70,0xd0,0x60,0x09,0xc1,0x3c,0x7a,0x45,0xd4,0x12,
+  0x61,0xe2,0x83,0x4c,0x0d,0x5b,0x8e,0x4b,0xb0,0x83,0x80,0x28,0x55,0xc2,0x88,0x74,
+  0xf8,0x04,0xb2,0x10,0x95,0x36,0x02,0x6d,0xd2,0x21,0x53,0x4e,0xef,0x92,0xaa,0x75,
+  0xf6,0x6a,0xf4,0xd2,0x9a,0x25,0x49,0x1a,0x06,0xc7,0xda,0x59,0xb5,0x25,0x3d,0x1b,
+  0x12,0x5e,0xd5,0xf1,0xa9,0xf8,0xd4,0x85,0x8a,0xb8,0xdb,0x65,0x9c,0x08,0x18,0xcf,
+  0x30,0x0e,0xd2,0xb7,0xdd,0xb5,0xb0,0x7d,0xfb,0x8d,0xd7,0xc3,0xf4,0xae,0x8f,0x8f,
+  0x7e,0xb3,0x42,0x6a,0x93,0xd6,0xf3,0xcf,0x9e,0x68,0x9b,0x44,0xa7,0x02,0x96,0xb5,
+  0x3b,0x29,0xfd,0xa5,0xbf,0xb2,0x86,0xff,0xb6,0x12,0x85,0xab,0x61,0x6d,0x58,0x3e,
+  0xa6,0x55,0xfa,0xeb,0x70,0x94,0x9f,0xeb,0x87,0xd8,0x91,0x22,0xbb,0x4a,0x41,0x36,
+  0x95,0xdf,0xdb,0xaf,0x1e,0x18,0xf6,0x6f,0xaf,0x63,0x41,0xf4,0xed,0x0b,0x91,0x45,
+  0xb2,0xb3,0x83,0xd0,0x08,0xff,0xbf,0x57,0x2f,0x52,0xa2,0xeb,0x5d,0xc1,0x5e,0xd3,
+  0x34,0xf7,0xe2,0x9c,0x3e,0x94,0xd3,0x42,0x01,0xdc,0xff,0xc2,0x41,0xaf,0xf2,0xdb,
+  0xef,0x6d,0xdf,0x6e,0xa9,0xb1,0xc0,0xc2,0x3d,0xba,0xc0,0xec,0xc5,0x01,0x27,0x1c,
+  0x26,0x42,0x07,0xdb,0x6d,0xb8,0x83,0xdd,0x3d,0xea,0xd8,0x37,0x36,0xf8,0xfa,0xab,
+  0xfd,0xc5,0xaa,0xd8,0x85,0x46,0xcb,0xd1,0xa7,0xc5,0x33,0x5e,0xac,0xdf,0x93,0x6a,
+  0xf5,0xa8,0x74,0x67,0x8f,0x3a,0x0a,0x29,0x86,0x0e,0x28,0x02,0x6e,0x8b,0x3d,0x94,
+  0xc8,0xfc,0x85,0x2a,0x1d,0x15,0xa0,0x91,0x02,0xc0,0x2c,0xda,0x67,0xb9,0x40,0x42,
+  0x0e,0xa1,0xcf,0x89,0x8f,0x5b,0x4d,0xce,0x72,0x6f,0xb7,0xae,0xbe,0x3d,0x9d,0x3c,
+  0x3e,0x95,0x39,0x60,0x1c,0xa3,0x38,0xb0,0x7d,0x32,0x74,0xa3,0xca,0x51,0xa2,0xb9,
+  0x1f,0xe2,0x9e,0x14,0xc8,0xa7,0x4c,0x63,0xd5,0xde,0xf0,0xc4,0x0f,0x13,0x1a,0xa8,
+  0x29,0xd0,0xe9,0x73,0xdb,0x51,0x5b,0x31,0x3e,0x36,0xe3,0x35,0x32,0xaa,0x91,0x1e,
+  0x13,0x74,0x46,0x34,0x1b,0x9a,0x9e,0xef,0x5b,0x83,0xc6,0xaf,0x00,0xa8,0x93,0xea,
+  0xf1,0xfc,0x09,0x0d,0x94,0x9d,0xac,0x86,0xef,0x9c,0x01,0x71,0x3f,0x7e,0x41,0x5a,
+  0x7c,0x6c,0xf6,0x1e,0x1f,0xbe,0xf5,0x7f,0x29,0x33,0x09,0xb4,0xe1,0x64,0xd9,0xd9,
+  0xf3,0x65,0xa9,0xba,0xb3,0x91,0x80,0x64,0x9f,0xe4,0x56,0xf0,0xe7,0xcd,0x9c,0x01,
+  0x7c,0x2d,0x6c,0x0f,0x99,0x85,0xeb,0xac,0xbb,0x9e,0xdd,0xf5,0xe7,0xa5,0xf2,0xfc,
+  0x43,0xc0,0x69,0x16,0xc3,0x21,0x22,0xcf,0xa6,0x39,0xd3,0xd4,0x40,0x41,0x5a,0x97,
+  0xff,0x4c,0xee,0xb0,0xc0,0x71,0xd7,0x13,0xfb,0xbb,0x4a,0x16,0x8f,0xd6,0x33,0x2f,
+  0xcb,0x96,0x15,0x0c,0x1f,0xf9,0x08,0xca,0xaf,0xaf,0x53,0xdd,0x87,0xee,0x7b,0x79,
+  0xb6,0x21,0x5a,0x1c,0xcc,0x84,0xdd,0x19,0x91,0x65,0xca,0xa4,0xdb,0x88,0x1f,0x6a,
+  0x1f,0xa8,0x0e,0x45,0x82,0x07,0xe4,0x16,0x60,0xef,0x18,0xcc,0x6c,0x0a,0x7d,0xd3,
+  0x6f,0x4b,0x75,0x44,0x3d,0xe4,0x4a,0xf2,0xba,0x34,0xae,0x99,0x73,0x96,0xa7,0x20,
+  0xf6,0x2d,0x28,0xa8,0xb6,0x5b,0x74,0x15,0x03,0xe6,0xd4,0x77,0xd5,0xb7,0xeb,0xc3,
+  0x5c,0xdf,0xae,0x0b,0xb7,0x7d,0xfa,0xea,0x3a,0x41,0x5b,0xbb,0xb1,0xc8,0xa2,0x9e,
+  0xd9,0xe9,0xe8,0xfa,0x56,0xb0,0x4e,0xec,0xd2,0x93,0x70,0xf6,0x1a,0x26,0xf8,0x97,
+  0x81,0x0f,0x12,0x3d,0xb8,0x88,0x21,0xa8,0x05,0x4c,0x8b,0x0c,0xcb,0xb5,0x75,0x84,
+  0x68,0xc3,0xc0,0x62,0x3d,0x32,0xce,0xef,0xee,0x5b,0xa6,0x9c,0x56,0x29,0x1b,0x56,
+  0x69,0x0c,0x41,0x83,0x86,0x9d,0x14,0x65,0xf7,0xd4,0x85,0x08,0x85,0x18,0x67,0xbd,
+  0x9d,0x74,0xf2,0x9b,0x6e,0xa2,0x8f,0xbc,0xed,0x66,0xd6,0x3a,0xa8,0x8d,0x43,0xd3,
+  0x80,0xf6,0x26,0x1e,0x24,0xdb,0x6e,0x4f,0xbf,0x39,0x02,0x96,0x4b,0x04,0x78,0xad,
+  0xb8,0xa6,0xdd,0x25,0xf2,0x05,0x67,0xec,0xe8,0x21,0xdf,0x56,0xe6,0xff,0xc1,0x63,
+  0x04,0xab,0x0b,0xa3,0x11,0xd8,0x99,0x63,0xd2,0x32,0x69,0x26,0x00,0x00,0x94,0xb4,
+  0x66,0x67,0x1b,0x17,0x90,0xf9,0xb4,0x12,0x8e,0xe0,0x1d,0x8d,0x6c,0x93,0x38,0xd6,
+  0xc6,0x47,0x09,0xe8,0xac,0x49,0xdc,0xaf,0x61,0x34,0xca,0xec,0x24,0xc1,0x67,0x3b,
+  0x4f,0xe8,0xfb,0x2c,0xc2,0xca,0x1a,0xaf,0x2f,0x3a,0x73,0x54,0x7d,0x9d,0xeb,0x0e,
+  0x46,0x8d,0x2e,0xc8,0xd6,0x61,0xd2,0x6b,0xc0,0xfc,0xd1,0xa0,0x53,0xd9,0x58,0xb3,
+  0x1b,0x50,0x8c,0xe1,0x23,0xbb,0x15,0xef,0x29,0xc6,0xa6,0x92,0xdf,0x5e,0x89,0x8c,
+  0xa1,0x03,0x46,0xbe,0xfc,0xab,0x99,0x69,0x69,0x92,0xec,0xf4,0x91,0x96,0xb3,0x43,
+  0x07,0x6c,0x20,0x71,0xdb,0x3a,0xec,0x1a,0xc9,0xcc,0x2d,0xb4,0xa1,0x7d,0x24,0xc6,
+  0xed,0xd6,0xd1,0x5a,0x8a,0xa3,0x27,0xa7,0xfb,0x51,0x4a,0xa0,0x1e,0xfb,0xfa,0x46,
+  0x1b,0x32,0x09,0x54,0x17,0x3a,0xaf,0x8d,0xba,0x60,0xdb,0x5f,0x15,0xd1,0x9f,0x5e,
+  0x81,0x71,0x10,0xf2,0x26,0xfe,0x7f,0xe7,0x6e,0x4a,0xbd,0x41,0x50,0x71,0xc0,0x46,
+  0x94,0xda,0x19,0xbb,0xd5,0x9b,0xc1,0xba,0x4e,0xab,0x64,0x93,0x52,0xd8,0x8b,0x55,
+  0xa5,0x64,0xdf,0x89,0x7c,0x43,0x31,0x79,0xfe,0xe3,0x76,0x22,0xc3,0x15,0x72,0x60,
+  0xeb,0xc5,0xce,0xb7,0x92,0x8c,0x5a,0x13,0x4d,0x63,0xb6,0x75,0xc9,0x21,0x00,0x07,
+  0xba,0xdc,0x7f,0x9c,0xb6,0xf4,0x9e,0x48,0x87,0x49,0x76,0xe5,0x52,0xc0,0x35,0xe2,
+  0xfe,0x42,0xae,0xec,0xdb,0x7b,0xab,0xf7,0xec,0x47,0xd0,0xb0,0x0f,0x15,0x50,0x56,
+  0x01,0x0b,0xb6,0x39,0xca,0xf1,0xaf,0x4c,0xf5,0x12,0x7d,0x67,0xf8,0x73,0x94,0xd3,
+  0xcf,0x6e,0x02,0x8c,0x1f,0x57,0xc9,0xbc,0xd5,0x14,0x9b,0xbc,0x4c,0x78,0x0a,0x70,
+  0xb7,0x31,0xb0,0xaf,0x4a,0x14,0x3a,0x8d,0x71,0xd3,0x1f,0x10,0x1f,0x67,0x25,0xc3,
+  0x1f,0xf7,0xb7,0x1c,0xd6,0xf4,0x9d,0x35,0x9e,0x30,0x52,0x70,0x58,0xf2,0x65,0x5e,
+  0x67,0xb8,0xc3,0x7e,0x96,0x26,0xd0,0xdb,0x5f,0x61,0x06,0x3d,0x4b,0x15,0x0f,0xd4,
+  0x39,0x4d,0xbd,0x1a,0x1b,0x27,0xe7,0x26,0xbe,0xd6,0x7f,0xbc,0xa3,0x01,0x49,0x1c,
+  0x0b,0x7a,0x18,0x37,0xee,0xc7,0x3f,0xcd,0x47,0x8a,0xbb,0x08,0xdf,0xc4,0xd5,0x2a,
+  0x28,0xb0,0x09,0x80,0xe8,0x94,0xe4,0x4b,0x8e,0xc4,0xe8,0x7e,0xe2,0x34,0x7f,0x07,
+  0x4a,0xbe,0x74,0x2d,0x01,0x94,0x89,0x30,0x9c,0x86,0xe2,0xcc,0x90,0x9e,0x3d,0x35,
+  0xa2,0x12,0xa6,0xdb,0x1a,0xe7,0x38,0xea,0xdc,0x8c,0x15,0x5f,0x8a,0x43,0xf0,0x9b,
+  0x4b,0xc2,0xc6,0xfb,0xce,0x90,0x66,0xe1,0x73,0x86,0xbc,0xd3,0x33,0x8e,0x15,0x2d,
+  0x0e,0x41,0x32,0xc3,0xd3,0x17,0xe4,0x9a,0xa6,0x3d,0x61,0xf5,0xd0,0xec,0xf8,0x1b,
+  0x07,0x6f,0xb5,0xe7,0x97,0x2d,0x31,0xde,0xab,0xad,0x59,0x3f,0x52,0x33,0xed,0x3d,
+  0x95,0x3b,0x0a,0x0d,0x8a,0x01,0xc3,0x77,0xb7,0x24,0x31,0x0c,0xd4,0x4f,0xb6,0xdb,
+  0x13,0x90,0x70,0x49,0x14,0x2b,0x8c,0x0a,0x1c,0x83,0xb2,0x19,0xff,0x4c,0x73,0x14,
+  0x3e,0x6e,0xb8,0x30,0x88,0x67,0x61,0x6a,0x5b,0xf4,0xb0,0xb8,0x75,0x11,0x0d,0x9c,
+  0xdd,0x8e,0x0a,0xfa,0xca,0x8d,0xe0,0x53,0x14,0x8f,0xa1,0x21,0x6d,0x1b,0x02,0x16,
+  0x46,0x3d,0x31,0x16,0x13,0xf1,0x9f,0xb7,0x47,0xf6,0xc2,0xe4,0x9b,0x66,0x16,0x97,
+  0x06,0x1a,0xb8,0x00,0x6d,0x39,0x56,0xd0,0xd4,0x38,0x46,0x89,0xcc,0x01,0x29,0x7d,
+  0x7a,0x20,0x32,0x28,0x82,0x6d,0x69,0xfc,0x84,0x92,0x23,0xec,0x22,0xcf,0x16,0x4d,
+  0xb6,0x56,0xb7,0x91,0x31,0xe4,0x99,0xa2,0x9d,0xb2,0xfe,0xea,0x5d,0xa7,0x49,0xd7,
+  0xaa,0xdb,0x53,0x46,0xe4,0x5d,0xfe,0x9d,0x26,0x56,0xfe,0x4d,0x5e,0x48,0xdc,0xaf,
+  0x8a,0x17,0x8b,0xaf,0x54,0xde,0x2f,0x69,0x70,0xe5,0xdb,0x18,0x1a,0xa3,0x22,0x21,
+  0x19,0xbd,0x83,0x8c,0xe0,0x7f,0x6f,0x10,0xbc,0x23,0x85,0x0a,0x1f,0xd0,0x3a,0x6b,
+  0xbb,0xe3,0xcb,0x72,0x7c,0x7c,0xdd,0xaf,0xf0,0x2c,0xcc,0xb2,0xc3,0xf6,0x5c,0xd7,
+  0xa1,0xd5,0x82,0x32,0x69,0xf4,0x3a,0xb7,0x25,0x8b,0xb1,0x57,0x44,0xa0,0x45,0x01,
+  0xe0,0xf8,0xe3,0x24,0xf8,0x94,0x27,0x19,0x29,0x55,0xe0,0x59,0x9e,0x6d,0xab,0xb1,
+  0xf7,0x86,0xfb,0x55,0xa0,0x9c,0x3d,0x3e,0xd8,0xee,0x1e,0xe0,0xe0,0xf7,0xc6,0x72,
+  0x9d,0x24,0xcd,0xf0,0x1d,0xb5,0x9a,0xf8,0xdf,0x31,0xf4,0x04,0x04,0xaa,0x55,0x9e,
+  0xb8,0x44,0x12,0x07,0x00,0x6c,0x67,0x2a,0x4f,0xcc,0xd6,0x37,0x0e,0xc9,0x22,0xfe,
+  0xfd,0xd1,0x38,0xf1,0x96,0xba,0x6f,0xf9,0x4c,0xac,0x48,0xde,0x28,0x8a,0xb2,0x55,
+  0xfe,0x85,0x69,0x08,0x8c,0xc2,0xf2,0x5b,0xbd,0x85,0x69,0xf3,0x28,0x14,0x24,0x1a,
+  0xe6,0xed,0x52,0x69,0x34,0x47,0xc1,0x14,0xb3,0x54,0x85,0x09,0x79,0xe0,0xcc,0x3b,
+  0x89,0x91,0x66,0x41,0xca,0x79,0x91,0xa7,0xe9,0x85,0x0b,0x66,0x74,0x63,0xb6,0x5a,
+  0xed,0x60,0x00,0xaf,0x68,0x32,0x8b,0x16,0x94,0x4d,0x3a,0x3b,0x18,0x59,0x83,0x65,
+  0xdb,0x8a,0x6d,0x8a,0x23,0xfa,0x1d,0xe1,0x90,0x45,0x07,0x0c,0x6e,0x4b,0x2a,0xbd,
+  0x0b,0x1f,0xfb,0xe8,0x39,0x6f,0x7f,0xd0,0x66,0xd0,0xce,0x0e,0xe6,0x35,0xaa,0xa4,
+  0xef,0x1e,0x0d,0xe6,0xfe,0xee,0xe1,0x50,0xd5,0xee,0x78,0xfe,0xf8,0xee,0xf1,0x60,
+  0xd1,0xaf,0x0e,0xc8,0xc0,0x1f,0x7e,0xff,0x93,0x07,0x64,0xd5,0xb8,0x5b,0xaa,0x6f,
+  0x34,0x8d,0xff,0x59,0xb2,0xe2,0xde,0x83,0x17,0xc6,0x23,0xd9,0xa2,0x8c,0x42,0x2d,
+  0x4c,0x68,0x87,0x85,0xe2,0xe4,0xaf,0x89,0x08,0x7b,0x9c,0x30,0xe2,0x38,0xd9,0x81,
+  0xe6,0xb6,0x25,0xec,0xb4,0x24,0x84,0x4b,0x14,0xed,0x57,0xfe,0x94,0xe6,0xbc,0xd5,
+  0xe1,0x33,0x04,0x59,0x83,0x0a,0x4e,0xb2,0x23,0xc8,0x00,0x2c,0x0f,0x2a,0x82,0x04,
+  0x04,0x60,0x96,0xaf,0xe6,0xc6,0x1c,0x26,0x3b,0x61,0x9e,0x71,0x37,0xb7,0x26,0x8c,
+  0x47,0x05,0x38,0x48,0x0f,0xab,0x3f,0xe2,0x80,0x4d,0x5b,0x8a,0xb0,0xc7,0xb7,0x8a,
+  0x51,0x4f,0xdc,0x72,0x34,0x54,0x1e,0x4e,0xd1,0xc2,0x2c,0xd3,0x65,0xae,0x74,0xb7,
+  0xb3,0x38,0xf0,0xfd,0x9e,0x53,0xf5,0xab,0x7e,0x05,0xeb,0xcd,0xa9,0x0e,0x97,0x62,
+  0xbb,0xe5,0xcd,0xc4,0x09,0x7a,0xf7,0xcd,0x12,0x54,0xed,0xfc,0x8f,0x46,0x2d,0xae,
+  0x6b,0x67,0xaa,0x85,0x76,0xe8,0x06,0xaa,0x3a,0x15,0xb6,0x7b,0xd1,0x48,0x2e,0x74,
+  0x5c,0x62,0xa1,0x2b,0xdc,0x34,0xa7,0x67,0x66,0x7b,0x39,0xdd,0x0f,0x71,0x9d,0xf5,
+  0x4a,0x13,0x1b,0xb5,0xdd,0x44,0xda,0x05,0xc7,0xbd,0xaa,0x8c,0x4c,0x55,0x37,0xc4,
+  0x0e,0xd4,0x36,0x36,0x87,0x28,0xe6,0x40,0xca,0x81,0x74,0xdb,0x63,0xad,0x82,0x58,
+  0xeb,0x23,0x00,0xd1,0xa8,0x9c,0x0a,0x32,0xcc,0xc5,0x38,0x99,0x85,0x4f,0x28,0x65,
+  0x3f,0x8c,0x64,0x6a,0xf8,0x94,0xb2,0x78,0x79,0x97,0x90,0x61,0xc6,0x72,0x68,0x35,
+  0xec,0x37,0x72,0xcb,0x56,0xc2,0xd2,0x4c,0x6a,0xab,0x0d,0x0a,0x50,0x86,0x88,0xb9,
+  0x3c,0xb2,0x51,0x41,0x94,0xcb,0x9b,0x1e,0x65,0xd0,0xee,0x38,0xe8,0xff,0x7e,0xca,
+  0x03,0xac,0x66,0x6a,0x7f,0xfb,0x44,0xe6,0xc0,0x4d,0xec,0xd1,0x6d,0x23,0x8e,0xfa,
+  0x54,0x1b,0x00,0x34,0x3c,0xfc,0xd0,0xee,0x55,0x6c,0xb7,0x22,0xc6,0x5d,0x5c,0x7e,
+  0xb6,0x11,0xfd,0x3a,0x74,0x23,0xad,0x08,0xf1,0xa9,0x5e,0xef,0x65,0x61,0x81,0xee,
+  0x29,0x09,0xa9,0xde,0x39,0x90,0xb5,0xff,0x00,0xd6,0x46,0x54,0x87,0xb5,0x1b,0xb5,
+  0x59,0xab,0x13,0x6c,0xaa,0x0e,0xd0,0x8f,0x63,0x1c,0x38,0xb8,0x8b,0x83,0x49,0xe4,
+  0x64,0xa4,0xad,0xdb,0xf0,0x29,0xa5,0x84,0x8d,0x51,0xb0,0x54,0xce,0xee,0xcf,0x41,
+  0xbc,0x8f,0xcc,0x41,0x4a,0xf4,0xeb,0xd4,0x25,0xac,0x2c,0x52,0x6e,0xc7,0xcb,0xd6,
+  0x44,0x99,0x35,0x90,0x7c,0x90,0xb9,0x1e,0x60,0x40,0x2a,0xd0,0x0e,0x60,0xc3,0x97,
+  0xc6,0x59,0x0a,0x83,0x91,0xcb,0xd1,0xe8,0x9f,0x7b,0x87,0x8a,0x4c,0x2c,0x4c,0xc3,
+  0x45,0x30,0xad,0xe7,0x67,0xbf,0xfe,0xf2,0xfe,0x42,0x0c,0xdd,0xe4,0x2e,0xc5,0x62,
+  0xe0,0x6b,0x45,0xd6,0x3f,0xc5,0x82,0x1f,0x7f,0x8a,0x6f,0x62,0xa0,0xb3,0x64,0x53,
+  0x71,0x29,0xfc,0x86,0x79,0xca,0x62,0xbe,0xdd,0x1a,0xd3,0x45,0x83,0x6d,0xc8,0x20,
+  0x8f,0x13,0x64,0xd5,0x7a,0x95,0x48,0xa5,0xee,0x7c,0x66,0xc1,0x69,0x12,0x55,0x63,
+  0x71,0x91,0x03,0x10,0xe2,0x11,0x88,0xb1,0xa7,0x23,0xc1,0xe3,0x80,0xc4,0x17,0x14,
+  0x51,0xee,0x3b,0xb4,0xe4,0xee,0x24,0x6b,0x1f,0x23,0x24,0x99,0x6e,0x49,0x47,0x03,
+  0x09,0x5c,0x04,0x1f,0xda,0x08,0x1f,0x8e,0x7d,0xbc,0x08,0xea,0x2c,0xf9,0x5b,0xbd,
+  0x85,0x87,0x85,0x86,0x46,0x92,0x38,0x4d,0xbe,0x68,0x32,0x14,0xd4,0x9f,0xd0,0x8d,
+  0x2f,0x74,0x16,0xee,0x42,0x66,0x3b,0x98,0x4a,0x33,0x02,0x3e,0x1f,0x47,0x7f,0x25,
+  0xef,0x1f,0x01,0x2b,0x9a,0x6f,0x4f,0xc0,0x6e,0xb4,0x8f,0x9c,0xa5,0xbb,0x49,0xd2,
+  0x9c,0x71,0x48,0x3b,0x51,0xb9,0x1f,0xbf,0x24,0x8b,0xed,0xd6,0xe3,0x07,0xa5,0xc7,
+  0x63,0xe7,0x58,0xc6,0xaa,0x3d,0x7f,0x42,0x58,0x6d,0x83,0x0c,0xa0,0x83,0xac,0xf4,
+  0x19,0xa2,0xa2,0x55,0x97,0x35,0x51,0x6f,0x5e,0x39,0x35,0x07,0xf0,0xa6,0xb3,0x43,
+  0x3b,0xbe,0x69,0x73,0xe8,0x61,0x5c,0xb4,0x0e,0xc8,0x71,0xa3,0x87,0x20,0xae,0x34,
+  0xbe,0x66,0x25,0x48,0xd4,0xa2,0x91,0xa8,0x25,0xac,0x70,0x36,0x1a,0xe1,0xf1,0xa0,
+  0x65,0x86,0xe1,0x02,0x29,0x00,0x49,0xc0,0xb0,0xe4,0xed,0xd1,0xe9,0x50,0x91,0xcb,
+  0xbe,0xe9,0xe9,0xa6,0xf5,0x90,0x7b,0x42,0x8c,0x2b,0x8b,0x14,0x45,0x20,0x1a,0x4b,
+  0x57,0x87,0x14,0xc2,0x97,0x95,0x61,0x1b,0xbe,0x47,0x01,0x2f,0x60,0x31,0x34,0x50,
+  0xd7,0x39,0x0b,0xb2,0x70,0xbd,0xa7,0xee,0x79,0xaf,0x28,0xfc,0x6b,0x3b,0xc0,0xf3,
+  0x5e,0x8d,0xa0,0x85,0x92,0x80,0x33,0x83,0x1f,0x06,0x11,0x00,0x67,0xcc,0x30,0xd8,
+  0x3b,0x04,0xb6,0xee,0x7a,0x98,0x60,0xc5,0x53,0x18,0x6e,0x4d,0x53,0x40,0x67,0xcb,
+  0xb6,0xdb,0xe1,0xd0,0x39,0xc9,0x73,0xed,0xb4,0x3d,0x27,0x6f,0x14,0xe4,0x5d,0xb2,
+  0x5b,0xaa,0xcd,0x75,0xc3,0xa1,0xcb,0x20,0xc1,0x62,0x8c,0x5b,0xe6,0x19,0x58,0x29,
+  0xdc,0xd2,0x97,0x0b,0x55,0x4e,0x57,0x78,0x52,0x0c,0x7f,0xf0,0xbc,0xd2,0x24,0x69,
+  0xf1,0xe8,0x71,0x0f,0x1a,0xe5,0x45,0xa6,0xd8,0x7f,0x94,0x68,0x49,0xe3,0x29,0xf1,
+  0xac,0x9c,0xb0,0xe1,0xa9,0x05,0xc7,0x92,0x97,0x40,0x0f,0x09,0xc2,0xdc,0x65,0xa6,
+  0x0a,0x49,0xbe,0x19,0x15,0xc3,0x2f,0x0d,0x68,0x4e,0x3b,0xb8,0x87,0x3e,0x57,0x54,
+  0x4e,0x69,0x0c,0xd6,0xfa,0x05,0x08,0x5b,0x6d,0xd5,0xdf,0x30,0x83,0xd5,0x1e,0xb2,
+  0x63,0x0f,0xe6,0xa5,0xda,0x8b,0x06,0xc8,0x50,0xad,0x80,0x36,0xec,0x8d,0x07,0x6a,
+  0x36,0x52,0xa1,0x69,0x98,0x56,0x55,0x53,0xe7,0xe0,0x17,0x4c,0x70,0xe8,0x1c,0x70,
+  0xdd,0xdd,0xbd,0xda,0x77,0x03,0xa9,0x4f,0x68,0x1a,0x40,0x43,0x49,0xf9,0xcb,0x7a,
+  0xad,0x17,0x09,0x74,0x09,0x2d,0xd9,0xf8,0x3a,0xc6,0x6c,0xe7,0x80,0x27,0x36,0x7a,
+  0x01,0xea,0xe5,0x01,0xd6,0x2a,0xae,0x62,0x95,0x73,0xf8,0xbc,0x4a,0x4d,0x27,0x34,
+  0x06,0x33,0x43,0x27,0x4a,0x74,0x09,0xe3,0xb1,0x40,0xf8,0x6f,0x83,0x47,0xcc,0x17,
+  0xbf,0x05,0x5d,0x14,0x7f,0x86,0x7e,0xb0,0x00,0x1d,0xf9,0xd0,0xed,0x1f,0xf5,0x32,
+  0xae,0x53,0x44,0x72,0x40,0xce,0xd0,0x98,0xd3,0x36,0x3a,0x98,0x12,0xc4,0xc2,0x41,
+  0x02,0x20,0x8f,0x55,0x84,0x5c,0xb0,0xed,0x06,0x12,0x45,0xec,0xc7,0x2f,0x21,0xf6,
+  0xd5,0xb8,0xd7,0x7c,0x10,0xd8,0x74,0xed,0xc1,0x62,0xe0,0xb4,0xd0,0x1c,0xc8,0xb5,
+  0x07,0x7a,0xcd,0xef,0xb0,0xcd,0xbd,0x65,0x70,0xd9,0xd8,0x34,0xc8,0xc2,0x13,0x8f,
+  0xa2,0xb1,0xfd,0xaf,0x13,0x0c,0xac,0x69,0x2b,0x20,0x7a,0x3f,0xc3,0x72,0xe8,0x4a,
+  0x0f,0xca,0x69,0x3e,0x9b,0xea,0x20,0x99,0x49,0xc1,0xba,0xe1,0xa0,0xff,0x74,0x7c,
+  0xb6,0xe7,0x1b,0x0c,0x41,0x07,0x24,0x73,0xec,0x10,0xd0,0x04,0x66,0x49,0xdd,0x0c,
+  0xe2,0x93,0x6b,0xb1,0x79,0x09,0x70,0x12,0xb4,0x55,0x9a,0x19,0x7e,0xcf,0xf3,0xad,
+  0x17,0xe8,0x56,0x4b,0x28,0xa4,0x5e,0xe3,0xa4,0x93,0x9e,0x7d,0xe5,0xba,0x71,0x32,
+  0xbb,0x75,0x96,0xc0,0x52,0x4e,0xf4,0x1e,0x54,0x70,0xe0,0xe2,0x34,0x9b,0xa9,0x3b,
+  0x59,0x8c,0x46,0x85,0xa1,0x85,0xc4,0xa1,0xc6,0x9d,0xd4,0xf8,0xfd,0x0a,0xc8,0xd1,
+  0x4b,0x80,0x1e,0xbb,0x9d,0x18,0x22,0xb5,0x1c,0x26,0xe3,0x89,0x1b,0xac,0x9e,0x84,
+  0x3f,0xce,0x47,0x12,0xa1,0x11,0xdb,0x24,0x11,0xf9,0x00,0xb4,0x25,0x87,0x92,0x4b,
+  0x3f,0x18,0xe5,0x70,0x90,0x48,0xa8,0xca,0xeb,0x9b,0x03,0x75,0x07,0xb4,0xe5,0x48,
+  0x99,0x73,0x37,0x0a,0xe5,0x21,0x2f,0x12,0x00,0xf4,0x71,0x4a,0x2b,0x10,0x56,0x3b,
+  0x37,0x44,0xf6,0xd6,0x06,0x92,0x83,0xfc,0x41,0x94,0x08,0xe3,0xc0,0xb9,0xc4,0x47,
+  0x72,0x18,0x59,0x4a,0xff,0x44,0xd1,0x18,0x3b,0x0e,0xf1,0xd4,0xea,0x14,0xea,0xe5,
+  0x13,0x36,0x6d,0x78,0x2b,0x1f,0x7f,0xc3,0x63,0x28,0x6d,0x70,0xaf,0xcc,0x7b,0x82,
+  0x64,0x0f,0x7d,0x78,0x3b,0xf4,0xae,0xee,0x64,0x8c,0x7f,0x6a,0x25,0xf2,0x6c,0x09,
+  0x92,0xa9,0x4c,0xe8,0x3c,0xa9,0x51,0xe9,0x4b,0x0c,0x7c,0x84,0xc4,0x50,0xd8,0x6f,
+  0xf2,0x2a,0xad,0x0b,0xf3,0x9a,0xd7,0x95,0xa0,0x33,0x75,0xeb,0xbc,0x2e,0x35,0xce,
+  0x09,0x7c,0xa1,0x67,0xa0,0xbc,0x42,0x48,0x7a,0x4c,0x75,0x7c,0xa3,0x6d,0x32,0x16,
+  0x98,0xc4,0x00,0x7c,0x92,0xf9,0x67,0x15,0x07,0x94,0x08,0xed,0x64,0xf6,0xb9,0xde,
+  0xd8,0x27,0x24,0x5e,0x25,0xde,0xe0,0x23,0xcd,0x60,0x29,0x90,0xcc,0xf0,0x49,0x3d,
+  0x60,0xdc,0xd9,0x8d,0x0d,0xd5,0xbb,0xdf,0xc9,0x6a,0x5f,0x2c,0x35,0x7b,0x00,0xa5,
+  0x7a,0xda,0x71,0xbf,0xe3,0x0a,0xef,0x45,0xc3,0x3f,0x25,0xff,0x24,0x46,0x74,0x71,
+  0x91,0xb8,0x87,0x4e,0xb5,0x21,0xcd,0x4c,0x96,0x51,0x13,0xd4,0xb6,0x5f,0x93,0xef,
+  0x87,0x0e,0xe1,0xda,0x25,0x8c,0x19,0x09,0x90,0x12,0x89,0x77,0xd0,0x52,0x8e,0x1b,
+  0x39,0x36,0x18,0x23,0x02,0x99,0x52,0x67,0x1c,0x69,0xaf,0xf9,0xa4,0xa3,0x1d,0x8d,
+  0x6d,0x12,0xe0,0x9c,0xc4,0xba,0x4d,0xb2,0xcd,0x36,0xa9,0x56,0x45,0x7e,0x4b,0x9a,
+  0x14,0xb7,0x6d,0x28,0xd4,0xd5,0x13,0xfa,0x6e,0x43,0x0e,0xfd,0x41,0x73,0x2c,0x1f,
+  0xdd,0x32,0x28,0xec,0xf1,0x80,0xda,0x63,0xd1,0xd7,0x6c,0x43,0xd8,0x54,0x53,0xa0,
+  0xce,0x0e,0x8a,0xec,0x15,0x58,0x2e,0x4d,0x34,0x2f,0xe5,0x07,0x28,0xbb,0x57,0xbf,
+  0xe3,0xf8,0xe9,0xb4,0x00,0xf2,0xf1,0x14,0x26,0x08,0x27,0xfb,0xee,0x70,0xb2,0x31,
+  0x5e,0xfc,0xaa,0x27,0xf9,0x94,0x8e,0xf1,0xfd,0xc5,0x67,0x19,0xb7,0x0e,0x3b,0x3f,
+  0xd9,0xa6,0xf1,0xbd,0x2e,0xa6,0x7f,0xfc,0x39,0x7b,0xe2,0xe3,0x59,0xbe,0x87,0xae,
+  0x56,0x00,0xd4,0x79,0xc0,0xba,0x42,0xa2,0x9a,0xe8,0xd3,0x55,0x98,0xfb,0x2b,0x3a,
+  0x8c,0x0b,0xee,0xe5,0xef,0xc9,0xb6,0x9b,0x54,0x6c,0x7c,0xa6,0x1a,0x3e,0xe8,0x6f,
+  0xcd,0xbc,0x0d,0x78,0x37,0x33,0xff,0x7d,0xc5,0x60,0xfe,0x3b,0xe5,0xd2,0xe4,0x46,
+  0xab,0xfe,0x60,0xd1,0x06,0x74,0x90,0xb9,0xed,0x37,0xfd,0xf2,0x9c,0x6d,0xa0,0xbc,
+  0xa0,0x36,0x4c,0xe4,0x00,0x77,0x3f,0xf9,0xde,0x0a,0xdb,0x3e,0x7f,0xa3,0xca,0x3c,
+  0x73,0x6b,0x2c,0x5d,0xa8,0x35,0x97,0xa9,0x5c,0x75,0xc3,0xf7,0x00,0xbd,0xe4,0x78,
+  0x46,0xdb,0x33,0x2a,0x46,0xef,0xed,0x14,0xac,0x98,0xa8,0xb0,0x1a,0xf8,0x84,0xd6,
+  0xe1,0xca,0x07,0xab,0xd8,0x43,0xbc,0x5b,0x78,0x35,0xfc,0xad,0x49,0xda,0x83,0x74,
+  0xad,0x01,0x4d,0xc5,0xaa,0xc4,0x53,0x5e,0xa0,0x4c,0x0a,0x2f,0x86,0x8f,0x31,0x47,
+  0xb2,0xd3,0xa1,0x2d,0xfc,0x8a,0xc7,0xed,0x2d,0xb8,0xa8,0xd5,0x15,0xd4,0xb6,0xef,
+  0x7d,0xa5,0x53,0xf0,0xf0,0x75,0xde,0x77,0x0c,0x01,0xb0,0x9c,0x64,0x5b,0x09,0x6d,
+  0xb3,0xba,0x1f,0x60,0x21,0xb2,0x82,0x0a,0xd2,0x43,0x34,0x87,0x3b,0x33,0x78,0x98,
+  0x88,0xa0,0x9c,0x1f,0x98,0x98,0x3f,0x80,0x19,0x85,0x8d,0xe3,0x71,0x8e,0x16,0xe6,
+  0xb4,0xf7,0x48,0xc7,0x61,0xf8,0xec,0x8f,0x77,0x8e,0x22,0xe6,0x61,0x5e,0x17,0x68,
+  0xd7,0x32,0x1e,0x0c,0x73,0x89,0x44,0xf1,0x53,0x52,0x80,0x56,0x2c,0x50,0x89,0x82,
+  0xf9,0x56,0xfb,0xa6,0x63,0xb9,0x04,0x51,0xf2,0x98,0x34,0x93,0x78,0x0c,0xcf,0x41,
+  0x83,0x37,0x78,0x1c,0x09,0xd6,0x0a,0x20,0xa9,0x4c,0xb7,0xdb,0x39,0x47,0x00,0xf3,
+  0x92,0x2e,0x97,0xdd,0xd3,0x7f,0xa5,0x95,0xa4,0xff,0xd1,0x5a,0xc6,0x46,0xa2,0x24,
+  0x7c,0xa8,0x28,0xa6,0x85,0x4c,0x68,0x21,0x71,0x39,0x4b,0xbb,0x90,0xa5,0x4a,0x40,
+  0x0f,0x66,0xe8,0x08,0x30,0x4b,0x55,0xe2,0x52,0xc5,0x07,0xdb,0x23,0xf7,0xd6,0x8b,
+  0x8c,0x81,0x39,0x6d,0x77,0x41,0x0d,0x5e,0x5f,0xeb,0xa2,0x9f,0xb0,0xb5,0xca,0x59,
+  0x2d,0x77,0xcf,0xc0,0x60,0xbf,0xab,0x80,0x14,0x11,0x3a,0x90,0x3f,0xb1,0xe5,0xc6,
+  0x88,0x95,0x37,0xa8,0x0f,0x5a,0xd7,0x44,0x08,0x64,0x8d,0x80,0x55,0xed,0x5c,0x93,
+  0x62,0xd5,0x2f,0xc5,0xb3,0x53,0x26,0xb3,0x93,0x6f,0x5e,0xf0,0x88,0x26,0x06,0xba,
+  0x60,0x3c,0x26,0xb5,0x28,0xdc,0xb8,0x88,0xa0,0xf3,0x89,0x0e,0x23,0x99,0xdd,0x09,
+  0x33,0xae,0x9f,0xe3,0x6c,0x91,0x62,0x84,0x32,0x0a,0x86,0xbd,0x31,0x9b,0x6f,0x3d,
+  0x8a,0x12,0x20,0xeb,0x57,0xb6,0x9a,0x80,0x7e,0x71,0x2b,0xe0,0xdc,0xcb,0xf7,0x26,
+  0x42,0xe3,0xb6,0x87,0x9d,0x86,0xc4,0x90,0x2e,0xb0,0x92,0x59,0xe2,0x15,0x1e,0x6a,
+  0x33,0xce,0x03,0xed,0xf7,0x1f,0x50,0x2d,0x94,0x81,0xa3,0xb0,0xd6,0x50,0xc5,0x37,
+  0x2c,0x08,0xbc,0xb2,0xa0,0xb9,0xa0,0xc2,0x97,0xc5,0x4e,0x5a,0x64,0x32,0xb0,0x90,
+  0x84,0x1f,0x06,0x88,0x53,0x06,0x78,0xd8,0x7b,0x50,0x68,0x0c,0x76,0x1e,0xb0,0xdf,
+  0x6c,0x50,0x67,0x94,0x48,0x10,0x64,0xb0,0xb8,0x4a,0xf9,0xa1,0x41,0x22,0x03,0x83,
+  0x43,0x06,0x0d,0x0a,0x19,0x34,0x88,0x66,0x60,0x41,0xcc,0xa0,0x05,0x3c,0x83,0x16,
+  0xe4,0x0c,0xe6,0xab,0x38,0xbb,0x86,0x86,0x48,0xf6,0x0d,0x3e,0xeb,0x7b,0xaa,0x10,
+  0x7e,0x41,0x21,0x95,0x25,0x3e,0x40,0xbd,0x7a,0xff,0x50,0x4a,0x2f,0xd6,0xaf,0xf6,
+  0xfd,0x87,0x5f,0x0f,0x28,0xb8,0xa2,0xb3,0x84,0xd2,0xc6,0x68,0x9b,0xe5,0x46,0x7f,
+  0x19,0x86,0x82,0xf1,0x7a,0xed,0xa9,0xf2,0x9c,0x76,0xb1,0xcc,0x69,0x3f,0x5e,0x24,
+  0xdf,0x9c,0xa3,0x6e,0x64,0xbb,0x39,0xa0,0x4b,0xab,0x1d,0x93,0xb9,0x2c,0x0c,0x18,
+  0x43,0x1f,0xfa,0xf0,0x04,0x91,0x93,0xf6,0xad,0x83,0xb7,0xc0,0x8e,0x69,0x5f,0x5c,
+  0xd5,0x57,0x57,0xa9,0x2e,0x05,0x0a,0x28,0xc8,0x35,0xd4,0xd3,0x62,0x16,0x66,0xf0,
+  0x47,0xe1,0x53,0xbb,0xf7,0x8b,0x07,0x18,0xb9,0x6e,0x64,0xfa,0xe1,0x89,0x2f,0x3f,
+  0xe1,0xe9,0x90,0x9d,0xf7,0x35,0x77,0xcb,0xca,0x33,0xc8,0x82,0xad,0x0b,0x4b,0x8b,
+  0xed,0x51,0x29,0xa4,0xcb,0x66,0x02,0x0a,0x3c,0x89,0x39,0x2c,0x7a,0xc0,0xbb,0xd7,
+  0x75,0x77,0x48,0x73,0x6a,0xb9,0x71,0x29,0x5c,0xa7,0xf9,0x55,0x9c,0x46,0x2b,0xb4,
+  0xdd,0xd8,0xa2,0xb3,0x74,0xe7,0x78,0x34,0xf0,0x6e,0x0b,0x93,0x73,0x34,0xa2,0x3d,
+  0xe0,0x80,0xaf,0x14,0x18,0x8f,0x47,0xa3,0x0d,0xf6,0x14,0xd1,0x9b,0x88,0x3f,0xc5,
+  0x77,0xe7,0xc0,0x1b,0x55,0xd7,0x87,0xd1,0x29,0x3d,0x3c,0x3a,0xb2,0x85,0x0f,0x8b,
+  0xe2,0x16,0x42,0xc7,0x9b,0x21,0x1d,0x0f,0x00,0xc5,0x23,0xde,0x35,0xae,0x6f,0x6d,
+  0xa2,0x29,0xcf,0x41,0x27,0xb0,0x4c,0xcf,0x70,0xaf,0xd3,0x37,0xe2,0x93,0xaa,0xe6,
+  0x7a,0x5f,0x36,0xf9,0x84,0x9c,0x42,0x16,0x73,0xb0,0xab,0x61,0x31,0x27,0xab,0x9b,
+  0xc9,0x75,0x98,0x34,0x38,0xcf,0x84,0x49,0xda,0xce,0x80,0x2a,0x13,0x65,0x3d,0x9f,
+  0x03,0xd9,0x8b,0x09,0x1e,0xb5,0xa3,0x47,0xee,0x0e,0x7a,0x9b,0x73,0x04,0xba,0x74,
+  0xfb,0x09,0x70,0x46,0x9e,0xde,0x70,0x24,0x63,0x81,0x2d,0xe4,0xd8,0x86,0xdc,0xa0,
+  0xaa,0x35,0x6d,0x9b,0x7a,0xe4,0x94,0x82,0x81,0xe0,0xe3,0x1d,0xa8,0xae,0xee,0x3d,
+  0x2b,0x3d,0x96,0x77,0xd2,0x4c,0x4c,0x12,0x10,0xcf,0x71,0xeb,0x39,0x1e,0x98,0x01,
+  0x46,0x61,0x8b,0xb3,0xd0,0x28,0xdd,0xa9,0x71,0xd4,0x86,0xf8,0x85,0x1a,0x4f,0xa0,
+  0x1b,0xd4,0x38,0x1f,0x21,0xc3,0x4f,0x60,0x89,0x81,0x10,0xa3,0xd6,0x79,0xcc,0x6d,
+  0xeb,0x77,0x16,0x9e,0x99,0x80,0x97,0xa6,0x65,0x7c,0xe2,0x6b,0x27,0xec,0x11,0x02,
+  0x6a,0x7a,0x43,0xf7,0xe9,0x50,0xfd,0x67,0xe6,0x3b,0x8f,0x0e,0x6a,0x5f,0x7b,0xee,
+  0xb8,0xae,0x40,0x91,0xb4,0x6f,0xb7,0xae,0xab,0x11,0xfd,0x1f,0xaa,0x89,0xd5,0x9a,
+  0x08,0x30,0x64,0x70,0x97,0x47,0xf2,0x07,0xb5,0x8c,0xf8,0x72,0x8f,0x10,0x9e,0xeb,
+  0x48,0x7c,0x2a,0x41,0xf7,0x84,0x65,0x73,0x93,0x8b,0x30,0xde,0xdd,0x30,0xb6,0x49,
+  0xa0,0xa4,0xee,0x20,0x3f,0xc8,0x04,0xbe,0x0e,0xa4,0x6d,0xf6,0x55,0xe7,0xca,0x25,
+  0x3c,0xbb,0x1b,0x55,0xa1,0x57,0x8d,0xc5,0x48,0x8c,0xb5,0x73,0x05,0xd4,0x74,0x14,
+  0xcd,0x1e,0x4e,0xe5,0xd3,0xdd,0xb1,0x14,0x91,0xe8,0xba,0x14,0x90,0xd4,0x41,0xca,
+  0xe3,0x42,0xfe,0x18,0x57,0x31,0x3a,0x58,0x16,0xf4,0xeb,0x84,0xec,0x91,0x0c,0xf2,
+  0xf8,0x03,0xdb,0xdc,0xe4,0x2b,0xa2,0xc3,0x00,0xf1,0xda,0xbc,0xa2,0x3e,0x29,0xe2,
+  0x05,0xed,0x00,0xc5,0x29,0x18,0xe0,0x43,0x4e,0x47,0xa7,0xa7,0xf1,0x60,0xff,0xf3,
+  0x15,0xfa,0xba,0xf9,0x75,0xdf,0xcd,0x0d,0xb5,0xd4,0x45,0xaa,0x5e,0xf1,0xaf,0x34,
+  0x8d,0x99,0x5f,0xc5,0x1c,0xee,0xbb,0x26,0x7d,0x43,0x55,0xed,0x25,0x08,0x8d,0x9d,
+  0x0d,0x4b,0x45,0x7e,0x39,0xc2,0x23,0x32,0xb3,0xc5,0x65,0x27,0x0f,0x22,0x18,0x93,
+  0xc7,0x7e,0x7f,0x80,0xa6,0x43,0xcd,0x71,0x6b,0x60,0x52,0x32,0x7d,0x87,0x09,0x25,
+  0xa0,0x31,0x07,0x50,0xad,0xed,0xc2,0x99,0xd7,0x25,0x6c,0xdc,0xff,0xb0,0x87,0x75,
+  0xa1,0x03,0x32,0x56,0xfb,0x58,0x05,0x64,0xa1,0xd1,0xbf,0x99,0x74,0x90,0x2b,0xed,
+  0x7d,0x98,0x49,0xae,0x89,0xfe,0x01,0x3d,0x26,0x51,0x11,0x16,0x63,0x31,0x15,0x63,
+  0x2f,0x6e,0xaf,0x7a,0x53,0x2a,0x77,0x76,0x63,0xf2,0x28,0xa3,0x10,0x06,0x31,0x13,
+  0x28,0x4c,0x47,0xa3,0x32,0x22,0xf7,0x98,0x57,0x07,0x59,0xbc,0x06,0x50,0x68,0xa2,
+  0xc4,0xc2,0xb6,0xc4,0x76,0x4b,0x07,0xbd,0xdb,0xea,0x22,0x1c,0x46,0x2d,0x29,0x9a,
+  0x8e,0x0b,0x63,0x87,0x76,0xec,0xdb,0x40,0xa7,0xab,0xc6,0x33,0xb9,0x07,0x37,0xf7,
+  0xe4,0xea,0xf8,0x19,0x53,0xea,0xe5,0xd5,0xf4,0xaf,0x67,0xb3,0x1f,0xbc,0x28,0xf4,
+  0xa2,0xe1,0xb3,0xcb,0x63,0x4e,0x7d,0xee,0x3f,0xa3,0x64,0xff,0x87,0x36,0x09,0x6f,
+  0xc2,0x29,0xf9,0x26,0x1c,0x24,0xe4,0x2d,0x82,0xdd,0x64,0x4e,0x30,0xc2,0xbf,0x74,
+  0x76,0x36,0x8e,0x13,0x98,0xbb,0xc7,0xb2,0x01,0x2b,0xc0,0xf7,0x5a,0x09,0x27,0xf9,
+  0x98,0x98,0x48,0x2e,0x15,0xef,0x91,0xf0,0xdd,0x39,0x73,0xbe,0xf5,0xe7,0xc9,0xb1,
+  0x4c,0x91,0xf1,0xbb,0x17,0xc4,0xc4,0xc2,0x9f,0xa4,0xc1,0xaa,0xd0,0x4b,0x3b,0xb2,
+  0x34,0xe7,0xba,0x28,0x51,0x5a,0x89,0x0f,0x63,0x87,0x47,0x10,0x07,0x78,0xfa,0xf5,
+  0x7d,0xab,0xa8,0x69,0xd5,0x71,0x4b,0xc8,0x13,0xb8,0x6c,0xe4,0xcb,0x6a,0x9c,0x07,
+  0x5c,0x02,0x7d,0xc6,0xb4,0x19,0x25,0x57,0x14,0x48,0x87,0x7d,0xdc,0x9c,0x81,0xb0,
+  0xb9,0x8a,0xe7,0x9f,0x61,0x1e,0xbc,0x0e,0x31,0xe6,0x7e,0x94,0x03,0xbe,0xcc,0x91,
+  0xcb,0x29,0xa7,0x18,0x0f,0xc6,0x63,0x3c,0x74,0x7f,0xd0,0x77,0x23,0x20,0xd0,0x22,
+  0xe2,0xbe,0x4f,0xcb,0x99,0x9c,0x77,0xac,0x96,0x0a,0xef,0x58,0xd8,0x83,0x9d,0x82,
+  0xf1,0x8d,0x44,0x97,0x67,0x7c,0x95,0x93,0xce,0x83,0xa9,0x79,0xa0,0xe7,0x70,0xde,
+  0xf8,0x45,0x48,0xfc,0x82,0x44,0x58,0x27,0xc0,0x98,0x29,0xf0,0x0c,0xd6,0x05,0xd5,
+  0x0a,0x42,0x67,0xa6,0x92,0x2e,0x4e,0x9d,0x03,0xca,0x2a,0x2e,0x92,0x35,0x22,0x30,
+  0x6f,0x65,0x8b,0x80,0xcd,0xd0,0x6e,0x92,0x49,0xd3,0xbc,0x65,0xff,0xd1,0x68,0x19,
+  0xdd,0x78,0x4b,0xdc,0xa8,0x48,0x59,0x89,0x1b,0x8f,0x4a,0x06,0xdd,0x33,0x8d,0xf0,
+  0x07,0xd9,0x0c,0x52,0xd5,0xb8,0xad,0xd6,0x99,0xb6,0x1a,0xf8,0xbc,0xa6,0x6a,0x70,
+  0x3a,0x96,0xaa,0xb1,0x8a,0xae,0x3d,0x28,0x6d,0xd4,0xa6,0x37,0xf7,0xec,0x88,0x65,
+  0x0a,0xc6,0x4b,0x5b,0xa1,0xbb,0x19,0xae,0x1a,0xe4,0xb6,0x03,0x93,0xa5,0x2c,0xe6,
+  0xb0,0x66,0x20,0x0e,0x5a,0x29,0x7a,0x19,0x79,0xc1,0xd8,0x57,0x97,0x11,0x4a,0xd1,
+  0x27,0xa7,0x4a,0x8c,0xe9,0x32,0x11,0xbc,0xf7,0xa8,0x73,0x93,0x4c,0x8c,0x68,0xb9,
+  0xe2,0xd9,0xc0,0x33,0x93,0xde,0x4a,0x95,0xba,0xb2,0xd3,0xe3,0x34,0x09,0xdd,0x32,
+  0xd9,0x70,0x29,0x9a,0x32,0x3e,0xf6,0x72,0x67,0xe8,0xee,0x5c,0x57,0x15,0x9e,0x28,
+  0x52,0x0f,0x38,0x6b,0x21,0x89,0x50,0xd9,0xe2,0x88,0xf0,0xaa,0x91,0x52,0x57,0x92,
+  0xa6,0x0d,0x7e,0xad,0x6a,0xa3,0x47,0xd2,0x77,0xb4,0x35,0x2a,0x19,0xd1,0x84,0xc3,
+  0x13,0x79,0xb7,0x2a,0xfa,0x8e,0x22,0xeb,0x5b,0xe3,0x5e,0x0c,0xfe,0x78,0xf3,0xfa,
+  0xe7,0xaa,0xda,0xfc,0xaa,0xff,0xae,0x41,0x09,0xc1,0x84,0x40,0x1b,0x9b,0xaa,0x0c,
+  0x1f,0x98,0xf8,0xc2,0xfd,0xcd,0x48,0x39,0xe8,0xb0,0xe3,0x23,0xe9,0x77,0x47,0xce,
+  0xf6,0xa5,0x44,0x32,0x0f,0x6b,0x09,0x0c,0x1d,0x76,0x98,0x19,0x12,0xe4,0x80,0xea,
+  0x47,0xb5,0x67,0x82,0xf3,0x39,0x0e,0x9e,0x9b,0xdd,0xa0,0x48,0x45,0xff,0x66,0x91,
+  0x83,0xd2,0xca,0xd7,0xf0,0x16,0x0e,0x4f,0xa5,0x99,0xbe,0xf0,0x44,0x3a,0xfa,0x0c,
+  0x47,0x3b,0x07,0x89,0xab,0x43,0x74,0x5f,0xf1,0x9c,0x1e,0x18,0xf8,0x31,0x1a,0xf8,
+  0xd6,0x5a,0x7f,0xd8,0x21,0x8b,0x3c,0xf0,0x7e,0x76,0x00,0xe8,0x14,0xa6,0x55,0x2f,
+  0x90,0xee,0xec,0xb3,0xc7,0x07,0x61,0xf8,0x24,0x7e,0x67,0x95,0xfc,0x66,0xb3,0x32,
+  0x9f,0x26,0x18,0x10,0x8c,0x3f,0xaa,0x9b,0x07,0xcf,0xe9,0x4f,0x16,0xc0,0xf0,0x32,
+  0x0f,0x9c,0x11,0x80,0x2e,0x8a,0x7b,0xe5,0x14,0x10,0x23,0xc9,0xa9,0x9c,0xf4,0xa2,
+  0x79,0xe1,0x9f,0x6e,0x0d,0x2a,0x65,0xef,0xf3,0x3c,0x4f,0xc7,0xe2,0xf8,0x58,0x8c,
+  0x41,0xc0,0xe5,0x65,0x35,0x84,0xcc,0xdd,0xf4,0x98,0xd2,0xb1,0x7d,0xa8,0x11,0xda,
+  0xa5,0xdf,0x03,0x39,0x68,0x2f,0xd9,0xc2,0x7d,0x9a,0x4f,0xd0,0x5d,0x12,0x66,0x35,
+  0x74,0xc3,0x2a,0x43,0x90,0xb7,0xc0,0x13,0xc1,0x18,0x39,0x82,0xb1,0x0a,0x55,0x44,
+  0x5e,0xdb,0x25,0xf9,0x69,0x8c,0x24,0xa3,0x91,0xe2,0x1a,0x0c,0x8d,0x5b,0x40,0xf3,
+  0x81,0x60,0x48,0x41,0x06,0x3d,0x01,0x8e,0x6f,0xb6,0xb4,0x6b,0x50,0x4e,0x5c,0x0a,
+  0x9e,0xfd,0xa6,0x73,0xaf,0xf8,0x57,0x8a,0x8f,0xc0,0x76,0x78,0xa1,0x40,0x90,0xe1,
+  0x09,0x13,0xe8,0x9a,0xc9,0x0d,0x58,0xca,0x8a,0xdf,0xe5,0x41,0xa9,0x9c,0x85,0x6f,
+  0x64,0x7e,0xc7,0x42,0x45,0x22,0x34,0x2f,0x2c,0x22,0xf0,0xb0,0xc3,0xdc,0xc8,0x66,
+  0xf8,0x88,0xc7,0x0c,0x5b,0xb1,0x0f,0x08,0xb4,0xe4,0xe1,0x9f,0xc9,0x15,0x4c,0x80,
+  0x61,0x86,0x69,0x3d,0x93,0x1b,0x74,0xd1,0xaf,0xf7,0x0c,0xb8,0xcd,0xb4,0xea,0x86,
+  0xb1,0xcf,0x14,0x01,0xf4,0x9d,0xbc,0x23,0x3f,0x29,0xde,0x67,0x36,0x0e,0x41,0x97,
+  0x5d,0x1e,0x77,0x26,0x2e,0x6a,0xae,0xa9,0x09,0xf7,0x17,0xc3,0x2e,0xa0,0x3c,0x87,
+  0xf6,0x81,0x7b,0x41,0xa0,0x5e,0xa8,0x73,0xbc,0xe0,0xd0,0xb0,0xe8,0xcf,0x20,0x85,
+  0x34,0x5d,0x07,0x54,0x02,0x0c,0x68,0xe4,0xf7,0xf9,0x01,0x95,0xad,0x3d,0xf1,0xc7,
+  0x91,0x29,0xa4,0x17,0x47,0x88,0xb0,0x85,0x14,0x5d,0x7e,0x17,0x88,0x76,0xc5,0x0b,
+  0x1a,0x26,0x30,0x20,0x1e,0x93,0x39,0xc6,0xfb,0x99,0x3c,0x1c,0xfd,0x1a,0xd8,0xec,
+  0x82,0x1c,0x07,0x2b,0x04,0x59,0xab,0x26,0x0a,0x15,0xaa,0xc1,0x8b,0x93,0x48,0xe0,
+  0xad,0x2c,0xfc,0x95,0x0d,0xfc,0x3d,0x0f,0xd0,0x52,0x2f,0x92,0x85,0x7e,0x63,0x6a,
+  0x18,0x8d,0x0e,0xd3,0x40,0x7d,0x40,0x3b,0xb9,0x3d,0xcb,0xc5,0x0d,0x75,0x5e,0x0d,
+  0x11,0xe5,0x16,0xa6,0x32,0xa8,0xcc,0x7b,0x40,0x25,0x74,0x0f,0x86,0x61,0xce,0xa9,
+  0x1c,0x61,0x59,0x21,0xf7,0x6a,0xee,0x0a,0x9e,0xa3,0xdb,0xdb,0xdb,0x23,0x60,0xed,
+  0xf5,0x11,0x2c,0x87,0xce,0xe6,0x39,0x5e,0x92,0x80,0x33,0xb8,0xa2,0xd9,0x2d,0xf9,
+  0x66,0x11,0x64,0xfb,0x36,0x69,0x0d,0xc6,0x51,0xf3,0x06,0x56,0x34,0x91,0xff,0xe1,
+  0xca,0xa8,0x35,0x4e,0x40,0x46,0x1b,0xcb,0x18,0x3a,0xa5,0xd9,0x25,0xa1,0xba,0xf1,
+  0x72,0xff,0x47,0xc1,0xa2,0x3a,0x77,0x3a,0x3c,0xf4,0x96,0x01,0xb1,0xee,0x2a,0xdc,
+  0x33,0xa6,0x4d,0xbc,0x51,0x68,0x78,0x6a,0x5a,0x87,0xdc,0x75,0xf9,0x5c,0x3d,0x3d,
+  0x39,0xc1,0x49,0xe6,0xd7,0x67,0xff,0x38,0x01,0x56,0xfb,0xc7,0x09,0x35,0xc2,0x49,
+  0x14,0x1f,0x6d,0x5f,0xd0,0x19,0x96,0xe0,0xfd,0x71,0x4a,0xdd,0xf9,0x0f,0x35,0x6e,
+  0x2c,0xdf,0x7a,0xee,0x7a,0x9f,0xa3,0xb3,0xf3,0x57,0x5d,0x6e,0xf2,0xac,0xd4,0x3c,
+  0x2c,0xcf,0x5e,0x36,0x77,0x44,0x30,0x08,0xb7,0xdd,0x68,0x04,0x9c,0x07,0x03,0x9f,
+  0x27,0x78,0xdd,0xa5,0xe5,0x6f,0xb4,0x78,0xbc,0x53,0x89,0x01,0x2a,0x3e,0x7a,0xa9,
+  0xc8,0xb0,0xc1,0x44,0xb7,0x14,0xd0,0x62,0xc8,0x66,0x91,0x42,0x71,0xe0,0x69,0x35,
+  0xb7,0xbb,0x72,0x7c,0x15,0x66,0xe5,0x5c,0x76,0x89,0xb1,0xd8,0x7c,0xd1,0x25,0xd8,
+  0xba,0x80,0x9a,0x77,0x59,0x84,0xbb,0x41,0x82,0x72,0x14,0x06,0x48,0x9c,0x4b,0xe4,
+  0xe0,0x10,0xc3,0x08,0xf8,0x91,0xaf,0x53,0xb9,0x6f,0x66,0x0a,0x3b,0xca,0x91,0x4d,
+  0xd2,0x26,0x45,0x06,0x85,0x84,0x06,0x3a,0xd8,0x92,0x3b,0x80,0x16,0xf0,0xd8,0xbd,
+  0x6a,0xe5,0x3c,0xa0,0x4c,0xc0,0x95,0x06,0xc5,0x74,0x0b,0xc9,0x73,0x5c,0x16,0x62,
+  0xdc,0x9f,0x12,0x9d,0x2e,0x3a,0x84,0xd4,0x26,0x9e,0xa3,0x27,0xc6,0x49,0x40,0x9f,
+  0x0c,0xae,0xec,0x5b,0x00,0xbb,0xe5,0x7d,0x36,0x47,0x94,0x99,0x63,0xc4,0x2c,0xbe,
+  0x80,0x3e,0x9b,0x00,0x75,0x00,0xec,0xf0,0x98,0xf6,0x59,0x9c,0xcb,0xb7,0xf8,0x0b,
+  0x43,0x27,0x03,0x20,0x87,0x99,0x2a,0xcb,0xdb,0xbc,0x58,0xb0,0xca,0xa2,0x26,0x37,
+  0xfe,0x85,0xf1,0x33,0x9f,0xcb,0x0d,0x51,0x6c,0x73,0x64,0xc0,0x45,0x2d,0x67,0x8f,
+  0xa0,0x96,0x47,0x48,0xf2,0x70,0x0a,0x2c,0xb6,0xb1,0x33,0x27,0x73,0x07,0xe1,0x20,
+  0x87,0x80,0xb2,0x65,0x2e,0x8e,0xf8,0x87,0x50,0x0a,0x7c,0x42,0x3d,0x8d,0xde,0xca,
+  0x9e,0x6d,0x69,0x46,0xd6,0xe7,0xee,0x16,0x5c,0xe7,0xc6,0x94,0x0a,0x0f,0x94,0x54,
+  0xfb,0xb1,0x6f,0x48,0x5d,0xbd,0x25,0x5a,0xd7,0x0c,0xc5,0x2b,0x89,0xf7,0xef,0xce,
+  0x2f,0x84,0x11,0xfd,0x1e,0x6f,0xa0,0x41,0x47,0xe8,0xfa,0x9b,0xff,0xbc,0x4a,0xab,
+  0x27,0x59,0x0d,0xee,0x55,0x8b,0xbb,0x42,0x80,0xa7,0x3b,0x0e,0x5f,0x13,0x7f,0xd4,
+  0x77,0xde,0x85,0xfc,0xf5,0x0c,0x55,0xf8,0x10,0x1a,0x9e,0x70,0x75,0xc3,0x16,0x00,
+  0xfd,0x1a,0x93,0x18,0xaf,0xd1,0xab,0xad,0x63,0x67,0xd2,0x1c,0x2e,0xb7,0x51,0x79,
+  0xa8,0x98,0x49,0x39,0x52,0x14,0x6e,0x0c,0x3f,0xa7,0x88,0x9d,0x6d,0x81,0x6e,0xa8,
+  0x57,0x80,0xe0,0xcb,0x8b,0x23,0x10,0xe4,0xcf,0x16,0xc9,0xcd,0x73,0xe1,0x73,0x4a,
+  0x1b,0x7a,0x49,0xc7,0x50,0xcc,0xe1,0xa6,0x98,0xdc,0xce,0xa0,0xfa,0x97,0x66,0x6a,
+  0x8a,0x4e,0xc0,0x80,0x19,0x7f,0x6d,0x76,0x9d,0x68,0x38,0x17,0x8a,0xc5,0xec,0x6f,
+  0xbf,0xfe,0x82,0x0e,0x97,0x3c,0xc3,0x50,0x51,0xe3,0x57,0xe8,0x73,0x86,0xe3,0xb1,
+  0x81,0x26,0xc2,0x17,0x8c,0xd5,0xbd,0x3c,0x87,0x3e,0x80,0x4c,0x51,0xa0,0x89,0x39,
+  0xd4,0xc8,0x17,0x39,0x0b,0xee,0x01,0x87,0x9a,0x5c,0xd0,0xa1,0x10,0x40,0x15,0x17,
+  0xb8,0xfd,0xbb,0x93,0x67,0xe4,0x0b,0xca,0x10,0xc3,0x73,0xb0,0xd4,0xc8,0xbd,0x4c,
+  0xfb,0xbf,0x9f,0x9e,0xe0,0x75,0xda,0x63,0xf1,0x88,0x37,0x94,0x16,0xb6,0x09,0x72,
+  0xdb,0xbb,0x59,0xab,0xb9,0xf9,0x8d,0xae,0xab,0x92,0x45,0xff,0xf5,0x91,0xc6,0xe9,
+  0x1c,0x35,0x4f,0x9e,0xf5,0x70,0x9a,0x83,0x0d,0x0f,0xc8,0xda,0xa1,0x96,0x64,0xdb,
+  0x87,0x18,0x50,0xeb,0x6e,0x10,0xf0,0x21,0x3c,0x73,0x7c,0xc7,0x04,0x80,0x6b,0x73,
+  0x55,0x9a,0x74,0xec,0x57,0x3c,0x40,0x6e,0xb4,0x26,0xc8,0xec,0x9c,0x1d,0x06,0x9a,
+  0x74,0x00,0xca,0x1e,0x5d,0x91,0x52,0x75,0x82,0x12,0x1d,0x3c,0x83,0x1b,0x46,0xb8,
+  0xdd,0x81,0xb7,0x8b,0x2e,0xd0,0x53,0x54,0x5f,0xad,0x13,0x2c,0x00,0x13,0x2c,0x40,
+  0x8c,0x6b,0xfb,0x7c,0x55,0x57,0x15,0x90,0x3e,0xbf,0xa0,0x72,0xe1,0x47,0x4f,0xa0,
+  0xa3,0x28,0x37,0xe9,0x00,0x03,0xe7,0x9f,0xaf,0xf2,0x3b,0x7c,0x25,0x5d,0x8f,0xef,
+  0x14,0xc8,0x52,0x78,0x00,0x8d,0x7c,0x74,0x62,0xf0,0xd1,0xe9,0xc4,0x70,0x4e,0x33,
+  0xc1,0x07,0x41,0xae,0x0e,0x7d,0x98,0xdd,0x4e,0x77,0x29,0xbc,0xc7,0x5c,0xfa,0x34,
+  0xaf,0x87,0x94,0x88,0x61,0x7f,0x18,0xee,0x4c,0xf4,0xd1,0xfb,0x99,0xfd,0x2b,0x74,
+  0xac,0xbb,0x25,0x17,0xdb,0x4b,0x9a,0x15,0xb5,0x17,0xe0,0xdf,0xdd,0x24,0xf0,0xdb,
+  0x4d,0x02,0x3b,0x8b,0xd2,0xb9,0xf1,0xb0,0xe7,0x34,0x80,0xf5,0xab,0xdb,0xec,0xe6,
+  0x04,0xaf,0xfe,0xdb,0x3b,0x69,0xbd,0xeb,0x99,0x4f,0x37,0xc3,0x1d,0xba,0xd6,0xcd,
+  0x05,0x03,0xbc,0x69,0x69,0x7a,0xe8,0x75,0x8f,0xe5,0xf7,0xd2,0xb5,0x68,0x2e,0xb4,
+  0x04,0x25,0xf4,0xb0,0xc3,0x6d,0x38,0x63,0x2e,0x55,0x1c,0xc0,0x29,0x1f,0x3e,0x84,
+  0x8f,0xec,0xdb,0x69,0x73,0x27,0xa6,0x29,0xa0,0x69,0x76,0xd0,0xb3,0xd7,0xdc,0x89,
+  0x99,0xd1,0x9d,0x98,0x3a,0xf8,0xf8,0xf1,0x03,0x98,0x03,0x52,0xe3,0x65,0x44,0x1f,
+  0x7a,0x8e,0xdd,0x34,0x6e,0xac,0xc6,0x25,0x89,0xce,0x51,0x28,0x45,0xb1,0x61,0xbb,
+  0x9d,0x4f,0x60,0xe3,0xe0,0xa8,0x9c,0x75,0x1e,0x36,0x17,0x62,0xf3,0x4c,0xee,0xe7,
+  0xb3,0xc1,0xa7,0xfb,0xe9,0x1d,0x36,0x75,0x2e,0xef,0xa6,0xdb,0x6e,0xf6,0x2f,0xd9,
+  0xa6,0xd3,0xd0,0xbb,0x66,0x12,0x27,0xff,0x0b,0x81,0x0f,0x3f,0x6d,0xee,0x61,0x00,
+  0x00,
+};
+
+static const AsyncWebAsset webAssets[] = {
+  {"/css/style.css", "/css/style.23f78045.css", "text/css", "\"23f78045c54fab58\"", webAssets_0, 619},
+  {"/index.html", "/index.13aada02.html", "text/html", "\"13aada02670f210a\"", webAssets_1, 797},
+  {"/js/zepto.min.js", "/js/zepto.min.43de3465.js", "application/javascript", "\"43de3465373fe8d7\"", webAssets_2, 9329},
+};
+
+#endif // WEB_ASSETS_H
@@ -8,52 +8,307 @@
 #include <Arduino.h>
 #include "defines.h"
 #include "globals.h"
+#include "MPU6050.h"
+#include "Motors.h"
+#include "Trace.h"
+
+// The control laws are in ControlLaws.h; these wrappers keep the float interface of the sketch and
+// run them in control_t (float, or Q16_16 with CONTROL_FIXED_POINT)
 
 // PD controller implementation(Proportional, derivative). DT in seconds
 float stabilityPDControl(float DT, float input, float setPoint,  float Kp, float Kd)
 {
-  float error;
-  float output;
-
-  error = setPoint - input;
-
-  // Kd is implemented in two parts
-  //    The biggest one using only the input (sensor) part not the SetPoint input-input(t-1).
-  //    And the second using the setpoint to make it a bit more agressive   setPoint-setPoint(t-1)
-  float Kd_setPoint = constrain((setPoint - setPointOld), -8, 8); // We limit the input part...
-  output = Kp * error + (Kd * Kd_setPoint - Kd * (input - PID_errorOld)) / DT;
-  //Serial.print(Kd*(error-PID_errorOld));Serial.print("\t");
-  //PID_errorOld2 = PID_errorOld;
-  PID_errorOld = input;  // error for Kd is only the input component
-  setPointOld = setPoint;
-  return (output);
+  return float(stabilityControl.compute(control_t(DT), control_t(input), control_t(setPoint), control_t(Kp), control_t(Kd)));
 }
 
 
 // PI controller implementation (Proportional, integral). DT in seconds
 float speedPIControl(float DT, int16_t input, int16_t setPoint,  float Kp, float Ki)
 {
-  int16_t error;
-  float output;
-
-  error = setPoint - input;
-  PID_errorSum += constrain(error, -ITERM_MAX_ERROR, ITERM_MAX_ERROR);
-  PID_errorSum = constrain(PID_errorSum, -ITERM_MAX, ITERM_MAX);
+  return float(speedControl.compute(control_t(DT), input, setPoint, control_t(Kp), control_t(Ki)));
+}
 
-  //Serial.println(PID_errorSum);
 
-  output = Kp * error + Ki * PID_errorSum * DT; // DT is in miliseconds...
-  return (output);
+float positionPDControl(long actualPos, long setPointPos, float Kpp, float Kdp, int16_t speedM)
+{
+  return float(positionPD<control_t>(actualPos, setPointPos, control_t(Kpp), control_t(Kdp), speedM, control_t(115))); // Limit command
 }
 
 
-float positionPDControl(long actualPos, long setPointPos, float Kpp, float Kdp, int16_t speedM)
+#ifdef IMU_FIFO_MODE
+static uint8_t imu_fifo_count;  // samples in the block being averaged
+
+// Drain the MPU6050 FIFO and run the angle filter on the mean of every IMU_FIFO_DECIMATION samples,
+// so the filter and the control laws keep their 100Hz tuning. Return the number of such blocks
+static int imuFifoAngle(float *sensor_angle)
 {
-  float output;
-  float P;
+  static int32_t sum[7];
+  accel_t_gyro_union samples[2 * MPU6050_FIFO_BURST];
+  int16_t *value;
+  int blocks = 0;
+  int n;
 
-  P = constrain(Kpp * float(setPointPos - actualPos), -115, 115); // Limit command
-  output = P + Kdp * float(speedM);
-  return (output);
+  do {
+    n = MPU6050_fifo_read(samples, 2 * MPU6050_FIFO_BURST);
+    if (n == -12) {  // FIFO overflowed and was reset: the partial block spans the lost samples, drop it
+      for (uint8_t k = 0; k < 7; k++)
+        sum[k] = 0;
+      imu_fifo_count = 0;
+      break;
+    }
+    for (int i = 0; i < n; i++) {
+      value = &samples[i].value.x_accel;
+      traceSample(timer_value, value);
+      for (uint8_t k = 0; k < 7; k++)
+        sum[k] += value[k];
+      if (++imu_fifo_count == IMU_FIFO_DECIMATION) {
+        value = &accel_t_gyro.value.x_accel;
+        for (uint8_t k = 0; k < 7; k++) {
+          value[k] = sum[k] / IMU_FIFO_DECIMATION;
+          sum[k] = 0;
+        }
+        imu_fifo_count = 0;
+        *sensor_angle = MPU6050_getAngle(IMU_FIFO_DECIMATION * IMU_FIFO_PERIOD);
+        blocks++;
+      }
+    }
+  } while (n == 2 * MPU6050_FIFO_BURST);
+  return blocks;
 }
+#endif
+
+// Apply the remote's OSC variables (web remote, UDP protocol) to the control parameters.
+// Called from loop() when OSCnewMessage is set; kept out of the sketch like controlLoop()
+void processOSCMsg() {
+  if (OSCpage == 1) {
+    if (modifing_control_parameters)  // We came from the settings screen
+    {
+      OSCfader[0] = 0.5; // default neutral values
+      OSCfader[1] = 0.5; // default neutral values
+      OSCtoggle[0] = 0;  // Normal mode
+      mode = 0;
+      modifing_control_parameters = false;
+    }
+    robot_sleeping = false;
+
+    if (OSCmove_mode) {
+      Serial.print("M ");
+      Serial.print(OSCmove_speed);
+      Serial.print(" ");
+      Serial.print(OSCmove_steps1);
+      Serial.print(",");
+      Serial.println(OSCmove_steps2);
+      positionControlMode = true;
+      OSCmove_mode = false;
+      target_steps1 = steps1 + OSCmove_steps1;
+      target_steps2 = steps2 + OSCmove_steps2;
+    } else {
+      positionControlMode = false;
+      throttle = (OSCfader[0] - 0.5) * max_throttle;
+      // We add some exponential on steering to smooth the center band
+      steering = OSCfader[1] - 0.5;
+      if (steering > 0)
+        steering = (steering * steering + 0.5 * steering) * max_steering;
+      else
+        steering = (-steering * steering + 0.5 * steering) * max_steering;
+    }
+
+    if ((mode == 0) && (OSCtoggle[0])) {
+      // Change to PRO mode
+      max_throttle = MAX_THROTTLE_PRO;
+      max_steering = MAX_STEERING_PRO;
+      max_target_angle = MAX_TARGET_ANGLE_PRO;
+      mode = 1;
+    }
+    if ((mode == 1) && (OSCtoggle[0] == 0)) {
+      // Change to NORMAL mode
+      max_throttle = MAX_THROTTLE;
+      max_steering = MAX_STEERING;
+      max_target_angle = MAX_TARGET_ANGLE;
+      mode = 0;
+    }
+  } else if (OSCpage == 2) { // OSC page 2
+    if (!modifing_control_parameters) {
+      for (uint8_t i = 0; i < 4; i++)
+        OSCfader[i] = 0.5;
+      OSCtoggle[0] = 0;
+
+      modifing_control_parameters = true;
+      //OSC_MsgSend("$P2", 4);
+    }
+    // User could adjust KP, KD, KP_THROTTLE and KI_THROTTLE (fadder3,4,5,6)
+    // Now we need to adjust all the parameters all the times because we dont know what parameter has been moved
+    Kp_user = KP * 2 * OSCfader[0];
+    Kd_user = KD * 2 * OSCfader[1];
+    Kp_thr_user = KP_THROTTLE * 2 * OSCfader[2];
+    Ki_thr_user = KI_THROTTLE * 2 * OSCfader[3];
+    // Send a special telemetry message with the new parameters
+    char auxS[50];
+    sprintf(auxS, "$tP,%d,%d,%d,%d", int(Kp_user * 1000), int(Kd_user * 1000), int(Kp_thr_user * 1000), int(Ki_thr_user * 1000));
+    //OSC_MsgSend(auxS, 50);
+
+
+    // Calibration mode??
+    if (OSCpush[2] == 1) {
+      Serial.print("Calibration MODE ");
+      angle_offset = angle_adjusted_filtered;
+      Serial.println(angle_offset);
+    }
+
+    // Kill robot => Sleep, until a message clears the toggle or goes back to page 1 (controlLoop() keeps the motors off)
+    robot_sleeping = (OSCtoggle[0] == 1);
+  }
+}
+
+// Main control loop: runs the whole control cascade each time the IMU has a new sample.
+// Called from loop(); kept out of the sketch so it can also be built by the host simulator (sim/)
+void controlLoop()
+{
+  float MPU_sensor_angle;
+
+  timer_value = micros();
+
+  if (robot_sleeping) {
+    // Sleep: motors off, without blocking loop() so the remote can still wake the robot
+    speedControl.reset();
+    timer_old = timer_value;
+    setMotorSpeedM1(0);
+    setMotorSpeedM2(0);
+    digitalWrite(PIN_ENABLE_MOTORS, HIGH);  // Disable motors
+    return;
+  }
 
+#ifdef IMU_FIFO_MODE
+  int blocks = imuFifoAngle(&MPU_sensor_angle);
+  if (blocks > 0) {
+
+    dt = blocks * IMU_FIFO_DECIMATION * IMU_FIFO_PERIOD; // dt in seconds, from the sensor clock
+    timer_old = timer_value;
+
+    angle_adjusted_Old = angle_adjusted;
+#else
+  if (MPU6050_newData()) {
+    
+    MPU6050_read_3axis();
+    traceSample(timer_value, &accel_t_gyro.value.x_accel);
+    
+    dt = (timer_value - timer_old) * 0.000001; // dt in seconds
+    //Serial.println(timer_value - timer_old);
+    timer_old = timer_value;
+
+    angle_adjusted_Old = angle_adjusted;
+    // Get new orientation angle from IMU (MPU6050)
+    MPU_sensor_angle = MPU6050_getAngle(dt);
+#endif
+    int16_t throttle_in = throttle;  // user inputs of this update, for the trace
+    float steering_in = steering;
+
+    angle_adjusted = MPU_sensor_angle + angle_offset;
+    if ((MPU_sensor_angle > -15) && (MPU_sensor_angle < 15))
+      angle_adjusted_filtered = angle_adjusted_filtered * 0.99 + MPU_sensor_angle * 0.01;
+
+
+    // We calculate the estimated robot speed:
+    // Estimated_Speed = angular_velocity_of_stepper_motors(combined) - angular_velocity_of_robot(angle measured by IMU)
+    actual_robot_speed = (speed_M1 + speed_M2) / 2; // Positive: forward
+
+    int16_t angular_velocity = (angle_adjusted - angle_adjusted_Old) * 25.0; // 25 is an empirical extracted factor to adjust for real units
+    int16_t estimated_speed = -actual_robot_speed + angular_velocity;
+    estimated_speed_filtered = estimated_speed_filtered * 0.9 + (float) estimated_speed * 0.1; // low pass filter on estimated speed
+
+
+    if (positionControlMode) {
+      // POSITION CONTROL. INPUT: Target steps for each motor. Output: motors speed
+      motor1_control = positionPDControl(steps1, target_steps1, Kp_position, Kd_position, speed_M1);
+      motor2_control = positionPDControl(steps2, target_steps2, Kp_position, Kd_position, speed_M2);
+
+      // Convert from motor position control to throttle / steering commands
+      throttle = (motor1_control + motor2_control) / 2;
+      throttle = constrain(throttle, -190, 190);
+      steering = motor2_control - motor1_control;
+      steering = constrain(steering, -50, 50);
+    }
+
+    // ROBOT SPEED CONTROL: This is a PI controller.
+    //    input:user throttle(robot speed), variable: estimated robot speed, output: target robot angle to get the desired speed
+    target_angle = speedPIControl(dt, estimated_speed_filtered, throttle, Kp_thr, Ki_thr);
+    target_angle = constrain(target_angle, -max_target_angle, max_target_angle); // limited output
+
+    // Stability control (100Hz loop): This is a PD controller.
+    //    input: robot target angle(from SPEED CONTROL), variable: robot angle, output: Motor speed
+    //    We integrate the output (sumatory), so the output is really the motor acceleration, not motor speed.
+    control_output += stabilityPDControl(dt, angle_adjusted, target_angle, Kp, Kd);
+    control_output = constrain(control_output, -MAX_CONTROL_OUTPUT,  MAX_CONTROL_OUTPUT); // Limit max output from control
+
+    // The steering part from the user is injected directly to the output
+    motor1 = control_output + steering;
+    motor2 = control_output - steering;
+
+    // Limit max speed (control output)
+    motor1 = constrain(motor1, -MAX_CONTROL_OUTPUT, MAX_CONTROL_OUTPUT);
+    motor2 = constrain(motor2, -MAX_CONTROL_OUTPUT, MAX_CONTROL_OUTPUT);
+
+    int angle_ready;
+    if (OSCpush[0])     // If we press the SERVO button we start to move
+      angle_ready = 82;
+    else
+      angle_ready = 74;  // Default angle
+    if ((angle_adjusted < angle_ready) && (angle_adjusted > -angle_ready)) // Is robot ready (upright?)
+        {
+      // NORMAL MODE
+      digitalWrite(PIN_ENABLE_MOTORS, LOW);  // Motors enable
+      // NOW we send the commands to the motors
+      setMotorSpeedM1(motor1);
+      setMotorSpeedM2(motor2);
+    } else   // Robot not ready (flat), angle > angle_ready => ROBOT OFF
+    {
+      digitalWrite(PIN_ENABLE_MOTORS, HIGH);  // Disable motors
+      setMotorSpeedM1(0);
+      setMotorSpeedM2(0);
+      speedControl.reset();  // Reset PID I term
+      Kp = KP_RAISEUP;   // CONTROL GAINS FOR RAISE UP
+      Kd = KD_RAISEUP;
+      Kp_thr = KP_THROTTLE_RAISEUP;
+      Ki_thr = KI_THROTTLE_RAISEUP;
+      // RESET steps
+      steps1 = 0;
+      steps2 = 0;
+      positionControlMode = false;
+      OSCmove_mode = false;
+      throttle = 0;
+      steering = 0;
+    }
+    
+    // Push1 Move servo arm
+    if (OSCpush[0]) {
+      if (angle_adjusted > -40)
+        ledcWrite(6, SERVO_MAX_PULSEWIDTH);
+      else
+        ledcWrite(6, SERVO_MIN_PULSEWIDTH);
+    } else
+      ledcWrite(6, SERVO_AUX_NEUTRO);
+
+    // Servo2
+    //ledcWrite(6, SERVO2_NEUTRO + (OSCfader[2] - 0.5) * SERVO2_RANGE);
+
+    // Normal condition?
+    if ((angle_adjusted < 56) && (angle_adjusted > -56)) {
+      Kp = Kp_user;            // Default user control gains
+      Kd = Kd_user;
+      Kp_thr = Kp_thr_user;
+      Ki_thr = Ki_thr_user;
+    } else // We are in the raise up procedure => we use special control parameters
+    {
+      Kp = KP_RAISEUP;         // CONTROL GAINS FOR RAISE UP
+      Kd = KD_RAISEUP;
+      Kp_thr = KP_THROTTLE_RAISEUP;
+      Ki_thr = KI_THROTTLE_RAISEUP;
+    }
+
+#ifdef IMU_FIFO_MODE
+    traceControl(timer_value, throttle_in, steering_in, imu_fifo_count == 0);
+#else
+    traceControl(timer_value, throttle_in, steering_in, true);
+#endif
+  } // End of new IMU data
+}
@@ -8,9 +8,21 @@
 #ifndef CONTROL_H_
 #define CONTROL_H_
 
+#include "ControlLaws.h"
+#include "defines.h"
+
+// Number type of the control laws
+#ifdef CONTROL_FIXED_POINT
+typedef Q16_16 control_t;
+#else
+typedef float control_t;
+#endif
+
 float stabilityPDControl(float DT, float input, float setPoint,  float Kp, float Kd);
 float speedPIControl(float DT, int16_t input, int16_t setPoint,  float Kp, float Ki);
 float positionPDControl(long actualPos, long setPointPos, float Kpp, float Kdp, int16_t speedM);
+void processOSCMsg();
+void controlLoop();
 
 
 
@@ -0,0 +1,97 @@
+/*
+ * ControlLaws.h
+ *
+ *  The robot control laws as templates on the number type, so the same
+ *  code runs in float (ESP32) or in Q16_16 fixed point (cores without FPU).
+ *  Controller state lives in the objects, one object per controlled loop.
+ *
+ *  Created on: 17.10.2026
+ *      Author: anonymous
+ */
+
+#ifndef CONTROLLAWS_H_
+#define CONTROLLAWS_H_
+
+#include <stdint.h>
+#include "FixedPoint.h"
+
+#define CONTROL_CONSTRAIN(x, low, high) ((x) < (low) ? (low) : ((x) > (high) ? (high) : (x)))
+
+// PD controller implementation(Proportional, derivative). DT in seconds
+template <typename T>
+class StabilityPD
+{
+public:
+  StabilityPD() { reset(); }
+
+  void reset()
+  {
+    inputOld = 0;
+    setPointOld = 0;
+  }
+
+  // Restart from a known previous update (trace replay)
+  void preset(T input, T setPoint)
+  {
+    inputOld = input;
+    setPointOld = setPoint;
+  }
+
+  T compute(T DT, T input, T setPoint, T Kp, T Kd)
+  {
+    T error = setPoint - input;
+
+    // Kd is implemented in two parts
+    //    The biggest one using only the input (sensor) part not the SetPoint input-input(t-1).
+    //    And the second using the setpoint to make it a bit more agressive   setPoint-setPoint(t-1)
+    T Kd_setPoint = CONTROL_CONSTRAIN(setPoint - setPointOld, T(-8), T(8)); // We limit the input part...
+    T output = Kp * error + (Kd * Kd_setPoint - Kd * (input - inputOld)) / DT;
+    inputOld = input;  // error for Kd is only the input component
+    setPointOld = setPoint;
+    return output;
+  }
+
+private:
+  T inputOld;
+  T setPointOld;
+};
+
+// PI controller implementation (Proportional, integral). DT in seconds
+// The error sum is limited to +-iTermMax, adding at most +-iTermMaxError per call (anti windup)
+template <typename T>
+class SpeedPI
+{
+public:
+  SpeedPI(int16_t iTermMaxError, int16_t iTermMax) : iTermMaxError(iTermMaxError), iTermMax(iTermMax) { reset(); }
+
+  void reset() { errorSum = 0; }
+  int16_t getErrorSum() const { return errorSum; }
+  void preset(int16_t sum) { errorSum = sum; }
+
+  T compute(T DT, int16_t input, int16_t setPoint, T Kp, T Ki)
+  {
+    int16_t error = setPoint - input;
+
+    errorSum += CONTROL_CONSTRAIN(error, -iTermMaxError, iTermMaxError);
+    errorSum = CONTROL_CONSTRAIN(errorSum, -iTermMax, iTermMax);
+
+    return Kp * T(error) + Ki * T(errorSum) * DT;
+  }
+
+private:
+  int16_t iTermMaxError;
+  int16_t iTermMax;
+  int16_t errorSum;  // the error is an integer, so the sum is kept exact
+};
+
+// P controller on position with speed damping, the P part limited to +-pMax. No state
+template <typename T>
+T positionPD(long actualPos, long setPointPos, T Kpp, T Kdp, int16_t speedM, T pMax)
+{
+  // Limit the error before the conversion so it fits any T (32767 steps is well beyond the P limit)
+  long error = CONTROL_CONSTRAIN(setPointPos - actualPos, -32767L, 32767L);
+  T P = CONTROL_CONSTRAIN(Kpp * T(error), -pMax, pMax); // Limit command
+  return P + Kdp * T(speedM);
+}
+
+#endif /* CONTROLLAWS_H_ */
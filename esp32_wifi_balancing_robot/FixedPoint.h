@@ -0,0 +1,82 @@
+/*
+ * FixedPoint.h
+ *
+ *  Q16.16 fixed point number for the control laws on cores without FPU.
+ *  Range is +-32768 with a resolution of 1/65536. Conversions, products and
+ *  quotients saturate at the range limits, sums wrap. Results are the same on
+ *  every target (integer arithmetic only), so they can be checked on the host
+ *  (sim/fixedpoint_test).
+ *
+ *  Created on: 17.10.2026
+ *      Author: anonymous
+ */
+
+#ifndef FIXEDPOINT_H_
+#define FIXEDPOINT_H_
+
+#include <stdint.h>
+
+class Q16_16
+{
+public:
+  int32_t raw;
+
+  Q16_16() : raw(0) {}
+  // Conversions saturate at the range limits like the products do
+  Q16_16(int v) : raw(fromInteger(v)) {}
+  Q16_16(long v) : raw(fromInteger(v)) {}
+  Q16_16(float v) : raw(fromReal(v)) {}
+  Q16_16(double v) : raw(fromReal(v)) {}
+
+  static Q16_16 fromRaw(int32_t r) { Q16_16 q; q.raw = r; return q; }
+  static Q16_16 saturate(int64_t r) { return fromRaw(r > INT32_MAX ? INT32_MAX : (r < INT32_MIN ? INT32_MIN : (int32_t)r)); }
+  // Two's complement wrap without signed overflow
+  static Q16_16 wrap(uint32_t r) { return fromRaw(r <= INT32_MAX ? (int32_t)r : (int32_t)(r - 0x80000000u) + INT32_MIN); }
+
+  explicit operator float() const { return raw * (1.0f / 65536.0f); }
+  explicit operator int32_t() const { return raw >> 16; }  // rounds toward -infinity
+
+  Q16_16 operator-() const { return wrap(0u - (uint32_t)raw); }
+  Q16_16 operator+(Q16_16 b) const { return wrap((uint32_t)raw + (uint32_t)b.raw); }
+  Q16_16 operator-(Q16_16 b) const { return wrap((uint32_t)raw - (uint32_t)b.raw); }
+  Q16_16 operator*(Q16_16 b) const { return saturate(((int64_t)raw * b.raw) >> 16); }
+  Q16_16 operator/(Q16_16 b) const { return b.raw ? saturate((int64_t)raw * 65536 / b.raw) : saturate(raw >= 0 ? INT64_MAX : INT64_MIN); }
+  Q16_16 &operator+=(Q16_16 b) { return *this = *this + b; }
+  Q16_16 &operator-=(Q16_16 b) { return *this = *this - b; }
+  Q16_16 &operator*=(Q16_16 b) { return *this = *this * b; }
+
+  bool operator<(Q16_16 b) const { return raw < b.raw; }
+  bool operator>(Q16_16 b) const { return raw > b.raw; }
+  bool operator<=(Q16_16 b) const { return raw <= b.raw; }
+  bool operator>=(Q16_16 b) const { return raw >= b.raw; }
+  bool operator==(Q16_16 b) const { return raw == b.raw; }
+  bool operator!=(Q16_16 b) const { return raw != b.raw; }
+
+private:
+  static int32_t fromInteger(long v)
+  {
+    if (v > 32767)
+      return INT32_MAX;
+    if (v < -32768)
+      return INT32_MIN;
+    return (int32_t)(v * 65536L);
+  }
+
+  // Rounds to nearest, halves away from zero. Scaling by a power of two is
+  // exact, so the rounding is done on the integer of twice the raw value.
+  template <typename T>
+  static int32_t fromReal(T v)
+  {
+    T r = v * (T)131072;
+    if (r >= (T)8589934592.0)
+      return INT32_MAX;
+    if (r <= (T)-8589934592.0)
+      return INT32_MIN;
+    if (r != r)
+      return 0;  // NaN
+    int64_t twice = (int64_t)r;
+    return saturate(twice >= 0 ? (twice + 1) / 2 : (twice - 1) / 2).raw;
+  }
+};
+
+#endif /* FIXEDPOINT_H_ */
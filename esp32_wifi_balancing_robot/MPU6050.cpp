@@ -201,6 +201,72 @@ void MPU6050_read_1axis()
   Serial.println(accel_t_gyro.value.x_gyro, DEC);
 }
 
+// FIFO mode: the sensor stores its samples in the 1024 bytes FIFO and we read them in bursts,
+// so no sample is lost if loop() is late (up to 73 samples, 365ms at 200Hz) and the I2C cost is shared by the burst.
+// sample_rate_div: Sample Rate = 1000 / (1 + sample_rate_div) Hz with the DLPF on, dlpf: MPU6050_DLPF_xxHZ
+void MPU6050_fifo_setup(uint8_t sample_rate_div, uint8_t dlpf)
+{
+  MPU6050_write_reg(MPU6050_CONFIG, dlpf);
+  MPU6050_write_reg(MPU6050_SMPLRT_DIV, sample_rate_div);
+  // Same layout as the data registers, so a sample is an accel_t_gyro_union
+  MPU6050_write_reg(MPU6050_FIFO_EN, bit(MPU6050_ACCEL_FIFO_EN) | bit(MPU6050_TEMP_FIFO_EN) |
+                    bit(MPU6050_XG_FIFO_EN) | bit(MPU6050_YG_FIFO_EN) | bit(MPU6050_ZG_FIFO_EN));
+  MPU6050_fifo_reset();
+}
+
+void MPU6050_fifo_reset()
+{
+  MPU6050_write_reg(MPU6050_USER_CTRL, bit(MPU6050_FIFO_RESET));
+  MPU6050_write_reg(MPU6050_USER_CTRL, bit(MPU6050_USER_FIFO_EN));
+}
+
+// Big endian to host: swap the bytes of the 16 bit values, two values per 32 bit word
+static void MPU6050_swap_samples(accel_t_gyro_union *samples, int n)
+{
+  uint8_t *p = (uint8_t *) samples;
+  int words = n * sizeof(accel_t_gyro_union) / 4;
+  uint32_t w;
+
+  for (int i = 0; i < words; i++, p += 4) {
+    memcpy(&w, p, 4);   // samples are only 2 bytes aligned
+    w = ((w & 0x00ff00ff) << 8) | ((w >> 8) & 0x00ff00ff);
+    memcpy(p, &w, 4);
+  }
+  if (n & 1) {  // 14 bytes samples: an odd count leaves one value
+    SWAP (p[0], p[1]);
+  }
+}
+
+// Read up to max_samples from the FIFO, oldest first. Return the number of samples read or a negative error.
+// On overflow the FIFO is reset and -12 returned: samples were lost.
+int MPU6050_fifo_read(accel_t_gyro_union *samples, int max_samples)
+{
+  uint8_t count_hl[2];
+  int error, count, n, burst;
+
+  error = MPU6050_read(MPU6050_FIFO_COUNTH, count_hl, 2);
+  if (error != 0)
+    return (error);
+  count = (count_hl[0] << 8) | count_hl[1];
+  // A full FIFO drops the oldest bytes, so we can no longer tell where a sample starts
+  if (count > MPU6050_FIFO_SIZE - (int) sizeof(accel_t_gyro_union)) {
+    MPU6050_fifo_reset();
+    return (-12);
+  }
+
+  n = count / sizeof(accel_t_gyro_union);
+  if (n > max_samples)
+    n = max_samples;
+  for (int i = 0; i < n; i += burst) {
+    burst = min(n - i, MPU6050_FIFO_BURST);
+    error = MPU6050_read(MPU6050_FIFO_R_W, (uint8_t *) &samples[i], burst * sizeof(accel_t_gyro_union));
+    if (error != 0)
+      return (error);
+  }
+  MPU6050_swap_samples(samples, n);
+  return (n);
+}
+
 // return true on new data available
 bool MPU6050_newData()
 {
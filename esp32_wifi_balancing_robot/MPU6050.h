@@ -360,7 +360,7 @@
 #define MPU6050_FIFO_RESET     MPU6050_D2
 #define MPU6050_I2C_IF_DIS     MPU6050_D4   // must be 0 for MPU-6050
 #define MPU6050_I2C_MST_EN     MPU6050_D5
-#define MPU6050_FIFO_EN        MPU6050_D6
+#define MPU6050_USER_FIFO_EN   MPU6050_D6   // named apart from the FIFO_EN register
 
 // PWR_MGMT_1 Register
 // These are the names for the bits.
@@ -421,6 +421,10 @@
 // Default I2C address for the MPU-6050 is 0x68.
 #define MPU6050_I2C_ADDRESS 0x68
 
+// FIFO mode: every sample is stored as the 14 bytes of accel_t_gyro_union (accels, temp, gyros)
+#define MPU6050_FIFO_SIZE  1024
+#define MPU6050_FIFO_BURST 9      // samples per I2C read (9 * 14 bytes fit the 128 bytes Wire buffer)
+
 
 // Declaring an union for the registers and the axis values.
 // The byte order does not match the byte order of
@@ -462,6 +466,10 @@ typedef union accel_t_gyro_union
   } value;
 };
 
+extern accel_t_gyro_union accel_t_gyro;  // last sample, input of MPU6050_getAngle()
+extern float x_gyro_offset;               // MPU6050_getAngle() state
+extern float angle;
+
 void MPU6050_read_1axis();
 void MPU6050_read_3axis();
 void MPU6050_setup();
@@ -471,5 +479,8 @@ bool MPU6050_newData();
 int MPU6050_read(int start, uint8_t *buffer, int size);
 int MPU6050_write(int start, const uint8_t *pData, int size);
 int MPU6050_write_reg(int reg, uint8_t data);
+void MPU6050_fifo_setup(uint8_t sample_rate_div, uint8_t dlpf);
+void MPU6050_fifo_reset();
+int MPU6050_fifo_read(accel_t_gyro_union *samples, int max_samples);
 
 #endif /* MPU6050_H_ */
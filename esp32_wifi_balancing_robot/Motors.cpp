@@ -8,13 +8,104 @@
 #include <Arduino.h>
 #include "defines.h"
 #include "globals.h"
+#include "freertos/FreeRTOS.h"
+
+#if MICROSTEPPING==16
+#define STEPS_PER_SPEED 50 // Adjust factor from control output speed to real motor speed in steps/second
+#else
+#define STEPS_PER_SPEED 25 // 1/8 Microstepping
+#endif
+
+// Step timer period (STEP_TIMER_HZ ticks) for each motor speed, so a control tick needs no division
+static uint32_t motor_period[MAX_CONTROL_OUTPUT + 1];
+// Direction the step timers run with (kept while stopped)
+static int8_t phase_dir_M1, phase_dir_M2;
+static uint16_t stop_phase_M1, stop_phase_M2;
+
+// Spinlocks of the step timer ISRs (Timers.cpp)
+extern "C" portMUX_TYPE muxer1, muxer2;
+
+// The fastest step must leave the pin low as long as the STEP pulse
+static_assert(STEP_TIMER_HZ / (MAX_CONTROL_OUTPUT * STEPS_PER_SPEED) >= 2 * STEP_PULSE_TICKS, "STEP pulse too long for the top speed");
+
+void initMotors()
+{
+  motor_period[0] = ZERO_SPEED;
+  for (int i = 1; i <= MAX_CONTROL_OUTPUT; i++)
+  {
+    motor_period[i] = (STEP_TIMER_HZ + i * STEPS_PER_SPEED / 2) / (i * STEPS_PER_SPEED);  // rounded
+    if (motor_period[i] > ZERO_SPEED)   // Check for minimun speed (maximun period without overflow)
+      motor_period[i] = ZERO_SPEED;
+  }
+}
+
+static uint32_t speedPeriod(int16_t speed)
+{
+  if (speed < 0)
+    speed = -speed;
+  if (speed > MAX_CONTROL_OUTPUT)
+    speed = MAX_CONTROL_OUTPUT;
+  return motor_period[speed];
+}
+
+// Change the period of a running step timer keeping its phase: the fraction of the step already done
+// is kept (or what is left of it, on a change of direction), so the next step comes when the new speed
+// says and not a whole new period later or immediately. While stopped the phase is kept in stop_phase,
+// the timer would lose it when the ZERO_SPEED period ends.
+// Only the alarm is moved, never the count, under the spinlock of the ISR: an alarm that comes
+// meanwhile runs its ISR right after, with the new period, so no step is lost or made twice
+static void setTimerPeriod(hw_timer_t *timer, portMUX_TYPE *mux, volatile StepState *step, uint32_t new_period, bool reverse,
+                           uint16_t *stop_phase)
+{
+  uint64_t count, done, left;
+  uint32_t phase;   // fraction of the step done, in 1/65536
+
+  portENTER_CRITICAL(mux);
+  count = timerRead(timer);   // since the last edge of the STEP pulse
+  if (step->period == ZERO_SPEED)
+    phase = *stop_phase;
+  else
+  {
+    done = step->high ? count : count + STEP_PULSE_TICKS;
+    if (done > step->period)
+      done = step->period;
+    phase = (done << 16) / step->period;
+  }
+  if (reverse)
+    phase = 65536 - phase;
+
+  if (new_period == ZERO_SPEED)
+  {
+    *stop_phase = phase > 65535 ? 65535 : phase;
+    left = ZERO_SPEED;
+  }
+  else
+  {
+    done = ((uint64_t)phase * new_period) >> 16;
+    if (done >= new_period)   // step due now
+      done = new_period - 1;
+    left = new_period - done;
+  }
+  // Keep the pin low at least as long as the pulse, an alarm already passed fires right away
+  if (step->high)
+  {
+    left = left + count > STEP_PULSE_TICKS * 2 ? left + count - STEP_PULSE_TICKS : STEP_PULSE_TICKS;
+    step->low = left < ZERO_SPEED ? left : ZERO_SPEED;
+  }
+  else if (new_period == ZERO_SPEED)
+    timerAlarmWrite(timer, ZERO_SPEED, true);
+  else
+    timerAlarmWrite(timer, count + left > STEP_PULSE_TICKS ? count + left : STEP_PULSE_TICKS, true);
+  step->period = new_period;
+  portEXIT_CRITICAL(mux);
+}
 
 // Set speed of Stepper Motor1
 // tspeed could be positive or negative (reverse)
 void setMotorSpeedM1(int16_t tspeed)
 {
-  long timer_period;
-  int16_t speed;
+  uint32_t timer_period;
+  bool reverse;
 
   // Limit max speed?
 
@@ -26,41 +117,37 @@ void setMotorSpeedM1(int16_t tspeed)
   else
     speed_M1 = tspeed;
 
-#if MICROSTEPPING==16
-  speed = speed_M1 * 50; // Adjust factor from control output speed to real motor speed in steps/second
-#else
-  speed = speed_M1 * 25; // 1/8 Microstepping
-#endif
-
-  if (speed == 0)
+  timer_period = speedPeriod(speed_M1);
+  if (speed_M1 == 0)
   {
-    timer_period = ZERO_SPEED;
     dir_M1 = 0;
   }
-  else if (speed > 0)
+  else if (speed_M1 > 0)
   {
-    timer_period = 2000000 / speed; // 2Mhz timer
+    if (dir_M1 <= 0)
+      digitalWrite(PIN_MOTOR1_DIR, HIGH);
     dir_M1 = 1;
-    digitalWrite(PIN_MOTOR1_DIR, HIGH);
   }
   else
   {
-    timer_period = 2000000 / -speed;
+    if (dir_M1 >= 0)
+      digitalWrite(PIN_MOTOR1_DIR, LOW);
     dir_M1 = -1;
-    digitalWrite(PIN_MOTOR1_DIR, LOW);
   }
-  if (timer_period > ZERO_SPEED)   // Check for minimun speed (maximun period without overflow)
-    timer_period = ZERO_SPEED;
 
-  timerAlarmWrite(timer1, timer_period, true);
+  reverse = dir_M1 != 0 && phase_dir_M1 != 0 && dir_M1 != phase_dir_M1;
+  if (timer_period != step_M1.period || reverse)
+    setTimerPeriod(timer1, &muxer1, &step_M1, timer_period, reverse, &stop_phase_M1);
+  if (dir_M1 != 0)
+    phase_dir_M1 = dir_M1;
 }
 
 // Set speed of Stepper Motor2
 // tspeed could be positive or negative (reverse)
 void setMotorSpeedM2(int16_t tspeed)
 {
-  long timer_period;
-  int16_t speed;
+  uint32_t timer_period;
+  bool reverse;
 
   // Limit max speed?
 
@@ -72,32 +159,28 @@ void setMotorSpeedM2(int16_t tspeed)
   else
     speed_M2 = tspeed;
 
-#if MICROSTEPPING==16
-  speed = speed_M2 * 50; // Adjust factor from control output speed to real motor speed in steps/second
-#else
-  speed = speed_M2 * 25; // 1/8 Microstepping
-#endif
-
-  if (speed == 0)
+  timer_period = speedPeriod(speed_M2);
+  if (speed_M2 == 0)
   {
-    timer_period = ZERO_SPEED;
     dir_M2 = 0;
   }
-  else if (speed > 0)
+  else if (speed_M2 > 0)
   {
-    timer_period = 2000000 / speed; // 2Mhz timer
+    if (dir_M2 <= 0)
+      digitalWrite(PIN_MOTOR2_DIR, LOW);
     dir_M2 = 1;
-    digitalWrite(PIN_MOTOR2_DIR, LOW);
   }
   else
   {
-    timer_period = 2000000 / -speed;
+    if (dir_M2 >= 0)
+      digitalWrite(PIN_MOTOR2_DIR, HIGH);
     dir_M2 = -1;
-    digitalWrite(PIN_MOTOR2_DIR, HIGH);
   }
-  if (timer_period > ZERO_SPEED)   // Check for minimun speed (maximun period without overflow)
-    timer_period = ZERO_SPEED;
 
-  timerAlarmWrite(timer2, timer_period, true);
+  reverse = dir_M2 != 0 && phase_dir_M2 != 0 && dir_M2 != phase_dir_M2;
+  if (timer_period != step_M2.period || reverse)
+    setTimerPeriod(timer2, &muxer2, &step_M2, timer_period, reverse, &stop_phase_M2);
+  if (dir_M2 != 0)
+    phase_dir_M2 = dir_M2;
 }
 
@@ -10,6 +10,7 @@
 
 #include <Arduino.h>
 
+void initMotors();
 void setMotorSpeedM1(int16_t tspeed);
 void setMotorSpeedM2(int16_t tspeed);
 
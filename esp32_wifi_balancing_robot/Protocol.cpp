@@ -0,0 +1,276 @@
+/*
+ * Protocol.cpp
+ *
+ *  Robot side of the binary UDP protocol (Protocol.h).
+ *  Command frames are decoded into the same OSC variables the web remote sets, so processOSCMsg()
+ *  applies them; the telemetry stream goes to the last client that subscribed.
+ *  Everything runs from loop(): no String, no heap, one datagram per command.
+ *
+ *  Created on: 18.10.2026
+ *      Author: anonymous
+ */
+
+#include <Arduino.h>
+#include <WiFiUdp.h>
+#include "defines.h"
+#include "globals.h"
+#include "Protocol.h"
+#include "Trace.h"
+
+static WiFiUDP udp;
+static IPAddress client_ip;              // sender of the last valid frame, the sequence is tracked per sender
+static uint16_t client_port;
+static uint16_t client_seq;
+static bool client_valid;
+
+static IPAddress telemetry_ip;
+static uint16_t telemetry_port;
+static uint16_t telemetry_period;        // ms, 0: no stream
+static uint16_t telemetry_seq;
+static unsigned long telemetry_last;
+
+static IPAddress trace_ip;
+static uint16_t trace_port;
+static uint16_t trace_seq;
+static unsigned long trace_last;         // ms, last TRACE frame
+
+static unsigned long drive_last;         // ms, last DRIVE frame
+static bool drive_active;                // throttle/steering set by a DRIVE frame, subject to the timeout
+static unsigned long beep_start;
+static bool beeping;
+static unsigned long loop_last;          // us
+static unsigned long loop_max;
+static uint16_t frames_received, frames_dropped;
+
+void protocolBegin()
+{
+  udp.begin(PROTO_PORT);
+  loop_last = micros();
+}
+
+static float faderValue(int16_t value)
+{
+  value = constrain(value, -PROTO_FADER_MAX, PROTO_FADER_MAX);
+  return 0.5 + value * (0.5 / PROTO_FADER_MAX);
+}
+
+static float gainValue(uint16_t value)
+{
+  return value * (1.0 / PROTO_GAIN_MAX);
+}
+
+// Decode one datagram. Return false for a malformed or stale frame
+static bool protocolDecode(const uint8_t *frame, int length)
+{
+  ProtoHeader h;
+
+  if (length < (int)sizeof(h))
+    return false;
+  memcpy(&h, frame, sizeof(h));
+  if (h.magic != PROTO_MAGIC)
+    return false;
+  if (client_valid && udp.remoteIP() == client_ip && udp.remotePort() == client_port && (int16_t)(h.seq - client_seq) <= 0)
+    return false;   // duplicated or reordered datagram, a newer command was applied
+
+  switch (h.type) {
+    case PROTO_DRIVE: {
+      ProtoDrive f;
+      if (length != sizeof(f))
+        return false;
+      memcpy(&f, frame, sizeof(f));
+      OSCpage = 1;
+      modifing_control_parameters = false;   // the frame sets all of page 1: no reset when coming from the settings
+      OSCfader[0] = faderValue(f.throttle);
+      OSCfader[1] = faderValue(f.steering);
+      OSCtoggle[0] = (f.flags & PROTO_DRIVE_PRO) ? 1 : 0;
+      OSCpush[0] = (f.flags & PROTO_DRIVE_SERVO) ? 1 : 0;
+      OSCnewMessage = 1;
+      drive_last = millis();
+      drive_active = true;
+      break;
+    }
+    case PROTO_MOVE: {
+      ProtoMove f;
+      if (length != sizeof(f))
+        return false;
+      memcpy(&f, frame, sizeof(f));
+      OSCpage = 1;
+      OSCmove_mode = 1;
+      OSCmove_speed = f.speed;
+      OSCmove_steps1 = f.steps1;
+      OSCmove_steps2 = f.steps2;
+      OSCnewMessage = 1;
+      break;
+    }
+    case PROTO_TUNE: {
+      ProtoTune f;
+      if (length != sizeof(f))
+        return false;
+      memcpy(&f, frame, sizeof(f));
+      OSCpage = 2;
+      modifing_control_parameters = true;    // the frame sets all of page 2: no reset of the gains and sleep it carries
+      OSCfader[0] = gainValue(f.kp);
+      OSCfader[1] = gainValue(f.kd);
+      OSCfader[2] = gainValue(f.kp_throttle);
+      OSCfader[3] = gainValue(f.ki_throttle);
+      OSCpush[2] = (f.flags & PROTO_TUNE_CALIBRATE) ? 1 : 0;
+      OSCtoggle[0] = (f.flags & PROTO_TUNE_SLEEP) ? 1 : 0;
+      OSCnewMessage = 1;
+      drive_active = false;
+      break;
+    }
+    case PROTO_AUX: {
+      ProtoAux f;
+      if (length != sizeof(f))
+        return false;
+      memcpy(&f, frame, sizeof(f));
+      digitalWrite(PIN_LED, (f.flags & PROTO_AUX_LED) ? HIGH : LOW);
+      if ((f.flags & PROTO_AUX_BEEP) && !beeping) {
+        beeping = true;
+        beep_start = millis();
+      }
+      break;
+    }
+    case PROTO_SUBSCRIBE: {
+      ProtoSubscribe f;
+      if (length != sizeof(f))
+        return false;
+      memcpy(&f, frame, sizeof(f));
+      telemetry_ip = udp.remoteIP();
+      telemetry_port = udp.remotePort();
+      telemetry_period = f.period;
+      if (telemetry_period != 0 && telemetry_period < PROTO_TELEMETRY_MIN_PERIOD)
+        telemetry_period = PROTO_TELEMETRY_MIN_PERIOD;
+      telemetry_last = millis() - telemetry_period;   // first frame right away
+      break;
+    }
+    case PROTO_RECORD: {
+      ProtoRecord f;
+      if (length != sizeof(f))
+        return false;
+      memcpy(&f, frame, sizeof(f));
+      if (f.enable) {
+        trace_ip = udp.remoteIP();
+        trace_port = udp.remotePort();
+        trace_last = millis();
+        traceStart();
+      } else {
+        traceStop();
+      }
+      break;
+    }
+    default:
+      return false;
+  }
+
+  client_ip = udp.remoteIP();
+  client_port = udp.remotePort();
+  client_seq = h.seq;
+  client_valid = true;
+  return true;
+}
+
+static void protocolTelemetry()
+{
+  ProtoTelemetry f;
+
+  f.h.magic = PROTO_MAGIC;
+  f.h.type = PROTO_TELEMETRY;
+  f.h.seq = telemetry_seq++;
+  f.time = millis();
+  f.angle = angle_adjusted;
+  f.target_angle = target_angle;
+  f.estimated_speed = estimated_speed_filtered;
+  f.speed_M1 = speed_M1;
+  f.speed_M2 = speed_M2;
+  f.steps1 = steps1;
+  f.steps2 = steps2;
+  f.control_period = min(dt * 1000000.0 + 0.5, 65535.0);
+  f.loop_max = min(loop_max, 65535UL);
+  f.frames_received = frames_received;
+  f.frames_dropped = frames_dropped;
+  f.flags = 0;
+  if (mode == 1)
+    f.flags |= PROTO_TELEMETRY_PRO;
+  if (positionControlMode)
+    f.flags |= PROTO_TELEMETRY_POSITION;
+  if (digitalRead(PIN_ENABLE_MOTORS) == LOW)
+    f.flags |= PROTO_TELEMETRY_MOTORS;
+
+  udp.beginPacket(telemetry_ip, telemetry_port);
+  udp.write((const uint8_t *)&f, sizeof(f));
+  udp.endPacket();
+  loop_max = 0;
+}
+
+// Send the recorded trace in frames of PROTO_TRACE_DATA bytes, or what there is every PROTO_TRACE_PERIOD.
+// Whole records only, so the client can append the frames to a file as they come
+static void protocolTrace(unsigned long now)
+{
+  ProtoTrace f;
+  uint16_t length;
+
+  while (true) {
+    if (now - trace_last < PROTO_TRACE_PERIOD && traceRecording() && traceAvailable() < PROTO_TRACE_DATA - sizeof(TraceState))
+      return;
+    length = traceRead(f.data, sizeof(f.data));
+    if (length == 0)
+      return;
+    f.h.magic = PROTO_MAGIC;
+    f.h.type = PROTO_TRACE;
+    f.h.seq = trace_seq++;
+    f.flags = traceFlags();
+    udp.beginPacket(trace_ip, trace_port);
+    udp.write((const uint8_t *)&f, sizeof(f) - sizeof(f.data) + length);
+    udp.endPacket();
+    trace_last = now;
+  }
+}
+
+// Call from loop(): decode the pending datagrams, run the drive timeout and the beep, stream telemetry
+void protocolHandle()
+{
+  uint8_t frame[PROTO_MAX_FRAME];
+  unsigned long now_us = micros();
+  unsigned long now;
+  int length;
+
+  if (now_us - loop_last > loop_max)
+    loop_max = now_us - loop_last;
+  loop_last = now_us;
+
+  while ((length = udp.parsePacket()) > 0) {
+    if (length <= (int)sizeof(frame) && udp.read(frame, length) == length && protocolDecode(frame, length))
+      frames_received++;
+    else
+      frames_dropped++;
+  }
+
+  now = millis();
+  // Lost link: stop driving instead of keeping the last throttle
+  if (drive_active && now - drive_last > PROTO_DRIVE_TIMEOUT) {
+    drive_active = false;
+    if (OSCpage == 1 && !OSCmove_mode) {
+      OSCfader[0] = 0.5;
+      OSCfader[1] = 0.5;
+      OSCnewMessage = 1;
+    }
+  }
+
+  // Two 150ms beeps like the web remote, without blocking the control loop
+  if (beeping) {
+    unsigned long t = now - beep_start;
+    digitalWrite(PIN_BUZZER, (t < 150 || (t >= 230 && t < 380)) ? HIGH : LOW);
+    if (t >= 460)
+      beeping = false;
+  }
+
+  if (telemetry_period != 0 && now - telemetry_last >= telemetry_period) {
+    telemetry_last += telemetry_period;
+    if (now - telemetry_last >= telemetry_period)   // late (stall): do not send a burst
+      telemetry_last = now;
+    protocolTelemetry();
+  }
+
+  protocolTrace(now);
+}
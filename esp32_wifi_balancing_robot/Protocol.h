@@ -0,0 +1,144 @@
+/*
+ * Protocol.h
+ *
+ *  Binary UDP control/telemetry protocol (PROTO_PORT).
+ *  One fixed layout frame per datagram, little endian on both ends (ESP32, x86/ARM hosts).
+ *  This header only describes the frames: it is shared with the Linux client (client/).
+ *
+ *  Created on: 18.10.2026
+ *      Author: anonymous
+ */
+
+#ifndef PROTOCOL_H_
+#define PROTOCOL_H_
+
+#include <stdint.h>
+
+#define PROTO_PORT 2222
+#define PROTO_MAGIC 0xB7     // protocol version 1, changes with every incompatible change of the frames
+
+// Frame types
+#define PROTO_DRIVE 1       // client -> robot: throttle/steering (page 1 of the remote)
+#define PROTO_MOVE 2        // client -> robot: position control move
+#define PROTO_TUNE 3        // client -> robot: control gains (page 2 of the remote)
+#define PROTO_AUX 4         // client -> robot: led state, beep
+#define PROTO_SUBSCRIBE 5   // client -> robot: start/stop the telemetry stream to the sender
+#define PROTO_TELEMETRY 6   // robot -> client
+#define PROTO_RECORD 7      // client -> robot: start/stop the IMU trace recording (Trace.h) to the sender
+#define PROTO_TRACE 8       // robot -> client: trace records
+
+// Flags
+#define PROTO_DRIVE_PRO 0x01        // PRO mode (OSCtoggle[0])
+#define PROTO_DRIVE_SERVO 0x02      // servo arm up (OSCpush[0])
+#define PROTO_TUNE_CALIBRATE 0x01   // take the current angle as the balance offset (OSCpush[2])
+#define PROTO_TUNE_SLEEP 0x02       // disable the motors (OSCtoggle[0] on page 2)
+#define PROTO_AUX_LED 0x01
+#define PROTO_AUX_BEEP 0x02
+#define PROTO_TELEMETRY_PRO 0x01
+#define PROTO_TELEMETRY_POSITION 0x02   // position control mode
+#define PROTO_TELEMETRY_MOTORS 0x04     // motors enabled
+
+#define PROTO_FADER_MAX 32767        // DRIVE values: -PROTO_FADER_MAX..PROTO_FADER_MAX, 0 is neutral
+#define PROTO_GAIN_MAX 65535         // TUNE values: 0..PROTO_GAIN_MAX is 0..2x the default gain
+#define PROTO_DRIVE_TIMEOUT 500      // ms without DRIVE frame before throttle/steering go neutral
+#define PROTO_TELEMETRY_MIN_PERIOD 5 // ms, 200Hz
+#define PROTO_TRACE_DATA 1024        // max bytes of records in a TRACE frame
+#define PROTO_TRACE_PERIOD 50        // ms, max time records wait in the robot buffer before being sent
+
+#define PROTO_PACKED __attribute__((packed))
+
+struct PROTO_PACKED ProtoHeader
+{
+  uint8_t magic;      // PROTO_MAGIC
+  uint8_t type;       // PROTO_xxx frame type
+  uint16_t seq;       // per sender, frames older than the last one applied are dropped
+};
+
+struct PROTO_PACKED ProtoDrive
+{
+  ProtoHeader h;
+  int16_t throttle;   // forward +
+  int16_t steering;   // right +
+  uint8_t flags;      // PROTO_DRIVE_xxx
+};
+
+struct PROTO_PACKED ProtoMove
+{
+  ProtoHeader h;
+  int16_t speed;
+  int16_t steps1;     // relative to the current position
+  int16_t steps2;
+};
+
+struct PROTO_PACKED ProtoTune
+{
+  ProtoHeader h;
+  uint16_t kp;        // stability P, D, speed P, I
+  uint16_t kd;
+  uint16_t kp_throttle;
+  uint16_t ki_throttle;
+  uint8_t flags;      // PROTO_TUNE_xxx
+};
+
+struct PROTO_PACKED ProtoAux
+{
+  ProtoHeader h;
+  uint8_t flags;      // PROTO_AUX_xxx
+};
+
+struct PROTO_PACKED ProtoSubscribe
+{
+  ProtoHeader h;
+  uint16_t period;    // ms between telemetry frames, 0 stops the stream
+};
+
+struct PROTO_PACKED ProtoTelemetry
+{
+  ProtoHeader h;
+  uint32_t time;               // ms, robot clock
+  float angle;                 // deg, angle_adjusted
+  float target_angle;          // deg
+  float estimated_speed;       // estimated_speed_filtered
+  int16_t speed_M1;            // motor speeds (control units)
+  int16_t speed_M2;
+  int32_t steps1;
+  int32_t steps2;
+  uint16_t control_period;     // us, dt of the last control update
+  uint16_t loop_max;           // us, longest loop() iteration since the previous frame
+  uint16_t frames_received;    // valid command frames received so far (wraps)
+  uint16_t frames_dropped;     // invalid or stale frames (wraps)
+  uint8_t flags;               // PROTO_TELEMETRY_xxx
+};
+
+struct PROTO_PACKED ProtoRecord
+{
+  ProtoHeader h;
+  uint8_t enable;     // 1: start a new recording, 0: stop
+};
+
+struct PROTO_PACKED ProtoTrace
+{
+  ProtoHeader h;               // seq: per frame, a gap is a lost part of the trace
+  uint8_t flags;               // TraceFileHeader.flags of the recording firmware
+  uint8_t data[PROTO_TRACE_DATA];   // whole records, the datagram is cut after the last one
+};
+
+#define PROTO_MAX_FRAME sizeof(ProtoTune)   // largest command frame received by the robot
+
+// Robot side (Protocol.cpp)
+void protocolBegin();
+void protocolHandle();
+
+static_assert(sizeof(ProtoHeader) == 4, "ProtoHeader layout");
+static_assert(sizeof(ProtoDrive) == 9, "ProtoDrive layout");
+static_assert(sizeof(ProtoMove) == 10, "ProtoMove layout");
+static_assert(sizeof(ProtoTune) == 13, "ProtoTune layout");
+static_assert(sizeof(ProtoAux) == 5, "ProtoAux layout");
+static_assert(sizeof(ProtoSubscribe) == 6, "ProtoSubscribe layout");
+static_assert(sizeof(ProtoTelemetry) == 41, "ProtoTelemetry layout");
+static_assert(sizeof(ProtoRecord) == 5, "ProtoRecord layout");
+static_assert(sizeof(ProtoTrace) == 5 + PROTO_TRACE_DATA, "ProtoTrace layout");
+static_assert(sizeof(ProtoDrive) <= PROTO_MAX_FRAME && sizeof(ProtoMove) <= PROTO_MAX_FRAME && sizeof(ProtoAux) <= PROTO_MAX_FRAME
+              && sizeof(ProtoSubscribe) <= PROTO_MAX_FRAME && sizeof(ProtoRecord) <= PROTO_MAX_FRAME, "PROTO_MAX_FRAME");
+
+#endif /* PROTOCOL_H_ */
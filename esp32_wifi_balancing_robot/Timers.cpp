@@ -16,54 +16,57 @@
 #include "driver/periph_ctrl.h"
 #include "driver/timer.h"
 #include "esp32-hal-timer.h"
+#include "soc/soc.h"
+#include "soc/gpio_reg.h"
+#include "Motors.h"
+
+#if PIN_MOTOR1_STEP > 31 || PIN_MOTOR2_STEP > 31
+#error The STEP pins must be GPIO0-31 (GPIO_OUT_W1TS_REG/W1TC_REG)
+#endif
+
+// STEP pulse by direct GPIO register writes, without the pin lookups of digitalWrite().
+// The step timer alarm makes both edges and the ISR never waits: a step raises the pin and sets the
+// alarm STEP_PULSE_TICKS later, that alarm lowers it and sets the alarm for the rest of the period.
+// All under the spinlock setMotorSpeedM1/M2() take to change the period
+#define STEP_EDGE(pin, timer, mux, dir, count, step) do { \
+    portENTER_CRITICAL_ISR(mux); \
+    if ((step).high) { \
+      REG_WRITE(GPIO_OUT_W1TC_REG, 1 << (pin)); \
+      (step).high = false; \
+      timerAlarmWrite(timer, (step).low, true); \
+    } else if (dir != 0) { \
+      REG_WRITE(GPIO_OUT_W1TS_REG, 1 << (pin)); \
+      count -= dir; \
+      (step).high = true; \
+      (step).low = (step).period - STEP_PULSE_TICKS; \
+      timerAlarmWrite(timer, STEP_PULSE_TICKS, true); \
+    } \
+    portEXIT_CRITICAL_ISR(mux); \
+  } while (0)
 
 extern "C" {
 
 portMUX_TYPE muxer1 = portMUX_INITIALIZER_UNLOCKED;
 portMUX_TYPE muxer2 = portMUX_INITIALIZER_UNLOCKED;
 
+// The step timers run from the period set by setMotorSpeedM1/M2(), the ISRs only make the pulse edges
 void IRAM_ATTR timer1ISR() {
-	portENTER_CRITICAL_ISR(&muxer1);
-
-	if (dir_M1 != 0) {
-		// We generate 1us STEP pulse
-		digitalWrite(PIN_MOTOR1_STEP, HIGH);
-
-		if (dir_M1 > 0)
-			steps1--;
-		else
-			steps1++;
-
-		digitalWrite(PIN_MOTOR1_STEP, LOW);
-	}
-
-	portEXIT_CRITICAL_ISR(&muxer1);
+	STEP_EDGE(PIN_MOTOR1_STEP, timer1, &muxer1, dir_M1, steps1, step_M1);
 }
 void IRAM_ATTR timer2ISR() {
-	portENTER_CRITICAL_ISR(&muxer2);
-
-	if (dir_M2 != 0) {
-		// We generate 1us STEP pulse
-		digitalWrite(PIN_MOTOR2_STEP, HIGH);
-
-		if (dir_M2 > 0)
-			steps2--;
-		else
-			steps2++;
-
-		digitalWrite(PIN_MOTOR2_STEP, LOW);
-	}
-	portEXIT_CRITICAL_ISR(&muxer2);
+	STEP_EDGE(PIN_MOTOR2_STEP, timer2, &muxer2, dir_M2, steps2, step_M2);
 }
 }
 
 void initTimers() {
 
-	timer1 = timerBegin(0, 40, true);
+	initMotors();  // period table of the step timers
+
+	timer1 = timerBegin(0, STEP_TIMER_DIVIDER, true);
 	timerAttachInterrupt(timer1, &timer1ISR, true);
 	timerAlarmWrite(timer1, ZERO_SPEED, true);
 
-	timer2 = timerBegin(1, 40, true);
+	timer2 = timerBegin(1, STEP_TIMER_DIVIDER, true);
 	timerAttachInterrupt(timer2, &timer2ISR, true);
 	timerAlarmWrite(timer2, ZERO_SPEED, true);
 
@@ -0,0 +1,181 @@
+/*
+ * Trace.cpp
+ *
+ *  IMU trace recorder (Trace.h).
+ *  Records are appended to a RAM ring buffer by the control loop and drained by the protocol (or the
+ *  simulator) with traceRead(). Both run from loop(), so there is no locking. When the buffer is full
+ *  the new records are dropped and counted, and a TRACE_LOST record marks the gap.
+ *
+ *  Created on: 18.10.2026
+ *      Author: anonymous
+ */
+
+#include <Arduino.h>
+#include "defines.h"
+#include "globals.h"
+#include "MPU6050.h"
+#include "Trace.h"
+
+static uint8_t trace_buffer[TRACE_BUFFER_SIZE];
+static uint16_t trace_head, trace_count;
+static uint16_t trace_lost;
+static bool trace_on;
+static bool trace_armed;
+
+static void tracePut(const void *record, uint8_t size)
+{
+  const uint8_t *data = (const uint8_t *)record;
+  uint16_t tail;
+
+  if (trace_lost) {
+    if (trace_count + sizeof(TraceLost) + size > TRACE_BUFFER_SIZE) {
+      if (trace_lost < 0xffff)
+        trace_lost++;
+      return;
+    }
+    TraceLost lost = { TRACE_LOST, trace_lost };
+    trace_lost = 0;
+    tracePut(&lost, sizeof(lost));
+  }
+  if (trace_count + size > TRACE_BUFFER_SIZE) {
+    trace_lost = 1;
+    return;
+  }
+
+  tail = trace_head + trace_count;
+  if (tail >= TRACE_BUFFER_SIZE)
+    tail -= TRACE_BUFFER_SIZE;
+  for (uint8_t i = 0; i < size; i++) {
+    trace_buffer[tail++] = data[i];
+    if (tail == TRACE_BUFFER_SIZE)
+      tail = 0;
+  }
+  trace_count += size;
+}
+
+// The buffer restarts with the controller state after a control update, so a replay can resume from there
+static void traceBegin(uint32_t time)
+{
+  TraceState s;
+
+  trace_head = 0;
+  trace_count = 0;
+  trace_lost = 0;
+  trace_on = true;
+  trace_armed = false;
+
+  s.type = TRACE_STATE;
+  s.time = time;
+  s.timer_old = timer_old;
+  s.angle = angle;
+  s.x_gyro_offset = x_gyro_offset;
+  s.angle_adjusted = angle_adjusted;
+  s.angle_adjusted_filtered = angle_adjusted_filtered;
+  s.estimated_speed_filtered = estimated_speed_filtered;
+  s.control_output = control_output;
+  s.target_angle = target_angle;
+  s.angle_offset = angle_offset;
+  s.Kp = Kp;
+  s.Kd = Kd;
+  s.Kp_thr = Kp_thr;
+  s.Ki_thr = Ki_thr;
+  s.Kp_user = Kp_user;
+  s.Kd_user = Kd_user;
+  s.Kp_thr_user = Kp_thr_user;
+  s.Ki_thr_user = Ki_thr_user;
+  s.max_target_angle = max_target_angle;
+  s.speed_M1 = speed_M1;
+  s.speed_M2 = speed_M2;
+  s.speed_error_sum = speedControl.getErrorSum();
+  tracePut(&s, sizeof(s));
+}
+
+// Start a recording at the end of the next control update that leaves a complete state
+void traceStart()
+{
+  trace_armed = true;
+}
+
+// Stop recording. The records already in the buffer can still be read
+void traceStop()
+{
+  trace_on = false;
+  trace_armed = false;
+}
+
+bool traceRecording()
+{
+  return trace_on || trace_armed;
+}
+
+uint8_t traceFlags()
+{
+  uint8_t flags = 0;
+#ifdef IMU_FIFO_MODE
+  flags |= TRACE_FIFO_MODE;
+#endif
+#ifdef CONTROL_FIXED_POINT
+  flags |= TRACE_FIXED_POINT;
+#endif
+  return flags;
+}
+
+// raw: the 7 values of an accel_t_gyro_union, after the byte swap
+void traceSample(uint32_t time, const int16_t *raw)
+{
+  TraceSample r;
+
+  if (!trace_on)
+    return;
+  r.type = TRACE_SAMPLE;
+  r.time = time;
+  memcpy(r.raw, raw, sizeof(r.raw));
+  tracePut(&r, sizeof(r));
+}
+
+// Call at the end of a control update, with the user inputs it started with. restartable: the controller
+// state is all in TraceState (in FIFO mode, no partially averaged block), a recording can start here
+void traceControl(uint32_t time, int16_t throttle, float steering, bool restartable)
+{
+  TraceControl r;
+
+  if (trace_armed && restartable) {
+    traceBegin(time);
+    return;
+  }
+  if (!trace_on)
+    return;
+  r.type = TRACE_CONTROL;
+  r.time = time;
+  r.throttle = throttle;
+  r.steering = steering;
+  r.angle = angle_adjusted;
+  r.motor1 = motor1;
+  r.motor2 = motor2;
+  tracePut(&r, sizeof(r));
+}
+
+// Bytes of records waiting in the buffer
+uint16_t traceAvailable()
+{
+  return trace_count;
+}
+
+// Copy whole records, up to size bytes. Return the number of bytes copied
+uint16_t traceRead(uint8_t *buffer, uint16_t size)
+{
+  uint16_t n = 0;
+
+  while (trace_count > 0) {
+    uint8_t length = traceRecordSize(trace_buffer[trace_head]);
+    if (n + length > size)
+      break;
+    for (uint8_t i = 0; i < length; i++) {
+      buffer[n++] = trace_buffer[trace_head++];
+      if (trace_head == TRACE_BUFFER_SIZE)
+        trace_head = 0;
+    }
+    trace_count -= length;
+  }
+  return n;
+}
@@ -0,0 +1,113 @@
+/*
+ * Trace.h
+ *
+ *  IMU trace format: the raw MPU6050 samples the control loop read, with their time, and the
+ *  control outputs they produced, so a field run can be replayed offline (sim/trace_replay).
+ *  A trace file is a TraceFileHeader followed by records, each starting with its type byte.
+ *  Little endian, packed. This header only describes the format: it is shared with the host tools.
+ *
+ *  Created on: 18.10.2026
+ *      Author: anonymous
+ */
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include <stdint.h>
+
+#define TRACE_MAGIC "BRT1"
+#define TRACE_VERSION 1
+
+// Build of the recording firmware (TraceFileHeader.flags): replay with the same build
+#define TRACE_FIFO_MODE 0x01
+#define TRACE_FIXED_POINT 0x02
+
+// Record types
+#define TRACE_SAMPLE 1      // one raw sample as read (in FIFO mode, all samples of a burst have the time of the read)
+#define TRACE_CONTROL 2     // a control update and its inputs/outputs
+#define TRACE_STATE 3       // controller state when the recording started
+#define TRACE_LOST 4        // records dropped here (recorder buffer full)
+
+#define TRACE_PACKED __attribute__((packed))
+
+struct TRACE_PACKED TraceFileHeader
+{
+  char magic[4];          // TRACE_MAGIC
+  uint8_t version;
+  uint8_t flags;          // TRACE_FIFO_MODE...
+  uint16_t reserved;
+};
+
+struct TRACE_PACKED TraceSample
+{
+  uint8_t type;
+  uint32_t time;          // us, micros() at the start of the control loop pass that read it
+  int16_t raw[7];         // accel x,y,z, temperature, gyro x,y,z (accel_t_gyro_union.value)
+};
+
+struct TRACE_PACKED TraceControl
+{
+  uint8_t type;
+  uint32_t time;          // us, same time as the samples it used
+  int16_t throttle;       // user inputs at the start of the update
+  float steering;
+  float angle;            // outputs: angle_adjusted, motor commands
+  int16_t motor1;
+  int16_t motor2;
+};
+
+struct TRACE_PACKED TraceState
+{
+  uint8_t type;
+  uint32_t time;          // us
+  uint32_t timer_old;     // us, time of the last control update
+  float angle;            // MPU6050_getAngle() filter and gyro offset
+  float x_gyro_offset;
+  float angle_adjusted;
+  float angle_adjusted_filtered;
+  float estimated_speed_filtered;
+  float control_output;
+  float target_angle;
+  float angle_offset;
+  float Kp, Kd, Kp_thr, Ki_thr;                       // gains of the last update
+  float Kp_user, Kd_user, Kp_thr_user, Ki_thr_user;
+  float max_target_angle;
+  int16_t speed_M1, speed_M2;
+  int16_t speed_error_sum;  // speedControl integral
+};
+
+struct TRACE_PACKED TraceLost
+{
+  uint8_t type;
+  uint16_t count;         // records dropped (saturates), 0: unknown (the client lost a trace datagram)
+};
+
+static_assert(sizeof(TraceFileHeader) == 8, "TraceFileHeader layout");
+static_assert(sizeof(TraceSample) == 19, "TraceSample layout");
+static_assert(sizeof(TraceControl) == 19, "TraceControl layout");
+static_assert(sizeof(TraceState) == 83, "TraceState layout");
+static_assert(sizeof(TraceLost) == 3, "TraceLost layout");
+
+// Size of a record from its type byte, 0 for an unknown type
+static inline uint8_t traceRecordSize(uint8_t type)
+{
+  switch (type) {
+    case TRACE_SAMPLE: return sizeof(TraceSample);
+    case TRACE_CONTROL: return sizeof(TraceControl);
+    case TRACE_STATE: return sizeof(TraceState);
+    case TRACE_LOST: return sizeof(TraceLost);
+  }
+  return 0;
+}
+
+// Recorder (Trace.cpp): records go to a ring buffer that the caller drains with traceRead()
+void traceStart();
+void traceStop();
+bool traceRecording();
+uint8_t traceFlags();
+void traceSample(uint32_t time, const int16_t *raw);
+void traceControl(uint32_t time, int16_t throttle, float steering, bool restartable);
+uint16_t traceAvailable();
+uint16_t traceRead(uint8_t *buffer, uint16_t size);
+
+#endif /* TRACE_H_ */
@@ -0,0 +1,197 @@
+/*
+ * brobot_client.cpp
+ *
+ *  Reference Linux client of the robot binary UDP protocol (../Protocol.h).
+ *
+ *  Usage: brobot_client [-p port] host command [args]
+ *    telemetry [period_ms] [seconds]          stream telemetry as CSV (default 5 ms, 0 s: until interrupted)
+ *    record file [seconds]                    record an IMU trace (../Trace.h) for sim/trace_replay (default 10 s)
+ *    drive throttle steering [seconds] [pro]  -1..1, resent every 100 ms, neutral at the end (default 1 s)
+ *    move speed steps1 steps2                 position control move, steps relative to the current position
+ *    tune kp kd kp_thr ki_thr [calibrate|sleep]   gains 0..2 times the defaults
+ *    led on|off
+ *    beep
+ *
+ *  Created on: 18.10.2026
+ *      Author: anonymous
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "client.h"
+#include "../Trace.h"
+
+#define DRIVE_REPEAT_MS 100   // well inside PROTO_DRIVE_TIMEOUT
+
+static void usage()
+{
+  fprintf(stderr, "usage: brobot_client [-p port] host telemetry [period_ms] [seconds]\n"
+                  "       brobot_client [-p port] host record file [seconds]\n"
+                  "       brobot_client [-p port] host drive throttle steering [seconds] [pro]\n"
+                  "       brobot_client [-p port] host move speed steps1 steps2\n"
+                  "       brobot_client [-p port] host tune kp kd kp_thr ki_thr [calibrate|sleep]\n"
+                  "       brobot_client [-p port] host led on|off\n"
+                  "       brobot_client [-p port] host beep\n");
+  exit(2);
+}
+
+static double now_s()
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static int telemetry(BrobotClient *c, int period, double seconds)
+{
+  ProtoTelemetry t;
+  uint16_t seq = 0;
+  long frames = 0, lost = 0;
+  double start = now_s();
+
+  if (!client_subscribe(c, period))
+    return 1;
+  printf("time,angle,target_angle,estimated_speed,speed_M1,speed_M2,steps1,steps2,control_us,loop_max_us,received,dropped,flags\n");
+  while (seconds <= 0 || now_s() - start < seconds) {
+    int r = client_telemetry(c, &t, 1000);
+    if (r < 0)
+      break;
+    if (r == 0) {
+      fprintf(stderr, "no telemetry, subscribing again\n");
+      client_subscribe(c, period);
+      continue;
+    }
+    if (frames > 0 && (uint16_t)(t.h.seq - seq) > 1)
+      lost += (uint16_t)(t.h.seq - seq) - 1;
+    seq = t.h.seq;
+    frames++;
+    printf("%u,%.2f,%.2f,%.1f,%d,%d,%d,%d,%u,%u,%u,%u,%u\n", t.time, t.angle, t.target_angle, t.estimated_speed, t.speed_M1,
+           t.speed_M2, t.steps1, t.steps2, t.control_period, t.loop_max, t.frames_received, t.frames_dropped, t.flags);
+  }
+  client_subscribe(c, 0);
+  fprintf(stderr, "%ld frames in %.1f s, %ld lost\n", frames, now_s() - start, lost);
+  return 0;
+}
+
+// Write the TRACE frames to a trace file as they come. A lost frame is marked with a TRACE_LOST record
+static int record(BrobotClient *c, const char *name, double seconds)
+{
+  ProtoTrace t;
+  TraceFileHeader header;
+  TraceLost lost = { TRACE_LOST, 0 };
+  uint16_t seq = 0;
+  long frames = 0, gaps = 0, bytes = 0;
+  bool stopped = false;
+  double start = now_s();
+
+  FILE *f = fopen(name, "wb");
+  if (!f) {
+    perror(name);
+    return 1;
+  }
+  if (!client_record(c, true)) {
+    fclose(f);
+    return 1;
+  }
+  for (;;) {
+    if (!stopped && now_s() - start >= seconds) {
+      client_record(c, false);
+      stopped = true;
+    }
+    int n = client_trace(c, &t, stopped ? 2 * PROTO_TRACE_PERIOD : 1000);
+    if (n < 0)
+      break;
+    if (n == 0) {
+      if (stopped)
+        break;      // the robot sent what was left
+      if (frames == 0) {
+        fprintf(stderr, "no trace, asking again\n");
+        client_record(c, true);
+      }
+      continue;
+    }
+    if (frames == 0) {
+      memcpy(header.magic, TRACE_MAGIC, sizeof(header.magic));
+      header.version = TRACE_VERSION;
+      header.flags = t.flags;
+      header.reserved = 0;
+      fwrite(&header, sizeof(header), 1, f);
+    } else if (t.h.seq != (uint16_t)(seq + 1)) {
+      fwrite(&lost, sizeof(lost), 1, f);
+      gaps++;
+    }
+    seq = t.h.seq;
+    frames++;
+    bytes += n;
+    fwrite(t.data, n, 1, f);
+  }
+  if (!stopped)
+    client_record(c, false);
+  fclose(f);
+  fprintf(stderr, "%ld bytes in %ld frames, %ld lost\n", bytes, frames, gaps);
+  return frames > 0 ? 0 : 1;
+}
+
+static int drive(BrobotClient *c, float throttle, float steering, double seconds, uint8_t flags)
+{
+  double start = now_s();
+  while (now_s() - start < seconds) {
+    if (!client_drive(c, throttle, steering, flags))
+      return 1;
+    usleep(DRIVE_REPEAT_MS * 1000);
+  }
+  return client_drive(c, 0, 0, flags) ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+  BrobotClient c;
+  uint16_t port = PROTO_PORT;
+  int opt;
+  int r = 1;
+
+  while ((opt = getopt(argc, argv, "p:")) != -1) {
+    if (opt == 'p')
+      port = atoi(optarg);
+    else
+      usage();
+  }
+  if (argc - optind < 2)
+    usage();
+  const char *host = argv[optind];
+  const char *cmd = argv[optind + 1];
+  char **arg = argv + optind + 2;
+  int args = argc - optind - 2;
+
+  if (!client_open(&c, host, port)) {
+    fprintf(stderr, "brobot_client: cannot reach %s\n", host);
+    return 1;
+  }
+
+  if (strcmp(cmd, "telemetry") == 0)
+    r = telemetry(&c, args > 0 ? atoi(arg[0]) : PROTO_TELEMETRY_MIN_PERIOD, args > 1 ? atof(arg[1]) : 0);
+  else if (strcmp(cmd, "record") == 0 && args >= 1)
+    r = record(&c, arg[0], args > 1 ? atof(arg[1]) : 10.0);
+  else if (strcmp(cmd, "drive") == 0 && args >= 2)
+    r = drive(&c, atof(arg[0]), atof(arg[1]), args > 2 ? atof(arg[2]) : 1.0,
+              args > 3 && strcmp(arg[3], "pro") == 0 ? PROTO_DRIVE_PRO : 0);
+  else if (strcmp(cmd, "move") == 0 && args == 3)
+    r = client_move(&c, atoi(arg[0]), atoi(arg[1]), atoi(arg[2])) ? 0 : 1;
+  else if (strcmp(cmd, "tune") == 0 && args >= 4) {
+    uint8_t flags = 0;
+    if (args > 4)
+      flags = strcmp(arg[4], "calibrate") == 0 ? PROTO_TUNE_CALIBRATE : strcmp(arg[4], "sleep") == 0 ? PROTO_TUNE_SLEEP : 0;
+    r = client_tune(&c, atof(arg[0]), atof(arg[1]), atof(arg[2]), atof(arg[3]), flags) ? 0 : 1;
+  } else if (strcmp(cmd, "led") == 0 && args == 1)
+    r = client_aux(&c, strcmp(arg[0], "on") == 0 ? PROTO_AUX_LED : 0) ? 0 : 1;
+  else if (strcmp(cmd, "beep") == 0)
+    r = client_aux(&c, PROTO_AUX_BEEP) ? 0 : 1;
+  else
+    usage();
+
+  client_close(&c);
+  return r;
+}
@@ -0,0 +1,149 @@
+/*
+ * client.cpp
+ *
+ *  Linux client of the robot binary UDP protocol (../Protocol.h).
+ *
+ *  Created on: 18.10.2026
+ *      Author: anonymous
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include "client.h"
+
+bool client_open(BrobotClient *c, const char *host, uint16_t port)
+{
+  struct addrinfo hints, *res;
+  char service[8];
+
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_DGRAM;
+  snprintf(service, sizeof(service), "%u", port);
+  if (getaddrinfo(host, service, &hints, &res) != 0)
+    return false;
+  c->fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+  if (c->fd >= 0 && connect(c->fd, res->ai_addr, res->ai_addrlen) < 0) {
+    close(c->fd);
+    c->fd = -1;
+  }
+  freeaddrinfo(res);
+  c->seq = 0;
+  return c->fd >= 0;
+}
+
+void client_close(BrobotClient *c)
+{
+  if (c->fd >= 0)
+    close(c->fd);
+  c->fd = -1;
+}
+
+static bool send_frame(BrobotClient *c, void *frame, size_t length, uint8_t type)
+{
+  ProtoHeader *h = (ProtoHeader *)frame;
+  h->magic = PROTO_MAGIC;
+  h->type = type;
+  h->seq = ++c->seq;
+  return send(c->fd, frame, length, 0) == (ssize_t)length;
+}
+
+static int16_t fader(float v)
+{
+  v = v < -1 ? -1 : v > 1 ? 1 : v;
+  return v * PROTO_FADER_MAX;
+}
+
+static uint16_t gain(float v)
+{
+  v = v < 0 ? 0 : v > 2 ? 2 : v;
+  return v * 0.5 * PROTO_GAIN_MAX + 0.5;
+}
+
+bool client_drive(BrobotClient *c, float throttle, float steering, uint8_t flags)
+{
+  ProtoDrive f;
+  f.throttle = fader(throttle);
+  f.steering = fader(steering);
+  f.flags = flags;
+  return send_frame(c, &f, sizeof(f), PROTO_DRIVE);
+}
+
+bool client_move(BrobotClient *c, int16_t speed, int16_t steps1, int16_t steps2)
+{
+  ProtoMove f;
+  f.speed = speed;
+  f.steps1 = steps1;
+  f.steps2 = steps2;
+  return send_frame(c, &f, sizeof(f), PROTO_MOVE);
+}
+
+bool client_tune(BrobotClient *c, float kp, float kd, float kp_throttle, float ki_throttle, uint8_t flags)
+{
+  ProtoTune f;
+  f.kp = gain(kp);
+  f.kd = gain(kd);
+  f.kp_throttle = gain(kp_throttle);
+  f.ki_throttle = gain(ki_throttle);
+  f.flags = flags;
+  return send_frame(c, &f, sizeof(f), PROTO_TUNE);
+}
+
+bool client_aux(BrobotClient *c, uint8_t flags)
+{
+  ProtoAux f;
+  f.flags = flags;
+  return send_frame(c, &f, sizeof(f), PROTO_AUX);
+}
+
+bool client_subscribe(BrobotClient *c, uint16_t period_ms)
+{
+  ProtoSubscribe f;
+  f.period = period_ms;
+  return send_frame(c, &f, sizeof(f), PROTO_SUBSCRIBE);
+}
+
+bool client_record(BrobotClient *c, bool enable)
+{
+  ProtoRecord f;
+  f.enable = enable ? 1 : 0;
+  return send_frame(c, &f, sizeof(f), PROTO_RECORD);
+}
+
+int client_telemetry(BrobotClient *c, ProtoTelemetry *t, int timeout_ms)
+{
+  struct pollfd p = { c->fd, POLLIN, 0 };
+
+  for (;;) {
+    int r = poll(&p, 1, timeout_ms);
+    if (r <= 0)
+      return r;
+    ssize_t n = recv(c->fd, t, sizeof(*t), 0);
+    if (n < 0)
+      return -1;
+    if (n == sizeof(*t) && t->h.magic == PROTO_MAGIC && t->h.type == PROTO_TELEMETRY)
+      return 1;
+    // not a telemetry frame: wait for the next one (the timeout restarts, good enough for a stream)
+  }
+}
+
+int client_trace(BrobotClient *c, ProtoTrace *t, int timeout_ms)
+{
+  struct pollfd p = { c->fd, POLLIN, 0 };
+  const ssize_t header = sizeof(*t) - sizeof(t->data);
+
+  for (;;) {
+    int r = poll(&p, 1, timeout_ms);
+    if (r <= 0)
+      return r;
+    ssize_t n = recv(c->fd, t, sizeof(*t), 0);
+    if (n < 0)
+      return -1;
+    if (n > header && t->h.magic == PROTO_MAGIC && t->h.type == PROTO_TRACE)
+      return n - header;
+  }
+}
@@ -0,0 +1,39 @@
+/*
+ * client.h
+ *
+ *  Linux client of the robot binary UDP protocol (../Protocol.h).
+ *
+ *  Created on: 18.10.2026
+ *      Author: anonymous
+ */
+
+#ifndef CLIENT_H_
+#define CLIENT_H_
+
+#include <stdint.h>
+#include "../Protocol.h"
+
+struct BrobotClient
+{
+  int fd;            // UDP socket connected to the robot
+  uint16_t seq;      // sequence of the next command frame
+};
+
+bool client_open(BrobotClient *c, const char *host, uint16_t port);
+void client_close(BrobotClient *c);
+
+// Command frames. throttle/steering in -1..1, gains in 0..2 (times the default gain)
+bool client_drive(BrobotClient *c, float throttle, float steering, uint8_t flags);
+bool client_move(BrobotClient *c, int16_t speed, int16_t steps1, int16_t steps2);
+bool client_tune(BrobotClient *c, float kp, float kd, float kp_throttle, float ki_throttle, uint8_t flags);
+bool client_aux(BrobotClient *c, uint8_t flags);
+bool client_subscribe(BrobotClient *c, uint16_t period_ms);
+bool client_record(BrobotClient *c, bool enable);
+
+// Wait up to timeout_ms for a telemetry frame. Return 1 with a frame, 0 on timeout, -1 on error
+int client_telemetry(BrobotClient *c, ProtoTelemetry *t, int timeout_ms);
+
+// Wait up to timeout_ms for a trace frame. Return the bytes of records in t->data, 0 on timeout, -1 on error
+int client_trace(BrobotClient *c, ProtoTrace *t, int timeout_ms);
+
+#endif /* CLIENT_H_ */
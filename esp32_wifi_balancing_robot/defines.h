@@ -47,6 +47,18 @@
 #define ITERM_MAX_ERROR 30   // Iterm windup constants for PI control
 #define ITERM_MAX 10000
 
+// IMU FIFO mode: the MPU6050 samples at 200Hz into its FIFO, the control loop averages blocks of
+// IMU_FIFO_DECIMATION samples, so a late loop() no longer loses samples.
+// 200Hz * 14 bytes is a quarter of the 100kHz I2C bus, 1kHz would not fit
+//#define IMU_FIFO_MODE
+#define IMU_FIFO_RATE_DIV 4     // SMPLRT_DIV: 1kHz / (1 + 4) = 200Hz
+#define IMU_FIFO_DECIMATION 2
+#define IMU_FIFO_PERIOD 0.005   // seconds, sensor sample period in FIFO mode
+
+//#define CONTROL_FIXED_POINT  // Run the control laws in Q16.16 fixed point instead of float
+
+#define TRACE_BUFFER_SIZE 8192  // IMU trace recorder buffer (Trace.h), about 1.5s of records at 100Hz
+
 #define ANGLE_OFFSET 0.0  // Offset angle for balance (to compensate robot own weight distribution)
 
 // Servo definitions
@@ -57,7 +69,11 @@
 #define SERVO2_NEUTRO 4444
 #define SERVO2_RANGE 8400
 
-#define ZERO_SPEED 0xffffff
+#define STEP_TIMER_DIVIDER 2      // Step timers clock: 80Mhz APB / 2 = 40Mhz, fine enough that the period rounding does not bias the speed
+#define STEP_TIMER_HZ 40000000
+#define STEP_PULSE_NS 2000      // STEP pin high time: DRV8825 needs 1.9us, A4988 1us
+#define STEP_PULSE_TICKS (STEP_PULSE_NS * (STEP_TIMER_HZ / 1000000) / 1000)
+#define ZERO_SPEED 0xffffff       // Step timer period when stopped (0.42s, no step is made)
 #define MAX_ACCEL 14      // Maximun motor acceleration (MAX RECOMMENDED VALUE: 20) (default:14)
 
 #define MICROSTEPPING 8   // 8 or 16 for 1/8 or 1/16 driver microstepping (default:16)
@@ -8,6 +8,8 @@
 #include <Arduino.h>
 #include "defines.h"
 #include "esp32-hal-timer.h"
+#include "Control.h"
+#include "globals.h"
 
 String MAC;  // MAC address of Wifi module
 
@@ -15,6 +17,8 @@ volatile long counter1 = 0;
 volatile long counter2 = 0;
 hw_timer_t * timer1 = NULL;
 hw_timer_t * timer2 = NULL;
+volatile StepState step_M1 = { ZERO_SPEED, 0, false };
+volatile StepState step_M2 = { ZERO_SPEED, 0, false };
 
 uint8_t cascade_control_loop_counter = 0;
 uint8_t loop_counter;       // To generate a medium loop 40Hz
@@ -45,12 +49,11 @@ float Kp_position = KP_POSITION;
 float Kd_position = KD_POSITION;
 bool newControlParameters = false;
 bool modifing_control_parameters = false;
+bool robot_sleeping = false;
 int16_t position_error_sum_M1;
 int16_t position_error_sum_M2;
-float PID_errorSum;
-float PID_errorOld = 0;
-float PID_errorOld2 = 0;
-float setPointOld = 0;
+StabilityPD<control_t> stabilityControl;
+SpeedPI<control_t> speedControl(ITERM_MAX_ERROR, ITERM_MAX);
 float target_angle;
 int16_t throttle;
 float steering;
@@ -10,12 +10,22 @@
 
 #include <Arduino.h>
 #include "esp32-hal-timer.h"
+#include "Control.h"
 
 extern volatile long counter1;
 extern volatile long counter2;
 extern hw_timer_t * timer1;
 extern hw_timer_t * timer2;
 
+// Step generator of a motor, shared by setMotorSpeedM1/M2() and the timer ISRs under muxer1/muxer2
+struct StepState
+{
+  uint32_t period;    // step period in timer ticks, ZERO_SPEED when stopped
+  uint32_t low;       // timer ticks from the end of the STEP pulse to the next step
+  bool high;          // STEP pin high: the next alarm ends the pulse
+};
+extern volatile StepState step_M1, step_M2;
+
 extern String MAC;  // MAC address of Wifi module
 
 extern uint8_t cascade_control_loop_counter;
@@ -47,12 +57,11 @@ extern float Kp_position;
 extern float Kd_position;
 extern bool newControlParameters;
 extern bool modifing_control_parameters;
+extern bool robot_sleeping;          // sleep toggle of the settings page: motors off
 extern int16_t position_error_sum_M1;
 extern int16_t position_error_sum_M2;
-extern float PID_errorSum;
-extern float PID_errorOld;
-extern float PID_errorOld2;
-extern float setPointOld;
+extern StabilityPD<control_t> stabilityControl;
+extern SpeedPI<control_t> speedControl;
 extern float target_angle;
 extern int16_t throttle;
 extern float steering;
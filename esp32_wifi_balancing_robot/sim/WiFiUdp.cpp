@@ -0,0 +1,99 @@
+/*
+ * WiFiUdp.cpp
+ *
+ *  Host stand-in for WiFiUDP (see include/WiFiUdp.h). The datagrams are real,
+ *  the simulated clock is not involved.
+ *
+ *  Created on: 18.10.2026
+ *      Author: anonymous
+ */
+
+#include <WiFiUdp.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+uint8_t WiFiUDP::begin(uint16_t port)
+{
+  struct sockaddr_in a;
+  int one = 1;
+
+  stop();
+  fd = socket(AF_INET, SOCK_DGRAM, 0);
+  if (fd < 0)
+    return 0;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  memset(&a, 0, sizeof(a));
+  a.sin_family = AF_INET;
+  a.sin_addr.s_addr = htonl(INADDR_ANY);
+  a.sin_port = htons(port);
+  if (bind(fd, (struct sockaddr *)&a, sizeof(a)) < 0 || fcntl(fd, F_SETFL, O_NONBLOCK) < 0) {
+    perror("WiFiUDP::begin");
+    stop();
+    return 0;
+  }
+  return 1;
+}
+
+void WiFiUDP::stop()
+{
+  if (fd >= 0)
+    close(fd);
+  fd = -1;
+}
+
+int WiFiUDP::parsePacket()
+{
+  struct sockaddr_in a;
+  socklen_t a_length = sizeof(a);
+
+  rx_length = rx_pos = 0;
+  if (fd < 0)
+    return 0;
+  ssize_t n = recvfrom(fd, rx, sizeof(rx), 0, (struct sockaddr *)&a, &a_length);
+  if (n <= 0)
+    return 0;
+  rx_length = n;
+  remote_ip.addr = ntohl(a.sin_addr.s_addr);
+  remote_port = ntohs(a.sin_port);
+  return rx_length;
+}
+
+int WiFiUDP::read(uint8_t *buffer, size_t length)
+{
+  int n = min((int)length, rx_length - rx_pos);
+  memcpy(buffer, rx + rx_pos, n);
+  rx_pos += n;
+  return n;
+}
+
+int WiFiUDP::beginPacket(IPAddress ip, uint16_t port)
+{
+  tx_ip = ip;
+  tx_port = port;
+  tx_length = 0;
+  return 1;
+}
+
+size_t WiFiUDP::write(const uint8_t *buffer, size_t size)
+{
+  size = min(size, sizeof(tx) - tx_length);
+  memcpy(tx + tx_length, buffer, size);
+  tx_length += size;
+  return size;
+}
+
+int WiFiUDP::endPacket()
+{
+  struct sockaddr_in a;
+
+  if (fd < 0)
+    return 0;
+  memset(&a, 0, sizeof(a));
+  a.sin_family = AF_INET;
+  a.sin_addr.s_addr = htonl(tx_ip.addr);
+  a.sin_port = htons(tx_port);
+  return sendto(fd, tx, tx_length, 0, (struct sockaddr *)&a, sizeof(a)) == (ssize_t)tx_length;
+}
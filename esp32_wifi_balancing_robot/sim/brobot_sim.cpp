@@ -0,0 +1,283 @@
+/*
+ * brobot_sim.cpp
+ *
+ *  Closed loop host simulator for the ESP32 balancing robot.
+ *  Runs the real Control.cpp / Motors.cpp / Timers.cpp / MPU6050.cpp code
+ *  against the simulated robot of sim.cpp and reports how well it balances.
+ *
+ *  Usage: brobot_sim [options]
+ *    -t seconds      simulated time after release (default 10)
+ *    -a degrees      initial tilt when the robot is released (default 5)
+ *    -p time:rate    push the robot at time (s) with a pitch rate kick (deg/s), can be repeated
+ *    -g scale        scale the user stability gains Kp/Kd (default 1)
+ *    -l us           fixed cost of the rest of loop() (OTA, WiFi...) in microseconds (default 20)
+ *    -w period:ms    stall loop() for ms milliseconds every period seconds (WiFi/OTA hiccups)
+ *    -s seed         sensor noise seed (default 1)
+ *    -m name=value   override a robot model parameter (see SimParams in sim.h), can be repeated
+ *    -c file         write a CSV trace (1 kHz) to file
+ *    -r file         record an IMU trace (../Trace.h) of the run to file, for trace_replay
+ *    -v              show the firmware Serial output
+ *
+ *  Exit status is 0 when the robot stayed up, 1 when it fell.
+ *
+ *  Created on: 17.10.2026
+ *      Author: anonymous
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <time.h>
+#include <unistd.h>
+#include "../Control.h"
+#include "../MPU6050.h"
+#include "../Motors.h"
+#include "../Trace.h"
+#include "../defines.h"
+#include "../globals.h"
+#include "sim.h"
+
+#define MAX_PUSHES 16
+#define FALL_ANGLE 74.0      // degrees: the robot is considered down (motors are disabled there)
+#define SETTLE_BAND 2.0      // degrees
+
+void initTimers();
+
+static uint64_t host_ns()
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1000000000ULL + t.tv_nsec;
+}
+
+// Same steps as setup() in the sketch, without WiFi/OTA/servo
+static void robot_setup()
+{
+  pinMode(PIN_ENABLE_MOTORS, OUTPUT);
+  digitalWrite(PIN_ENABLE_MOTORS, HIGH);
+  pinMode(PIN_MOTOR1_DIR, OUTPUT);
+  pinMode(PIN_MOTOR1_STEP, OUTPUT);
+  pinMode(PIN_MOTOR2_DIR, OUTPUT);
+  pinMode(PIN_MOTOR2_STEP, OUTPUT);
+  digitalWrite(PIN_MOTOR1_STEP, LOW);
+  digitalWrite(PIN_MOTOR2_STEP, LOW);
+
+  Wire.begin();
+  MPU6050_setup();
+  delay(500);
+  MPU6050_calibrate();
+#ifdef IMU_FIFO_MODE
+  MPU6050_fifo_setup(IMU_FIFO_RATE_DIV, MPU6050_DLPF_44HZ);
+#endif
+
+  initTimers();
+
+  OSCfader[0] = 0.5;
+  OSCfader[1] = 0.5;
+  OSCfader[2] = 0.5;
+  OSCfader[3] = 0.5;
+
+  digitalWrite(PIN_ENABLE_MOTORS, LOW);
+}
+
+static void usage()
+{
+  fprintf(stderr, "usage: brobot_sim [-t seconds] [-a tilt_deg] [-p time:rate]... [-g gain_scale] [-l loop_us] [-w period:stall_ms] [-s seed] [-m name=value]... [-c trace.csv] [-r trace.brt] [-v]\n");
+  exit(2);
+}
+
+static bool set_param(SimParams &p, const char *arg)
+{
+  static const struct { const char *name; double SimParams::*field; } fields[] = {
+    { "body_mass", &SimParams::body_mass },
+    { "com_height", &SimParams::com_height },
+    { "body_inertia", &SimParams::body_inertia },
+    { "wheel_radius", &SimParams::wheel_radius },
+    { "wheel_mass", &SimParams::wheel_mass },
+    { "imu_height", &SimParams::imu_height },
+    { "motor_wn", &SimParams::motor_wn },
+    { "motor_zeta", &SimParams::motor_zeta },
+    { "wheel_friction", &SimParams::wheel_friction },
+    { "gyro_bias", &SimParams::gyro_bias },
+    { "gyro_noise", &SimParams::gyro_noise },
+    { "accel_noise", &SimParams::accel_noise },
+  };
+  const char *eq = strchr(arg, '=');
+  if (!eq)
+    return false;
+  for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++) {
+    if (strlen(fields[i].name) == (size_t)(eq - arg) && strncmp(arg, fields[i].name, eq - arg) == 0) {
+      p.*fields[i].field = atof(eq + 1);
+      return true;
+    }
+  }
+  return false;
+}
+
+int main(int argc, char **argv)
+{
+  SimParams params;
+  double duration = 10.0;
+  double tilt = 5.0;
+  double gain_scale = 1.0;
+  uint32_t loop_us = 20;
+  double stall_period = 0, stall_ms = 0;
+  double push_time[MAX_PUSHES], push_rate[MAX_PUSHES];
+  int pushes = 0;
+  const char *csv_name = NULL;
+  const char *trace_name = NULL;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "t:a:p:g:l:w:s:m:c:r:v")) != -1) {
+    switch (opt) {
+      case 't': duration = atof(optarg); break;
+      case 'a': tilt = atof(optarg); break;
+      case 'p':
+        if (pushes == MAX_PUSHES || sscanf(optarg, "%lf:%lf", &push_time[pushes], &push_rate[pushes]) != 2)
+          usage();
+        pushes++;
+        break;
+      case 'g': gain_scale = atof(optarg); break;
+      case 'l': loop_us = atoi(optarg); break;
+      case 'w':
+        if (sscanf(optarg, "%lf:%lf", &stall_period, &stall_ms) != 2 || stall_period <= 0)
+          usage();
+        break;
+      case 's': params.seed = strtoul(optarg, NULL, 0); break;
+      case 'm':
+        if (!set_param(params, optarg))
+          usage();
+        break;
+      case 'c': csv_name = optarg; break;
+      case 'r': trace_name = optarg; break;
+      case 'v': Serial.enabled = true; break;
+      default: usage();
+    }
+  }
+
+  FILE *csv = NULL;
+  if (csv_name) {
+    csv = fopen(csv_name, "w");
+    if (!csv) {
+      perror(csv_name);
+      return 2;
+    }
+    fprintf(csv, "t,tilt,angle_adjusted,target_angle,speed_M1,speed_M2,steps1,steps2,position\n");
+  }
+
+  FILE *trace = NULL;
+  uint8_t trace_block[1024];
+  if (trace_name) {
+    trace = fopen(trace_name, "wb");
+    if (!trace) {
+      perror(trace_name);
+      return 2;
+    }
+    TraceFileHeader header;
+    memcpy(header.magic, TRACE_MAGIC, sizeof(header.magic));
+    header.version = TRACE_VERSION;
+    header.flags = traceFlags();
+    header.reserved = 0;
+    fwrite(&header, sizeof(header), 1, trace);
+  }
+
+  sim_init(params, tilt);
+  robot_setup();
+  Kp_user *= gain_scale;
+  Kd_user *= gain_scale;
+  sim_hold(false);
+  if (trace)
+    traceStart();
+
+  const uint64_t t_release = sim_now();
+  const uint64_t t_end = t_release + (uint64_t)(duration * 1e9);
+  uint64_t next_sample = t_release;
+  uint64_t last_outside_band = t_release;
+  double max_tilt = 0, sum_sq = 0;
+  long samples = 0;
+  bool fell = false;
+  int next_push = 0;
+  uint64_t next_stall = t_release + (uint64_t)(stall_period * 1e9);
+
+  long control_updates = 0;
+  uint64_t control_host_ns = 0, control_host_max = 0;
+  const uint64_t wall_start = host_ns();
+
+  while (sim_now() < t_end) {
+    double t = (sim_now() - t_release) * 1e-9;
+    for (int i = 0; i < pushes; i++) {
+      if (i == next_push && t >= push_time[i]) {
+        sim_push(push_rate[i]);
+        next_push++;
+      }
+    }
+
+    // Firmware cost of a control update: host time in controlLoop() minus the time spent simulating the robot.
+    // Passes far from a new IMU sample only poll and are not timed, the clock reads would cost more than the simulation.
+    if (sim_imu_data_soon(1000000)) {
+      long old_timer = timer_old;
+      sim_timing(true);
+      uint64_t model0 = sim_model_host_ns();
+      uint64_t h0 = host_ns();
+      controlLoop();
+      uint64_t cost = host_ns() - h0 - (sim_model_host_ns() - model0);
+      sim_timing(false);
+      if (timer_old != old_timer) {
+        control_updates++;
+        control_host_ns += cost;
+        if (cost > control_host_max)
+          control_host_max = cost;
+      }
+    } else {
+      controlLoop();
+    }
+
+    uint64_t loop_ns = loop_us * 1000ULL;
+    if (stall_period > 0 && sim_now() >= next_stall) {
+      loop_ns += (uint64_t)(stall_ms * 1e6);
+      next_stall += (uint64_t)(stall_period * 1e9);
+    }
+    sim_advance(loop_ns);
+
+    if (trace) {
+      uint16_t length;
+      while ((length = traceRead(trace_block, sizeof(trace_block))) > 0)
+        fwrite(trace_block, length, 1, trace);
+    }
+
+    const SimState &s = sim_state();
+    while (next_sample <= sim_now()) {
+      double tilt_deg = s.pitch * RAD2GRAD;
+      if (fabs(tilt_deg) > max_tilt)
+        max_tilt = fabs(tilt_deg);
+      if (fabs(tilt_deg) > SETTLE_BAND)
+        last_outside_band = next_sample;
+      if (fabs(tilt_deg) > FALL_ANGLE)
+        fell = true;
+      sum_sq += tilt_deg * tilt_deg;
+      samples++;
+      if (csv)
+        fprintf(csv, "%.3f,%.3f,%.3f,%.3f,%d,%d,%d,%d,%.4f\n", (next_sample - t_release) * 1e-9, tilt_deg, angle_adjusted, target_angle,
+                speed_M1, speed_M2, (int)steps1, (int)steps2, s.position);
+      next_sample += 1000000;
+    }
+  }
+  const uint64_t wall = host_ns() - wall_start;
+
+  if (csv)
+    fclose(csv);
+  if (trace)
+    fclose(trace);
+
+  printf("result          %s\n", fell ? "FELL" : "balanced");
+  printf("simulated       %.1f s in %.3f s wall (%.0fx real time)\n", duration, wall * 1e-9, duration / (wall * 1e-9));
+  printf("max tilt        %.2f deg\n", max_tilt);
+  printf("rms tilt        %.3f deg\n", samples ? sqrt(sum_sq / samples) : 0.0);
+  if (!fell)
+    printf("settling time   %.3f s (|tilt| < %.1f deg)\n", (last_outside_band - t_release) * 1e-9, SETTLE_BAND);
+  printf("final position  %.3f m\n", sim_state().position);
+  printf("control rate    %.1f Hz\n", control_updates / duration);
+  printf("control cost    %.0f ns mean, %llu ns max (host)\n", control_updates ? (double)control_host_ns / control_updates : 0.0,
+         (unsigned long long)control_host_max);
+
+  return fell ? 1 : 0;
+}
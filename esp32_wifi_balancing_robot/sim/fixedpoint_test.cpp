@@ -0,0 +1,212 @@
+/*
+ * fixedpoint_test.cpp
+ *
+ *  Bit exact check of the Q16.16 operations (FixedPoint.h) against
+ *  reference results computed in 64 bit integers: fixed vectors for the
+ *  rounding and saturation corners, then random operands over the whole
+ *  raw range. Built with -fsanitize=undefined, so any signed overflow in
+ *  the header stops the test.
+ *
+ *  Usage: fixedpoint_test [-n count]
+ *    -n n   number of random operand pairs (default 1000000)
+ *
+ *  Exit status is 0 when every check passed.
+ *
+ *  Created on: 18.10.2026
+ *      Author: anonymous
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <unistd.h>
+#include "../FixedPoint.h"
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("FAILED line %d: %s\n", __LINE__, #cond); failures++; } } while (0)
+#define CHECK_RAW(q, expected) do { int32_t r_ = (q).raw; int64_t e_ = (expected); if (r_ != e_) { \
+    printf("FAILED line %d: %s = %ld, expected %lld\n", __LINE__, #q, (long)r_, (long long)e_); failures++; } } while (0)
+
+static uint64_t rndState = 1;
+
+static uint32_t rnd()
+{
+  rndState = rndState * 6364136223846793005ULL + 1442695040888963407ULL;
+  return (uint32_t)(rndState >> 32);
+}
+
+// Operands biased towards the interesting corners: small values, the limits, then anything
+static int32_t rndRaw()
+{
+  switch (rnd() % 8) {
+    case 0: return (int32_t)(rnd() % 0x20000) - 0x10000;
+    case 1: return (rnd() & 1) ? INT32_MAX - (int32_t)(rnd() % 4) : INT32_MIN + (int32_t)(rnd() % 4);
+    case 2: return (int32_t)(rnd() % 0x2000000) - 0x1000000;
+    default: return (int32_t)rnd();
+  }
+}
+
+static int64_t clamp(int64_t r)
+{
+  return r > INT32_MAX ? INT32_MAX : (r < INT32_MIN ? INT32_MIN : r);
+}
+
+static int64_t wrapped(int64_t r)
+{
+  r &= 0xFFFFFFFFLL;
+  return r >= 0x80000000LL ? r - 0x100000000LL : r;
+}
+
+// Floor of the exact product, then saturated
+static int64_t refMul(int32_t a, int32_t b)
+{
+  int64_t p = (int64_t)a * b;
+  int64_t q = p / 65536;
+  if (p % 65536 != 0 && p < 0)
+    q--;
+  return clamp(q);
+}
+
+// Truncated quotient, saturated; divide by zero gives the limit of the dividend's sign
+static int64_t refDiv(int32_t a, int32_t b)
+{
+  if (b == 0)
+    return a >= 0 ? INT32_MAX : INT32_MIN;
+  return clamp((int64_t)a * 65536 / b);
+}
+
+static void checkConstruction()
+{
+  CHECK_RAW(Q16_16(), 0);
+  CHECK_RAW(Q16_16(1), 65536);
+  CHECK_RAW(Q16_16(-1), -65536);
+  CHECK_RAW(Q16_16(32767), 32767LL * 65536);
+  CHECK_RAW(Q16_16(-32768), INT32_MIN);
+  CHECK_RAW(Q16_16(32768), INT32_MAX);
+  CHECK_RAW(Q16_16(-32769), INT32_MIN);
+  CHECK_RAW(Q16_16(100000), INT32_MAX);
+  CHECK_RAW(Q16_16(INT32_MAX), INT32_MAX);
+  CHECK_RAW(Q16_16(INT32_MIN), INT32_MIN);
+  CHECK_RAW(Q16_16(40000L), INT32_MAX);
+  CHECK_RAW(Q16_16(-40000L), INT32_MIN);
+  CHECK_RAW(Q16_16(-12L), -12LL * 65536);
+
+  // Round to nearest, halves away from zero
+  CHECK_RAW(Q16_16(0.5f), 32768);
+  CHECK_RAW(Q16_16(-0.5f), -32768);
+  CHECK_RAW(Q16_16(1.0f / 131072), 1);
+  CHECK_RAW(Q16_16(-1.0f / 131072), -1);
+  CHECK_RAW(Q16_16(0.99f / 131072), 0);
+  CHECK_RAW(Q16_16(0.1), 6554);
+  CHECK_RAW(Q16_16(-0.1), -6554);
+  CHECK_RAW(Q16_16(3.14159265), 205887);
+  CHECK_RAW(Q16_16(32767.99998), INT32_MAX);
+  CHECK_RAW(Q16_16(32767.9999847), INT32_MAX);
+  CHECK_RAW(Q16_16(-32768.0), INT32_MIN);
+  CHECK_RAW(Q16_16(1e6f), INT32_MAX);
+  CHECK_RAW(Q16_16(-1e6f), INT32_MIN);
+  CHECK_RAW(Q16_16(1e300), INT32_MAX);
+  CHECK_RAW(Q16_16((double)INFINITY), INT32_MAX);
+  CHECK_RAW(Q16_16(-INFINITY), INT32_MIN);
+  CHECK_RAW(Q16_16((float)NAN), 0);
+  CHECK_RAW(Q16_16((double)NAN), 0);
+
+  // Every float step in range converts like the reference rounding
+  for (int32_t i = -40000; i <= 40000; i++) {
+    float f = i * 0.8191f;
+    double r = (double)f * 65536;
+    int64_t expected = clamp((int64_t)(r >= 0 ? floor(r + 0.5) : ceil(r - 0.5)));
+    CHECK_RAW(Q16_16(f), expected);
+  }
+
+  CHECK((int32_t)Q16_16(2.75) == 2);
+  CHECK((int32_t)Q16_16(-2.75) == -3);
+  CHECK((float)Q16_16(-2.75) == -2.75f);
+  CHECK((float)Q16_16::fromRaw(1) == 1.0f / 65536);
+}
+
+static void checkVectors()
+{
+  Q16_16 max = Q16_16::fromRaw(INT32_MAX), min = Q16_16::fromRaw(INT32_MIN);
+
+  CHECK_RAW(Q16_16(1.5) * Q16_16(2.25), (int64_t)(3.375 * 65536));
+  CHECK_RAW(Q16_16(-1.5) * Q16_16(2.25), (int64_t)(-3.375 * 65536));
+  CHECK_RAW(Q16_16::fromRaw(1) * Q16_16::fromRaw(1), 0);
+  CHECK_RAW(Q16_16::fromRaw(-1) * Q16_16::fromRaw(1), -1);      // floor
+  CHECK_RAW(Q16_16(200) * Q16_16(200), INT32_MAX);
+  CHECK_RAW(Q16_16(-200) * Q16_16(200), INT32_MIN);
+  CHECK_RAW(min * min, INT32_MAX);
+  CHECK_RAW(min * Q16_16(-1), INT32_MAX);
+
+  CHECK_RAW(Q16_16(1) / Q16_16(3), 21845);
+  CHECK_RAW(Q16_16(-1) / Q16_16(3), -21845);                   // toward zero
+  CHECK_RAW(Q16_16(7) / Q16_16(2), 7 * 32768);
+  CHECK_RAW(Q16_16(1) / Q16_16::fromRaw(1), INT32_MAX);
+  CHECK_RAW(Q16_16(1) / Q16_16(0), INT32_MAX);
+  CHECK_RAW(Q16_16(0) / Q16_16(0), INT32_MAX);
+  CHECK_RAW(Q16_16(-1) / Q16_16(0), INT32_MIN);
+  CHECK_RAW(min / Q16_16::fromRaw(-1), INT32_MAX);
+  CHECK_RAW(min / Q16_16(-1), INT32_MAX);
+
+  CHECK_RAW(max + Q16_16::fromRaw(1), INT32_MIN);              // sums wrap
+  CHECK_RAW(min - Q16_16::fromRaw(1), INT32_MAX);
+  CHECK_RAW(-min, INT32_MIN);
+  CHECK_RAW(-max, -INT32_MAX);
+  CHECK_RAW(Q16_16(0.25) - Q16_16(0.75), -32768);
+
+  Q16_16 q = max;
+  q += Q16_16::fromRaw(2);
+  CHECK_RAW(q, INT32_MIN + 1);
+  q -= Q16_16::fromRaw(3);
+  CHECK_RAW(q, INT32_MAX - 1);
+  q = Q16_16(3);
+  q *= Q16_16(0.5);
+  CHECK_RAW(q, 3 * 32768);
+
+  CHECK(Q16_16(-1) < Q16_16(0.5));
+  CHECK(Q16_16(0.5) > Q16_16(-1));
+  CHECK(Q16_16(2) <= Q16_16(2.0f) && Q16_16(2) >= Q16_16(2L));
+  CHECK(Q16_16(2) == Q16_16(2.0) && Q16_16(2) != Q16_16::fromRaw(131073));
+}
+
+static void checkRandom(long count)
+{
+  for (long n = 0; n < count && failures < 20; n++) {
+    int32_t a = rndRaw(), b = rndRaw();
+    Q16_16 qa = Q16_16::fromRaw(a), qb = Q16_16::fromRaw(b);
+
+    CHECK_RAW(qa + qb, wrapped((int64_t)a + b));
+    CHECK_RAW(qa - qb, wrapped((int64_t)a - b));
+    CHECK_RAW(-qa, wrapped(-(int64_t)a));
+    CHECK_RAW(qa * qb, refMul(a, b));
+    CHECK_RAW(qa / qb, refDiv(a, b));
+    CHECK((int32_t)qa == (int32_t)floor(a / 65536.0));
+    CHECK((qa < qb) == (a < b) && (qa == qb) == (a == b));
+
+    int32_t i = (int32_t)rnd() >> (rnd() % 32);
+    CHECK_RAW(Q16_16(i), clamp((int64_t)i * 65536));
+  }
+}
+
+int main(int argc, char **argv)
+{
+  long count = 1000000;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "n:")) != -1) {
+    switch (opt) {
+      case 'n': count = atol(optarg); break;
+      default:
+        fprintf(stderr, "usage: fixedpoint_test [-n count]\n");
+        return 2;
+    }
+  }
+
+  checkConstruction();
+  checkVectors();
+  checkRandom(count);
+
+  printf("result          %s (%d failures)\n", failures ? "FAILED" : "ok", failures);
+  return failures ? 1 : 0;
+}
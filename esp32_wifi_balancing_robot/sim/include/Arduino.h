@@ -0,0 +1,101 @@
+/*
+ * Arduino.h
+ *
+ *  Host (Linux) stand-in for the ESP32 Arduino core, used by the simulator.
+ *  Only the API used by the robot sources is provided. Time, pins, LEDC and
+ *  timers are routed to the simulated robot in sim.cpp.
+ *
+ *  Created on: 17.10.2026
+ *      Author: anonymous
+ */
+
+#ifndef SIM_ARDUINO_H_
+#define SIM_ARDUINO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 0x1
+#define LOW  0x0
+#define INPUT  0x01
+#define OUTPUT 0x02
+
+#define DEC 10
+#define HEX 16
+
+#define IRAM_ATTR
+
+#define F_CPU 240000000L
+
+#define bit(b) (1UL << (b))
+
+#ifndef constrain
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+#endif
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+
+unsigned long micros();
+unsigned long millis();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+
+double ledcSetup(uint8_t channel, double freq, uint8_t resolution_bits);
+void ledcAttachPin(uint8_t pin, uint8_t channel);
+void ledcWrite(uint8_t channel, uint32_t duty);
+
+// Minimal String: enough for the globals and the debug prints
+class String : public std::string {
+public:
+  String() {}
+  String(const char *s) : std::string(s) {}
+  String(const std::string &s) : std::string(s) {}
+};
+
+// Serial output goes to stderr and is muted unless the simulator runs with -v
+class HardwareSerial {
+public:
+  bool enabled = false;
+  void begin(unsigned long) {}
+  void setDebugOutput(bool) {}
+  void print(const char *s) { if (enabled) fputs(s, stderr); }
+  void print(const String &s) { print(s.c_str()); }
+  void print(char c) { if (enabled) fputc(c, stderr); }
+  void print(long n, int base = DEC) { if (enabled) fprintf(stderr, base == HEX ? "%lX" : "%ld", n); }
+  void print(int n, int base = DEC) { print((long)n, base); }
+  void print(unsigned int n, int base = DEC) { print((long)n, base); }
+  void print(unsigned long n, int base = DEC) { print((long)n, base); }
+  void print(double d, int digits = 2) { if (enabled) fprintf(stderr, "%.*f", digits, d); }
+  void println() { print("\n"); }
+  template <typename T> void println(const T &v) { print(v); println(); }
+  template <typename T> void println(const T &v, int f) { print(v, f); println(); }
+};
+
+extern HardwareSerial Serial;
+
+// CPU cycle counter on the simulated clock. Inside a timer ISR every read
+// moves the ISR's own time on, so busy waits end and pulse widths can be measured
+uint32_t sim_cycle_count();
+
+class EspClass {
+public:
+  uint32_t getCycleCount() { return sim_cycle_count(); }
+};
+
+extern EspClass ESP;
+
+#endif /* SIM_ARDUINO_H_ */
@@ -0,0 +1,53 @@
+/*
+ * WiFiUdp.h
+ *
+ *  Host stand-in for the ESP32 WiFiUDP and IPAddress classes, used by the simulator.
+ *  A non blocking POSIX UDP socket on all interfaces: host tools (client/) reach the
+ *  simulated robot on 127.0.0.1.
+ *
+ *  Created on: 18.10.2026
+ *      Author: anonymous
+ */
+
+#ifndef SIM_WIFIUDP_H_
+#define SIM_WIFIUDP_H_
+
+#include <Arduino.h>
+
+#define SIM_UDP_BUFFER_LENGTH 1460
+
+class IPAddress {
+public:
+  IPAddress() : addr(0) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : addr((uint32_t)a << 24 | (uint32_t)b << 16 | (uint32_t)c << 8 | d) {}
+  bool operator==(const IPAddress &other) const { return addr == other.addr; }
+  bool operator!=(const IPAddress &other) const { return addr != other.addr; }
+  uint32_t addr;     // host order
+};
+
+class WiFiUDP {
+public:
+  WiFiUDP() : fd(-1), rx_length(0), rx_pos(0), tx_length(0), remote_port(0), tx_port(0) {}
+  uint8_t begin(uint16_t port);
+  void stop();
+
+  int parsePacket();      // size of the next datagram, 0 when none
+  int read(uint8_t *buffer, size_t length);
+  IPAddress remoteIP() { return remote_ip; }
+  uint16_t remotePort() { return remote_port; }
+
+  int beginPacket(IPAddress ip, uint16_t port);
+  size_t write(const uint8_t *buffer, size_t size);
+  int endPacket();
+
+private:
+  int fd;
+  uint8_t rx[SIM_UDP_BUFFER_LENGTH];
+  int rx_length, rx_pos;
+  uint8_t tx[SIM_UDP_BUFFER_LENGTH];
+  size_t tx_length;
+  IPAddress remote_ip, tx_ip;
+  uint16_t remote_port, tx_port;
+};
+
+#endif /* SIM_WIFIUDP_H_ */
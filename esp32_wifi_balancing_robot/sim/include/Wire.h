@@ -0,0 +1,46 @@
+/*
+ * Wire.h
+ *
+ *  Host stand-in for the Arduino TwoWire API, used by the simulator.
+ *  Transactions are served by the simulated I2C devices in sim.cpp and
+ *  advance the simulated clock by their time on the bus.
+ *
+ *  Created on: 17.10.2026
+ *      Author: anonymous
+ */
+
+#ifndef SIM_WIRE_H_
+#define SIM_WIRE_H_
+
+#include <Arduino.h>
+
+#define SIM_WIRE_BUFFER_LENGTH 128
+
+class TwoWire {
+public:
+  bool begin();
+  void setClock(uint32_t frequency);
+  uint32_t getClock() { return clock; }
+
+  void beginTransmission(uint16_t address);
+  uint8_t endTransmission(bool sendStop = true);
+  size_t write(uint8_t data);
+  size_t write(const uint8_t *data, size_t quantity);
+
+  uint8_t requestFrom(int address, int size, int sendStop = true);
+  int available() { return rxLength - rxIndex; }
+  int read() { return rxIndex < rxLength ? rxBuffer[rxIndex++] : -1; }
+
+private:
+  uint32_t clock = 100000;
+  uint16_t txAddress = 0;
+  uint8_t txBuffer[SIM_WIRE_BUFFER_LENGTH];
+  size_t txLength = 0;
+  uint8_t rxBuffer[SIM_WIRE_BUFFER_LENGTH];
+  size_t rxLength = 0;
+  size_t rxIndex = 0;
+};
+
+extern TwoWire Wire;
+
+#endif /* SIM_WIRE_H_ */
@@ -0,0 +1,12 @@
+/*
+ * driver/periph_ctrl.h
+ *
+ *  Empty host stand-in used by the simulator.
+ */
+
+#ifndef SIM_DRIVER_PERIPH_CTRL_H_
+#define SIM_DRIVER_PERIPH_CTRL_H_
+
+#include <stdint.h>
+
+#endif /* SIM_DRIVER_PERIPH_CTRL_H_ */
@@ -0,0 +1,12 @@
+/*
+ * driver/timer.h
+ *
+ *  Empty host stand-in used by the simulator.
+ */
+
+#ifndef SIM_DRIVER_TIMER_H_
+#define SIM_DRIVER_TIMER_H_
+
+#include <stdint.h>
+
+#endif /* SIM_DRIVER_TIMER_H_ */
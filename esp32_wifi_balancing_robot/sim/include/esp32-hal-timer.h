@@ -0,0 +1,28 @@
+/*
+ * esp32-hal-timer.h
+ *
+ *  Host stand-in for the ESP32 hardware timer API, used by the simulator.
+ *  Timers tick at 80MHz / divider on the simulated clock and call their
+ *  ISR when the alarm value is reached (auto reload).
+ *
+ *  Created on: 17.10.2026
+ *      Author: anonymous
+ */
+
+#ifndef SIM_ESP32_HAL_TIMER_H_
+#define SIM_ESP32_HAL_TIMER_H_
+
+#include <stdint.h>
+
+struct hw_timer_s;
+typedef struct hw_timer_s hw_timer_t;
+
+hw_timer_t * timerBegin(uint8_t timer, uint16_t divider, bool countUp);
+void timerAttachInterrupt(hw_timer_t *timer, void (*fn)(void), bool edge);
+void timerAlarmWrite(hw_timer_t *timer, uint64_t alarm_value, bool autoreload);
+void timerAlarmEnable(hw_timer_t *timer);
+void timerAlarmDisable(hw_timer_t *timer);
+uint64_t timerRead(hw_timer_t *timer);
+void timerWrite(hw_timer_t *timer, uint64_t val);
+
+#endif /* SIM_ESP32_HAL_TIMER_H_ */
@@ -0,0 +1,12 @@
+/*
+ * esp_types.h
+ *
+ *  Empty host stand-in used by the simulator.
+ */
+
+#ifndef SIM_ESP_TYPES_H_
+#define SIM_ESP_TYPES_H_
+
+#include <stdint.h>
+
+#endif /* SIM_ESP_TYPES_H_ */
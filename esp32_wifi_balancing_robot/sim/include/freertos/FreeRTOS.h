@@ -0,0 +1,27 @@
+/*
+ * freertos/FreeRTOS.h
+ *
+ *  Host stand-in used by the simulator. The simulated robot is single
+ *  threaded, so critical sections are no-ops (counted in ISRs, see sim_isr_stats()).
+ *
+ *  Created on: 17.10.2026
+ *      Author: anonymous
+ */
+
+#ifndef SIM_FREERTOS_H_
+#define SIM_FREERTOS_H_
+
+typedef struct {
+  int owner;
+  int count;
+} portMUX_TYPE;
+
+void sim_critical_section(portMUX_TYPE *mux);
+
+#define portMUX_INITIALIZER_UNLOCKED {0, 0}
+#define portENTER_CRITICAL_ISR(mux) sim_critical_section(mux)
+#define portEXIT_CRITICAL_ISR(mux) ((void)(mux))
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+
+#endif /* SIM_FREERTOS_H_ */
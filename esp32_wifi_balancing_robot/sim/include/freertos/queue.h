@@ -0,0 +1,12 @@
+/*
+ * freertos/queue.h
+ *
+ *  Empty host stand-in used by the simulator.
+ */
+
+#ifndef SIM_FREERTOS_QUEUE_H_
+#define SIM_FREERTOS_QUEUE_H_
+
+#include "freertos/FreeRTOS.h"
+
+#endif /* SIM_FREERTOS_QUEUE_H_ */
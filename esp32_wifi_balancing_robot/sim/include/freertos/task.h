@@ -0,0 +1,12 @@
+/*
+ * freertos/task.h
+ *
+ *  Empty host stand-in used by the simulator.
+ */
+
+#ifndef SIM_FREERTOS_TASK_H_
+#define SIM_FREERTOS_TASK_H_
+
+#include "freertos/FreeRTOS.h"
+
+#endif /* SIM_FREERTOS_TASK_H_ */
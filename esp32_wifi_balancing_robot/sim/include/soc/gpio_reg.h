@@ -0,0 +1,18 @@
+/*
+ * soc/gpio_reg.h
+ *
+ *  Host stand-in for the ESP32 GPIO registers used by the robot, simulator only.
+ *
+ *  Created on: 18.10.2026
+ *      Author: anonymous
+ */
+
+#ifndef SIM_SOC_GPIO_REG_H_
+#define SIM_SOC_GPIO_REG_H_
+
+#include "soc/soc.h"
+
+#define GPIO_OUT_W1TS_REG (DR_REG_GPIO_BASE + 0x0008)  // set the bits of GPIO0-31
+#define GPIO_OUT_W1TC_REG (DR_REG_GPIO_BASE + 0x000c)  // clear the bits of GPIO0-31
+
+#endif /* SIM_SOC_GPIO_REG_H_ */
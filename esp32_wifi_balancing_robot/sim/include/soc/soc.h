@@ -0,0 +1,22 @@
+/*
+ * soc/soc.h
+ *
+ *  Host stand-in for the ESP32 register access macros, used by the simulator.
+ *  Register writes go to the simulated peripherals in sim.cpp.
+ *
+ *  Created on: 18.10.2026
+ *      Author: anonymous
+ */
+
+#ifndef SIM_SOC_SOC_H_
+#define SIM_SOC_SOC_H_
+
+#include <stdint.h>
+
+#define DR_REG_GPIO_BASE 0x3ff44000
+
+void sim_reg_write(uint32_t reg, uint32_t value);
+
+#define REG_WRITE(_r, _v) sim_reg_write((_r), (_v))
+
+#endif /* SIM_SOC_SOC_H_ */
@@ -0,0 +1,12 @@
+/*
+ * soc/timer_group_struct.h
+ *
+ *  Empty host stand-in used by the simulator.
+ */
+
+#ifndef SIM_SOC_TIMER_GROUP_STRUCT_H_
+#define SIM_SOC_TIMER_GROUP_STRUCT_H_
+
+#include <stdint.h>
+
+#endif /* SIM_SOC_TIMER_GROUP_STRUCT_H_ */
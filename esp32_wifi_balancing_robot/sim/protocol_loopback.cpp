@@ -0,0 +1,336 @@
+/*
+ * protocol_loopback.cpp
+ *
+ *  Loopback test of the binary UDP protocol: the robot side (Protocol.cpp, on the simulated
+ *  clock) and the Linux client (client/) talk over real datagrams on 127.0.0.1.
+ *  Checks the decoding of every frame, the commands applied by processOSCMsg() (gains, sleep
+ *  and wake), the dropping of stale and malformed frames, the drive timeout, the beep, a 200Hz
+ *  telemetry stream and the IMU trace recording, and measures the command latency (client send
+ *  to the OSC variables set by protocolHandle(), host time).
+ *
+ *  Usage: protocol_loopback [commands]
+ *  Exit status is 0 when every check passed.
+ *
+ *  Created on: 18.10.2026
+ *      Author: anonymous
+ */
+
+#include <Arduino.h>
+#include <time.h>
+#include <sys/socket.h>
+#include "../Protocol.h"
+#include "../Trace.h"
+#include "../defines.h"
+#include "../globals.h"
+#include <Wire.h>
+#include "../MPU6050.h"
+#include "../client/client.h"
+#include "sim.h"
+
+void initTimers();
+
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("FAILED line %d: %s\n", __LINE__, #cond); failures++; } } while (0)
+#define NEAR(a, b) (fabs((a) - (b)) < 0.001)
+
+static uint64_t host_ns()
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1000000000ULL + t.tv_nsec;
+}
+
+// loop() of the robot for ms milliseconds of simulated time
+static void run(int ms)
+{
+  for (int i = 0; i < ms; i++) {
+    sim_advance(1000000);
+    protocolHandle();
+  }
+}
+
+static void checkCommands(BrobotClient *c)
+{
+  OSCnewMessage = 0;
+  CHECK(client_drive(c, 0.5, -0.25, PROTO_DRIVE_PRO | PROTO_DRIVE_SERVO));
+  run(1);
+  CHECK(OSCnewMessage && OSCpage == 1);
+  CHECK(NEAR(OSCfader[0], 0.75) && NEAR(OSCfader[1], 0.375));
+  CHECK(OSCtoggle[0] == 1 && OSCpush[0] == 1);
+
+  // Neutral is exact, so processOSCMsg() sets throttle 0
+  CHECK(client_drive(c, 0, 0, 0));
+  run(1);
+  CHECK(OSCfader[0] == 0.5f && OSCfader[1] == 0.5f && OSCtoggle[0] == 0 && OSCpush[0] == 0);
+
+  CHECK(client_move(c, 100, 400, -400));
+  run(1);
+  CHECK(OSCmove_mode && OSCmove_speed == 100 && OSCmove_steps1 == 400 && OSCmove_steps2 == -400);
+  OSCmove_mode = 0;
+
+  CHECK(client_tune(c, 1.0, 0.5, 2.0, 0.0, PROTO_TUNE_CALIBRATE));
+  run(1);
+  CHECK(OSCpage == 2 && NEAR(OSCfader[0], 0.5) && NEAR(OSCfader[1], 0.25) && NEAR(OSCfader[2], 1.0) && OSCfader[3] == 0);
+  CHECK(OSCpush[2] == 1 && OSCtoggle[0] == 0);
+  OSCpush[2] = 0;
+
+  CHECK(client_aux(c, PROTO_AUX_LED | PROTO_AUX_BEEP));
+  run(1);
+  CHECK(digitalRead(PIN_LED) == HIGH);
+  run(100);
+  CHECK(digitalRead(PIN_BUZZER) == HIGH);
+  run(100);
+  CHECK(digitalRead(PIN_BUZZER) == LOW);
+  run(100);
+  CHECK(digitalRead(PIN_BUZZER) == HIGH);
+  run(200);
+  CHECK(digitalRead(PIN_BUZZER) == LOW);
+  CHECK(client_aux(c, 0));
+  run(1);
+  CHECK(digitalRead(PIN_LED) == LOW);
+}
+
+static void checkDrops(BrobotClient *c)
+{
+  uint8_t bad[sizeof(ProtoDrive)] = { 0x42, PROTO_DRIVE };
+
+  CHECK(client_drive(c, 0.2, 0, 0));
+  run(1);
+  OSCnewMessage = 0;
+
+  // Reordered: a frame older than the one applied
+  c->seq -= 2;
+  CHECK(client_drive(c, 1.0, 0, 0));
+  c->seq += 2;
+  // Wrong magic, wrong length, unknown type
+  send(c->fd, bad, sizeof(bad), 0);
+  bad[0] = PROTO_MAGIC;
+  send(c->fd, bad, sizeof(bad) - 1, 0);
+  bad[1] = 99;
+  send(c->fd, bad, sizeof(bad), 0);
+  run(1);
+  CHECK(!OSCnewMessage && NEAR(OSCfader[0], 0.6));
+
+  // Lost link: neutral after PROTO_DRIVE_TIMEOUT
+  run(PROTO_DRIVE_TIMEOUT - 10);
+  CHECK(NEAR(OSCfader[0], 0.6));
+  run(20);
+  CHECK(OSCnewMessage && OSCfader[0] == 0.5f);
+}
+
+static void checkTelemetry(BrobotClient *c)
+{
+  ProtoTelemetry t;
+  int frames = 0, gaps = 0;
+  uint16_t seq = 0;
+  bool match = true;
+
+  angle_adjusted = 12.5;
+  steps1 = 1234;
+  steps2 = -4321;
+  speed_M1 = 250;
+  dt = 0.01;
+  CHECK(client_subscribe(c, PROTO_TELEMETRY_MIN_PERIOD));
+  for (int ms = 0; ms < 1000; ms++) {
+    run(1);
+    while (client_telemetry(c, &t, 0) == 1) {
+      if (frames > 0 && (uint16_t)(t.h.seq - seq) != 1)
+        gaps++;
+      seq = t.h.seq;
+      frames++;
+      if (t.angle != 12.5f || t.steps1 != 1234 || t.steps2 != -4321 || t.speed_M1 != 250 || t.control_period != 10000)
+        match = false;
+    }
+  }
+  printf("telemetry       %d frames in 1 s of robot time (period %d ms), %d gaps\n", frames, PROTO_TELEMETRY_MIN_PERIOD, gaps);
+  CHECK(frames >= 199 && frames <= 201);
+  CHECK(gaps == 0 && match);
+
+  CHECK(client_subscribe(c, 0));
+  run(50);
+  while (client_telemetry(c, &t, 0) == 1)
+    ;
+  run(50);
+  CHECK(client_telemetry(c, &t, 0) == 0);
+}
+
+// Parse the records of the TRACE frames received so far. Return the number of samples, -1 on a bad frame
+static int traceFrames(BrobotClient *c, int *states, int *lost, int *gaps, uint16_t *seq, int *frames)
+{
+  ProtoTrace t;
+  int n, samples = 0;
+
+  while ((n = client_trace(c, &t, 0)) > 0) {
+    if (*frames > 0 && t.h.seq != (uint16_t)(*seq + 1))
+      (*gaps)++;
+    *seq = t.h.seq;
+    (*frames)++;
+    if (t.flags != traceFlags())
+      return -1;
+    for (int pos = 0; pos < n; pos += traceRecordSize(t.data[pos])) {
+      uint8_t type = t.data[pos];
+      if (traceRecordSize(type) == 0 || pos + traceRecordSize(type) > n)
+        return -1;
+      if (type == TRACE_SAMPLE)
+        samples++;
+      else if (type == TRACE_STATE)
+        (*states)++;
+      else if (type == TRACE_LOST)
+        (*lost)++;
+    }
+  }
+  return samples;
+}
+
+// One control update as seen by the recorder: a sample and the control record
+static void traceUpdate(uint32_t time)
+{
+  int16_t raw[7] = { 1, 2, 3, 4, 5, 6, 7 };
+  traceSample(time, raw);
+  traceControl(time, 0, 0, true);
+}
+
+static void checkTrace(BrobotClient *c)
+{
+  int states = 0, lost = 0, gaps = 0, frames = 0, samples = 0, n;
+  uint16_t seq = 0;
+
+  CHECK(client_record(c, true));
+  run(1);
+  CHECK(traceRecording());
+  // 2 s of 100Hz updates; the recording starts at the end of the first one
+  for (int i = 0; i <= 200; i++) {
+    traceUpdate(micros());
+    run(10);
+    n = traceFrames(c, &states, &lost, &gaps, &seq, &frames);
+    CHECK(n >= 0);
+    samples += n;
+  }
+  CHECK(client_record(c, false));
+  run(1);
+  CHECK(!traceRecording());
+  run(PROTO_TRACE_PERIOD);
+  samples += traceFrames(c, &states, &lost, &gaps, &seq, &frames);
+  printf("trace           %d samples in %d frames, %d gaps\n", samples, frames, gaps);
+  CHECK(samples == 200 && states == 1 && lost == 0 && gaps == 0);
+  CHECK(frames >= 2000 / PROTO_TRACE_PERIOD - 1);
+
+  // Nobody drains the buffer for a while: the overflow is marked, and the recording goes on after it
+  states = 0;
+  CHECK(client_record(c, true));
+  run(1);
+  traceUpdate(micros());
+  for (size_t i = 0; i < TRACE_BUFFER_SIZE / (sizeof(TraceSample) + sizeof(TraceControl)) + 10; i++)
+    traceUpdate(micros());
+  run(10 * PROTO_TRACE_PERIOD);
+  traceUpdate(micros());
+  CHECK(client_record(c, false));
+  run(10 * PROTO_TRACE_PERIOD);
+  lost = 0;
+  CHECK(traceFrames(c, &states, &lost, &gaps, &seq, &frames) > 0);
+  CHECK(states == 1 && lost == 1 && traceAvailable() == 0);
+}
+
+// loop() of the robot for ms milliseconds: the decoded frames go through processOSCMsg() and controlLoop()
+static void runLoop(int ms)
+{
+  for (int i = 0; i < ms; i++) {
+    sim_advance(1000000);
+    protocolHandle();
+    if (OSCnewMessage) {
+      OSCnewMessage = 0;
+      processOSCMsg();
+    }
+    controlLoop();
+  }
+}
+
+#define GAIN(a, b) (fabs((a) - (b)) < 0.001 * (b))
+
+// The commands applied by processOSCMsg(): gains of the first TUNE frame after page 1, sleep and wake
+static void checkProcessing(BrobotClient *c)
+{
+  CHECK(client_drive(c, 0, 0, 0));
+  runLoop(1);
+  CHECK(!modifing_control_parameters && !robot_sleeping);
+
+  CHECK(client_tune(c, 1.5, 0.5, 1.25, 0.75, 0));
+  runLoop(1);
+  CHECK(GAIN(Kp_user, KP * 1.5) && GAIN(Kd_user, KD * 0.5) && GAIN(Kp_thr_user, KP_THROTTLE * 1.25) && GAIN(Ki_thr_user, KI_THROTTLE * 0.75));
+  CHECK(!robot_sleeping);
+
+  // Sleep: loop() goes on with the motors off, a later TUNE frame wakes the robot
+  CHECK(client_tune(c, 1.5, 0.5, 1.25, 0.75, PROTO_TUNE_SLEEP));
+  runLoop(10);
+  CHECK(robot_sleeping && digitalRead(PIN_ENABLE_MOTORS) == HIGH);
+  CHECK(GAIN(Kp_user, KP * 1.5));
+  CHECK(client_tune(c, 1.0, 1.0, 1.0, 1.0, 0));
+  runLoop(1);
+  CHECK(!robot_sleeping && GAIN(Kp_user, KP));
+
+  // A DRIVE frame wakes it too, and its throttle applies at once
+  CHECK(client_tune(c, 1.0, 1.0, 1.0, 1.0, PROTO_TUNE_SLEEP));
+  runLoop(1);
+  CHECK(robot_sleeping);
+  CHECK(client_drive(c, 0.5, 0, 0));
+  runLoop(1);
+  CHECK(!robot_sleeping && OSCpage == 1 && throttle == (int16_t)(0.25 * max_throttle));
+
+  CHECK(client_drive(c, 0, 0, 0));
+  runLoop(1);
+}
+
+// Host time from the send to the command applied by the next loop() pass
+static void measureLatency(BrobotClient *c, int commands)
+{
+  uint64_t sum = 0, worst = 0;
+
+  for (int i = 0; i < commands; i++) {
+    OSCnewMessage = 0;
+    uint64_t t0 = host_ns();
+    client_drive(c, (i & 1) ? 0.1 : -0.1, 0, 0);
+    while (!OSCnewMessage)
+      protocolHandle();
+    uint64_t latency = host_ns() - t0;
+    sum += latency;
+    if (latency > worst)
+      worst = latency;
+  }
+  printf("latency         %.1f us mean, %.1f us max (%d DRIVE frames, send to applied)\n", sum * 1e-3 / commands, worst * 1e-3,
+         commands);
+}
+
+int main(int argc, char **argv)
+{
+  SimParams params;
+  BrobotClient c;
+  int commands = argc > 1 ? atoi(argv[1]) : 1000;
+
+  sim_init(params, 0);
+  sim_hold(true);
+  pinMode(PIN_LED, OUTPUT);
+  pinMode(PIN_BUZZER, OUTPUT);
+  pinMode(PIN_ENABLE_MOTORS, OUTPUT);
+  pinMode(PIN_MOTOR1_STEP, OUTPUT);
+  pinMode(PIN_MOTOR2_STEP, OUTPUT);
+  Wire.begin();
+  MPU6050_setup();      // controlLoop() runs in checkProcessing()
+  initTimers();
+  protocolBegin();
+  if (!client_open(&c, "127.0.0.1", PROTO_PORT)) {
+    fprintf(stderr, "protocol_loopback: no UDP socket\n");
+    return 2;
+  }
+
+  checkCommands(&c);
+  checkDrops(&c);
+  checkProcessing(&c);
+  checkTelemetry(&c);
+  checkTrace(&c);
+  measureLatency(&c, commands);
+
+  client_close(&c);
+  printf("result          %s (%d failures)\n", failures ? "FAILED" : "ok", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,574 @@
+/*
+ * sim.cpp
+ *
+ *  Host simulator for the ESP32 balancing robot: implementation of the
+ *  Arduino/ESP32 stand-ins (sim/include) on top of a simulated clock.
+ *
+ *  Everything is deterministic: time only moves when the firmware spends it
+ *  (I2C transfers, delay(), the fixed loop overhead added by brobot_sim.cpp)
+ *  and sensor noise comes from a seeded generator.
+ *
+ *  Created on: 17.10.2026
+ *      Author: anonymous
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <time.h>
+#include "esp32-hal-timer.h"
+#include "freertos/FreeRTOS.h"
+#include "soc/gpio_reg.h"
+#include "../defines.h"
+#include "../MPU6050.h"
+#include "sim.h"
+
+HardwareSerial Serial;
+TwoWire Wire;
+EspClass ESP;
+
+#define PHYSICS_STEP_NS 100000ULL  // 10kHz physics integration
+#define SENSOR_STEP_NS 1000000ULL  // MPU6050 internal sample clock (1kHz with DLPF on)
+#define GRAVITY 9.81
+#define STEPS_PER_REV (200.0 * MICROSTEPPING)
+#define MAX_TILT (80.0 * GRAD2RAD) // Body rests on the ground here
+#define CYCLE_COUNT_READ_NS 25     // a read of the cycle counter and the compare of a busy wait, 6 cycles at 240Mhz
+
+struct hw_timer_s
+{
+  uint16_t divider;
+  uint64_t alarm;       // in timer ticks
+  uint64_t start;       // ns, time of the last reload
+  void (*fn)(void);
+  bool enabled;
+};
+
+static SimParams P;
+static SimState S;
+static bool held;
+static uint64_t now_ns;
+static uint64_t next_physics_ns;
+static uint64_t next_sensor_ns;
+static uint64_t model_host_ns;
+static bool timing;
+
+static double wheel_rate[2];
+static double wheel_offset[2];   // rad, re-synced while the drivers are disabled
+static double accel_x;           // m/s^2, ground acceleration of the axle
+static double pitch_acc;         // rad/s^2
+static uint8_t pins[40];
+
+static hw_timer_t timers[4];
+static sim_step_fn step_fn;
+static bool isr_profiling, in_isr;
+static SimIsrStats isr_stats;
+static uint64_t isr_shim_cycles;
+static bool isr_running;
+static uint64_t isr_ns;          // time the running timer ISR has spent, by its cycle counter reads
+static uint64_t step_rise_ns[2];
+
+// ---------------------------------------------------------------------------
+// Deterministic noise
+
+static uint32_t rng_state;
+
+static double rng_uniform()
+{
+  rng_state = rng_state * 1664525u + 1013904223u;
+  return ((rng_state >> 8) + 0.5) / 16777216.0;
+}
+
+static double rng_gauss()
+{
+  return sqrt(-2.0 * log(rng_uniform())) * cos(2.0 * M_PI * rng_uniform());
+}
+
+// ---------------------------------------------------------------------------
+// MPU6050 register model
+
+static uint8_t mpu_regs[128];
+static uint8_t mpu_reg_ptr;
+static uint8_t mpu_fifo[MPU6050_FIFO_SIZE];
+static uint16_t mpu_fifo_head, mpu_fifo_count;
+static uint16_t mpu_sample_counter;
+static double lpf_accel_y, lpf_accel_z, lpf_gyro_x;
+static bool imu_external;     // samples come from sim_imu_inject(), not from the model
+
+// Gyro bandwidth in Hz for each DLPF_CFG setting (CONFIG register)
+static const double dlpf_hz[8] = { 256, 188, 98, 42, 20, 10, 5, 256 };
+
+static void mpu_put16(uint8_t reg, double value)
+{
+  int32_t v = lround(value);
+  v = constrain(v, -32768, 32767);
+  mpu_regs[reg] = (uint16_t)v >> 8;
+  mpu_regs[reg + 1] = (uint16_t)v & 0xff;
+}
+
+static void mpu_latch();
+
+static void mpu_sensor_tick()
+{
+  if (imu_external)
+    return;
+
+  // Specific force at the sensor (imu_height above the axle), rotated into the sensor frame, in g
+  double c = cos(S.pitch), s = sin(S.pitch);
+  double w2 = S.pitch_rate * S.pitch_rate;
+  double ax = accel_x - P.imu_height * (pitch_acc * c - w2 * s);
+  double az = GRAVITY - P.imu_height * (pitch_acc * s + w2 * c);
+  double fy = (ax * c + az * s) / GRAVITY;
+  double fz = (-ax * s + az * c) / GRAVITY;
+  double rate = S.pitch_rate * RAD2GRAD;
+
+  // DLPF modelled as a first order low pass at the configured bandwidth
+  double rc = 1.0 / (2.0 * M_PI * dlpf_hz[mpu_regs[MPU6050_CONFIG] & 0x07]);
+  double alpha = (SENSOR_STEP_NS * 1e-9) / (SENSOR_STEP_NS * 1e-9 + rc);
+  lpf_accel_y += alpha * (fy - lpf_accel_y);
+  lpf_accel_z += alpha * (fz - lpf_accel_z);
+  lpf_gyro_x += alpha * (rate - lpf_gyro_x);
+
+  if (mpu_sample_counter++ < mpu_regs[MPU6050_SMPLRT_DIV])
+    return;
+  mpu_sample_counter = 0;
+
+  double accel_lsb = 16384.0 / (1 << ((mpu_regs[MPU6050_ACCEL_CONFIG] >> 3) & 3));
+  double gyro_lsb = 131.0 / (1 << ((mpu_regs[MPU6050_GYRO_CONFIG] >> 3) & 3));
+  mpu_put16(MPU6050_ACCEL_XOUT_H, P.accel_noise * rng_gauss());
+  mpu_put16(MPU6050_ACCEL_YOUT_H, lpf_accel_y * accel_lsb + P.accel_noise * rng_gauss());
+  mpu_put16(MPU6050_ACCEL_ZOUT_H, lpf_accel_z * accel_lsb + P.accel_noise * rng_gauss());
+  mpu_put16(MPU6050_TEMP_OUT_H, (25.0 - 36.53) * 340.0);
+  mpu_put16(MPU6050_GYRO_XOUT_H, lpf_gyro_x * gyro_lsb + P.gyro_bias + P.gyro_noise * rng_gauss());
+  mpu_put16(MPU6050_GYRO_YOUT_H, P.gyro_noise * rng_gauss());
+  mpu_put16(MPU6050_GYRO_ZOUT_H, P.gyro_noise * rng_gauss());
+  mpu_latch();
+}
+
+// A new sample is in the data registers: copy it to the FIFO, raise DATA_RDY
+static void mpu_latch()
+{
+  // FIFO: enabled registers in register order; when full the oldest bytes are overwritten
+  if (mpu_regs[MPU6050_USER_CTRL] & bit(MPU6050_USER_FIFO_EN)) {
+    static const struct { uint8_t enable, reg, len; } sources[] = {
+      { MPU6050_ACCEL_FIFO_EN, MPU6050_ACCEL_XOUT_H, 6 },
+      { MPU6050_TEMP_FIFO_EN, MPU6050_TEMP_OUT_H, 2 },
+      { MPU6050_XG_FIFO_EN, MPU6050_GYRO_XOUT_H, 2 },
+      { MPU6050_YG_FIFO_EN, MPU6050_GYRO_YOUT_H, 2 },
+      { MPU6050_ZG_FIFO_EN, MPU6050_GYRO_ZOUT_H, 2 },
+    };
+    for (size_t i = 0; i < sizeof(sources) / sizeof(sources[0]); i++) {
+      if (!(mpu_regs[MPU6050_FIFO_EN] & bit(sources[i].enable)))
+        continue;
+      for (uint8_t k = 0; k < sources[i].len; k++) {
+        mpu_fifo[(mpu_fifo_head + mpu_fifo_count) % MPU6050_FIFO_SIZE] = mpu_regs[sources[i].reg + k];
+        if (mpu_fifo_count < MPU6050_FIFO_SIZE) {
+          mpu_fifo_count++;
+        } else {
+          mpu_fifo_head = (mpu_fifo_head + 1) % MPU6050_FIFO_SIZE;
+          mpu_regs[MPU6050_INT_STATUS] |= bit(MPU6050_FIFO_OFLOW_INT);
+        }
+      }
+    }
+  }
+  // The status bit is set whatever INT_ENABLE says (the sketch writes MPU6050_DATA_RDY_EN, i.e. 0, there)
+  mpu_regs[MPU6050_INT_STATUS] |= bit(MPU6050_DATA_RDY_INT);
+}
+
+static void mpu_write(const uint8_t *data, size_t len)
+{
+  if (len == 0)
+    return;
+  mpu_reg_ptr = data[0] & 0x7f;
+  for (size_t i = 1; i < len; i++) {
+    uint8_t reg = mpu_reg_ptr++ & 0x7f;
+    if (reg == MPU6050_PWR_MGMT_1 && (data[i] & bit(MPU6050_DEVICE_RESET))) {
+      memset(mpu_regs, 0, sizeof(mpu_regs));
+      mpu_regs[MPU6050_PWR_MGMT_1] = 0x40;
+      mpu_regs[MPU6050_WHO_AM_I] = MPU6050_I2C_ADDRESS;
+      continue;
+    }
+    if (reg == MPU6050_USER_CTRL && (data[i] & bit(MPU6050_FIFO_RESET))) {
+      mpu_fifo_head = 0;
+      mpu_fifo_count = 0;
+      mpu_regs[reg] = data[i] & ~bit(MPU6050_FIFO_RESET);  // self clearing
+      continue;
+    }
+    if (reg != MPU6050_WHO_AM_I && reg != MPU6050_INT_STATUS)
+      mpu_regs[reg] = data[i];
+  }
+}
+
+static uint8_t mpu_read()
+{
+  uint8_t reg = mpu_reg_ptr & 0x7f;
+  uint8_t value = mpu_regs[reg];
+
+  switch (reg) {
+    case MPU6050_INT_STATUS:
+      mpu_regs[reg] = 0;  // cleared on read
+      break;
+    case MPU6050_FIFO_COUNTH:
+      value = mpu_fifo_count >> 8;
+      break;
+    case MPU6050_FIFO_COUNTL:
+      value = mpu_fifo_count & 0xff;
+      break;
+    case MPU6050_FIFO_R_W:  // no auto increment: a burst read pops the FIFO
+      value = 0;
+      if (mpu_fifo_count > 0) {
+        value = mpu_fifo[mpu_fifo_head];
+        mpu_fifo_head = (mpu_fifo_head + 1) % MPU6050_FIFO_SIZE;
+        mpu_fifo_count--;
+      }
+      return value;
+  }
+  mpu_reg_ptr++;
+  return value;
+}
+
+// ---------------------------------------------------------------------------
+// Physics
+
+static void physics_step(double h)
+{
+  double k = 2.0 * M_PI / STEPS_PER_REV;
+  double wheel_accel[2];
+
+  S.motors_enabled = pins[PIN_ENABLE_MOTORS] == LOW;
+  for (int i = 0; i < 2; i++) {
+    if (S.motors_enabled) {
+      double target = S.steps[i] * k + wheel_offset[i];
+      wheel_accel[i] = P.motor_wn * P.motor_wn * (target - S.wheel[i]) - 2.0 * P.motor_zeta * P.motor_wn * wheel_rate[i];
+    } else {
+      wheel_accel[i] = -P.wheel_friction * wheel_rate[i];
+      wheel_offset[i] = S.wheel[i] - S.steps[i] * k;
+    }
+  }
+  double psi_acc = (wheel_accel[0] + wheel_accel[1]) / 2;
+
+  // Inverted pendulum on a wheel axle. The steppers impose the wheel rotation relative to the body,
+  // so the only free coordinate is the pitch; the equation comes from the Lagrangian of body + wheels
+  // (wheels as solid discs), including the motor reaction torque on the body.
+  // Ground position x = r * (wheel - pitch)
+  double r = P.wheel_radius;
+  double ml = P.body_mass * P.com_height;
+  double M = P.body_mass + 1.5 * P.wheel_mass;  // translating mass plus wheel inertia / r^2
+  double J = P.body_inertia + ml * P.com_height;
+  double c = cos(S.pitch), s = sin(S.pitch);
+  pitch_acc = 0;
+  if (!held)
+    pitch_acc = (psi_acc * (M * r * r + ml * r * c) + ml * r * s * S.pitch_rate * S.pitch_rate + ml * GRAVITY * s) / (M * r * r + 2 * ml * r * c + J);
+
+  accel_x = r * (psi_acc - pitch_acc);
+  for (int i = 0; i < 2; i++) {
+    wheel_rate[i] += wheel_accel[i] * h;
+    S.wheel[i] += wheel_rate[i] * h;
+  }
+  S.pitch_rate += pitch_acc * h;
+  S.pitch += S.pitch_rate * h;
+  if (fabs(S.pitch) > MAX_TILT) {
+    S.pitch = S.pitch > 0 ? MAX_TILT : -MAX_TILT;
+    S.pitch_rate = 0;
+  }
+  S.position += r * ((wheel_rate[0] + wheel_rate[1]) / 2 - S.pitch_rate) * h;
+}
+
+// ---------------------------------------------------------------------------
+// Simulated clock
+
+// Host cycle counter for the ISR profile (ns where there is none)
+static inline uint64_t host_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __builtin_ia32_rdtsc();
+#else
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1000000000ULL + t.tv_nsec;
+#endif
+}
+
+static uint64_t timer_next(const hw_timer_t *t)
+{
+  if (!t->enabled || t->fn == NULL)
+    return UINT64_MAX;
+  // APB clock is 80MHz: one tick is divider * 12.5ns
+  return t->start + t->alarm * t->divider * 25 / 2;
+}
+
+void sim_advance(uint64_t ns)
+{
+  struct timespec t0, t1;
+  bool timed = timing;
+  if (timed)
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+
+  uint64_t target = now_ns + ns;
+  while (true) {
+    uint64_t next = target;
+    if (next_physics_ns < next) next = next_physics_ns;
+    if (next_sensor_ns < next) next = next_sensor_ns;
+    for (int i = 0; i < 4; i++)
+      if (timer_next(&timers[i]) < next) next = timer_next(&timers[i]);
+    if (next > now_ns)  // an alarm moved below the count fires now
+      now_ns = next;
+
+    if (now_ns >= next_physics_ns) {
+      physics_step(PHYSICS_STEP_NS * 1e-9);
+      next_physics_ns += PHYSICS_STEP_NS;
+    }
+    if (now_ns >= next_sensor_ns) {
+      mpu_sensor_tick();
+      next_sensor_ns += SENSOR_STEP_NS;
+    }
+    for (int i = 0; i < 4; i++) {
+      if (timer_next(&timers[i]) <= now_ns) {
+        timers[i].start = now_ns;
+        isr_running = true;
+        isr_ns = 0;
+        if (isr_profiling) {
+          in_isr = true;
+          isr_shim_cycles = 0;
+          uint64_t c0 = host_cycles();
+          timers[i].fn();
+          isr_stats.cycles += host_cycles() - c0 - isr_shim_cycles;
+          isr_stats.calls++;
+          in_isr = false;
+        } else {
+          timers[i].fn();
+        }
+        isr_running = false;
+      }
+    }
+    if (now_ns == target)
+      break;
+  }
+  now_ns = target;
+
+  if (timed) {
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    model_host_ns += (t1.tv_sec - t0.tv_sec) * 1000000000ULL + t1.tv_nsec - t0.tv_nsec;
+  }
+}
+
+void sim_init(const SimParams &params, double initial_tilt_deg)
+{
+  P = params;
+  memset(&S, 0, sizeof(S));
+  S.pitch = initial_tilt_deg * GRAD2RAD;
+  held = true;
+  now_ns = 0;
+  next_physics_ns = 0;
+  next_sensor_ns = 0;
+  rng_state = params.seed;
+  lpf_accel_y = sin(S.pitch);
+  lpf_accel_z = cos(S.pitch);
+  lpf_gyro_x = 0;
+  memset(mpu_regs, 0, sizeof(mpu_regs));
+  mpu_regs[MPU6050_PWR_MGMT_1] = 0x40;
+  mpu_regs[MPU6050_WHO_AM_I] = MPU6050_I2C_ADDRESS;
+  mpu_fifo_head = 0;
+  mpu_fifo_count = 0;
+  for (int i = 0; i < 40; i++)
+    pins[i] = HIGH;
+}
+
+void sim_hold(bool hold) { held = hold; if (hold) S.pitch_rate = 0; }
+void sim_push(double pitch_rate_deg) { S.pitch_rate += pitch_rate_deg * GRAD2RAD; }
+uint64_t sim_now() { return now_ns; }
+const SimState &sim_state() { return S; }
+uint64_t sim_model_host_ns() { return model_host_ns; }
+void sim_timing(bool enable) { timing = enable; }
+void sim_on_step(sim_step_fn fn) { step_fn = fn; }
+
+void sim_isr_profile(bool enable)
+{
+  isr_profiling = enable;
+  memset(&isr_stats, 0, sizeof(isr_stats));
+  isr_stats.since_ns = now_ns;
+}
+
+void sim_isr_stats(SimIsrStats *stats) { *stats = isr_stats; }
+
+void sim_critical_section(portMUX_TYPE *mux)
+{
+  if (in_isr)
+    isr_stats.critical_sections++;
+}
+
+void sim_imu_external(bool external) { imu_external = external; }
+
+void sim_imu_inject(const int16_t *raw)
+{
+  static const uint8_t regs[7] = { MPU6050_ACCEL_XOUT_H, MPU6050_ACCEL_YOUT_H, MPU6050_ACCEL_ZOUT_H, MPU6050_TEMP_OUT_H,
+                                   MPU6050_GYRO_XOUT_H, MPU6050_GYRO_YOUT_H, MPU6050_GYRO_ZOUT_H };
+  for (int i = 0; i < 7; i++)
+    mpu_put16(regs[i], raw[i]);
+  mpu_latch();
+}
+
+bool sim_imu_data_soon(uint64_t ns)
+{
+  if (mpu_regs[MPU6050_INT_STATUS] & bit(MPU6050_DATA_RDY_INT))
+    return true;
+  uint64_t ticks = mpu_regs[MPU6050_SMPLRT_DIV] - mpu_sample_counter;
+  return next_sensor_ns + ticks * SENSOR_STEP_NS <= now_ns + ns;
+}
+
+// ---------------------------------------------------------------------------
+// Arduino core
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+
+uint32_t sim_cycle_count()
+{
+  uint64_t c0 = in_isr ? host_cycles() : 0;
+  uint64_t ns = now_ns;
+  if (isr_running) {
+    isr_ns += CYCLE_COUNT_READ_NS;
+    ns += isr_ns;
+  }
+  if (in_isr)
+    isr_shim_cycles += host_cycles() - c0;
+  return (uint32_t)(ns * (F_CPU / 1000000) / 1000);
+}
+
+static void set_pin(uint8_t pin, uint8_t val)
+{
+  int motor = pin == PIN_MOTOR1_STEP ? 0 : (pin == PIN_MOTOR2_STEP ? 1 : -1);
+  uint64_t edge_ns = now_ns + (isr_running ? isr_ns : 0);
+
+  // Step on the rising edge. Motor2 is mounted mirrored: its forward direction is DIR LOW (see Motors.cpp)
+  if (motor >= 0 && val == HIGH && pins[pin] == LOW) {
+    int dir = motor == 0 ? (pins[PIN_MOTOR1_DIR] == HIGH ? 1 : -1) : (pins[PIN_MOTOR2_DIR] == LOW ? 1 : -1);
+    S.steps[motor] += dir;
+    step_rise_ns[motor] = edge_ns;
+    if (step_fn)
+      step_fn(motor, dir, now_ns);
+  }
+  // STEP high time, as the driver sees it
+  if (motor >= 0 && val == LOW && pins[pin] == HIGH && isr_profiling && step_rise_ns[motor] >= isr_stats.since_ns) {
+    uint64_t high = edge_ns - step_rise_ns[motor];
+    if (isr_stats.step_pulses == 0 || high < isr_stats.step_high_min_ns)
+      isr_stats.step_high_min_ns = high;
+    if (high > isr_stats.step_high_max_ns)
+      isr_stats.step_high_max_ns = high;
+    isr_stats.step_pulses++;
+  }
+  pins[pin] = val;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+  uint64_t c0 = in_isr ? host_cycles() : 0;
+  if (pin < 40)
+    set_pin(pin, val);
+  if (in_isr) {
+    isr_stats.digital_writes++;
+    isr_shim_cycles += host_cycles() - c0;
+  }
+}
+
+// GPIO0-31 set/clear registers
+void sim_reg_write(uint32_t reg, uint32_t value)
+{
+  uint64_t c0 = in_isr ? host_cycles() : 0;
+  if (reg == GPIO_OUT_W1TS_REG || reg == GPIO_OUT_W1TC_REG) {
+    for (uint8_t pin = 0; pin < 32; pin++)
+      if (value & bit(pin))
+        set_pin(pin, reg == GPIO_OUT_W1TS_REG ? HIGH : LOW);
+  }
+  if (in_isr) {
+    isr_stats.reg_writes++;
+    isr_shim_cycles += host_cycles() - c0;
+  }
+}
+
+int digitalRead(uint8_t pin) { return pin < 40 ? pins[pin] : LOW; }
+
+unsigned long micros() { return now_ns / 1000; }
+unsigned long millis() { return now_ns / 1000000; }
+void delay(uint32_t ms) { sim_advance(ms * 1000000ULL); }
+void delayMicroseconds(uint32_t us) { sim_advance(us * 1000ULL); }
+
+double ledcSetup(uint8_t channel, double freq, uint8_t resolution_bits) { return freq; }
+void ledcAttachPin(uint8_t pin, uint8_t channel) {}
+void ledcWrite(uint8_t channel, uint32_t duty) {}
+
+// ---------------------------------------------------------------------------
+// ESP32 timers
+
+hw_timer_t * timerBegin(uint8_t num, uint16_t divider, bool countUp)
+{
+  hw_timer_t *t = &timers[num & 3];
+  t->divider = divider;
+  t->alarm = 0;
+  t->start = now_ns;
+  t->fn = NULL;
+  t->enabled = false;
+  return t;
+}
+
+void timerAttachInterrupt(hw_timer_t *timer, void (*fn)(void), bool edge) { timer->fn = fn; }
+
+// The counter keeps running: a new alarm value lower than the current count fires on the next tick
+void timerAlarmWrite(hw_timer_t *timer, uint64_t alarm_value, bool autoreload) { timer->alarm = alarm_value; }
+void timerAlarmEnable(hw_timer_t *timer) { timer->enabled = true; timer->start = now_ns; }
+void timerAlarmDisable(hw_timer_t *timer) { timer->enabled = false; }
+uint64_t timerRead(hw_timer_t *timer) { return (now_ns - timer->start) * 2 / (timer->divider * 25); }
+void timerWrite(hw_timer_t *timer, uint64_t val) { timer->start = now_ns - val * timer->divider * 25 / 2; }
+
+// ---------------------------------------------------------------------------
+// I2C: each byte costs 9 clocks, plus start/stop
+
+static void i2c_bus_time(size_t bytes)
+{
+  sim_advance((bytes * 9 + 2) * 1000000000ULL / Wire.getClock());
+}
+
+bool TwoWire::begin() { clock = 100000; return true; }
+void TwoWire::setClock(uint32_t frequency) { clock = frequency; }
+
+void TwoWire::beginTransmission(uint16_t address)
+{
+  txAddress = address;
+  txLength = 0;
+}
+
+size_t TwoWire::write(uint8_t data)
+{
+  if (txLength >= SIM_WIRE_BUFFER_LENGTH)
+    return 0;
+  txBuffer[txLength++] = data;
+  return 1;
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t quantity)
+{
+  size_t n = 0;
+  while (n < quantity && write(data[n]))
+    n++;
+  return n;
+}
+
+uint8_t TwoWire::endTransmission(bool sendStop)
+{
+  i2c_bus_time(txLength + 1);
+  if (txAddress != MPU6050_I2C_ADDRESS)
+    return 2;  // NACK on address
+  mpu_write(txBuffer, txLength);
+  return 0;
+}
+
+uint8_t TwoWire::requestFrom(int address, int size, int sendStop)
+{
+  rxIndex = 0;
+  rxLength = 0;
+  i2c_bus_time(size + 1);
+  if (address != MPU6050_I2C_ADDRESS)
+    return 0;
+  if (size > SIM_WIRE_BUFFER_LENGTH)
+    size = SIM_WIRE_BUFFER_LENGTH;
+  while (rxLength < (size_t)size)
+    rxBuffer[rxLength++] = mpu_read();
+  return size;
+}
@@ -0,0 +1,89 @@
+/*
+ * sim.h
+ *
+ *  Host simulator for the ESP32 balancing robot.
+ *  Simulated clock, ESP32 timers, GPIO, MPU6050 on I2C and the physics of an
+ *  inverted pendulum driven by two stepper wheels.
+ *
+ *  Created on: 17.10.2026
+ *      Author: anonymous
+ */
+
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stdint.h>
+
+struct SimParams
+{
+  double body_mass = 0.8;          // kg (everything above the axle)
+  double com_height = 0.05;        // m, axle to centre of mass
+  double body_inertia = 0.006;     // kg*m^2 about the centre of mass
+  double wheel_radius = 0.05;      // m
+  double wheel_mass = 0.2;         // kg, both wheels
+  double imu_height = 0.06;        // m, axle to MPU6050
+  double motor_wn = 300.0;         // rad/s, stepper rotor stiffness (rotor follows the step position as a 2nd order system)
+  double motor_zeta = 0.7;
+  double wheel_friction = 2.0;     // 1/s, viscous friction on free (disabled) wheels
+  double gyro_bias = 25.0;         // LSB
+  double gyro_noise = 4.0;         // LSB rms
+  double accel_noise = 60.0;       // LSB rms
+  uint32_t seed = 1;
+};
+
+struct SimState
+{
+  double pitch;          // rad, true body tilt, same sign as the firmware angle
+  double pitch_rate;     // rad/s
+  double position;       // m, ground position of the axle (positive: forward)
+  double wheel[2];       // rad, wheel angle relative to the body (positive: forward)
+  bool motors_enabled;
+  int32_t steps[2];      // step pulses seen on the STEP pins (positive: forward)
+};
+
+void sim_init(const SimParams &params, double initial_tilt_deg);
+// Hold the body still (robot in the hands of the user), e.g. during calibration
+void sim_hold(bool hold);
+// Add an angular velocity impulse (deg/s) to the body, e.g. a push
+void sim_push(double pitch_rate_deg);
+
+// Advance the simulated clock, running physics, sensor and timer ISRs
+void sim_advance(uint64_t ns);
+uint64_t sim_now();                   // ns since start
+const SimState &sim_state();
+
+// Feed the MPU6050 with recorded samples instead of the model (trace replay): inject one sample
+// (accel x,y,z, temperature, gyro x,y,z) into the data registers and the FIFO, and raise DATA_RDY
+void sim_imu_external(bool external);
+void sim_imu_inject(const int16_t *raw);
+
+// True when the MPU6050 has a sample ready or will latch one within ns
+bool sim_imu_data_soon(uint64_t ns);
+
+// Host time spent inside sim_advance() while timing is enabled, to separate model cost from firmware cost
+void sim_timing(bool enable);
+uint64_t sim_model_host_ns();
+
+// Called on every step pulse (rising STEP edge), motor 0 or 1, dir +1 forward / -1 backward
+typedef void (*sim_step_fn)(int motor, int dir, uint64_t ns);
+void sim_on_step(sim_step_fn fn);
+
+// Profile of the timer ISRs (enable resets it). Host cycles exclude the time spent in the
+// stand-ins (digitalWrite, register writes), which cost nothing like the ESP32 versions: the
+// calls are counted instead
+struct SimIsrStats
+{
+  uint64_t calls;
+  uint64_t cycles;              // host cycles in the firmware code of the ISRs
+  uint64_t digital_writes;
+  uint64_t reg_writes;
+  uint64_t critical_sections;
+  uint64_t since_ns;            // profile start
+  uint64_t step_pulses;         // STEP pulses completed since then, with their high time
+  uint64_t step_high_min_ns;
+  uint64_t step_high_max_ns;
+};
+void sim_isr_profile(bool enable);
+void sim_isr_stats(SimIsrStats *stats);
+
+#endif /* SIM_H_ */
@@ -0,0 +1,173 @@
+/*
+ * stepgen_bench.cpp
+ *
+ *  Host harness for the step generator (Motors.cpp / Timers.cpp).
+ *  Drives setMotorSpeedM1/M2 with a speed profile at the 100Hz control rate,
+ *  runs the timer ISRs on the simulated clock and compares every step pulse
+ *  with the ideal profile (the commanded speed integrated exactly).
+ *  ISR cost is measured in host cycles: compare builds, not absolute numbers.
+ *  Fails when a STEP pulse is shorter than the driver minimum high time.
+ *
+ *  Usage: stepgen_bench [-r repeats] [-v]
+ *    -r n   run the profile n times (default 4)
+ *    -v     print every control tick
+ *
+ *  Created on: 18.10.2026
+ *      Author: anonymous
+ */
+
+#include <Arduino.h>
+#include <unistd.h>
+#include "../Motors.h"
+#include "../defines.h"
+#include "../globals.h"
+#include "sim.h"
+
+#define TICK_NS 10000000ULL   // 100Hz control loop
+#define DRIVER_HIGH_NS 1900   // minimum STEP high time of the DRV8825 (A4988: 1000)
+
+#if MICROSTEPPING==16
+#define STEPS_PER_SPEED 50.0  // steps/s per speed unit, as in Motors.cpp
+#else
+#define STEPS_PER_SPEED 25.0
+#endif
+
+void initTimers();
+
+// Speed profile: target speed held for a time, setMotorSpeed applies MAX_ACCEL
+struct Segment
+{
+  double seconds;
+  int16_t speed;       // target, or amplitude of the oscillation
+  double hz;           // 0: constant target, else a sine like the balancing loop makes
+};
+
+static const Segment profile[] = {
+  { 0.1, 0, 0 },
+  { 1.0, MAX_CONTROL_OUTPUT, 0 },        // accelerate to full speed and cruise
+  { 1.5, -MAX_CONTROL_OUTPUT, 0 },       // reverse
+  { 1.0, 4, 0 },                         // crawl: long periods
+  { 2.0, 200, 2.0 },                     // balancing
+  { 2.0, 40, 5.0 },                      // small corrections around zero
+  { 0.5, 0, 0 },
+};
+
+struct Ideal
+{
+  double position;     // steps, exact integral of the commanded speed
+  double speed;        // steps/s since the last tick
+  uint64_t since;      // ns, time of the last tick
+};
+
+static Ideal ideal[2];
+static int32_t actual[2];
+static double err_sum_sq, err_max, time_err_sum_sq, time_err_max;
+static long steps_total, steps_timed;
+
+static void on_step(int motor, int dir, uint64_t ns)
+{
+  Ideal &I = ideal[motor];
+  actual[motor] += dir;
+  double x = I.position + I.speed * (ns - I.since) * 1e-9;
+  // A forward step is due when the ideal position reaches the new count, a backward one when it leaves the old count
+  double e = actual[motor] + (dir < 0 ? 1 : 0) - x;
+  err_sum_sq += e * e;
+  if (fabs(e) > err_max)
+    err_max = fabs(e);
+  if (I.speed != 0) {
+    double te = e / fabs(I.speed) * 1e6;   // us early (+) or late (-) against the ideal step time
+    time_err_sum_sq += te * te;
+    if (fabs(te) > time_err_max)
+      time_err_max = fabs(te);
+    steps_timed++;
+  }
+  steps_total++;
+}
+
+static void tick(uint64_t ns, int16_t target1, int16_t target2)
+{
+  for (int m = 0; m < 2; m++) {
+    ideal[m].position += ideal[m].speed * (ns - ideal[m].since) * 1e-9;
+    ideal[m].since = ns;
+  }
+  setMotorSpeedM1(target1);
+  setMotorSpeedM2(target2);
+  ideal[0].speed = speed_M1 * STEPS_PER_SPEED;
+  ideal[1].speed = speed_M2 * STEPS_PER_SPEED;
+}
+
+int main(int argc, char **argv)
+{
+  int repeats = 4;
+  bool verbose = false;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "r:v")) != -1) {
+    switch (opt) {
+      case 'r': repeats = atoi(optarg); break;
+      case 'v': verbose = true; break;
+      default:
+        fprintf(stderr, "usage: stepgen_bench [-r repeats] [-v]\n");
+        return 2;
+    }
+  }
+
+  SimParams params;
+  sim_init(params, 0);
+  sim_hold(true);
+  pinMode(PIN_MOTOR1_DIR, OUTPUT);
+  pinMode(PIN_MOTOR1_STEP, OUTPUT);
+  pinMode(PIN_MOTOR2_DIR, OUTPUT);
+  pinMode(PIN_MOTOR2_STEP, OUTPUT);
+  digitalWrite(PIN_MOTOR1_STEP, LOW);
+  digitalWrite(PIN_MOTOR2_STEP, LOW);
+  initTimers();
+
+  sim_on_step(on_step);
+  sim_isr_profile(true);
+  uint64_t start = sim_now();
+  for (int m = 0; m < 2; m++)
+    ideal[m].since = start;
+
+  for (int r = 0; r < repeats; r++) {
+    for (size_t s = 0; s < sizeof(profile) / sizeof(profile[0]); s++) {
+      const Segment &seg = profile[s];
+      uint64_t seg_start = sim_now();
+      for (uint64_t t = 0; t < seg.seconds * 1e9; t += TICK_NS) {
+        int16_t target = seg.speed;
+        if (seg.hz > 0)
+          target = seg.speed * sin(2 * M_PI * seg.hz * t * 1e-9);
+        // Motor2 turns a bit slower, like with some steering
+        tick(seg_start + t, target, target * 3 / 4);
+        if (verbose)
+          printf("%.2f %d %d %d %d %.1f %.1f\n", (sim_now() - start) * 1e-9, speed_M1, speed_M2, actual[0], actual[1],
+                 ideal[0].position, ideal[1].position);
+        sim_advance(TICK_NS);
+      }
+    }
+  }
+
+  SimIsrStats isr;
+  sim_isr_stats(&isr);
+  double seconds = (sim_now() - start) * 1e-9;
+  double final_err = fabs(actual[0] - ideal[0].position) + fabs(actual[1] - ideal[1].position);
+
+  printf("simulated       %.1f s, %ld steps\n", seconds, steps_total);
+  printf("isr calls       %llu (%.0f per second)\n", (unsigned long long)isr.calls, isr.calls / seconds);
+  if (isr.calls) {
+    printf("isr cost        %.1f host cycles per call (without the stand-ins below)\n", (double)isr.cycles / isr.calls);
+    printf("isr calls to    %.2f digitalWrite, %.2f register writes, %.2f critical sections per call\n",
+           (double)isr.digital_writes / isr.calls, (double)isr.reg_writes / isr.calls, (double)isr.critical_sections / isr.calls);
+  }
+  printf("position error  %.3f steps rms, %.3f max\n", steps_total ? sqrt(err_sum_sq / steps_total) : 0.0, err_max);
+  printf("timing error    %.1f us rms, %.1f max (steps while moving)\n", steps_timed ? sqrt(time_err_sum_sq / steps_timed) : 0.0,
+         time_err_max);
+  printf("final drift     %.2f steps\n", final_err);
+  printf("step pulse      %.2f us min, %.2f max high (%llu pulses, driver needs %.2f)\n", isr.step_high_min_ns * 1e-3,
+         isr.step_high_max_ns * 1e-3, (unsigned long long)isr.step_pulses, DRIVER_HIGH_NS * 1e-3);
+  if (isr.step_pulses == 0 || isr.step_high_min_ns < DRIVER_HIGH_NS) {
+    printf("FAILED: STEP pulse shorter than the driver minimum\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,314 @@
+/*
+ * trace_replay.cpp
+ *
+ *  Deterministic replay of an IMU trace (../Trace.h) through the real Control.cpp / MPU6050.cpp code.
+ *  The controller restarts from the recorded state, the recorded samples are injected into the
+ *  simulated MPU6050 at their recorded time and controlLoop() runs at that time, so dt and the
+ *  sample grouping are those of the recording. Each control update is compared with the recorded
+ *  one (angle and motor commands), and timed on the host.
+ *
+ *  The replay is open loop: the recorded samples do not react to different motor commands. With
+ *  modified gains (-g) or control laws the comparison shows how the outputs move away from the
+ *  recorded ones, not how the robot would have balanced (use brobot_sim for that).
+ *  A trace recorded on the robot matches to the float rounding of the host compiler; a trace recorded
+ *  by brobot_sim -r matches exactly.
+ *
+ *  Usage: trace_replay [options] trace.brt
+ *    -g scale        scale the user stability gains Kp/Kd (default 1)
+ *    -e degrees      angle difference counted as a mismatch (default 0.001)
+ *    -c file         write a CSV (one line per control update) to file
+ *    -v              show the firmware Serial output
+ *
+ *  Exit status is 0 when every control update matches the recording, 1 otherwise, 2 on a bad trace.
+ *
+ *  Created on: 18.10.2026
+ *      Author: anonymous
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+#include "../Control.h"
+#include "../MPU6050.h"
+#include "../Motors.h"
+#include "../Trace.h"
+#include "../defines.h"
+#include "../globals.h"
+#include "sim.h"
+
+#define START_DELAY_US 1000   // simulated time between the end of setup and the first replayed update
+
+void initTimers();
+
+static uint64_t host_ns()
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1000000000ULL + t.tv_nsec;
+}
+
+// Same steps as setup() in the sketch, without WiFi/OTA/servo and without the gyro calibration (restored from the trace)
+static void robot_setup()
+{
+  pinMode(PIN_ENABLE_MOTORS, OUTPUT);
+  digitalWrite(PIN_ENABLE_MOTORS, HIGH);
+  pinMode(PIN_MOTOR1_DIR, OUTPUT);
+  pinMode(PIN_MOTOR1_STEP, OUTPUT);
+  pinMode(PIN_MOTOR2_DIR, OUTPUT);
+  pinMode(PIN_MOTOR2_STEP, OUTPUT);
+  digitalWrite(PIN_MOTOR1_STEP, LOW);
+  digitalWrite(PIN_MOTOR2_STEP, LOW);
+
+  Wire.begin();
+  MPU6050_setup();
+#ifdef IMU_FIFO_MODE
+  MPU6050_fifo_setup(IMU_FIFO_RATE_DIV, MPU6050_DLPF_44HZ);
+#endif
+
+  initTimers();
+}
+
+static void restore_state(const TraceState &s)
+{
+  angle = s.angle;
+  x_gyro_offset = s.x_gyro_offset;
+  angle_adjusted = s.angle_adjusted;
+  angle_adjusted_filtered = s.angle_adjusted_filtered;
+  estimated_speed_filtered = s.estimated_speed_filtered;
+  control_output = s.control_output;
+  target_angle = s.target_angle;
+  angle_offset = s.angle_offset;
+  Kp = s.Kp;
+  Kd = s.Kd;
+  Kp_thr = s.Kp_thr;
+  Ki_thr = s.Ki_thr;
+  Kp_user = s.Kp_user;
+  Kd_user = s.Kd_user;
+  Kp_thr_user = s.Kp_thr_user;
+  Ki_thr_user = s.Ki_thr_user;
+  max_target_angle = s.max_target_angle;
+  speed_M1 = s.speed_M1;
+  speed_M2 = s.speed_M2;
+  speedControl.preset(s.speed_error_sum);
+  // StabilityPD keeps the input and set point of the previous update
+  stabilityControl.preset(control_t(s.angle_adjusted), control_t(s.target_angle));
+}
+
+static void usage()
+{
+  fprintf(stderr, "usage: trace_replay [-g gain_scale] [-e max_angle_error] [-c replay.csv] [-v] trace.brt\n");
+  exit(2);
+}
+
+int main(int argc, char **argv)
+{
+  double gain_scale = 1.0;
+  double max_error = 0.001;
+  const char *csv_name = NULL;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "g:e:c:v")) != -1) {
+    switch (opt) {
+      case 'g': gain_scale = atof(optarg); break;
+      case 'e': max_error = atof(optarg); break;
+      case 'c': csv_name = optarg; break;
+      case 'v': Serial.enabled = true; break;
+      default: usage();
+    }
+  }
+  if (optind != argc - 1)
+    usage();
+
+  // The whole trace in memory: a minute is about 250kB
+  FILE *f = fopen(argv[optind], "rb");
+  if (!f) {
+    perror(argv[optind]);
+    return 2;
+  }
+  std::vector<uint8_t> trace;
+  uint8_t block[4096];
+  size_t n;
+  while ((n = fread(block, 1, sizeof(block), f)) > 0)
+    trace.insert(trace.end(), block, block + n);
+  fclose(f);
+
+  TraceFileHeader header;
+  if (trace.size() < sizeof(header) + sizeof(TraceState)) {
+    fprintf(stderr, "trace_replay: %s: too short\n", argv[optind]);
+    return 2;
+  }
+  memcpy(&header, &trace[0], sizeof(header));
+  if (memcmp(header.magic, TRACE_MAGIC, sizeof(header.magic)) != 0 || header.version != TRACE_VERSION) {
+    fprintf(stderr, "trace_replay: %s: not a version %d trace\n", argv[optind], TRACE_VERSION);
+    return 2;
+  }
+  if ((header.flags ^ traceFlags()) & TRACE_FIFO_MODE) {
+    fprintf(stderr, "trace_replay: recorded %s FIFO mode, use trace_replay%s\n", (header.flags & TRACE_FIFO_MODE) ? "in" : "without",
+            (header.flags & TRACE_FIFO_MODE) ? "_fifo" : "");
+    return 2;
+  }
+  if ((header.flags ^ traceFlags()) & TRACE_FIXED_POINT)
+    fprintf(stderr, "trace_replay: recorded with the control laws in %s, replayed in %s\n",
+            (header.flags & TRACE_FIXED_POINT) ? "fixed point" : "float", (traceFlags() & TRACE_FIXED_POINT) ? "fixed point" : "float");
+
+  // Split the records, the first one is the state the recording started from
+  std::vector<const uint8_t *> records;
+  size_t pos = sizeof(header);
+  while (pos < trace.size()) {
+    uint8_t length = traceRecordSize(trace[pos]);
+    if (length == 0 || pos + length > trace.size()) {
+      fprintf(stderr, "trace_replay: bad record at offset %zu, replaying up to there\n", pos);
+      break;
+    }
+    records.push_back(&trace[pos]);
+    pos += length;
+  }
+  if (records.empty() || records[0][0] != TRACE_STATE) {
+    fprintf(stderr, "trace_replay: %s: no state record at the start\n", argv[optind]);
+    return 2;
+  }
+  TraceState state;
+  memcpy(&state, records[0], sizeof(state));
+
+  FILE *csv = NULL;
+  if (csv_name) {
+    csv = fopen(csv_name, "w");
+    if (!csv) {
+      perror(csv_name);
+      return 2;
+    }
+    fprintf(csv, "t,angle_recorded,angle,motor1_recorded,motor1,motor2_recorded,motor2\n");
+  }
+
+  SimParams params;
+  sim_init(params, 0);
+  sim_hold(true);
+  sim_imu_external(true);
+  robot_setup();
+  restore_state(state);
+  if (Kp == Kp_user && Kd == Kd_user) {
+    Kp *= gain_scale;
+    Kd *= gain_scale;
+  }
+  Kp_user *= gain_scale;
+  Kd_user *= gain_scale;
+
+  // Recorded micros() to simulated us: unwrap the 32 bit time, then shift it after the setup
+  int64_t trace_time = state.time;
+  uint32_t trace_last = state.time;
+  const int64_t offset = (int64_t)(sim_now() / 1000) + START_DELAY_US - state.time;
+  timer_old = state.time + (int32_t)(state.timer_old - state.time) + offset;
+
+  long updates = 0, mismatches = 0, extra_updates = 0, missing_updates = 0, late = 0, gaps = 0;
+  double angle_error_max = 0, angle_error_sq = 0, angle_max = 0, recorded_angle_max = 0;
+  int motor_error_max = 0;
+  double first_mismatch = -1;
+  uint64_t control_host_ns = 0, control_host_max = 0;
+  size_t i = 1;
+
+  while (i < records.size()) {
+    const uint8_t *r = records[i];
+    if (r[0] == TRACE_LOST) {
+      gaps++;
+      i++;
+      continue;
+    }
+    if (r[0] == TRACE_STATE) {       // a new recording in the same file: restart from it
+      memcpy(&state, r, sizeof(state));
+      restore_state(state);
+      i++;
+      continue;
+    }
+
+    // One controlLoop() pass: the samples it read, and the control update they produced if any
+    uint32_t time;
+    memcpy(&time, r + 1, sizeof(time));
+    trace_time += (int32_t)(time - trace_last);
+    trace_last = time;
+    uint64_t at_ns = (uint64_t)(trace_time + offset) * 1000;
+    if (at_ns >= sim_now())
+      sim_advance(at_ns - sim_now());
+    else
+      late++;      // the I2C transfers of the previous pass took longer than on the robot
+
+    while (i < records.size() && records[i][0] == TRACE_SAMPLE && memcmp(records[i] + 1, &time, sizeof(time)) == 0) {
+      TraceSample s;
+      memcpy(&s, records[i], sizeof(s));
+      sim_imu_inject(s.raw);
+      i++;
+    }
+    TraceControl c;
+    bool recorded = false;
+    if (i < records.size() && records[i][0] == TRACE_CONTROL && memcmp(records[i] + 1, &time, sizeof(time)) == 0) {
+      memcpy(&c, records[i], sizeof(c));
+      throttle = c.throttle;
+      steering = c.steering;
+      recorded = true;
+      i++;
+    }
+
+    long old_timer = timer_old;
+    sim_timing(true);
+    uint64_t model0 = sim_model_host_ns();
+    uint64_t h0 = host_ns();
+    controlLoop();
+    uint64_t cost = host_ns() - h0 - (sim_model_host_ns() - model0);
+    sim_timing(false);
+    bool updated = timer_old != old_timer;
+
+    if (!updated) {
+      if (recorded)
+        missing_updates++;
+      continue;
+    }
+    updates++;
+    control_host_ns += cost;
+    if (cost > control_host_max)
+      control_host_max = cost;
+    if (fabs(angle_adjusted) > angle_max)
+      angle_max = fabs(angle_adjusted);
+    double t = (trace_time - (int64_t)state.time) * 1e-6;
+    if (!recorded) {
+      extra_updates++;
+      continue;
+    }
+
+    double angle_error = fabs(angle_adjusted - c.angle);
+    int motor_error = max(abs(motor1 - c.motor1), abs(motor2 - c.motor2));
+    if (angle_error > angle_error_max)
+      angle_error_max = angle_error;
+    angle_error_sq += angle_error * angle_error;
+    if (motor_error > motor_error_max)
+      motor_error_max = motor_error;
+    if (fabs(c.angle) > recorded_angle_max)
+      recorded_angle_max = fabs(c.angle);
+    if (angle_error > max_error || motor_error != 0) {
+      if (mismatches++ == 0)
+        first_mismatch = t;
+    }
+    if (csv)
+      fprintf(csv, "%.4f,%.4f,%.4f,%d,%d,%d,%d\n", t, c.angle, angle_adjusted, c.motor1, motor1, c.motor2, motor2);
+  }
+
+  if (csv)
+    fclose(csv);
+
+  double duration = (trace_time - (int64_t)state.time) * 1e-6;
+  printf("result          %s\n", mismatches || extra_updates || missing_updates ? "DIFFERS" : "matches");
+  printf("trace           %.2f s, %zu records, %ld gaps%s\n", duration, records.size(), gaps, gaps ? " (the replay drifts after a gap)" : "");
+  printf("control updates %ld (%ld not recorded, %ld recorded but not replayed), %ld passes late\n", updates, extra_updates,
+         missing_updates, late);
+  printf("mismatches      %ld", mismatches);
+  if (mismatches)
+    printf(", first at %.3f s", first_mismatch);
+  printf("\n");
+  printf("angle error     %.6f deg max, %.6f deg rms\n", angle_error_max, updates ? sqrt(angle_error_sq / updates) : 0.0);
+  printf("motor error     %d max\n", motor_error_max);
+  printf("max angle       %.2f deg replayed, %.2f deg recorded\n", angle_max, recorded_angle_max);
+  printf("control cost    %.0f ns mean, %llu ns max (host)\n", updates ? (double)control_host_ns / updates : 0.0,
+         (unsigned long long)control_host_max);
+
+  return mismatches || extra_updates || missing_updates ? 1 : 0;
+}
@@ -117,6 +117,8 @@ Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h) {
   wrap = true;
   _cp437 = false;
   gfxFont = NULL;
+  spanFont = false;
+  glyphCache = NULL;
 }
 
 /**************************************************************************/
@@ -1194,6 +1196,13 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
       yo16 = yo;
     }
 
+    // Row spans, from the font itself or converted once by the glyph cache
+    const uint8_t *spans = NULL;
+    if (spanFont)
+      spans = bitmap + bo;
+    else if (glyphCache)
+      spans = glyphCache->glyph(gfxFont, c);
+
     // Todo: Add character clipping here
 
     // NOTE: THERE IS NO 'BACKGROUND' COLOR OPTION ON CUSTOM FONTS.
@@ -1213,26 +1222,93 @@ void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c,
     // implemented this yet.
 
     startWrite();
-    for (yy = 0; yy < h; yy++) {
-      for (xx = 0; xx < w; xx++) {
-        if (!(bit++ & 7)) {
-          bits = pgm_read_byte(&bitmap[bo++]);
-        }
-        if (bits & 0x80) {
-          if (size_x == 1 && size_y == 1) {
-            writePixel(x + xo + xx, y + yo + yy, color);
-          } else {
-            writeFillRect(x + (xo16 + xx) * size_x, y + (yo16 + yy) * size_y,
-                          size_x, size_y, color);
+    if (spans) {
+      drawSpans(x + xo * size_x, y + yo * size_y, spans, spanFont, h, size_x,
+                size_y, color);
+    } else {
+      for (yy = 0; yy < h; yy++) {
+        for (xx = 0; xx < w; xx++) {
+          if (!(bit++ & 7)) {
+            bits = pgm_read_byte(&bitmap[bo++]);
           }
+          if (bits & 0x80) {
+            if (size_x == 1 && size_y == 1) {
+              writePixel(x + xo + xx, y + yo + yy, color);
+            } else {
+              writeFillRect(x + (xo16 + xx) * size_x,
+                            y + (yo16 + yy) * size_y, size_x, size_y, color);
+            }
+          }
+          bits <<= 1;
         }
-        bits <<= 1;
       }
     }
     endWrite();
 
   } // End classic vs custom font
 }
+/**************************************************************************/
+/*!
+    @brief   The 'classic' built-in font (glcdfont.c)
+    @returns Pointer to the PROGMEM font: 5 bytes per character, one per
+             column, least significant bit at the top
+*/
+/**************************************************************************/
+const unsigned char *Adafruit_GFX::classicFont(void) { return font; }
+
+/**************************************************************************/
+/*!
+    @brief   Glyph of the current custom font
+    @param   c  Character index, from the first character of the font
+    @returns Pointer to the PROGMEM glyph (read it with pgm_read_*())
+*/
+/**************************************************************************/
+GFXglyph *Adafruit_GFX::fontGlyph(uint8_t c) {
+  return pgm_read_glyph_ptr(gfxFont, c);
+}
+
+/**************************************************************************/
+/*!
+    @brief   Glyph bitmaps of the current custom font
+    @returns Pointer to the PROGMEM bitmaps (GFXglyph bitmapOffset is from
+             there)
+*/
+/**************************************************************************/
+uint8_t *Adafruit_GFX::fontBitmap(void) { return pgm_read_bitmap_ptr(gfxFont); }
+
+/**************************************************************************/
+/*!
+    @brief   Draw a glyph from its row spans (GFXspanfont encoding), inside a
+             startWrite()/endWrite() pair
+    @param   x  Left of the glyph bitmap
+    @param   y  Top of the glyph bitmap
+    @param   spans  Spans of the glyph
+    @param   progmem  If set, spans are in PROGMEM
+    @param   h  Rows of the glyph
+    @param   size_x  Font magnification level in X-axis
+    @param   size_y  Font magnification level in Y-axis
+    @param   color 16-bit 5-6-5 Color to draw the glyph with
+*/
+/**************************************************************************/
+void Adafruit_GFX::drawSpans(int16_t x, int16_t y, const uint8_t *spans,
+                             bool progmem, uint8_t h, uint8_t size_x,
+                             uint8_t size_y, uint16_t color) {
+  for (uint8_t yy = 0; yy < h; yy++, y += size_y) {
+    uint8_t n = progmem ? pgm_read_byte(spans) : *spans;
+    int16_t xx = x;
+    for (spans++; n--; spans += 2) {
+      uint8_t skip = progmem ? pgm_read_byte(&spans[0]) : spans[0];
+      uint8_t len = progmem ? pgm_read_byte(&spans[1]) : spans[1];
+      xx += skip * size_x;
+      if (size_x == 1 && size_y == 1)
+        writeFastHLine(xx, y, len, color);
+      else
+        writeFillRect(xx, y, len * size_x, size_y, color);
+      xx += len * size_x;
+    }
+  }
+}
+
 /**************************************************************************/
 /*!
     @brief  Print one byte/character of data, used to support print()
@@ -1348,6 +1424,20 @@ void Adafruit_GFX::setFont(const GFXfont *f) {
     cursor_y -= 6;
   }
   gfxFont = (GFXfont *)f;
+  spanFont = false;
+}
+
+/**************************************************************************/
+/*!
+    @brief Set a font in the run-length format of 'fontconvert -r' to
+           display when print()ing. Metrics are the same as the GFXfont it
+           was converted from, glyphs are drawn a line per span.
+    @param  f  The GFXspanfont object, if NULL use built in 6x8 font
+*/
+/**************************************************************************/
+void Adafruit_GFX::setSpanFont(const GFXspanfont *f) {
+  setFont((const GFXfont *)f);
+  spanFont = (f != NULL);
 }
 
 /**************************************************************************/
@@ -1728,6 +1818,167 @@ bool Adafruit_GFX_Button::justReleased() { return (!currstate && laststate); }
 
 // -------------------------------------------------------------------------
 
+// GFXglyphCache keeps the glyphs last drawn in a custom font converted to
+// row spans, in a fixed pool allocated once. A miss converts the glyph from
+// its bitmap, evicting the least recently used glyphs (and compacting the
+// pool) until it fits. Glyphs larger than the pool are drawn from their
+// bitmap as usual.
+
+/**************************************************************************/
+/*!
+   @brief    Allocate a glyph cache
+   @param    bytes    Size of the span pool. A 24pt glyph takes 50 to 200
+                      bytes, a 9pt glyph 20 to 60.
+   @param    entries  Maximum number of glyphs
+*/
+/**************************************************************************/
+GFXglyphCache::GFXglyphCache(uint16_t bytes, uint8_t entries) {
+  size = bytes;
+  capacity = entries;
+  count = 0;
+  clock = 0;
+  pool = (uint8_t *)malloc(bytes);
+  entry = (Entry *)malloc(entries * sizeof(Entry));
+  if (!pool || !entry) {
+    free(pool);
+    free(entry);
+    pool = NULL;
+    entry = NULL;
+  }
+}
+
+/**************************************************************************/
+/*!
+   @brief    Delete the cache, free memory
+*/
+/**************************************************************************/
+GFXglyphCache::~GFXglyphCache(void) {
+  free(pool);
+  free(entry);
+}
+
+/**************************************************************************/
+/*!
+   @brief    Forget all glyphs, e.g. after changing a font in RAM
+*/
+/**************************************************************************/
+void GFXglyphCache::clear(void) { count = 0; }
+
+/**************************************************************************/
+/*!
+   @brief    Row spans of a glyph, converted on a miss
+   @param    font  The GFXfont
+   @param    c     Character index, from font->first
+   @returns  Spans in the GFXspanfont encoding, valid until the next call,
+             or NULL if the glyph does not fit in the cache
+*/
+/**************************************************************************/
+const uint8_t *GFXglyphCache::glyph(const GFXfont *font, uint8_t c) {
+  if (!pool)
+    return NULL;
+  for (uint8_t i = 0; i < count; i++) {
+    if ((entry[i].c == c) && (entry[i].font == font)) {
+      entry[i].used = ++clock;
+      return &pool[entry[i].offset];
+    }
+  }
+
+  GFXglyph *glyph = pgm_read_glyph_ptr(font, c);
+  const uint8_t *bitmap =
+      pgm_read_bitmap_ptr(font) + pgm_read_word(&glyph->bitmapOffset);
+  uint8_t w = pgm_read_byte(&glyph->width), h = pgm_read_byte(&glyph->height);
+  uint16_t length = encode(bitmap, w, h, NULL);
+  if ((length > size) || !capacity)
+    return NULL;
+  uint16_t end;
+  for (;;) {
+    end = count ? entry[count - 1].offset + entry[count - 1].length : 0;
+    if ((count < capacity) && (end + length <= size))
+      break;
+    evict();
+  }
+  Entry *e = &entry[count++];
+  e->font = font;
+  e->used = ++clock;
+  e->offset = end;
+  e->length = length;
+  e->c = c;
+  encode(bitmap, w, h, &pool[end]);
+  return &pool[end];
+}
+
+/**************************************************************************/
+/*!
+   @brief    Drop the least recently used glyph and close the gap in the pool
+*/
+/**************************************************************************/
+void GFXglyphCache::evict(void) {
+  uint8_t lru = 0;
+  for (uint8_t i = 1; i < count; i++) {
+    if ((int32_t)(entry[i].used - entry[lru].used) < 0)
+      lru = i;
+  }
+  uint16_t length = entry[lru].length;
+  uint16_t from = entry[lru].offset + length;
+  uint16_t end = entry[count - 1].offset + entry[count - 1].length;
+  memmove(&pool[entry[lru].offset], &pool[from], end - from);
+  for (uint8_t i = lru + 1; i < count; i++) {
+    entry[i - 1] = entry[i];
+    entry[i - 1].offset -= length;
+  }
+  count--;
+}
+
+/**************************************************************************/
+/*!
+   @brief    Convert a glyph bitmap to row spans. Each row is a span count,
+             then a (skip, length) pair per span, skip counting from the end
+             of the previous span (see GFXspanfont).
+   @param    bitmap  Glyph bitmap in PROGMEM, rows bit-packed MSB first
+   @param    w       Glyph width
+   @param    h       Glyph height
+   @param    spans   Output, or NULL to only get the length
+   @returns  Bytes of spans
+*/
+/**************************************************************************/
+uint16_t GFXglyphCache::encode(const uint8_t *bitmap, uint8_t w, uint8_t h,
+                               uint8_t *spans) {
+  uint16_t length = 0;
+  uint8_t bits = 0, bit = 0;
+  for (uint8_t yy = 0; yy < h; yy++) {
+    uint16_t head = length++;
+    uint8_t n = 0, last = 0, start = 0;
+    bool on = false;
+    for (uint16_t xx = 0; xx <= w; xx++) {
+      bool set = false;
+      if (xx < w) {
+        if (!(bit++ & 7))
+          bits = pgm_read_byte(bitmap++);
+        set = bits & 0x80;
+        bits <<= 1;
+      }
+      if (set && !on) {
+        start = xx;
+        on = true;
+      } else if (!set && on) {
+        if (spans) {
+          spans[length] = start - last;
+          spans[length + 1] = xx - start;
+        }
+        length += 2;
+        n++;
+        last = xx;
+        on = false;
+      }
+    }
+    if (spans)
+      spans[head] = n;
+  }
+  return length;
+}
+
+// -------------------------------------------------------------------------
+
 // GFXcanvas1, GFXcanvas8 and GFXcanvas16 (currently a WIP, don't get too
 // comfy with the implementation) provide 1-, 8- and 16-bit offscreen
 // canvases, the address of which can be passed to drawBitmap() or
@@ -12,6 +12,8 @@
 #include <Adafruit_I2CDevice.h>
 #include <Adafruit_SPIDevice.h>
 
+class GFXglyphCache;
+
 /// A generic graphics superclass that can handle all sorts of drawing. At a
 /// minimum you can subclass and provide drawPixel(). At a maximum you can do a
 /// ton of overriding to optimize. Used for any/all Adafruit displays!
@@ -65,6 +67,17 @@ public:
                         uint16_t color);
   virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
                         uint16_t color);
+  // Monochrome displays may blit 1-bit images and glyphs a byte at a time
+  virtual void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                          int16_t w, int16_t h, uint16_t color);
+  virtual void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                          int16_t w, int16_t h, uint16_t color, uint16_t bg);
+  virtual void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w,
+                          int16_t h, uint16_t color);
+  virtual void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w,
+                          int16_t h, uint16_t color, uint16_t bg);
+  virtual void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                        uint16_t bg, uint8_t size_x, uint8_t size_y);
 
   // These exist only with Adafruit_GFX (no subclass overrides)
   void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
@@ -81,14 +94,6 @@ public:
                      int16_t radius, uint16_t color);
   void fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
                      int16_t radius, uint16_t color);
-  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
-                  int16_t h, uint16_t color);
-  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
-                  int16_t h, uint16_t color, uint16_t bg);
-  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
-                  uint16_t color);
-  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
-                  uint16_t color, uint16_t bg);
   void drawXBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
                    int16_t h, uint16_t color);
   void drawGrayscaleBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
@@ -109,8 +114,6 @@ public:
                      int16_t w, int16_t h);
   void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
                 uint16_t bg, uint8_t size);
-  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
-                uint16_t bg, uint8_t size_x, uint8_t size_y);
   void getTextBounds(const char *string, int16_t x, int16_t y, int16_t *x1,
                      int16_t *y1, uint16_t *w, uint16_t *h);
   void getTextBounds(const __FlashStringHelper *s, int16_t x, int16_t y,
@@ -120,6 +123,17 @@ public:
   void setTextSize(uint8_t s);
   void setTextSize(uint8_t sx, uint8_t sy);
   void setFont(const GFXfont *f = NULL);
+  void setSpanFont(const GFXspanfont *f);
+
+  /**********************************************************************/
+  /*!
+    @brief  Draw custom font glyphs as row spans kept in a cache, instead of
+            a pixel at a time
+    @param  cache  The cache, NULL (default) for none. It may be shared by
+                   several displays.
+  */
+  /**********************************************************************/
+  void setGlyphCache(GFXglyphCache *cache) { glyphCache = cache; }
 
   /**********************************************************************/
   /*!
@@ -232,6 +246,12 @@ public:
 protected:
   void charBounds(unsigned char c, int16_t *x, int16_t *y, int16_t *minx,
                   int16_t *miny, int16_t *maxx, int16_t *maxy);
+  // Font data, for subclasses overriding drawChar()
+  static const unsigned char *classicFont(void);
+  GFXglyph *fontGlyph(uint8_t c);
+  uint8_t *fontBitmap(void);
+  void drawSpans(int16_t x, int16_t y, const uint8_t *spans, bool progmem,
+                 uint8_t h, uint8_t size_x, uint8_t size_y, uint16_t color);
   int16_t WIDTH;        ///< This is the 'raw' display width - never changes
   int16_t HEIGHT;       ///< This is the 'raw' display height - never changes
   int16_t _width;       ///< Display width as modified by current rotation
@@ -246,6 +266,38 @@ protected:
   bool wrap;            ///< If set, 'wrap' text at right edge of display
   bool _cp437;          ///< If set, use correct CP437 charset (default is off)
   GFXfont *gfxFont;     ///< Pointer to special font
+  bool spanFont;        ///< If set, gfxFont is a GFXspanfont
+  GFXglyphCache *glyphCache; ///< Custom font glyphs as spans, or NULL
+};
+
+/// LRU cache of custom font glyphs converted to row spans (the GFXspanfont
+/// encoding), so that redrawing the same characters takes a line per span
+/// rather than a pixel per set bit
+class GFXglyphCache {
+public:
+  GFXglyphCache(uint16_t bytes = 1024, uint8_t entries = 16);
+  ~GFXglyphCache(void);
+  const uint8_t *glyph(const GFXfont *font, uint8_t c);
+  void clear(void);
+  static uint16_t encode(const uint8_t *bitmap, uint8_t w, uint8_t h,
+                         uint8_t *spans);
+
+private:
+  /// A cached glyph. Entries are kept in the order of their spans in pool.
+  struct Entry {
+    const GFXfont *font; ///< Font of the glyph
+    uint32_t used;       ///< Last use, for the LRU eviction
+    uint16_t offset;     ///< Spans in pool
+    uint16_t length;     ///< Bytes of spans
+    uint8_t c;           ///< Character index, from font->first
+  };
+  void evict(void);
+  uint8_t *pool;      ///< Spans of the cached glyphs
+  Entry *entry;       ///< Cached glyphs
+  uint16_t size;      ///< Bytes in pool
+  uint8_t capacity;   ///< Entries in entry
+  uint8_t count;      ///< Entries used
+  uint32_t clock;     ///< Use counter
 };
 
 /// A simple drawn button UI element
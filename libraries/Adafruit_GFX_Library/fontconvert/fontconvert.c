@@ -29,30 +29,61 @@ See notes at end for glyph nomenclature & other tidbits.
 
 #define DPI 141 // Approximate res. of Adafruit 2.8" TFT
 
+// Hexadecimal byte write, 12 per line
+void enbyte(uint8_t value) {
+  static uint8_t row = 0, firstCall = 1;
+  if (!firstCall) {    // Format output table nicely
+    if (++row >= 12) { // Last entry on line?
+      printf(",\n  "); //   Newline format output
+      row = 0;         //   Reset row counter
+    } else {           // Not end of line
+      printf(", ");    //   Simple comma delim
+    }
+  }
+  printf("0x%02X", value); // Write byte value
+  firstCall = 0;           // Formatting flag
+}
+
 // Accumulate bits for output, with periodic hexadecimal byte write
 void enbit(uint8_t value) {
-  static uint8_t row = 0, sum = 0, bit = 0x80, firstCall = 1;
+  static uint8_t sum = 0, bit = 0x80;
   if (value)
-    sum |= bit;          // Set bit if needed
-  if (!(bit >>= 1)) {    // Advance to next bit, end of byte reached?
-    if (!firstCall) {    // Format output table nicely
-      if (++row >= 12) { // Last entry on line?
-        printf(",\n  "); //   Newline format output
-        row = 0;         //   Reset row counter
-      } else {           // Not end of line
-        printf(", ");    //   Simple comma delim
-      }
+    sum |= bit;       // Set bit if needed
+  if (!(bit >>= 1)) { // Advance to next bit, end of byte reached?
+    enbyte(sum);      // Write byte value
+    sum = 0;          // Clear for next byte
+    bit = 0x80;       // Reset bit counter
+  }
+}
+
+// Write one bitmap row as spans (GFXspanfont): span count, then a (skip,
+// length) pair per span, skip from the end of the previous span.
+// Returns the number of bytes written.
+int enspans(uint8_t *row, int width) {
+  int x, start, last = 0, n = 0;
+  for (x = 0; x < width; x++) // Count spans first
+    if ((row[x / 8] & (0x80 >> (x & 7))) &&
+        ((x == 0) || !(row[(x - 1) / 8] & (0x80 >> ((x - 1) & 7)))))
+      n++;
+  enbyte(n);
+  for (x = 0; x < width;) {
+    if (!(row[x / 8] & (0x80 >> (x & 7)))) {
+      x++;
+      continue;
     }
-    printf("0x%02X", sum); // Write byte value
-    sum = 0;               // Clear for next byte
-    bit = 0x80;            // Reset bit counter
-    firstCall = 0;         // Formatting flag
+    for (start = x; (x < width) && (row[x / 8] & (0x80 >> (x & 7))); x++)
+      ;
+    enbyte(start - last);
+    enbyte(x - start);
+    last = x;
   }
+  return 1 + 2 * n;
 }
 
 int main(int argc, char *argv[]) {
   int i, j, err, size, first = ' ', last = '~', bitmapOffset = 0, x, y, byte;
-  char *fontName, c, *ptr;
+  char *fontName, c, *ptr, *table_type = "Bitmaps";
+  int spans = 0;
   FT_Library library;
   FT_Face face;
   FT_Glyph glyph;
@@ -62,14 +93,23 @@ int main(int argc, char *argv[]) {
   uint8_t bit;
 
   // Parse command line.  Valid syntaxes are:
-  //   fontconvert [filename] [size]
-  //   fontconvert [filename] [size] [last char]
-  //   fontconvert [filename] [size] [first char] [last char]
+  //   fontconvert [-r] [filename] [size]
+  //   fontconvert [-r] [filename] [size] [last char]
+  //   fontconvert [-r] [filename] [size] [first char] [last char]
   // Unless overridden, default first and last chars are
-  // ' ' (space) and '~', respectively
+  // ' ' (space) and '~', respectively.  -r outputs a GFXspanfont (row
+  // spans, for Adafruit_GFX::setSpanFont()) instead of a GFXfont.
+
+  if ((argc > 1) && !strcmp(argv[1], "-r")) {
+    spans = 1;
+    table_type = "Spans";
+    argc--;
+    argv++;
+  }
 
   if (argc < 3) {
-    fprintf(stderr, "Usage: %s fontfile size [first] [last]\n", argv[0]);
+    fprintf(stderr, "Usage: %s [-r] fontfile size [first] [last]\n",
+            argv[0]);
     return 1;
   }
 
@@ -109,7 +149,7 @@ int main(int argc, char *argv[]) {
     ptr = &fontName[strlen(fontName)]; // If none, append
   // Insert font size and 7/8 bit.  fontName was alloc'd w/extra
   // space to allow this, we're not sprintfing into Forbidden Zone.
-  sprintf(ptr, "%dpt%db", size, (last > 127) ? 8 : 7);
+  sprintf(ptr, "%dpt%db%s", size, (last > 127) ? 8 : 7, spans ? "RLE" : "");
   // Space and punctuation chars in name replaced w/ underscores.
   for (i = 0; (c = fontName[i]); i++) {
     if (isspace(c) || ispunct(c))
@@ -145,7 +185,7 @@ int main(int argc, char *argv[]) {
   // the right symbols, and that's not done yet.
   // fprintf(stderr, "%ld glyphs\n", face->num_glyphs);
 
-  printf("const uint8_t %sBitmaps[] PROGMEM = {\n  ", fontName);
+  printf("const uint8_t %s%s[] PROGMEM = {\n  ", fontName, table_type);
 
   // Process glyphs and output huge bitmap data array
   for (i = first, j = 0; i <= last; i++, j++) {
@@ -184,6 +224,14 @@ int main(int argc, char *argv[]) {
     table[j].xOffset = g->left;
     table[j].yOffset = 1 - g->top;
 
+    if (spans) { // Row spans, no padding
+      for (y = 0; y < bitmap->rows; y++)
+        bitmapOffset +=
+            enspans(&bitmap->buffer[y * bitmap->pitch], bitmap->width);
+      FT_Done_Glyph(glyph);
+      continue;
+    }
+
     for (y = 0; y < bitmap->rows; y++) {
       for (x = 0; x < bitmap->width; x++) {
         byte = x / 8;
@@ -226,8 +274,9 @@ int main(int argc, char *argv[]) {
   printf("\n\n");
 
   // Output font structure
-  printf("const GFXfont %s PROGMEM = {\n", fontName);
-  printf("  (uint8_t  *)%sBitmaps,\n", fontName);
+  printf("const %s %s PROGMEM = {\n", spans ? "GFXspanfont" : "GFXfont",
+         fontName);
+  printf("  (uint8_t  *)%s%s,\n", fontName, table_type);
   printf("  (GFXglyph *)%sGlyphs,\n", fontName);
   if (face->size->metrics.height == 0) {
     // No face height info, assume fixed width and get from a glyph.
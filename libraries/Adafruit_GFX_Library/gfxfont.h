@@ -26,4 +26,16 @@ typedef struct {
   uint8_t yAdvance; ///< Newline distance (y axis)
 } GFXfont;
 
+/// Font stored as row spans (fontconvert -r) instead of bitmaps. Same layout
+/// as GFXfont: glyph->bitmapOffset indexes the spans. Each glyph row is a
+/// span count, then a (skip, length) byte pair per span, skip counting from
+/// the end of the previous span. Pass it to Adafruit_GFX::setSpanFont().
+typedef struct {
+  uint8_t *spans;   ///< Glyph row spans, concatenated
+  GFXglyph *glyph;  ///< Glyph array
+  uint16_t first;   ///< ASCII extents (first char)
+  uint16_t last;    ///< ASCII extents (last char)
+  uint8_t yAdvance; ///< Newline distance (y axis)
+} GFXspanfont;
+
 #endif // _GFXFONT_H_
@@ -43,6 +43,8 @@
 #else
 #define pgm_read_byte(addr)                                                    \
   (*(const unsigned char *)(addr)) ///< PROGMEM workaround for non-AVR
+#define pgm_read_word(addr)                                                    \
+  (*(const unsigned short *)(addr)) ///< PROGMEM workaround for non-AVR
 #endif
 
 #if !defined(__ARM_ARCH) && !defined(ENERGIA) && !defined(ESP8266) &&          \
@@ -67,6 +69,18 @@
 #define WIRE_MAX 32 ///< Use common Arduino core default
 #endif
 
+/// Bytes a partial refresh spends to open a window on the display (address
+/// commands and transfer overhead). display() merges the dirty ranges of
+/// adjacent pages when that costs fewer bytes than one more window.
+#define SSD1306_WINDOW_COST 10
+
+/// Bit rate assumed by displayStep() for software SPI (bitbang speed depends
+/// on the MCU, this is a low estimate)
+#define SSD1306_SOFTSPI_CLOCK 100000
+
+/// 32-bit access to the buffer for the span fills, allowed to alias bytes
+typedef uint32_t __attribute__((__may_alias__)) ssd1306_word_t;
+
 #define ssd1306_swap(a, b)                                                     \
   (((a) ^= (b)), ((b) ^= (a)), ((a) ^= (b))) ///< No-temp-var swap operation
 
@@ -172,7 +186,8 @@ Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire *twi,
                                    int8_t rst_pin, uint32_t clkDuring,
                                    uint32_t clkAfter)
     : Adafruit_GFX(w, h), spi(NULL), wire(twi ? twi : &Wire), buffer(NULL),
-      mosiPin(-1), clkPin(-1), dcPin(-1), csPin(-1), rstPin(rst_pin)
+      frontBuffer(NULL), mosiPin(-1), clkPin(-1), dcPin(-1), csPin(-1),
+      rstPin(rst_pin)
 #if ARDUINO >= 157
       ,
       wireClk(clkDuring), restoreClk(clkAfter)
@@ -211,8 +226,8 @@ Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, int8_t mosi_pin,
                                    int8_t sclk_pin, int8_t dc_pin,
                                    int8_t rst_pin, int8_t cs_pin)
     : Adafruit_GFX(w, h), spi(NULL), wire(NULL), buffer(NULL),
-      mosiPin(mosi_pin), clkPin(sclk_pin), dcPin(dc_pin), csPin(cs_pin),
-      rstPin(rst_pin) {}
+      frontBuffer(NULL), mosiPin(mosi_pin), clkPin(sclk_pin), dcPin(dc_pin),
+      csPin(cs_pin), rstPin(rst_pin) {}
 
 /*!
     @brief  Constructor for SPI SSD1306 displays, using native hardware SPI.
@@ -244,8 +259,9 @@ Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, SPIClass *spi_ptr,
                                    int8_t dc_pin, int8_t rst_pin, int8_t cs_pin,
                                    uint32_t bitrate)
     : Adafruit_GFX(w, h), spi(spi_ptr ? spi_ptr : &SPI), wire(NULL),
-      buffer(NULL), mosiPin(-1), clkPin(-1), dcPin(dc_pin), csPin(cs_pin),
-      rstPin(rst_pin) {
+      buffer(NULL), frontBuffer(NULL), mosiPin(-1), clkPin(-1), dcPin(dc_pin),
+      csPin(cs_pin), rstPin(rst_pin) {
+  spiClk = bitrate;
 #ifdef SPI_HAS_TRANSACTION
   spiSettings = SPISettings(bitrate, MSBFIRST, SPI_MODE0);
 #endif
@@ -280,8 +296,8 @@ Adafruit_SSD1306::Adafruit_SSD1306(uint8_t w, uint8_t h, SPIClass *spi_ptr,
 Adafruit_SSD1306::Adafruit_SSD1306(int8_t mosi_pin, int8_t sclk_pin,
                                    int8_t dc_pin, int8_t rst_pin, int8_t cs_pin)
     : Adafruit_GFX(SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT), spi(NULL), wire(NULL),
-      buffer(NULL), mosiPin(mosi_pin), clkPin(sclk_pin), dcPin(dc_pin),
-      csPin(cs_pin), rstPin(rst_pin) {}
+      buffer(NULL), frontBuffer(NULL), mosiPin(mosi_pin), clkPin(sclk_pin),
+      dcPin(dc_pin), csPin(cs_pin), rstPin(rst_pin) {}
 
 /*!
     @brief  DEPRECATED constructor for SPI SSD1306 displays, using native
@@ -306,8 +322,9 @@ Adafruit_SSD1306::Adafruit_SSD1306(int8_t mosi_pin, int8_t sclk_pin,
 */
 Adafruit_SSD1306::Adafruit_SSD1306(int8_t dc_pin, int8_t rst_pin, int8_t cs_pin)
     : Adafruit_GFX(SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT), spi(&SPI), wire(NULL),
-      buffer(NULL), mosiPin(-1), clkPin(-1), dcPin(dc_pin), csPin(cs_pin),
-      rstPin(rst_pin) {
+      buffer(NULL), frontBuffer(NULL), mosiPin(-1), clkPin(-1), dcPin(dc_pin),
+      csPin(cs_pin), rstPin(rst_pin) {
+  spiClk = 8000000;
 #ifdef SPI_HAS_TRANSACTION
   spiSettings = SPISettings(8000000, MSBFIRST, SPI_MODE0);
 #endif
@@ -329,8 +346,8 @@ Adafruit_SSD1306::Adafruit_SSD1306(int8_t dc_pin, int8_t rst_pin, int8_t cs_pin)
 */
 Adafruit_SSD1306::Adafruit_SSD1306(int8_t rst_pin)
     : Adafruit_GFX(SSD1306_LCDWIDTH, SSD1306_LCDHEIGHT), spi(NULL), wire(&Wire),
-      buffer(NULL), mosiPin(-1), clkPin(-1), dcPin(-1), csPin(-1),
-      rstPin(rst_pin) {}
+      buffer(NULL), frontBuffer(NULL), mosiPin(-1), clkPin(-1), dcPin(-1),
+      csPin(-1), rstPin(rst_pin) {}
 
 /*!
     @brief  Destructor for Adafruit_SSD1306 object.
@@ -340,6 +357,10 @@ Adafruit_SSD1306::~Adafruit_SSD1306(void) {
     free(buffer);
     buffer = NULL;
   }
+  if (frontBuffer) {
+    free(frontBuffer);
+    frontBuffer = NULL;
+  }
 }
 
 // LOW-LEVEL UTILS ---------------------------------------------------------
@@ -377,6 +398,38 @@ inline void Adafruit_SSD1306::SPIwrite(uint8_t d) {
   }
 }
 
+/*!
+    @brief  Record a change of the buffer, for the next display().
+    @param  x1
+            First column changed (in display coordinates, not rotated).
+    @param  x2
+            Last column changed.
+    @param  page1
+            First page (8 rows) changed.
+    @param  page2
+            Last page changed.
+    @return void
+*/
+inline void Adafruit_SSD1306::dirtyRange(uint8_t x1, uint8_t x2,
+                                         uint8_t page1, uint8_t page2) {
+  for (uint8_t p = page1; p <= page2; p++) {
+    if (x1 < dirtyStart[p])
+      dirtyStart[p] = x1;
+    if (x2 > dirtyEnd[p])
+      dirtyEnd[p] = x2;
+  }
+}
+
+/*!
+    @brief  Mark the whole buffer as sent to the display.
+    @return void
+*/
+void Adafruit_SSD1306::clearDirty(void) {
+  uint8_t pages = (HEIGHT + 7) / 8;
+  memset(dirtyStart, 0xFF, pages);
+  memset(dirtyEnd, 0, pages);
+}
+
 /*!
     @brief Issue single command to SSD1306, using I2C or hard/soft SPI as
    needed. Because command calls are often grouped, SPI transaction and
@@ -492,8 +545,14 @@ void Adafruit_SSD1306::ssd1306_command(uint8_t c) {
 bool Adafruit_SSD1306::begin(uint8_t vcs, uint8_t addr, bool reset,
                              bool periphBegin) {
 
-  if ((!buffer) && !(buffer = (uint8_t *)malloc(WIDTH * ((HEIGHT + 7) / 8))))
+  // The dirty ranges (2 bytes per page) follow the image in the same block
+  uint16_t bytes = WIDTH * ((HEIGHT + 7) / 8);
+  if ((!buffer) &&
+      !(buffer = (uint8_t *)malloc(bytes + 2 * ((HEIGHT + 7) / 8))))
     return false;
+  dirtyStart = buffer + bytes;
+  dirtyEnd = dirtyStart + (HEIGHT + 7) / 8;
+  stepping = false;
 
   clearDisplay();
 
@@ -655,6 +714,7 @@ void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
       y = HEIGHT - y - 1;
       break;
     }
+    dirtyRange(x, x, y / 8, y / 8);
     switch (color) {
     case SSD1306_WHITE:
       buffer[x + (y / 8) * WIDTH] |= (1 << (y & 7));
@@ -678,6 +738,21 @@ void Adafruit_SSD1306::drawPixel(int16_t x, int16_t y, uint16_t color) {
 */
 void Adafruit_SSD1306::clearDisplay(void) {
   memset(buffer, 0, WIDTH * ((HEIGHT + 7) / 8));
+  markDirty();
+}
+
+/*!
+    @brief  Mark the whole buffer as changed: the next display() refreshes
+            the whole screen.
+    @return None (void).
+    @note   The drawing functions record the area they change, and display()
+            only sends that area. Call this after writing to the buffer
+            directly, or when the display RAM may differ from the buffer.
+*/
+void Adafruit_SSD1306::markDirty(void) {
+  uint8_t pages = (HEIGHT + 7) / 8;
+  memset(dirtyStart, 0, pages);
+  memset(dirtyEnd, WIDTH - 1, pages);
 }
 
 /*!
@@ -757,25 +832,8 @@ void Adafruit_SSD1306::drawFastHLineInternal(int16_t x, int16_t y, int16_t w,
       w = (WIDTH - x);
     }
     if (w > 0) { // Proceed only if width is positive
-      uint8_t *pBuf = &buffer[(y / 8) * WIDTH + x], mask = 1 << (y & 7);
-      switch (color) {
-      case SSD1306_WHITE:
-        while (w--) {
-          *pBuf++ |= mask;
-        };
-        break;
-      case SSD1306_BLACK:
-        mask = ~mask;
-        while (w--) {
-          *pBuf++ &= mask;
-        };
-        break;
-      case SSD1306_INVERSE:
-        while (w--) {
-          *pBuf++ ^= mask;
-        };
-        break;
-      }
+      dirtyRange(x, x + w - 1, y / 8, y / 8);
+      fillSpan(&buffer[(y / 8) * WIDTH + x], w, 1 << (y & 7), color);
     }
   }
 }
@@ -860,6 +918,7 @@ void Adafruit_SSD1306::drawFastVLineInternal(int16_t x, int16_t __y,
       // use local byte registers for faster juggling
       uint8_t y = __y, h = __h;
       uint8_t *pBuf = &buffer[(y / 8) * WIDTH + x];
+      dirtyRange(x, x, y / 8, (y + h - 1) / 8);
 
       // do the first partial byte, if necessary - this requires some masking
       uint8_t mod = (y & 7);
@@ -940,6 +999,555 @@ void Adafruit_SSD1306::drawFastVLineInternal(int16_t x, int16_t __y,
   }   // endif x in bounds
 }
 
+// 1-BIT KERNELS ----------------------------------------------------------
+
+// The generic Adafruit_GFX fills, bitmaps and glyphs draw pixel by pixel
+// (or column by column), each call clipping and locating its byte again.
+// These work on whole bytes of the page-packed buffer: a byte holds 8 rows
+// of a column, least significant bit at the top. Bitmaps and custom font
+// glyphs are stored by rows, blocks of 8x8 bits are transposed to columns.
+
+/*!
+    @brief  Apply a color to the bits of mask in consecutive columns of a
+            page: the row span of a fill.
+    @param  p
+            First byte.
+    @param  n
+            Number of columns.
+    @param  mask
+            Rows to draw, bit 0 at the top of the page.
+    @param  color
+            SSD1306_BLACK, SSD1306_WHITE or SSD1306_INVERSE.
+    @return None (void).
+*/
+void Adafruit_SSD1306::fillSpan(uint8_t *p, int16_t n, uint8_t mask,
+                                uint16_t color) {
+  if ((mask == 0xFF) && (color != SSD1306_INVERSE)) {
+    memset(p, (color == SSD1306_WHITE) ? 0xFF : 0x00, n);
+    return;
+  }
+  // Bytes up to a word boundary, words, then the remaining bytes
+  uint32_t word = mask * 0x01010101UL;
+  while ((n > 0) && ((uintptr_t)p & 3)) {
+    switch (color) {
+    case SSD1306_WHITE:
+      *p |= mask;
+      break;
+    case SSD1306_BLACK:
+      *p &= ~mask;
+      break;
+    case SSD1306_INVERSE:
+      *p ^= mask;
+      break;
+    }
+    p++;
+    n--;
+  }
+  ssd1306_word_t *w = (ssd1306_word_t *)p;
+  switch (color) {
+  case SSD1306_WHITE:
+    for (; n >= 4; n -= 4)
+      *w++ |= word;
+    break;
+  case SSD1306_BLACK:
+    for (; n >= 4; n -= 4)
+      *w++ &= ~word;
+    break;
+  case SSD1306_INVERSE:
+    for (; n >= 4; n -= 4)
+      *w++ ^= word;
+    break;
+  default:
+    return;
+  }
+  p = (uint8_t *)w;
+  while (n-- > 0) {
+    switch (color) {
+    case SSD1306_WHITE:
+      *p++ |= mask;
+      break;
+    case SSD1306_BLACK:
+      *p++ &= ~mask;
+      break;
+    case SSD1306_INVERSE:
+      *p++ ^= mask;
+      break;
+    }
+  }
+}
+
+/*!
+    @brief  Apply a color to the bits of mask in one byte.
+    @param  p
+            Byte of the buffer.
+    @param  mask
+            Bits to draw.
+    @param  color
+            SSD1306_BLACK, SSD1306_WHITE or SSD1306_INVERSE.
+*/
+static inline void ssd1306_apply(uint8_t *p, uint8_t mask, uint16_t color) {
+  switch (color) {
+  case SSD1306_WHITE:
+    *p |= mask;
+    break;
+  case SSD1306_BLACK:
+    *p &= ~mask;
+    break;
+  case SSD1306_INVERSE:
+    *p ^= mask;
+    break;
+  }
+}
+
+/*!
+    @brief  Transpose 8x8 bits: 8 rows (most significant bit at the left) to
+            8 columns (least significant bit at the top). Hacker's Delight,
+            transpose8.
+    @param  r
+            Rows, top first.
+    @param  c
+            Columns, left first.
+*/
+static void ssd1306_transpose(const uint8_t *r, uint8_t *c) {
+  // Bottom row first: the top row ends in the least significant bits
+  uint32_t x = ((uint32_t)r[7] << 24) | ((uint32_t)r[6] << 16) |
+               ((uint32_t)r[5] << 8) | r[4];
+  uint32_t y = ((uint32_t)r[3] << 24) | ((uint32_t)r[2] << 16) |
+               ((uint32_t)r[1] << 8) | r[0];
+  uint32_t t;
+
+  t = (x ^ (x >> 7)) & 0x00AA00AAUL;
+  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AAUL;
+  y = y ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCCUL;
+  x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCCUL;
+  y = y ^ t ^ (t << 14);
+  t = (x & 0xF0F0F0F0UL) | ((y >> 4) & 0x0F0F0F0FUL);
+  y = ((x << 4) & 0xF0F0F0F0UL) | (y & 0x0F0F0F0FUL);
+  x = t;
+  c[0] = x >> 24;
+  c[1] = x >> 16;
+  c[2] = x >> 8;
+  c[3] = x;
+  c[4] = y >> 24;
+  c[5] = y >> 16;
+  c[6] = y >> 8;
+  c[7] = y;
+}
+
+/*!
+    @brief  Read up to 8 bits of a bitmap at any bit position, without
+            reading past them.
+    @param  bitmap
+            Bitmap, most significant bit first.
+    @param  progmem
+            true if the bitmap is in PROGMEM.
+    @param  bit
+            Position of the first bit.
+    @param  n
+            Number of bits, 1 to 8.
+    @return The bits, left aligned (first one in bit 7).
+*/
+static inline uint8_t ssd1306_bits(const uint8_t *bitmap, bool progmem,
+                                   uint32_t bit, uint8_t n) {
+  const uint8_t *p = &bitmap[bit >> 3];
+  uint8_t shift = bit & 7;
+  uint8_t b = (progmem ? pgm_read_byte(p) : *p) << shift;
+  if (shift + n > 8)
+    b |= (progmem ? pgm_read_byte(p + 1) : p[1]) >> (8 - shift);
+  return b;
+}
+
+/*!
+    @brief  Draw a 1-bit image stored by rows, in display coordinates
+            (rotation 0), clipped to the display.
+    @param  x
+            Left column.
+    @param  y
+            Top row.
+    @param  bitmap
+            Image bits, most significant bit first.
+    @param  progmem
+            true if the image is in PROGMEM.
+    @param  bitOffset
+            Position of the first bit of the image in bitmap.
+    @param  stride
+            Bits from one row to the next: 8 * bytes per row for a bitmap,
+            the width for a custom font glyph.
+    @param  w
+            Width in pixels.
+    @param  h
+            Height in pixels.
+    @param  color
+            Color of the set bits.
+    @param  bg
+            Color of the clear bits, if opaque.
+    @param  opaque
+            false to leave the pixels of clear bits unchanged.
+    @return None (void).
+*/
+void Adafruit_SSD1306::blit(int16_t x, int16_t y, const uint8_t *bitmap,
+                            bool progmem, uint32_t bitOffset, uint16_t stride,
+                            int16_t w, int16_t h, uint16_t color, uint16_t bg,
+                            bool opaque) {
+  int16_t i0 = max((int16_t)0, (int16_t)-x), i1 = min(w, (int16_t)(WIDTH - x));
+  int16_t j0 = max((int16_t)0, (int16_t)-y), j1 = min(h, (int16_t)(HEIGHT - y));
+  if ((i0 >= i1) || (j0 >= j1))
+    return;
+  dirtyRange(x + i0, x + i1 - 1, (y + j0) / 8, (y + j1 - 1) / 8);
+
+  // Groups of up to 8 rows, each within one page of the buffer
+  for (int16_t j = j0; j < j1;) {
+    uint8_t shift = (y + j) & 7;
+    uint8_t n = min(8 - shift, j1 - j);
+    uint8_t mask = ((1 << n) - 1) << shift;
+    uint8_t *dst = &buffer[((y + j) / 8) * WIDTH + x];
+
+    for (int16_t i = i0; i < i1; i += 8) {
+      uint8_t bits = min(8, i1 - i);
+      uint8_t rows[8] = {0, 0, 0, 0, 0, 0, 0, 0}, cols[8];
+      for (uint8_t r = 0; r < n; r++)
+        rows[r] = ssd1306_bits(bitmap, progmem,
+                               bitOffset + (uint32_t)(j + r) * stride + i, bits);
+      ssd1306_transpose(rows, cols);
+      for (uint8_t k = 0; k < bits; k++) {
+        uint8_t set = (cols[k] << shift) & mask;
+        ssd1306_apply(&dst[i + k], set, color);
+        if (opaque)
+          ssd1306_apply(&dst[i + k], ~set & mask, bg);
+      }
+    }
+    j += n;
+  }
+}
+
+/*!
+    @brief  Draw a 'classic' font glyph, scaled, in display coordinates
+            (rotation 0), clipped to the display.
+    @param  x
+            Left column.
+    @param  y
+            Top row.
+    @param  lines
+            The 5 glyph columns in PROGMEM, bit 0 at the top.
+    @param  size_x
+            Horizontal scale.
+    @param  size_y
+            Vertical scale, 1 to 7.
+    @param  color
+            Color of the set bits.
+    @param  bg
+            Color of the clear bits, if opaque.
+    @param  opaque
+            false to leave the pixels of clear bits unchanged. If true, the
+            space column after the glyph is drawn as well.
+    @return None (void).
+*/
+void Adafruit_SSD1306::drawGlyph(int16_t x, int16_t y, const uint8_t *lines,
+                                 uint8_t size_x, uint8_t size_y,
+                                 uint16_t color, uint16_t bg, bool opaque) {
+  uint8_t columns = opaque ? 6 : 5;
+  uint64_t bits[6], mask = (size_y < 8) ? (1ULL << (8 * size_y)) - 1 : 0;
+
+  // The columns scaled in 64-bit words: up to 7 * 8 rows, plus the shift
+  // to the page
+  for (uint8_t i = 0; i < columns; i++) {
+    uint8_t line = (i < 5) ? pgm_read_byte(&lines[i]) : 0;
+    if (size_y == 1) {
+      bits[i] = line;
+    } else {
+      uint64_t unit = (1ULL << size_y) - 1;
+      bits[i] = 0;
+      for (uint8_t j = 0; j < 8; j++)
+        if (line & (1 << j))
+          bits[i] |= unit << (j * size_y);
+    }
+  }
+  uint8_t shift;
+  int16_t page;
+  if (y < 0) { // Clipped at the top: drop the rows above
+    for (uint8_t i = 0; i < columns; i++)
+      bits[i] >>= -y;
+    mask >>= -y;
+    shift = 0;
+    page = 0;
+  } else {
+    shift = y & 7;
+    page = y / 8;
+  }
+
+  // Text is mostly white on black or black on white: one store per byte
+  uint8_t mode = 0;
+  if (opaque && (color == SSD1306_WHITE) && (bg == SSD1306_BLACK))
+    mode = 1;
+  else if (opaque && (color == SSD1306_BLACK) && (bg == SSD1306_WHITE))
+    mode = 2;
+
+  for (uint8_t k = 0; (page < (HEIGHT + 7) / 8); k++, page++) {
+    uint8_t m = ((mask << shift) >> (8 * k)) & 0xFF;
+    if (!m)
+      break;
+    uint8_t *row = &buffer[page * WIDTH];
+    for (uint8_t i = 0; i < columns; i++) {
+      uint8_t set = ((bits[i] << shift) >> (8 * k)) & m;
+      int16_t x1 = max((int16_t)0, (int16_t)(x + i * size_x));
+      int16_t x2 = min((int16_t)(x + (i + 1) * size_x), WIDTH);
+      for (int16_t c = x1; c < x2; c++) {
+        uint8_t *p = &row[c];
+        if (mode == 1) {
+          *p = (*p & ~m) | set;
+        } else if (mode == 2) {
+          *p = (*p & ~m) | (~set & m);
+        } else {
+          ssd1306_apply(p, set, color);
+          if (opaque)
+            ssd1306_apply(p, ~set & m, bg);
+        }
+      }
+    }
+  }
+}
+
+/*!
+    @brief  Fill a rectangle, a page row at a time.
+    @param  x
+            Top left corner x coordinate.
+    @param  y
+            Top left corner y coordinate.
+    @param  w
+            Width in pixels.
+    @param  h
+            Height in pixels.
+    @param  color
+            SSD1306_BLACK, SSD1306_WHITE or SSD1306_INVERSE.
+    @return None (void).
+    @note   Changes buffer contents only, no immediate effect on display.
+*/
+void Adafruit_SSD1306::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                uint16_t color) {
+  if ((w <= 0) || (h <= 0))
+    return;
+  // Rectangle in display coordinates
+  int16_t t;
+  switch (rotation) {
+  case 1:
+    t = x;
+    x = WIDTH - y - h;
+    y = t;
+    ssd1306_swap(w, h);
+    break;
+  case 2:
+    x = WIDTH - x - w;
+    y = HEIGHT - y - h;
+    break;
+  case 3:
+    t = y;
+    y = HEIGHT - x - w;
+    x = t;
+    ssd1306_swap(w, h);
+    break;
+  }
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > WIDTH)
+    w = WIDTH - x;
+  if (y + h > HEIGHT)
+    h = HEIGHT - y;
+  if ((w <= 0) || (h <= 0))
+    return;
+
+  dirtyRange(x, x + w - 1, y / 8, (y + h - 1) / 8);
+  for (int16_t row = y; row < y + h;) {
+    uint8_t shift = row & 7;
+    uint8_t n = min(8 - shift, y + h - row);
+    fillSpan(&buffer[(row / 8) * WIDTH + x], w, ((1 << n) - 1) << shift,
+             color);
+    row += n;
+  }
+}
+
+/*!
+    @brief  Draw a PROGMEM-resident 1-bit image (unset bits are transparent).
+    @param  x
+            Top left corner x coordinate.
+    @param  y
+            Top left corner y coordinate.
+    @param  bitmap
+            Image, rows padded to whole bytes, most significant bit first.
+    @param  w
+            Width of bitmap in pixels.
+    @param  h
+            Height of bitmap in pixels.
+    @param  color
+            SSD1306_BLACK, SSD1306_WHITE or SSD1306_INVERSE.
+    @return None (void).
+    @note   Rotated displays use the generic Adafruit_GFX version.
+*/
+void Adafruit_SSD1306::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                                  int16_t w, int16_t h, uint16_t color) {
+  if (rotation)
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color);
+  else
+    blit(x, y, bitmap, true, 0, ((w + 7) / 8) * 8, w, h, color, color, false);
+}
+
+/*!
+    @brief  Draw a PROGMEM-resident 1-bit image with a background color.
+    @param  x
+            Top left corner x coordinate.
+    @param  y
+            Top left corner y coordinate.
+    @param  bitmap
+            Image, rows padded to whole bytes, most significant bit first.
+    @param  w
+            Width of bitmap in pixels.
+    @param  h
+            Height of bitmap in pixels.
+    @param  color
+            Color of the set bits.
+    @param  bg
+            Color of the unset bits.
+    @return None (void).
+    @note   Rotated displays use the generic Adafruit_GFX version.
+*/
+void Adafruit_SSD1306::drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[],
+                                  int16_t w, int16_t h, uint16_t color,
+                                  uint16_t bg) {
+  if (rotation)
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+  else
+    blit(x, y, bitmap, true, 0, ((w + 7) / 8) * 8, w, h, color, bg, true);
+}
+
+/*!
+    @brief  Draw a RAM-resident 1-bit image (unset bits are transparent).
+    @param  x
+            Top left corner x coordinate.
+    @param  y
+            Top left corner y coordinate.
+    @param  bitmap
+            Image, rows padded to whole bytes, most significant bit first.
+    @param  w
+            Width of bitmap in pixels.
+    @param  h
+            Height of bitmap in pixels.
+    @param  color
+            SSD1306_BLACK, SSD1306_WHITE or SSD1306_INVERSE.
+    @return None (void).
+    @note   Rotated displays use the generic Adafruit_GFX version.
+*/
+void Adafruit_SSD1306::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap,
+                                  int16_t w, int16_t h, uint16_t color) {
+  if (rotation)
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color);
+  else
+    blit(x, y, bitmap, false, 0, ((w + 7) / 8) * 8, w, h, color, color, false);
+}
+
+/*!
+    @brief  Draw a RAM-resident 1-bit image with a background color.
+    @param  x
+            Top left corner x coordinate.
+    @param  y
+            Top left corner y coordinate.
+    @param  bitmap
+            Image, rows padded to whole bytes, most significant bit first.
+    @param  w
+            Width of bitmap in pixels.
+    @param  h
+            Height of bitmap in pixels.
+    @param  color
+            Color of the set bits.
+    @param  bg
+            Color of the unset bits.
+    @return None (void).
+    @note   Rotated displays use the generic Adafruit_GFX version.
+*/
+void Adafruit_SSD1306::drawBitmap(int16_t x, int16_t y, uint8_t *bitmap,
+                                  int16_t w, int16_t h, uint16_t color,
+                                  uint16_t bg) {
+  if (rotation)
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+  else
+    blit(x, y, bitmap, false, 0, ((w + 7) / 8) * 8, w, h, color, bg, true);
+}
+
+/*!
+    @brief  Draw a single character, a glyph column (classic font) or a
+            block of 8x8 bits (custom font) at a time.
+    @param  x
+            Bottom left corner x coordinate.
+    @param  y
+            Bottom left corner y coordinate.
+    @param  c
+            The 8-bit font-indexed character (likely ascii).
+    @param  color
+            Color to draw character with.
+    @param  bg
+            Color to fill background with (if same as color, no background).
+            Classic font only, as Adafruit_GFX.
+    @param  size_x
+            Font magnification level in X-axis, 1 is 'original' size.
+    @param  size_y
+            Font magnification level in Y-axis, 1 is 'original' size.
+    @return None (void).
+    @note   Rotated displays, classic font scaled more than 7 times
+            vertically, scaled custom fonts and span fonts use the generic
+            Adafruit_GFX version (spans go to drawFastHLine()). Unscaled
+            custom fonts do not use the glyph cache: the blit is faster.
+*/
+void Adafruit_SSD1306::drawChar(int16_t x, int16_t y, unsigned char c,
+                                uint16_t color, uint16_t bg, uint8_t size_x,
+                                uint8_t size_y) {
+  if (rotation || (size_x == 0) || (size_y == 0) ||
+      (gfxFont ? (spanFont || (size_x != 1) || (size_y != 1))
+               : (size_y > 7))) {
+    Adafruit_GFX::drawChar(x, y, c, color, bg, size_x, size_y);
+    return;
+  }
+
+  if (!gfxFont) { // 'Classic' built-in font
+    if ((x >= _width) ||              // Clip right
+        (y >= _height) ||             // Clip bottom
+        ((x + 6 * size_x - 1) < 0) || // Clip left
+        ((y + 8 * size_y - 1) < 0))   // Clip top
+      return;
+
+    if (!_cp437 && (c >= 176))
+      c++; // Handle 'classic' charset behavior
+
+    bool opaque = (bg != color);
+    const unsigned char *font = classicFont();
+    int16_t x1 = max((int16_t)0, x);
+    int16_t x2 = min((int16_t)(x + (opaque ? 6 : 5) * size_x - 1),
+                     (int16_t)(WIDTH - 1));
+    int16_t y1 = max((int16_t)0, y);
+    int16_t y2 = min((int16_t)(y + 8 * size_y - 1), (int16_t)(HEIGHT - 1));
+    if ((x1 > x2) || (y1 > y2))
+      return;
+    dirtyRange(x1, x2, y1 / 8, y2 / 8);
+    drawGlyph(x, y, &font[c * 5], size_x, size_y, color, bg, opaque);
+
+  } else { // Custom font, no background (see Adafruit_GFX::drawChar())
+
+    GFXglyph *glyph = fontGlyph(c - (uint8_t)pgm_read_byte(&gfxFont->first));
+    uint16_t bo = pgm_read_word(&glyph->bitmapOffset);
+    uint8_t w = pgm_read_byte(&glyph->width), h = pgm_read_byte(&glyph->height);
+    int8_t xo = pgm_read_byte(&glyph->xOffset),
+           yo = pgm_read_byte(&glyph->yOffset);
+    blit(x + xo, y + yo, fontBitmap(), true, (uint32_t)bo * 8, w, w, h, color,
+         color, false);
+  }
+}
+
 /*!
     @brief  Return color of a single pixel in display buffer.
     @param  x
@@ -977,28 +1585,138 @@ bool Adafruit_SSD1306::getPixel(int16_t x, int16_t y) {
     @brief  Get base address of display buffer for direct reading or writing.
     @return Pointer to an unsigned 8-bit array, column-major, columns padded
             to full byte boundary if needed.
+    @note   The next display() refreshes the whole screen, as the buffer may
+            be written through this pointer (see markDirty()).
 */
-uint8_t *Adafruit_SSD1306::getBuffer(void) { return buffer; }
+uint8_t *Adafruit_SSD1306::getBuffer(void) {
+  markDirty();
+  return buffer;
+}
 
 // REFRESH DISPLAY ---------------------------------------------------------
 
+/*!
+    @brief  Send a rectangle of the buffer to the SSD1306 display.
+            Transaction must be started in calling function.
+    @param  page1
+            First page (8 rows).
+    @param  page2
+            Last page.
+    @param  x1
+            First column.
+    @param  x2
+            Last column.
+    @return None (void).
+*/
+void Adafruit_SSD1306::ssd1306_window(uint8_t page1, uint8_t page2, uint8_t x1,
+                                      uint8_t x2) {
+  uint8_t window[] = {SSD1306_PAGEADDR, page1, page2, SSD1306_COLUMNADDR, x1,
+                      x2};
+  uint8_t width = x2 - x1 + 1;
+
+  // The window is in RAM, ssd1306_commandList() reads PROGMEM
+  if (wire) { // I2C
+    wire->beginTransmission(i2caddr);
+    WIRE_WRITE((uint8_t)0x00); // Co = 0, D/C = 0
+    for (uint8_t i = 0; i < sizeof(window); i++)
+      WIRE_WRITE(window[i]);
+    wire->endTransmission();
+
+    // Horizontal addressing mode: the display wraps to the next page of the
+    // window, the rows follow each other in the data stream
+    wire->beginTransmission(i2caddr);
+    WIRE_WRITE((uint8_t)0x40);
+    uint16_t bytesOut = 1;
+    for (uint8_t page = page1; page <= page2; page++) {
+      uint8_t *ptr = &buffer[page * WIDTH + x1];
+      uint8_t count = width;
+      while (count--) {
+        if (bytesOut >= WIRE_MAX) {
+          wire->endTransmission();
+          wire->beginTransmission(i2caddr);
+          WIRE_WRITE((uint8_t)0x40);
+          bytesOut = 1;
+        }
+        WIRE_WRITE(*ptr++);
+        bytesOut++;
+      }
+    }
+    wire->endTransmission();
+  } else { // SPI
+    SSD1306_MODE_COMMAND
+    for (uint8_t i = 0; i < sizeof(window); i++)
+      SPIwrite(window[i]);
+    SSD1306_MODE_DATA
+    for (uint8_t page = page1; page <= page2; page++) {
+      uint8_t *ptr = &buffer[page * WIDTH + x1];
+      uint8_t count = width;
+      while (count--)
+        SPIwrite(*ptr++);
+    }
+  }
+}
+
+/*!
+    @brief  Find the next window to send from per page column ranges: the
+            first dirty page from page on, grown over the next dirty pages
+            while that sends fewer bytes than opening another window.
+            The window is stored in windowPage1, windowPage2, windowX1 and
+            windowX2.
+    @param  start
+            Per page, first column to send (page clean when > end).
+    @param  end
+            Per page, last column to send.
+    @param  page
+            First page to look at.
+    @return true if a window was found, false if no page is dirty from page.
+*/
+bool Adafruit_SSD1306::nextWindow(const uint8_t *start, const uint8_t *end,
+                                  uint8_t page) {
+  uint8_t pages = (HEIGHT + 7) / 8;
+
+  while ((page < pages) && (start[page] > end[page]))
+    page++;
+  if (page == pages)
+    return false;
+
+  uint8_t first = page, x1 = start[page], x2 = end[page];
+  while ((page + 1 < pages) && (start[page + 1] <= end[page + 1])) {
+    uint8_t nx1 = min(x1, start[page + 1]);
+    uint8_t nx2 = max(x2, end[page + 1]);
+    uint16_t merged = (nx2 - nx1 + 1) * (page + 2 - first);
+    uint16_t split = (x2 - x1 + 1) * (page + 1 - first) +
+                     (end[page + 1] - start[page + 1] + 1) +
+                     SSD1306_WINDOW_COST;
+    if (merged > split)
+      break;
+    x1 = nx1;
+    x2 = nx2;
+    page++;
+  }
+  windowPage1 = first;
+  windowPage2 = page;
+  windowX1 = x1;
+  windowX2 = x2;
+  return true;
+}
+
 /*!
     @brief  Push data currently in RAM to SSD1306 display.
     @return None (void).
     @note   Drawing operations are not visible until this function is
             called. Call after each graphics command, or after a whole set
             of graphics commands, as best needed by one's own application.
+            Only the columns changed since the last call are sent, in one
+            window per group of adjacent pages; nothing is sent if the
+            buffer did not change. A refresh in progress with displayStep()
+            is abandoned, its remaining area is sent from the buffer.
 */
 void Adafruit_SSD1306::display(void) {
-  TRANSACTION_START
-  static const uint8_t PROGMEM dlist1[] = {
-      SSD1306_PAGEADDR,
-      0,                      // Page start address
-      0xFF,                   // Page end (not really, but works here)
-      SSD1306_COLUMNADDR, 0}; // Column start address
-  ssd1306_commandList(dlist1, sizeof(dlist1));
-  ssd1306_command1(WIDTH - 1); // Column end address
+  cancelStep();
+  if (!nextWindow(dirtyStart, dirtyEnd, 0))
+    return; // Nothing changed
 
+  TRANSACTION_START
 #if defined(ESP8266)
   // ESP8266 needs a periodic yield() call to avoid watchdog reset.
   // With the limited size of SSD1306 displays, and the fast bitrate
@@ -1008,34 +1726,235 @@ void Adafruit_SSD1306::display(void) {
   // 32-byte transfer condition below.
   yield();
 #endif
-  uint16_t count = WIDTH * ((HEIGHT + 7) / 8);
-  uint8_t *ptr = buffer;
-  if (wire) { // I2C
-    wire->beginTransmission(i2caddr);
-    WIRE_WRITE((uint8_t)0x40);
-    uint16_t bytesOut = 1;
-    while (count--) {
-      if (bytesOut >= WIRE_MAX) {
-        wire->endTransmission();
-        wire->beginTransmission(i2caddr);
-        WIRE_WRITE((uint8_t)0x40);
-        bytesOut = 1;
-      }
-      WIRE_WRITE(*ptr++);
-      bytesOut++;
-    }
-    wire->endTransmission();
-  } else { // SPI
-    SSD1306_MODE_DATA
-    while (count--)
-      SPIwrite(*ptr++);
-  }
+  do {
+    ssd1306_window(windowPage1, windowPage2, windowX1, windowX2);
+  } while (nextWindow(dirtyStart, dirtyEnd, windowPage2 + 1));
+  clearDirty();
   TRANSACTION_END
 #if defined(ESP8266)
   yield();
 #endif
 }
 
+// INCREMENTAL REFRESH -----------------------------------------------------
+
+// display() holds the bus for the whole transfer: up to ~25 ms for a full
+// 128x64 screen on I2C at 400 KHz, longer than the period of a control loop
+// sharing the bus with its sensors. beginDisplay() takes a copy of the
+// changed area, and displayStep() sends it in transfers that fit in the time
+// the caller has left, while the sketch keeps drawing in the buffer.
+
+/*!
+    @brief  Start an incremental refresh of the area changed since the last
+            refresh, to be sent by displayStep().
+    @return true if started (or nothing to send), false if the previous
+            incremental refresh is still in progress or the second image
+            buffer could not be allocated.
+    @note   The changed area is copied to a second image buffer (allocated
+            by the first call, same size as the display buffer): the sketch
+            can go on drawing while it is sent, the changes go to the next
+            refresh.
+*/
+bool Adafruit_SSD1306::beginDisplay(void) {
+  uint8_t pages = (HEIGHT + 7) / 8;
+
+  if (stepping)
+    return false;
+  if ((!frontBuffer) &&
+      !(frontBuffer = (uint8_t *)malloc(WIDTH * pages + 3 * pages)))
+    return false;
+  sendStart = frontBuffer + WIDTH * pages;
+  sendEnd = sendStart + pages;
+  sendLast = sendEnd + pages;
+
+  // The windows are chosen now and kept: a window may span columns that did
+  // not change on some of its pages, they are copied as well
+  memset(sendStart, 0xFF, pages);
+  memset(sendEnd, 0, pages);
+  uint8_t page = 0;
+  while (nextWindow(dirtyStart, dirtyEnd, page)) {
+    sendStart[windowPage1] = windowX1;
+    sendEnd[windowPage1] = windowX2;
+    sendLast[windowPage1] = windowPage2;
+    for (page = windowPage1; page <= windowPage2; page++)
+      memcpy(&frontBuffer[page * WIDTH + windowX1],
+             &buffer[page * WIDTH + windowX1], windowX2 - windowX1 + 1);
+  }
+  clearDirty();
+  windowOpen = false;
+  stepping = stepWindow(0);
+  return true;
+}
+
+/*!
+    @brief  Find the next window of the incremental refresh, from page on.
+            The window is stored in windowPage1, windowPage2, windowX1 and
+            windowX2.
+    @param  page
+            First page to look at.
+    @return true if a window was found, false if the refresh is complete.
+*/
+bool Adafruit_SSD1306::stepWindow(uint8_t page) {
+  uint8_t pages = (HEIGHT + 7) / 8;
+
+  while ((page < pages) && (sendStart[page] > sendEnd[page]))
+    page++;
+  if (page == pages)
+    return false;
+  windowPage1 = page;
+  windowPage2 = sendLast[page];
+  windowX1 = sendStart[page];
+  windowX2 = sendEnd[page];
+  return true;
+}
+
+/*!
+    @brief  Bus time of a transfer to the display, for displayStep().
+    @param  n
+            Bytes to send.
+    @param  command
+            true for a window address command, false for image data.
+    @return Bits at the bus clock, start/stop conditions and I2C address
+            included.
+*/
+uint32_t Adafruit_SSD1306::stepBits(uint16_t n, bool command) {
+  if (wire) // Address and control bytes, 9 bits per byte with the ack
+    return (n + 2) * 9 + 2;
+  return n * 8 + (command ? 0 : 8); // SPI: the D/C switch, one byte time
+}
+
+/*!
+    @brief  Send the next part of a refresh started by beginDisplay(), as
+            many whole transfers as fit in a time budget.
+    @param  budget_us
+            Bus time available, in microseconds. Transfers that would not
+            end within it are left for the next call.
+    @return true when the refresh is complete, false while there is more
+            to send.
+    @note   The longest transfer is bounded by the Wire buffer (WIRE_MAX
+            bytes): with a budget under its time (~3 ms for 128 bytes at
+            400 KHz) the data goes in smaller transfers, down to one byte.
+            A budget must at least fit the window address command (8 bytes,
+            ~185 us on I2C at 400 KHz), or the refresh makes no progress.
+            The window address of the display must not be changed between
+            calls (display() may be called, it cancels the refresh). The
+            time is estimated from the bus clock (wire clock, SPI bitrate,
+            or SSD1306_SOFTSPI_CLOCK for software SPI) and does not include
+            the CPU time of the calls.
+*/
+bool Adafruit_SSD1306::displayStep(uint32_t budget_us) {
+  if (!stepping)
+    return true;
+
+  uint32_t clk;
+  if (wire) {
+#if ARDUINO >= 157
+    clk = wireClk;
+#else
+    clk = 100000UL;
+#endif
+  } else {
+    clk = spi ? spiClk : SSD1306_SOFTSPI_CLOCK;
+  }
+  // 32 bits: budget_us * clk / 1000 fits up to a few seconds at 1 MHz
+  uint32_t bits = budget_us * (clk / 1000) / 1000;
+  uint16_t dataMax = wire ? WIRE_MAX - 1 : WIDTH;
+  bool started = false;
+
+  while (stepping) {
+    if (!windowOpen) {
+      uint32_t cost = stepBits(6, true);
+      if (cost > bits)
+        break;
+      if (!started) {
+        TRANSACTION_START
+        started = true;
+      }
+      uint8_t window[] = {SSD1306_PAGEADDR,   windowPage1, windowPage2,
+                          SSD1306_COLUMNADDR, windowX1,    windowX2};
+      if (wire) {
+        wire->beginTransmission(i2caddr);
+        WIRE_WRITE((uint8_t)0x00); // Co = 0, D/C = 0
+        for (uint8_t i = 0; i < sizeof(window); i++)
+          WIRE_WRITE(window[i]);
+        wire->endTransmission();
+      } else {
+        SSD1306_MODE_COMMAND
+        for (uint8_t i = 0; i < sizeof(window); i++)
+          SPIwrite(window[i]);
+      }
+      bits -= cost;
+      windowOpen = true;
+      stepPage = windowPage1;
+      stepX = windowX1;
+    }
+
+    // Data bytes left in the window, and that fit in the budget
+    uint16_t left = (windowX2 - stepX + 1) +
+                    (windowPage2 - stepPage) * (windowX2 - windowX1 + 1);
+    uint16_t n = min(left, dataMax);
+    if (stepBits(n, false) > bits) {
+      uint32_t overhead = stepBits(0, false);
+      n = (bits > overhead) ? (bits - overhead) / (wire ? 9 : 8) : 0;
+    }
+    if (n == 0)
+      break;
+    if (!started) {
+      TRANSACTION_START
+      started = true;
+    }
+    bits -= stepBits(n, false);
+
+    if (wire) {
+      wire->beginTransmission(i2caddr);
+      WIRE_WRITE((uint8_t)0x40);
+    } else {
+      SSD1306_MODE_DATA
+    }
+    while (n--) {
+      uint8_t d = frontBuffer[stepPage * WIDTH + stepX];
+      if (wire) {
+        WIRE_WRITE(d);
+      } else {
+        SPIwrite(d);
+      }
+      if (stepX++ == windowX2) {
+        stepX = windowX1;
+        stepPage++;
+      }
+    }
+    if (wire)
+      wire->endTransmission();
+
+    if (stepPage > windowPage2) { // Window done
+      sendStart[windowPage1] = 0xFF;
+      sendEnd[windowPage1] = 0;
+      windowOpen = false;
+      stepping = stepWindow(windowPage2 + 1);
+    }
+  }
+  if (started) {
+    TRANSACTION_END
+  }
+  return !stepping;
+}
+
+/*!
+    @brief  Abandon the incremental refresh in progress: what it had still
+            to send is marked dirty, for the next refresh.
+    @return None (void).
+*/
+void Adafruit_SSD1306::cancelStep(void) {
+  if (!stepping)
+    return;
+  // The part of the current window already sent is sent again: simpler
+  // than splitting its range, and rare
+  for (uint8_t page = windowPage1; page < (HEIGHT + 7) / 8; page++)
+    if (sendStart[page] <= sendEnd[page])
+      dirtyRange(sendStart[page], sendEnd[page], page, sendLast[page]);
+  stepping = false;
+}
+
 // SCROLLING FUNCTIONS -----------------------------------------------------
 
 /*!
@@ -1139,11 +2058,13 @@ void Adafruit_SSD1306::startscrolldiagleft(uint8_t start, uint8_t stop) {
 /*!
     @brief  Cease a previously-begun scrolling action.
     @return None (void).
+    @note   The next display() refreshes the whole screen.
 */
 void Adafruit_SSD1306::stopscroll(void) {
   TRANSACTION_START
   ssd1306_command1(SSD1306_DEACTIVATE_SCROLL);
   TRANSACTION_END
+  markDirty(); // The display RAM must be rewritten after a scroll
 }
 
 // OTHER HARDWARE SETTINGS -------------------------------------------------
@@ -148,12 +148,27 @@ public:
   bool begin(uint8_t switchvcc = SSD1306_SWITCHCAPVCC, uint8_t i2caddr = 0,
              bool reset = true, bool periphBegin = true);
   void display(void);
+  bool beginDisplay(void);
+  bool displayStep(uint32_t budget_us);
+  bool displayBusy(void) { return stepping; }
   void clearDisplay(void);
   void invertDisplay(bool i);
   void dim(bool dim);
   void drawPixel(int16_t x, int16_t y, uint16_t color);
   virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
   virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color, uint16_t bg);
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
+                  uint16_t color);
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
+                  uint16_t color, uint16_t bg);
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                uint16_t bg, uint8_t size_x, uint8_t size_y);
+  using Adafruit_GFX::drawChar;
   void startscrollright(uint8_t start, uint8_t stop);
   void startscrollleft(uint8_t start, uint8_t stop);
   void startscrolldiagright(uint8_t start, uint8_t stop);
@@ -162,13 +177,28 @@ public:
   void ssd1306_command(uint8_t c);
   bool getPixel(int16_t x, int16_t y);
   uint8_t *getBuffer(void);
+  void markDirty(void);
 
 protected:
   inline void SPIwrite(uint8_t d) __attribute__((always_inline));
+  inline void dirtyRange(uint8_t x1, uint8_t x2, uint8_t page1, uint8_t page2)
+      __attribute__((always_inline));
+  void clearDirty(void);
   void drawFastHLineInternal(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void fillSpan(uint8_t *p, int16_t n, uint8_t mask, uint16_t color);
+  void blit(int16_t x, int16_t y, const uint8_t *bitmap, bool progmem,
+            uint32_t bitOffset, uint16_t stride, int16_t w, int16_t h,
+            uint16_t color, uint16_t bg, bool opaque);
+  void drawGlyph(int16_t x, int16_t y, const uint8_t *lines, uint8_t size_x,
+                 uint8_t size_y, uint16_t color, uint16_t bg, bool opaque);
   void drawFastVLineInternal(int16_t x, int16_t y, int16_t h, uint16_t color);
   void ssd1306_command1(uint8_t c);
   void ssd1306_commandList(const uint8_t *c, uint8_t n);
+  void ssd1306_window(uint8_t page1, uint8_t page2, uint8_t x1, uint8_t x2);
+  bool nextWindow(const uint8_t *start, const uint8_t *end, uint8_t page);
+  bool stepWindow(uint8_t page);
+  uint32_t stepBits(uint16_t n, bool command);
+  void cancelStep(void);
 
   SPIClass *spi;   ///< Initialized during construction when using SPI. See
                    ///< SPI.cpp, SPI.h
@@ -176,6 +206,16 @@ protected:
                    ///< Wire.cpp, Wire.h
   uint8_t *buffer; ///< Buffer data used for display buffer. Allocated when
                    ///< begin method is called.
+  uint8_t *frontBuffer; ///< Image being sent by displayStep(). Allocated by
+                        ///< the first beginDisplay() call.
+  uint8_t *sendStart;   ///< Windows displayStep() has still to send, by first
+                        ///< page: first column (> sendEnd: no window),
+  uint8_t *sendEnd;     ///< last column,
+  uint8_t *sendLast;    ///< and last page. In the frontBuffer allocation.
+  uint8_t *dirtyStart; ///< Per page, first column changed since the last
+                       ///< display(), in the buffer allocation
+  uint8_t *dirtyEnd;   ///< Per page, last column changed. A page is clean
+                       ///< when dirtyStart > dirtyEnd.
   int8_t i2caddr;  ///< I2C address initialized when begin method is called.
   int8_t vccstate; ///< VCC selection, set by begin method.
   int8_t page_end; ///< not used
@@ -196,6 +236,13 @@ protected:
   uint32_t restoreClk; ///< Wire speed following SSD1306 transfers
 #endif
   uint8_t contrast; ///< normal contrast setting for this device
+  uint32_t spiClk;  ///< Hardware SPI bitrate, for the displayStep() timing
+  uint8_t windowPage1, windowPage2, windowX1, windowX2; ///< Window being
+                                                        ///< sent by displayStep()
+  uint8_t stepPage; ///< Next byte displayStep() sends: page...
+  uint8_t stepX;    ///< ...and column
+  bool windowOpen;  ///< Window address sent to the display
+  bool stepping;    ///< Refresh started by beginDisplay() in progress
 #if defined(SPI_HAS_TRANSACTION)
 protected:
   // Allow sub-class to change
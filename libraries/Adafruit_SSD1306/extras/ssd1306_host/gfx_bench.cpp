@@ -0,0 +1,389 @@
+// Adafruit_SSD1306 - host benchmark of the 1-bit drawing kernels
+// Renders a reference dashboard (text of the classic and custom fonts,
+// filled bars, frames, an icon) with the SSD1306 kernels and with the
+// generic Adafruit_GFX code, reports the host time per frame of each, and
+// checks that both draw exactly the same pixels: the dashboard, then random
+// fills, bitmaps and characters over the whole screen, in every rotation
+// and color.
+// Then a large font readout on a 16-bit canvas standing for a SPI TFT,
+// drawn from the glyph bitmaps, through a GFXglyphCache and from a
+// GFXspanfont (converted here as 'fontconvert -r' would): drawing calls
+// (an address window each on a TFT) and host time per frame, and the same
+// pixels for all three.
+//
+// Usage: gfx_bench [-f frames] [-n random operations] [-s seed]
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <time.h>
+#include <unistd.h>
+#include "../../Adafruit_SSD1306.h"
+#include <Fonts/FreeMonoBold12pt7b.h>
+#include <Fonts/FreeSans18pt7b.h>
+#include <Fonts/FreeSans9pt7b.h>
+
+#define SCREEN_WIDTH 128
+#define SCREEN_HEIGHT 64
+
+// The same display drawn by the generic Adafruit_GFX code
+class GenericSSD1306 : public Adafruit_SSD1306 {
+public:
+  GenericSSD1306() : Adafruit_SSD1306(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire) {}
+  uint32_t pixels = 0; // drawPixel() calls: a call each on the target too
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    pixels++;
+    Adafruit_SSD1306::drawPixel(x, y, color);
+  }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    Adafruit_GFX::fillRect(x, y, w, h, color);
+  }
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color) {
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color);
+  }
+  void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w,
+                  int16_t h, uint16_t color, uint16_t bg) {
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+  }
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
+                  uint16_t color) {
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color);
+  }
+  void drawBitmap(int16_t x, int16_t y, uint8_t *bitmap, int16_t w, int16_t h,
+                  uint16_t color, uint16_t bg) {
+    Adafruit_GFX::drawBitmap(x, y, bitmap, w, h, color, bg);
+  }
+  void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
+                uint16_t bg, uint8_t size_x, uint8_t size_y) {
+    Adafruit_GFX::drawChar(x, y, c, color, bg, size_x, size_y);
+  }
+};
+
+static Adafruit_SSD1306 fast(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire);
+static GenericSSD1306 generic;
+
+static const uint8_t PROGMEM battery[] = {
+    0x00, 0x00, 0x7F, 0xFC, 0x40, 0x04, 0x5D, 0xD6, 0x5D, 0xD3, 0x5D, 0xD3,
+    0x5D, 0xD3, 0x5D, 0xD6, 0x40, 0x04, 0x7F, 0xFC, 0x00, 0x00};
+
+static uint64_t hostNs() {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1000000000ULL + t.tv_nsec;
+}
+
+// Telemetry screen of a balancing robot, values change every frame
+static void dashboard(Adafruit_SSD1306 &d, uint32_t frame) {
+  d.setFont();
+  d.fillScreen(SSD1306_BLACK);
+  d.fillRect(0, 0, SCREEN_WIDTH, 9, SSD1306_WHITE);
+  d.setTextSize(1);
+  d.setTextColor(SSD1306_BLACK, SSD1306_WHITE);
+  d.setCursor(2, 1);
+  d.print("BROBOT  WIFI OK");
+  d.drawBitmap(108, 0, battery, 16, 11, SSD1306_INVERSE);
+
+  d.setTextSize(2);
+  d.setTextColor(SSD1306_WHITE, SSD1306_BLACK);
+  d.setCursor(0, 13);
+  d.print((int)(frame * 37 % 900) / 10.0 - 45.0, 1);
+  d.setTextSize(1);
+  d.setCursor(0, 31);
+  d.print("angle  speed");
+
+  d.setFont(&FreeSans9pt7b);
+  d.setTextColor(SSD1306_WHITE);
+  d.setCursor(70, 27);
+  d.print((int)(frame * 13 % 400) - 200);
+
+  // Motor commands, bars from the middle
+  for (uint8_t m = 0; m < 2; m++) {
+    int16_t y = 42 + m * 8, v = (int16_t)((frame * (5 + m * 3)) % 120) - 60;
+    d.drawRect(0, y, SCREEN_WIDTH, 7, SSD1306_WHITE);
+    if (v >= 0)
+      d.fillRect(64, y + 1, v, 5, SSD1306_WHITE);
+    else
+      d.fillRect(64 + v, y + 1, -v, 5, SSD1306_WHITE);
+  }
+  d.setFont(&FreeMonoBold12pt7b);
+  d.setCursor(0, SCREEN_HEIGHT - 1);
+  d.setTextColor(SSD1306_INVERSE);
+  d.print("P");
+  d.setFont();
+  d.setTextColor(SSD1306_WHITE, SSD1306_BLACK);
+  d.setCursor(18, 57);
+  d.print("Kp 0.32 Kd 0.18");
+}
+
+static double frameUs(Adafruit_SSD1306 &d, uint32_t frames) {
+  uint64_t start = hostNs();
+  for (uint32_t i = 0; i < frames; i++)
+    dashboard(d, i);
+  return (hostNs() - start) / 1000.0 / frames;
+}
+
+static int failures;
+
+static void compare(const char *what, uint32_t i) {
+  // getBuffer() marks the buffers dirty, the drawing is all that matters
+  if (memcmp(fast.getBuffer(), generic.getBuffer(),
+             SCREEN_WIDTH * SCREEN_HEIGHT / 8)) {
+    if (failures < 10)
+      printf("FAIL: %s %u: kernels and generic code differ\n", what, i);
+    failures++;
+  }
+}
+
+static uint8_t randomBitmap[64 * 8];
+
+// One random operation, drawn on both displays
+static void randomOperation() {
+  int16_t x = rand() % 176 - 24, y = rand() % 112 - 24;
+  int16_t w = rand() % 70 - 2, h = rand() % 50 - 2;
+  uint16_t color = rand() % 3, bg = rand() % 3;
+  uint8_t rotation = rand() % 4;
+  int op = rand() % 5;
+  unsigned char c = rand() % 256;
+  uint8_t sx = rand() % 4 + 1, sy = rand() % 8 + 1;
+  const GFXfont *font = (rand() & 1) ? &FreeSans9pt7b : &FreeMonoBold12pt7b;
+  Adafruit_SSD1306 *d[2] = {&fast, &generic};
+
+  for (uint8_t k = 0; k < 2; k++) {
+    d[k]->setRotation(rotation);
+    switch (op) {
+    case 0:
+      d[k]->fillRect(x, y, w, h, color);
+      break;
+    case 1:
+      if (w > 0 && h > 0)
+        d[k]->drawBitmap(x, y, randomBitmap, w, h, color);
+      break;
+    case 2:
+      if (w > 0 && h > 0)
+        d[k]->drawBitmap(x, y, (const uint8_t *)randomBitmap, w, h, color, bg);
+      break;
+    case 3:
+      d[k]->setFont();
+      d[k]->drawChar(x, y, c, color, bg, sx, sy);
+      break;
+    case 4:
+      d[k]->setFont(font);
+      d[k]->drawChar(x, y, ' ' + c % 95, color, color, 1, 1);
+      break;
+    }
+    d[k]->setRotation(0);
+  }
+}
+
+#define CANVAS_WIDTH 160
+#define CANVAS_HEIGHT 128
+
+// Counts the calls that would each open an address window on a TFT
+class CountingCanvas : public GFXcanvas16 {
+public:
+  CountingCanvas() : GFXcanvas16(CANVAS_WIDTH, CANVAS_HEIGHT) {}
+  uint32_t calls = 0;
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    calls++;
+    GFXcanvas16::drawPixel(x, y, color);
+  }
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    calls++;
+    GFXcanvas16::drawFastHLine(x, y, w, color);
+  }
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    calls++;
+    GFXcanvas16::fillRect(x, y, w, h, color);
+  }
+};
+
+static CountingCanvas bitmapCanvas, cachedCanvas, spanCanvas;
+static GFXglyphCache cache(2048, 32), smallCache(300, 6);
+
+// GFXspanfont versions of the fonts, in RAM
+struct SpanFont {
+  GFXspanfont font;
+  GFXglyph glyphs[95];
+  uint8_t spans[16384];
+};
+static SpanFont sans9, sans18;
+
+static void convert(const GFXfont *f, SpanFont *s) {
+  uint16_t n = 0;
+  for (uint16_t c = 0; c <= f->last - f->first; c++) {
+    GFXglyph g = f->glyph[c];
+    uint16_t length = GFXglyphCache::encode(f->bitmap + g.bitmapOffset,
+                                            g.width, g.height, NULL);
+    if (n + length > sizeof(s->spans)) {
+      printf("FAIL: span font too large\n");
+      exit(1);
+    }
+    GFXglyphCache::encode(f->bitmap + g.bitmapOffset, g.width, g.height,
+                          &s->spans[n]);
+    s->glyphs[c] = g;
+    s->glyphs[c].bitmapOffset = n;
+    n += length;
+  }
+  s->font = {s->spans, s->glyphs, f->first, f->last, f->yAdvance};
+}
+
+static void useFont(uint8_t k, const GFXfont *font, SpanFont *s) {
+  if (k == 2)
+    spanCanvas.setSpanFont(&s->font);
+  else
+    (k ? cachedCanvas : bitmapCanvas).setFont(font);
+}
+
+// Readouts of a motor controller: the digits repeat from frame to frame
+static void readout(Adafruit_GFX &d, uint8_t k, uint32_t frame) {
+  d.fillScreen(0);
+  d.setTextColor(0xFFE0);
+  useFont(k, &FreeSans18pt7b, &sans18);
+  d.setTextSize(1);
+  d.setCursor(2, 30);
+  d.print((int)(frame * 37 % 2000) / 10.0 - 100.0, 1);
+  d.print(" V");
+  d.setTextSize(2);
+  d.setCursor(2, 118);
+  d.print((int)(frame * 7 % 1000));
+  useFont(k, &FreeSans9pt7b, &sans9);
+  d.setTextSize(1);
+  d.setCursor(2, 50);
+  d.print("rpm ");
+  d.print((int)(frame * 113 % 6000));
+}
+
+static double readoutUs(Adafruit_GFX &d, uint8_t k, uint32_t frames) {
+  uint64_t start = hostNs();
+  for (uint32_t i = 0; i < frames; i++)
+    readout(d, k, i);
+  return (hostNs() - start) / 1000.0 / frames;
+}
+
+static void compareCanvases(const char *what, uint32_t i) {
+  size_t bytes = CANVAS_WIDTH * CANVAS_HEIGHT * 2;
+  if (memcmp(bitmapCanvas.getBuffer(), cachedCanvas.getBuffer(), bytes) ||
+      memcmp(bitmapCanvas.getBuffer(), spanCanvas.getBuffer(), bytes)) {
+    if (failures < 10)
+      printf("FAIL: %s %u: bitmap, cached and span glyphs differ\n", what,
+             i);
+    failures++;
+  }
+}
+
+// One random glyph, drawn on the three canvases
+static void randomGlyph() {
+  int16_t x = rand() % 220 - 30, y = rand() % 190 - 30;
+  uint16_t color = rand();
+  uint8_t rotation = rand() % 4, sx = rand() % 3 + 1, sy = rand() % 3 + 1;
+  unsigned char c = ' ' + rand() % 95;
+  bool large = rand() & 1;
+  CountingCanvas *d[3] = {&bitmapCanvas, &cachedCanvas, &spanCanvas};
+
+  for (uint8_t k = 0; k < 3; k++) {
+    d[k]->setRotation(rotation);
+    useFont(k, large ? &FreeSans18pt7b : &FreeSans9pt7b,
+            large ? &sans18 : &sans9);
+    d[k]->drawChar(x, y, c, color, color, sx, sy);
+    d[k]->setRotation(0);
+  }
+}
+
+int main(int argc, char **argv) {
+  uint32_t frames = 20000, operations = 200000;
+  unsigned seed = 1;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "f:n:s:")) != -1) {
+    switch (opt) {
+    case 'f':
+      frames = atoi(optarg);
+      break;
+    case 'n':
+      operations = atoi(optarg);
+      break;
+    case 's':
+      seed = atoi(optarg);
+      break;
+    default:
+      fprintf(stderr, "usage: %s [-f frames] [-n operations] [-s seed]\n",
+              argv[0]);
+      return 2;
+    }
+  }
+  srand(seed);
+  if (!fast.begin() || !generic.begin()) {
+    printf("FAIL: begin\n");
+    return 1;
+  }
+
+  for (uint32_t i = 0; i < 50; i++) {
+    dashboard(fast, i * 7);
+    dashboard(generic, i * 7);
+    compare("dashboard", i);
+  }
+
+  generic.pixels = 0;
+  dashboard(generic, 0);
+  uint32_t pixels = generic.pixels;
+  double genericUs = frameUs(generic, frames);
+  double fastUs = frameUs(fast, frames);
+  printf("dashboard, %u frames (host time)\n", frames);
+  printf("  generic Adafruit_GFX  %8.2f us/frame  (%u drawPixel calls)\n",
+         genericUs, (unsigned)pixels);
+  printf("  1-bit kernels         %8.2f us/frame  (x%.1f)\n", fastUs,
+         genericUs / fastUs);
+
+  for (uint32_t i = 0; i < operations; i++) {
+    if (i % 1000 == 0) {
+      for (size_t b = 0; b < sizeof(randomBitmap); b++)
+        randomBitmap[b] = rand();
+      uint16_t color = rand() % 2;
+      fast.fillScreen(color);
+      generic.fillScreen(color);
+    }
+    randomOperation();
+    compare("random operation", i);
+  }
+  printf("%u random operations checked\n", operations);
+
+  convert(&FreeSans9pt7b, &sans9);
+  convert(&FreeSans18pt7b, &sans18);
+  cachedCanvas.setGlyphCache(&cache);
+  CountingCanvas *canvas[3] = {&bitmapCanvas, &cachedCanvas, &spanCanvas};
+  for (uint32_t i = 0; i < 50; i++) {
+    for (uint8_t k = 0; k < 3; k++)
+      readout(*canvas[k], k, i * 7);
+    compareCanvases("readout", i);
+  }
+  const char *name[3] = {"glyph bitmaps", "GFXglyphCache", "GFXspanfont"};
+  double us[3];
+  printf("FreeSans readout %dx%d, 16-bit canvas, %u frames (host time)\n",
+         CANVAS_WIDTH, CANVAS_HEIGHT, frames);
+  for (uint8_t k = 0; k < 3; k++) {
+    canvas[k]->calls = 0;
+    readout(*canvas[k], k, 1);
+    uint32_t calls = canvas[k]->calls;
+    us[k] = readoutUs(*canvas[k], k, frames);
+    printf("  %-20s %8.2f us/frame  %5u drawing calls\n", name[k], us[k],
+           (unsigned)calls);
+  }
+
+  cachedCanvas.setGlyphCache(&smallCache); // Evictions, glyphs too large
+  for (uint32_t i = 0; i < operations; i++) {
+    if (i % 1000 == 0) {
+      for (uint8_t k = 0; k < 3; k++)
+        canvas[k]->fillScreen(0);
+    }
+    randomGlyph();
+    compareCanvases("random glyph", i);
+  }
+  printf("%u random glyphs checked\n", operations);
+
+  if (failures) {
+    printf("%d failures\n", failures);
+    return 1;
+  }
+  printf("OK\n");
+  return 0;
+}
@@ -0,0 +1,75 @@
+// Host implementation of the Arduino stand-ins in include/: virtual time and
+// the mock TwoWire bus
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <Wire.h>
+
+static uint64_t hostNs;
+
+unsigned long micros() { return hostNs / 1000; }
+unsigned long millis() { return hostNs / 1000000; }
+void delay(uint32_t ms) { hostNs += ms * 1000000ULL; }
+void hostAdvance(uint32_t us) { hostNs += us * 1000ULL; }
+
+TwoWire Wire;
+SPIClass SPI;
+
+// Start condition, bytes of 8 bits + ack, stop condition
+uint32_t TwoWire::transferNs(size_t bytes) {
+  return (uint32_t)((uint64_t)(bytes * 9 + 2) * 1000000000 / clock);
+}
+
+void TwoWire::beginTransmission(uint8_t address) {
+  txAddress = address;
+  txLength = 0;
+  overflow = false;
+}
+
+size_t TwoWire::write(uint8_t data) {
+  if (txLength >= sizeof(txBuffer)) {
+    overflow = true;
+    return 0;
+  }
+  txBuffer[txLength++] = data;
+  return 1;
+}
+
+size_t TwoWire::write(const uint8_t *data, size_t quantity) {
+  size_t n = 0;
+  while (quantity--)
+    n += write(*data++);
+  return n;
+}
+
+void TwoWire::busy(size_t bytes) {
+  uint32_t ns = transferNs(bytes);
+
+  stats.transfers++;
+  stats.bytes += bytes;
+  stats.busyNs += ns;
+  if (ns > stats.longestNs)
+    stats.longestNs = ns;
+  hostNs += ns;
+}
+
+uint8_t TwoWire::endTransmission(bool) {
+  busy(txLength + 1);
+  if (overflow)
+    return 1; // data too long
+  if (!device || txAddress != deviceAddress)
+    return 2; // address not acknowledged
+  device->received(txBuffer, txLength);
+  return 0;
+}
+
+uint8_t TwoWire::requestFrom(uint8_t, uint8_t quantity, bool) {
+  busy(quantity + 1);
+  rxLength = quantity;
+  return quantity;
+}
+
+void TwoWire::attach(uint8_t address, WireDevice *d) {
+  deviceAddress = address;
+  device = d;
+}
@@ -0,0 +1 @@
+// Host stand-in: Adafruit_GFX includes it, the SSD1306 harness does not use it
@@ -0,0 +1,68 @@
+// Host (Linux) stand-in for the Arduino core, used by ssd1306_host.
+// Only the API used by Adafruit_GFX and Adafruit_SSD1306 is provided, built
+// as the ESP32 target (the Makefile defines ARDUINO and ESP32). Time is
+// virtual: it is advanced by the mock TwoWire for the bus time of each
+// transfer, and by the test for its own work.
+
+#ifndef SSD1306_HOST_ARDUINO_H
+#define SSD1306_HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x02
+
+#define DEC 10
+#define HEX 16
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+#define pgm_read_word(addr) (*(const unsigned short *)(addr))
+#define pgm_read_dword(addr) (*(const unsigned long *)(addr))
+#define pgm_read_pointer(addr) ((void *)pgm_read_dword(addr))
+
+#ifndef _swap_int16_t
+#define _swap_int16_t(a, b)                                                    \
+  {                                                                            \
+    int16_t t = a;                                                             \
+    a = b;                                                                     \
+    b = t;                                                                     \
+  }
+#endif
+
+inline void pinMode(uint8_t, uint8_t) {}
+inline void digitalWrite(uint8_t, uint8_t) {}
+inline void yield() {}
+
+unsigned long micros();
+unsigned long millis();
+void delay(uint32_t ms);
+void hostAdvance(uint32_t us); // virtual time spent by the caller
+
+class __FlashStringHelper;
+
+class String : public std::string {
+public:
+  String() {}
+  String(const char *s) : std::string(s) {}
+  String(const std::string &s) : std::string(s) {}
+};
+
+#include "Print.h"
+
+#endif // SSD1306_HOST_ARDUINO_H
@@ -0,0 +1,39 @@
+// Host stand-in for the Arduino Print class (Adafruit_GFX text output)
+
+#ifndef SSD1306_HOST_PRINT_H
+#define SSD1306_HOST_PRINT_H
+
+#include <stdio.h>
+#include <string.h>
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--)
+      n += write(*buffer++);
+    return n;
+  }
+  size_t write(const char *str) {
+    return write((const uint8_t *)str, strlen(str));
+  }
+  size_t print(const char *str) { return write(str); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(long n) {
+    char s[24];
+    snprintf(s, sizeof(s), "%ld", n);
+    return write(s);
+  }
+  size_t print(int n) { return print((long)n); }
+  size_t print(unsigned long n) { return print((long)n); }
+  size_t print(double d, int digits = 2) {
+    char s[32];
+    snprintf(s, sizeof(s), "%.*f", digits, d);
+    return write(s);
+  }
+  template <typename T> size_t println(T v) { return print(v) + print('\n'); }
+};
+
+#endif // SSD1306_HOST_PRINT_H
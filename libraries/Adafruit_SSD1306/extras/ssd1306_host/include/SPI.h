@@ -0,0 +1,19 @@
+// Host stand-in for the Arduino SPI library: the SSD1306 harness only uses I2C
+
+#ifndef SSD1306_HOST_SPI_H
+#define SSD1306_HOST_SPI_H
+
+#include <Arduino.h>
+
+#define MSBFIRST 1
+#define SPI_MODE0 0
+
+class SPIClass {
+public:
+  void begin() {}
+  uint8_t transfer(uint8_t data) { return data; }
+};
+
+extern SPIClass SPI;
+
+#endif // SSD1306_HOST_SPI_H
@@ -0,0 +1,63 @@
+// Host mock of the Arduino TwoWire API, used by ssd1306_host.
+// Every write is handed to the device attached at its address (reads get
+// zeros), and each transfer advances the virtual clock by its time on the bus
+// at the current clock speed. The bus occupancy is recorded: transfers,
+// bytes, busy time and the longest transfer.
+
+#ifndef SSD1306_HOST_WIRE_H
+#define SSD1306_HOST_WIRE_H
+
+#include <Arduino.h>
+
+#define I2C_BUFFER_LENGTH 128 // as the ESP32 core
+
+// A device on the mock bus: receives the bytes of each write transfer
+class WireDevice {
+public:
+  virtual ~WireDevice() {}
+  virtual void received(const uint8_t *data, size_t length) = 0;
+};
+
+struct WireStats {
+  uint32_t transfers;
+  uint32_t bytes;    // address bytes included
+  uint64_t busyNs;    // total time the bus was held
+  uint32_t longestNs; // longest single transfer
+};
+
+class TwoWire {
+public:
+  bool begin() { return true; }
+  void setClock(uint32_t frequency) { clock = frequency; }
+  uint32_t getClock() { return clock; }
+
+  void beginTransmission(uint8_t address);
+  uint8_t endTransmission(bool sendStop = true);
+  size_t write(uint8_t data);
+  size_t write(const uint8_t *data, size_t quantity);
+
+  // Reads get zeros: the harness only needs their time on the bus
+  uint8_t requestFrom(uint8_t address, uint8_t quantity, bool sendStop = true);
+  int available() { return rxLength; }
+  int read() { return rxLength ? (rxLength--, 0) : -1; }
+
+  void attach(uint8_t address, WireDevice *device);
+  uint32_t transferNs(size_t bytes); // bus time of a transfer of bytes
+  WireStats stats;
+
+private:
+  void busy(size_t bytes);
+
+  uint32_t clock = 100000;
+  uint8_t txAddress = 0;
+  uint8_t txBuffer[I2C_BUFFER_LENGTH];
+  size_t txLength = 0;
+  bool overflow = false;
+  size_t rxLength = 0;
+  uint8_t deviceAddress = 0;
+  WireDevice *device = NULL;
+};
+
+extern TwoWire Wire;
+
+#endif // SSD1306_HOST_WIRE_H
@@ -0,0 +1,2 @@
+// Host stand-in: PROGMEM is plain memory, the macros are in Arduino.h
+#include <Arduino.h>
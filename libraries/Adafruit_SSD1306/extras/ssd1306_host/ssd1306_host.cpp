@@ -0,0 +1,366 @@
+// Adafruit_SSD1306 - host test of the display refresh
+// Runs the driver against a model of the SSD1306 on a mock I2C bus, checks
+// that the display RAM matches the buffer after each refresh, and reports
+// what each refresh costs on the bus at 400 kHz:
+//   - display(): bytes and time of partial refreshes
+//   - displayStep(): bus time of each call against its budget, over a range
+//     of budgets
+//   - a 200 Hz control loop reading an MPU6050 on the same bus, refreshing a
+//     readout with display() then with displayStep() in its slack time:
+//     lateness of the sensor reads
+//
+// Usage: ssd1306_host [-n iterations] [-s seed]
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <unistd.h>
+#include "../../Adafruit_SSD1306.h"
+
+#define SCREEN_WIDTH 128
+#define SCREEN_HEIGHT 64
+#define SCREEN_ADDRESS 0x3D
+
+#define LOOP_PERIOD_US 5000 // control loop of the balancing robots
+#define LOOP_WORK_US 600    // computation after the sensor read
+#define LOOP_GUARD_US 100   // slack kept after the display steps
+
+// SSD1306 model: command parser and display RAM, horizontal addressing mode
+class SSD1306Model : public WireDevice {
+public:
+  uint8_t ram[8][128];
+
+  SSD1306Model() { memset(ram, 0xA5, sizeof(ram)); } // not the buffer
+
+  void received(const uint8_t *data, size_t length) {
+    if (length == 0)
+      return;
+    bool isData = (data[0] == 0x40);
+    if (!isData && data[0] != 0x00) {
+      printf("FAIL: control byte %02X\n", data[0]);
+      exit(1);
+    }
+    for (size_t i = 1; i < length; i++) {
+      if (isData)
+        writeData(data[i]);
+      else
+        command(data[i]);
+    }
+  }
+
+private:
+  uint8_t cmd[8], cmdLength = 0, cmdArgs = 0;
+  uint8_t colStart = 0, colEnd = 127, pageStart = 0, pageEnd = 7;
+  uint8_t col = 0, page = 0;
+
+  static uint8_t argCount(uint8_t c) {
+    switch (c) {
+    case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3: case 0xD5:
+    case 0xD9: case 0xDA: case 0xDB:
+      return 1;
+    case 0x21: case 0x22: case 0xA3:
+      return 2;
+    case 0x29: case 0x2A:
+      return 5;
+    case 0x26: case 0x27:
+      return 6;
+    }
+    return 0;
+  }
+
+  // Commands and their arguments may come in separate transfers
+  void command(uint8_t c) {
+    if (cmdLength == 0)
+      cmdArgs = argCount(c);
+    cmd[cmdLength++] = c;
+    if (cmdLength <= cmdArgs)
+      return;
+    cmdLength = 0;
+    if (cmd[0] == 0x20 && cmd[1] != 0x00) {
+      printf("FAIL: addressing mode %d\n", cmd[1]);
+      exit(1);
+    } else if (cmd[0] == 0x21) {
+      colStart = col = cmd[1] & 0x7F;
+      colEnd = cmd[2] & 0x7F;
+    } else if (cmd[0] == 0x22) {
+      pageStart = page = cmd[1] & 0x07;
+      pageEnd = cmd[2] & 0x07;
+    }
+  }
+
+  void writeData(uint8_t d) {
+    ram[page][col] = d;
+    if (col++ == colEnd) {
+      col = colStart;
+      if (page++ == pageEnd)
+        page = pageStart;
+    }
+  }
+};
+
+static SSD1306Model oled;
+static Adafruit_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, -1);
+static int failures;
+
+static void check(const char *what) {
+  if (memcmp(oled.ram, display.getBuffer(), sizeof(oled.ram))) {
+    printf("FAIL: %s: display RAM differs from the buffer\n", what);
+    failures++;
+  }
+}
+
+// One display() and its bus cost
+static void refresh(const char *what, bool print) {
+  WireStats before = Wire.stats;
+  uint32_t start = micros();
+  display.display();
+  uint32_t us = micros() - start;
+  if (print)
+    printf("%-28s %4u bytes %3u transfers %6u us\n", what,
+           Wire.stats.bytes - before.bytes,
+           Wire.stats.transfers - before.transfers, us);
+  // getBuffer() would mark the buffer dirty: compare after the refresh
+  check(what);
+  display.display();
+}
+
+// Send everything: the refresh in progress, then what changed during it
+static void flush() {
+  while (!display.displayStep(100000))
+    ;
+  display.beginDisplay();
+  while (!display.displayStep(100000))
+    ;
+}
+
+static void randomDrawing() {
+  int16_t x = rand() % 160 - 16, y = rand() % 96 - 16;
+  int16_t w = rand() % 64, h = rand() % 48;
+  uint16_t color = rand() % 3;
+  display.setRotation(rand() % 4);
+  switch (rand() % 6) {
+  case 0:
+    display.drawPixel(x, y, color);
+    break;
+  case 1:
+    display.drawFastHLine(x, y, w, color);
+    break;
+  case 2:
+    display.drawFastVLine(x, y, h, color);
+    break;
+  case 3:
+    display.fillRect(x, y, w, h, color);
+    break;
+  case 4:
+    display.drawLine(x, y, x + w, y + h, color);
+    break;
+  case 5:
+    display.setCursor(x, y);
+    display.setTextColor(color == SSD1306_BLACK ? SSD1306_BLACK
+                                                : SSD1306_WHITE);
+    display.print(rand() % 1000);
+    break;
+  }
+  display.setRotation(0);
+}
+
+// A full screen sent with displayStep(budget): no call may hold the bus
+// longer than its budget
+static void budgetSweep() {
+  static const uint32_t budgets[] = {200, 250, 500, 1000, 3000, 30000};
+
+  printf("\n%8s %6s %12s %14s\n", "budget", "calls", "max call us",
+         "max transfer us");
+  for (uint8_t i = 0; i < sizeof(budgets) / sizeof(budgets[0]); i++) {
+    uint32_t budget = budgets[i], calls = 0;
+    uint64_t worstNs = 0;
+
+    for (int16_t x = 0; x < SCREEN_WIDTH; x++)
+      display.drawFastVLine(x, 0, SCREEN_HEIGHT,
+                            (x + i) & 1 ? SSD1306_WHITE : SSD1306_BLACK);
+    Wire.stats.longestNs = 0;
+    display.beginDisplay();
+    bool done;
+    do {
+      uint64_t busy = Wire.stats.busyNs;
+      done = display.displayStep(budget);
+      busy = Wire.stats.busyNs - busy;
+      if (busy > worstNs)
+        worstNs = busy;
+      calls++;
+      if (calls > 100000) {
+        printf("FAIL: budget %u: no progress\n", budget);
+        failures++;
+        break;
+      }
+    } while (!done);
+    printf("%8u %6u %12.1f %14.1f\n", budget, calls, worstNs / 1000.0,
+           Wire.stats.longestNs / 1000.0);
+    if (worstNs > budget * 1000ULL) {
+      printf("FAIL: budget %u us exceeded\n", budget);
+      failures++;
+    }
+    check("stepped full screen");
+  }
+}
+
+// 200 Hz loop: read the MPU6050 (register address, then 14 bytes), compute,
+// and update a readout every 100 ms. Returns the worst lateness of a sensor
+// read, in microseconds.
+static uint32_t controlLoop(bool stepped, uint32_t seconds, uint32_t *refreshes) {
+  uint32_t periods = seconds * (1000000 / LOOP_PERIOD_US);
+
+  *refreshes = 0;
+  display.clearDisplay();
+  display.setTextSize(2);
+  display.setTextColor(SSD1306_WHITE, SSD1306_BLACK);
+  flush();
+  uint32_t next = micros(), worst = 0;
+  for (uint32_t i = 0; i < periods; i++) {
+    while ((int32_t)(micros() - next) < 0)
+      hostAdvance(1);
+    uint32_t late = micros() - next;
+    if (late > worst)
+      worst = late;
+    next += LOOP_PERIOD_US;
+
+    Wire.beginTransmission(0x68);
+    Wire.write(0x3B);
+    Wire.endTransmission(false);
+    Wire.requestFrom(0x68, 14);
+    hostAdvance(LOOP_WORK_US);
+
+    if (i % (100000 / LOOP_PERIOD_US) == 0) {
+      display.setCursor(16, 8);
+      display.print((int)(i * 37 % 2000) - 1000);
+      display.print("   ");
+      display.setCursor(16, 40);
+      display.print((i * 7 % 1000) / 10.0, 1);
+      display.print("  ");
+      if (!stepped) {
+        display.display();
+        (*refreshes)++;
+      }
+    }
+    if (stepped) {
+      if (!display.displayBusy() && display.beginDisplay() &&
+          display.displayBusy())
+        (*refreshes)++;
+      int32_t slack = (int32_t)(next - micros()) - LOOP_GUARD_US;
+      if (slack > 0)
+        display.displayStep(slack);
+    }
+  }
+  flush();
+  check("control loop");
+  return worst;
+}
+
+// Drawing, display(), beginDisplay() and steps of random budgets, mixed
+static void randomSteps(int iterations) {
+  for (int i = 0; i < iterations; i++) {
+    int n = rand() % 4 + 1;
+    while (n--)
+      randomDrawing();
+    switch (rand() % 4) {
+    case 0:
+      display.display(); // cancels a refresh in progress
+      break;
+    case 1:
+      display.beginDisplay();
+      break;
+    default:
+      display.displayStep(rand() % 2000);
+      break;
+    }
+    if (rand() % 16 == 0) {
+      flush();
+      check("random steps");
+    }
+  }
+  flush();
+  check("random steps");
+}
+
+int main(int argc, char **argv) {
+  int iterations = 2000;
+  unsigned seed = 1;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+    switch (opt) {
+    case 'n':
+      iterations = atoi(optarg);
+      break;
+    case 's':
+      seed = atoi(optarg);
+      break;
+    default:
+      fprintf(stderr, "usage: %s [-n iterations] [-s seed]\n", argv[0]);
+      return 2;
+    }
+  }
+  srand(seed);
+  Wire.attach(SCREEN_ADDRESS, &oled);
+  Wire.setClock(400000);
+  if (!display.begin(SSD1306_SWITCHCAPVCC, SCREEN_ADDRESS)) {
+    printf("FAIL: begin\n");
+    return 1;
+  }
+
+  refresh("first refresh (splash)", true);
+  refresh("no change", true);
+
+  display.setTextSize(1);
+  display.setTextColor(SSD1306_WHITE, SSD1306_BLACK);
+  display.setCursor(96, 0);
+  display.print("123");
+  refresh("3 digits, size 1", true);
+
+  display.setCursor(0, 56);
+  display.print("7");
+  display.setCursor(122, 56);
+  display.print("9");
+  refresh("2 digits, far apart", true);
+
+  display.setTextSize(2);
+  display.setCursor(40, 24);
+  display.print("-12.5");
+  refresh("5 characters, size 2", true);
+
+  display.clearDisplay();
+  refresh("clearDisplay", true);
+
+  for (int i = 0; i < iterations; i++) {
+    int n = rand() % 4 + 1;
+    while (n--)
+      randomDrawing();
+    refresh("random drawing", false);
+  }
+  printf("%d random refreshes checked\n", iterations);
+
+  budgetSweep();
+
+  uint32_t refreshes, late;
+  printf("\n%u Hz loop, %u us work, readout refreshed every 100 ms\n",
+         1000000 / LOOP_PERIOD_US, LOOP_WORK_US);
+  late = controlLoop(false, 10, &refreshes);
+  printf("display():     worst sensor read lateness %5u us, %u refreshes\n",
+         late, refreshes);
+  uint32_t steppedLate = controlLoop(true, 10, &refreshes);
+  printf("displayStep(): worst sensor read lateness %5u us, %u refreshes\n",
+         steppedLate, refreshes);
+  if (steppedLate > 0) {
+    printf("FAIL: a stepped refresh delayed the control loop\n");
+    failures++;
+  }
+
+  randomSteps(iterations);
+  printf("%d random stepped refreshes checked\n", iterations);
+
+  if (failures) {
+    printf("%d failures\n", failures);
+    return 1;
+  }
+  printf("OK\n");
+  return 0;
+}
@@ -0,0 +1,608 @@
+// AsyncTCP - host tests
+//
+// The library runs on a fake lwIP and FreeRTOS (include/, host.cpp): its async
+// task is a thread, the test thread plays the lwIP thread and calls the
+// callbacks the library set on its pcbs.
+//
+// Events: clients accepted by an AsyncServer get numbered data, acks and polls,
+// some are closed by the application from their data handler, others by a FIN
+// or an error from the peer. Each client must see its data in order and
+// complete, nothing once it is closed, and every pbuf must be freed.
+//
+// Coalesced writes: small writes wait for the byte threshold or the deadline,
+// and the window update of the data received goes out with them. A deadline
+// passing while the queue is full does not hold the timer task, the flush
+// comes later. Acks merged while the async task is busy reach onAck() whole,
+// beyond 64KiB.
+//
+// Then reports events per second, heap allocations per event and the dispatch
+// latency (lwIP callback to data handler) for 8 busy connections, and messages
+// per second and the latency (write to tcp_output) of 32 byte messages written
+// at once and coalesced.
+//
+// Usage: asynctcp_host [-n events] [-s seed]
+
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <unistd.h>
+#include "host.h"
+
+static int failures;
+
+#define CHECK(cond, ...)                                                                                               \
+  do {                                                                                                                 \
+    if (!(cond)) {                                                                                                     \
+      failures++;                                                                                                      \
+      printf("FAIL %s:%d: ", __FILE__, __LINE__);                                                                      \
+      printf(__VA_ARGS__);                                                                                             \
+      printf("\n");                                                                                                    \
+    }                                                                                                                  \
+  } while (0)
+
+// One sequence per thread
+static uint32_t rnd(uint32_t n) {
+  static thread_local uint32_t x = 1;
+  static thread_local bool seeded;
+  if (!seeded) {
+    const char *s = getenv("ASYNCTCP_HOST_SEED");
+    x = s ? strtoul(s, NULL, 0) | 1 : 1;
+    seeded = true;
+  }
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return x % n;
+}
+
+static uint64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// Head of the data sent on a connection, the rest is filler
+struct Data {
+  uint32_t id;
+  uint32_t offset; // bytes sent on the connection before this packet
+  uint64_t sent;   // nowNs() of the lwIP callback
+};
+
+// Written by a writer client, one per sizeof(Data) bytes it receives
+struct Message {
+  uint64_t written; // nowNs() of the write
+  uint32_t seq;
+  uint8_t filler[20];
+};
+
+/*
+ * The application, in the async task
+ */
+
+#define MAX_CONNECTIONS 65536
+
+struct App {
+  AsyncClient *client;
+  int id;
+  size_t received;
+  bool closed;       // closed by the application
+  bool disconnected; // onDisconnect() called
+  bool busy;         // benchmark connection: only measures latency
+  bool writer;       // answers its data with messages
+  uint32_t written;  // messages
+  size_t acked;      // lengths given to onAck()
+  unsigned acks;     // onAck() calls
+};
+
+static App apps[MAX_CONNECTIONS];
+static std::vector<AsyncClient *> graveyard; // disconnected clients, deleted outside of their handlers
+static unsigned deleted;
+static unsigned closeOneIn = 100; // the application closes a connection after one data packet in closeOneIn
+static std::atomic<bool> barrierSeen;
+static std::atomic<int> stallId{-1}; // its data handler holds the async task until this changes
+static std::atomic<bool> stallSeen;
+static uint64_t latencySum, latencyMax, latencyCount;
+
+static void reap() {
+  for (AsyncClient *c : graveyard) {
+    delete c;
+    deleted++;
+  }
+  graveyard.clear();
+}
+
+static bool live(App *app, const char *event) {
+  CHECK(!app->disconnected, "connection %d: %s after disconnect", app->id, event);
+  CHECK(!app->closed, "connection %d: %s after close", app->id, event);
+  return !app->disconnected && !app->closed;
+}
+
+static void onData(void *arg, AsyncClient *, void *data, size_t len) {
+  App *app = (App *)arg;
+  if (!live(app, "data"))
+    return;
+  Data head;
+  memcpy(&head, data, sizeof(head));
+  if (app->busy) {
+    uint64_t latency = nowNs() - head.sent;
+    latencySum += latency;
+    latencyMax = std::max(latencyMax, latency);
+    latencyCount++;
+  }
+  CHECK(head.id == (uint32_t)app->id && head.offset == app->received, "connection %d: got data %u@%u at %zu",
+        app->id, head.id, head.offset, app->received);
+  app->received += len;
+  if (app->id == stallId.load()) {
+    stallSeen.store(true, std::memory_order_release);
+    while (app->id == stallId.load())
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+    return;
+  }
+  for (size_t n = 0; app->writer && n < len / sizeof(Data); n++) {
+    Message m = {nowNs(), app->written++, {0}};
+    CHECK(app->client->write((const char *)&m, sizeof(m)) == sizeof(m), "connection %d: write failed", app->id);
+  }
+  if (app->id && !app->busy && !app->writer && rnd(closeOneIn) == 0) {
+    app->client->close();
+    // Unless the peer closed it first, the client is disconnected by now
+    app->closed = app->disconnected;
+  }
+}
+
+static void onAck(void *arg, AsyncClient *, size_t len, uint32_t) {
+  App *app = (App *)arg;
+  if (live(app, "ack")) {
+    app->acked += len;
+    app->acks++;
+  }
+  if (!app->disconnected && !app->closed && app->id == 0) {
+    // The barrier: the events sent before are handled
+    reap();
+    barrierSeen.store(true, std::memory_order_release);
+  }
+}
+
+static void onPoll(void *arg, AsyncClient *) { live((App *)arg, "poll"); }
+
+static void onError(void *arg, AsyncClient *, int8_t) { live((App *)arg, "error"); }
+
+static void onDisconnect(void *arg, AsyncClient *c) {
+  App *app = (App *)arg;
+  CHECK(!app->disconnected, "connection %d: disconnected twice", app->id);
+  app->disconnected = true;
+  graveyard.push_back(c);
+}
+
+static bool busyClients, writerClients;
+static size_t coalesceBytes;
+static uint32_t coalesceDeadline;
+static int accepted;
+
+// The accept events come in order: the n-th client is connection n
+static void onClient(void *, AsyncClient *c) {
+  reap();
+  App *app = &apps[accepted];
+  app->client = c;
+  app->id = accepted++;
+  app->busy = busyClients;
+  app->writer = writerClients;
+  c->setWriteCoalescing(coalesceBytes, coalesceDeadline);
+  c->onData(onData, app);
+  c->onAck(onAck, app);
+  c->onPoll(onPoll, app);
+  c->onError(onError, app);
+  c->onDisconnect(onDisconnect, app);
+}
+
+/*
+ * The peer, in the lwIP thread
+ */
+
+struct Connection {
+  tcp_pcb *pcb;
+  size_t sent;
+  pbuf *refused; // data the library refused, delivered again before anything else
+};
+
+static AsyncServer server(80);
+
+// What the writer clients sent
+static uint32_t outputNext; // next message expected
+static std::vector<uint64_t> outputLatencies;
+static uint64_t lastOutput;
+
+static void output(tcp_pcb *, const uint8_t *data, size_t len) {
+  uint64_t now = nowNs();
+  CHECK(len % sizeof(Message) == 0, "output of %zu bytes", len);
+  for (size_t n = 0; n + sizeof(Message) <= len; n += sizeof(Message)) {
+    Message m;
+    memcpy(&m, data + n, sizeof(m));
+    CHECK(m.seq == outputNext, "message %u sent instead of %u", m.seq, outputNext);
+    outputNext = m.seq + 1;
+    outputLatencies.push_back(now - m.written);
+  }
+  lastOutput = now;
+}
+
+// Waits for message count - 1 to be sent
+static bool waitOutput(uint32_t count) {
+  for (int i = 0; i < 5000; i++) {
+    {
+      std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+      if (outputNext >= count)
+        return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return false;
+}
+static Connection connections[MAX_CONNECTIONS];
+static int nextId;
+static unsigned events;
+
+// Holding the lwIP lock, as lwIP calls its callbacks
+static int accept() {
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  tcp_pcb *listen = hostPcbs[0];
+  tcp_pcb *pcb = tcp_new_ip_type(IPADDR_TYPE_V4);
+  int id = nextId++;
+  pcb->state = ESTABLISHED;
+  pcb->output = output;
+  connections[id].pcb = pcb;
+  listen->accept(listen->callback_arg, pcb, ERR_OK);
+  events++;
+  return id;
+}
+
+// Gives p (or the refused data) to the library, false when it is refused again.
+// lwIP frees refused data with the pcb.
+static bool offer(Connection &c, pbuf *p) {
+  if (c.pcb->closed || !c.pcb->recv) {
+    c.sent -= p->len;
+    pbuf_free(p);
+    return true;
+  }
+  if (c.pcb->recv(c.pcb->callback_arg, c.pcb, p, ERR_OK) == ERR_MEM) {
+    c.refused = p;
+    return false;
+  }
+  events++;
+  return true;
+}
+
+// Delivers the refused data, retrying as lwIP does on its timer
+static void flush(Connection &c) {
+  while (c.refused) {
+    {
+      std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+      pbuf *p = c.refused;
+      c.refused = NULL;
+      if (offer(c, p))
+        return;
+    }
+    std::this_thread::yield();
+  }
+}
+
+// False once the connection is closed
+static bool receive(int id, size_t len) {
+  Connection &c = connections[id];
+  flush(c);
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  if (c.pcb->closed || !c.pcb->recv)
+    return false;
+  uint8_t buf[1460];
+  Data head = {(uint32_t)id, (uint32_t)c.sent, nowNs()};
+  memset(buf, id, len);
+  memcpy(buf, &head, sizeof(head));
+  c.sent += len;
+  offer(c, pbuf_alloc_host(buf, len));
+  return true;
+}
+
+static bool ack(int id, uint16_t len) {
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  tcp_pcb *pcb = connections[id].pcb;
+  if (pcb->closed || !pcb->sent)
+    return false;
+  pcb->sent(pcb->callback_arg, pcb, len);
+  events++;
+  return true;
+}
+
+static bool poll(int id) {
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  tcp_pcb *pcb = connections[id].pcb;
+  if (pcb->closed || !pcb->poll)
+    return false;
+  pcb->poll(pcb->callback_arg, pcb);
+  events++;
+  return true;
+}
+
+static bool fin(int id) {
+  flush(connections[id]);
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  tcp_pcb *pcb = connections[id].pcb;
+  if (pcb->closed || !pcb->recv || !pcb->callback_arg)
+    return false;
+  pcb->recv(pcb->callback_arg, pcb, NULL, ERR_OK);
+  events++;
+  return true;
+}
+
+// A reset: lwIP frees the pcb before calling the error callback
+static bool reset(int id) {
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  tcp_pcb *pcb = connections[id].pcb;
+  if (pcb->closed || !pcb->errf)
+    return false;
+  if (connections[id].refused) {
+    connections[id].sent -= connections[id].refused->len;
+    pbuf_free(connections[id].refused);
+    connections[id].refused = NULL;
+  }
+  pcb->closed = 1;
+  pcb->state = CLOSED;
+  pcb->errf(pcb->callback_arg, ERR_RST);
+  events++;
+  return true;
+}
+
+// Waits until the async task handled every event sent so far
+static void barrier() {
+  barrierSeen = false;
+  ack(0, 1);
+  while (!barrierSeen.load(std::memory_order_acquire))
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+}
+
+static void testEvents(unsigned count) {
+  std::vector<int> open;
+  while (events < count) {
+    if (open.empty() || (open.size() < 8 && rnd(4) == 0)) {
+      if (nextId == MAX_CONNECTIONS - 8)
+        break;
+      open.push_back(accept());
+      continue;
+    }
+    size_t i = rnd(open.size());
+    int id = open[i];
+    uint32_t r = rnd(1000);
+    bool ok;
+    if (r < 600)
+      ok = receive(id, sizeof(Data) + rnd(1400));
+    else if (r < 800)
+      ok = ack(id, 1 + rnd(1436));
+    else if (r < 985)
+      ok = poll(id);
+    else if (r < 995)
+      ok = fin(id);
+    else
+      ok = reset(id);
+    if (!ok || r >= 985) {
+      open[i] = open.back();
+      open.pop_back();
+    }
+  }
+  // The peer closes what is left, lwIP frees the data refused by closed clients
+  for (int id : open)
+    fin(id);
+  for (int id = 1; id < nextId; id++)
+    flush(connections[id]);
+  barrier();
+
+  int closed = 0, peer = 0;
+  for (int id = 1; id < nextId; id++) {
+    App &app = apps[id];
+    CHECK(app.disconnected, "connection %d: not disconnected", id);
+    CHECK(connections[id].pcb->closed, "connection %d: pcb not closed", id);
+    if (app.closed) {
+      closed++;
+      CHECK(app.received <= connections[id].sent, "connection %d: %zu bytes received, %zu sent", id, app.received,
+            connections[id].sent);
+    } else {
+      peer++;
+      CHECK(app.received == connections[id].sent, "connection %d: %zu bytes received, %zu sent", id, app.received,
+            connections[id].sent);
+    }
+  }
+  CHECK(deleted == (unsigned)nextId - 1, "%u clients deleted, %d connections", deleted, nextId - 1);
+  CHECK(hostPbufs == 0, "%ld pbufs not freed", hostPbufs.load());
+  CHECK(hostDiagnostics == 0, "%d diagnostics", hostDiagnostics);
+  printf("events: %u on %d connections, %d closed by the application, %d by the peer\n", events, nextId - 1, closed,
+         peer);
+}
+
+// Acks arriving while the async task is busy add up in one event, past what one lwIP ack can hold
+static void testAcks() {
+  int id = accept();
+  barrier();
+  stallId = id;
+  stallSeen = false;
+  receive(id, sizeof(Data));
+  while (!stallSeen.load(std::memory_order_acquire))
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  for (int i = 0; i < 4; i++)
+    ack(id, 60000);
+  stallId = -1;
+  barrier();
+  CHECK(apps[id].acked == 240000 && apps[id].acks == 1, "%zu bytes acked in %u calls", apps[id].acked,
+        apps[id].acks);
+  fin(id);
+  barrier();
+}
+
+static void reportBenchmark(unsigned count) {
+  const int n = 8;
+  busyClients = true;
+  int first = nextId;
+  for (int i = 0; i < n; i++)
+    accept();
+  barrier();
+  unsigned long allocations = hostAllocations;
+  uint64_t start = nowNs();
+  for (unsigned i = 0; i < count; i++)
+    receive(first + i % n, 64);
+  for (int i = 0; i < n; i++)
+    flush(connections[first + i]);
+  barrier();
+  double seconds = (nowNs() - start) / 1e9;
+  double perEvent = (double)(hostAllocations - allocations) / count;
+  CHECK(latencyCount == count, "%llu of %u events handled", (unsigned long long)latencyCount, count);
+  CHECK(hostPbufs == 0, "%ld pbufs not freed", hostPbufs.load());
+  printf("benchmark: %.0f events/s, %.2f allocations per event, latency %.1f us mean, %.1f us max "
+         "(%d connections, %u events of 64 bytes, queue of %d)\n",
+         count / seconds, perEvent, latencySum / 1e3 / latencyCount, latencyMax / 1e3, n, count,
+         CONFIG_ASYNC_TCP_QUEUE_SIZE);
+}
+
+static void testCoalescing() {
+  const uint32_t deadline = 20000;
+  coalesceBytes = 1024;
+  coalesceDeadline = deadline;
+  writerClients = true;
+  int id = accept();
+  tcp_pcb *pcb = connections[id].pcb;
+  barrier();
+  CHECK(tcp_nagle_disabled(pcb), "Nagle enabled");
+  outputNext = 0;
+
+  // Below the threshold: held back until the deadline, with the window update
+  uint64_t start = nowNs();
+  receive(id, sizeof(Data));
+  barrier();
+  {
+    std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+    CHECK(pcb->unsent_len == sizeof(Message) && pcb->outputs == 0, "%zu bytes held back, %u outputs",
+          pcb->unsent_len, pcb->outputs);
+    CHECK(pcb->recved_calls == 0, "%u window updates", pcb->recved_calls);
+  }
+  CHECK(waitOutput(1), "message not sent");
+  uint64_t waited = nowNs() - start;
+  CHECK(waited >= deadline * 1000ULL, "sent after %llu us", (unsigned long long)waited / 1000);
+  {
+    std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+    CHECK(pcb->outputs == 1 && pcb->segments == 1, "%u outputs, %u segments", pcb->outputs, pcb->segments);
+    CHECK(pcb->recved == sizeof(Data) && pcb->recved_calls == 1, "%zu bytes in %u window updates", pcb->recved,
+          pcb->recved_calls);
+  }
+
+  // The threshold sends at once, the window update follows at the deadline
+  receive(id, 32 * sizeof(Data));
+  barrier();
+  {
+    std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+    CHECK(outputNext == 33 && pcb->unsent_len == 0, "%u messages sent, %zu bytes held back", outputNext,
+          pcb->unsent_len);
+  }
+  std::this_thread::sleep_for(std::chrono::microseconds(deadline * 2));
+  {
+    std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+    CHECK(pcb->recved == 33 * sizeof(Data), "%zu bytes in window updates", pcb->recved);
+  }
+
+  // Closed while data is held back: the deadline passes without a flush
+  receive(id, sizeof(Data));
+  barrier(); // the FIN moves the pcb out of ESTABLISHED, writes after it fail
+  fin(id);
+  barrier();
+  unsigned outputs = pcb->outputs;
+  std::this_thread::sleep_for(std::chrono::microseconds(deadline * 2));
+  barrier();
+  CHECK(pcb->outputs == outputs, "flushed after close");
+  CHECK(apps[accepted - 1].disconnected, "not disconnected");
+
+  // The deadline passes while the async task is stalled with data in the queue: the timer
+  // task keeps running and tries again, the message goes out once the task is back
+  id = accept();
+  barrier();
+  writerClients = false; // read by onClient(), in the async task
+  int stalled = accept();
+  barrier();
+  outputNext = 0;
+  receive(id, sizeof(Data));
+  barrier();
+  stallId = stalled;
+  stallSeen = false;
+  receive(stalled, sizeof(Data));
+  while (!stallSeen.load(std::memory_order_acquire))
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  while (!connections[stalled].refused)
+    receive(stalled, sizeof(Data));
+  unsigned timerCalls = hostTimerCalls;
+  std::this_thread::sleep_for(std::chrono::microseconds(deadline * 2));
+  CHECK(hostTimerCalls - timerCalls >= 2, "%u timer callbacks while the queue was full", hostTimerCalls - timerCalls);
+  CHECK(outputNext == 0, "flushed while the queue was full");
+  stallId = -1;
+  CHECK(waitOutput(1), "message not sent after the stall");
+  flush(connections[stalled]);
+  fin(id);
+  fin(stalled);
+  barrier();
+
+  coalesceBytes = 0;
+}
+
+static void reportWrites(const char *name, size_t bytes, uint32_t deadline, uint32_t count, unsigned interval) {
+  coalesceBytes = bytes;
+  coalesceDeadline = deadline;
+  writerClients = true;
+  int id = accept();
+  tcp_pcb *pcb = connections[id].pcb;
+  barrier();
+  {
+    std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+    outputNext = 0;
+    outputLatencies.clear();
+    outputLatencies.reserve(count);
+  }
+  unsigned segments = pcb->segments;
+  uint64_t start = nowNs();
+  for (uint32_t i = 0; i < count; i++) {
+    uint64_t elapsed = nowNs() - start;
+    if (interval && elapsed < (uint64_t)i * interval * 1000) // sleeps: the timer thread may share the CPU
+      std::this_thread::sleep_for(std::chrono::nanoseconds((uint64_t)i * interval * 1000 - elapsed));
+    receive(id, sizeof(Data));
+  }
+  CHECK(waitOutput(count), "%u of %u messages sent", outputNext, count);
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  std::sort(outputLatencies.begin(), outputLatencies.end());
+  printf("writes %s: %.0f messages/s, %.1f messages per segment, latency p50 %.1f us, p99 %.1f us "
+         "(%u messages of %zu bytes%s)\n",
+         name, count / ((lastOutput - start) / 1e9), (double)count / (pcb->segments - segments),
+         outputLatencies[count / 2] / 1e3, outputLatencies[count * 99 / 100] / 1e3, count, sizeof(Message),
+         interval ? ", one every 100 us" : "");
+  fin(id);
+  writerClients = false;
+  coalesceBytes = 0;
+}
+
+int main(int argc, char **argv) {
+  unsigned count = 200000;
+  int opt;
+  while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+    if (opt == 'n')
+      count = strtoul(optarg, NULL, 0);
+    else if (opt == 's')
+      setenv("ASYNCTCP_HOST_SEED", optarg, 1);
+  }
+
+  server.onClient(onClient, NULL);
+  server.begin();
+  accept(); // connection 0, the barrier
+  testEvents(count);
+  testCoalescing();
+  testAcks();
+  reportBenchmark(count);
+  busyClients = false;
+  reportWrites("at once", 0, 0, 50000, 0);
+  reportWrites("coalesced", 1436, 1000, 50000, 0);
+  reportWrites("at once", 0, 0, 5000, 100);
+  reportWrites("coalesced", 1436, 1000, 5000, 100);
+
+  printf(failures ? "%d FAILED\n" : "all passed\n", failures);
+  fflush(stdout);
+  _exit(failures ? 1 : 0); // the async task never returns
+}
@@ -0,0 +1,396 @@
+// Definitions behind the mock headers of asynctcp_host: FreeRTOS tasks,
+// semaphores, queues and notifications on threads, the lwIP pcbs and pbufs,
+// and an allocation counter (operator new and malloc).
+
+#include <Arduino.h>
+#include <chrono>
+#include <condition_variable>
+#include <new>
+#include <thread>
+#include "esp_task_wdt.h"
+#include "esp_timer.h"
+extern "C" {
+#include "lwip/dns.h"
+}
+#include "lwip/priv/tcpip_priv.h"
+#include "host.h"
+
+int hostDiagnostics;
+std::atomic<unsigned long> hostAllocations;
+std::atomic<long> hostPbufs;
+std::recursive_mutex hostLwipLock;
+std::vector<tcp_pcb *> hostPcbs;
+
+#ifndef HOST_SANITIZE // the sanitizers have their own allocator
+extern "C" void *__libc_malloc(size_t size);
+
+extern "C" void *malloc(size_t size) {
+  hostAllocations++;
+  return __libc_malloc(size);
+}
+
+void *operator new(size_t size) {
+  hostAllocations++;
+  void *p = __libc_malloc(size ? size : 1);
+  if (!p)
+    throw std::bad_alloc();
+  return p;
+}
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+// Memory lwIP takes from its own pools
+static void *poolAlloc(size_t size) { return __libc_malloc(size); }
+#else
+static void *poolAlloc(size_t size) { return malloc(size); }
+#endif
+
+unsigned long millis() {
+  static auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+/*
+ * FreeRTOS
+ */
+
+template <typename Predicate>
+static bool waitTicks(std::condition_variable &cv, std::unique_lock<std::mutex> &lock, TickType_t ticks, Predicate ready) {
+  if (ticks == portMAX_DELAY) {
+    cv.wait(lock, ready);
+    return true;
+  }
+  return cv.wait_for(lock, std::chrono::milliseconds(ticks), ready);
+}
+
+struct HostSemaphore {
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool given = false;
+};
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void) { return new HostSemaphore(); }
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t ticks) {
+  std::unique_lock<std::mutex> lock(s->mutex);
+  if (!waitTicks(s->cv, lock, ticks, [s] { return s->given; }))
+    return pdFALSE;
+  s->given = false;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s) {
+  std::lock_guard<std::mutex> lock(s->mutex);
+  if (s->given)
+    return pdFALSE;
+  s->given = true;
+  s->cv.notify_one();
+  return pdTRUE;
+}
+
+// A ring of fixed size items, allocated at creation like a FreeRTOS queue
+struct HostQueue {
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<char> items;
+  uint32_t length, size, first = 0, count = 0;
+};
+
+xQueueHandle xQueueCreate(uint32_t length, uint32_t size) {
+  HostQueue *q = new HostQueue();
+  q->items.resize(length * size);
+  q->length = length;
+  q->size = size;
+  return q;
+}
+
+static BaseType_t queueSend(xQueueHandle q, const void *item, TickType_t ticks, bool front) {
+  std::unique_lock<std::mutex> lock(q->mutex);
+  if (!waitTicks(q->cv, lock, ticks, [q] { return q->count < q->length; }))
+    return pdFALSE;
+  uint32_t at;
+  if (front) {
+    q->first = (q->first + q->length - 1) % q->length;
+    at = q->first;
+  } else {
+    at = (q->first + q->count) % q->length;
+  }
+  memcpy(&q->items[at * q->size], item, q->size);
+  q->count++;
+  q->cv.notify_all();
+  return pdPASS;
+}
+
+BaseType_t xQueueSend(xQueueHandle q, const void *item, TickType_t ticks) { return queueSend(q, item, ticks, false); }
+BaseType_t xQueueSendToFront(xQueueHandle q, const void *item, TickType_t ticks) { return queueSend(q, item, ticks, true); }
+
+static BaseType_t queueReceive(xQueueHandle q, void *item, TickType_t ticks, bool remove) {
+  std::unique_lock<std::mutex> lock(q->mutex);
+  if (!waitTicks(q->cv, lock, ticks, [q] { return q->count > 0; }))
+    return pdFALSE;
+  memcpy(item, &q->items[q->first * q->size], q->size);
+  if (remove) {
+    q->first = (q->first + 1) % q->length;
+    q->count--;
+    q->cv.notify_all();
+  }
+  return pdPASS;
+}
+
+BaseType_t xQueueReceive(xQueueHandle q, void *item, TickType_t ticks) { return queueReceive(q, item, ticks, true); }
+BaseType_t xQueuePeek(xQueueHandle q, void *item, TickType_t ticks) { return queueReceive(q, item, ticks, false); }
+
+struct HostTask {
+  std::mutex mutex;
+  std::condition_variable cv;
+  uint32_t notifications = 0;
+};
+
+static thread_local HostTask *currentTask;
+
+BaseType_t xTaskCreateUniversal(TaskFunction_t code, const char *, uint32_t, void *arg, int, TaskHandle_t *handle, int) {
+  HostTask *task = new HostTask();
+  *handle = task;
+  std::thread([task, code, arg] {
+    currentTask = task;
+    code(arg);
+  }).detach();
+  return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t) {}
+
+void vTaskDelay(TickType_t ticks) { std::this_thread::sleep_for(std::chrono::milliseconds(ticks)); }
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  std::lock_guard<std::mutex> lock(task->mutex);
+  task->notifications++;
+  task->cv.notify_one();
+  return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks) {
+  HostTask *task = currentTask;
+  std::unique_lock<std::mutex> lock(task->mutex);
+  if (!waitTicks(task->cv, lock, ticks, [task] { return task->notifications > 0; }))
+    return 0;
+  uint32_t n = task->notifications;
+  task->notifications = clear ? 0 : n - 1;
+  return n;
+}
+
+/*
+ * esp_timer: one thread runs the callbacks of the timers that are due
+ */
+
+struct esp_timer {
+  esp_timer_cb_t callback;
+  void *arg;
+  int64_t due; // 0: stopped
+};
+
+static std::mutex timersLock;
+static std::condition_variable timersChanged;
+static std::vector<esp_timer *> timers;
+std::atomic<unsigned> hostTimerCalls;
+
+int64_t esp_timer_get_time(void) {
+  static auto start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void runTimers() {
+  std::unique_lock<std::mutex> lock(timersLock);
+  for (;;) {
+    int64_t now = esp_timer_get_time(), next = INT64_MAX;
+    esp_timer *due = NULL;
+    for (esp_timer *t : timers) {
+      if (t->due && t->due <= now)
+        due = t;
+      else if (t->due)
+        next = std::min(next, t->due);
+    }
+    if (due) {
+      due->due = 0;
+      lock.unlock();
+      due->callback(due->arg);
+      hostTimerCalls++;
+      lock.lock();
+    } else if (next == INT64_MAX) {
+      timersChanged.wait(lock);
+    } else {
+      timersChanged.wait_for(lock, std::chrono::microseconds(next - now));
+    }
+  }
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *handle) {
+  std::lock_guard<std::mutex> lock(timersLock);
+  if (timers.empty())
+    std::thread(runTimers).detach();
+  esp_timer *t = new esp_timer{args->callback, args->arg, 0};
+  timers.push_back(t);
+  *handle = t;
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us) {
+  std::lock_guard<std::mutex> lock(timersLock);
+  if (timer->due)
+    return ESP_ERR_INVALID_STATE;
+  timer->due = esp_timer_get_time() + timeout_us;
+  if (!timer->due)
+    timer->due = 1;
+  timersChanged.notify_one();
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+  std::lock_guard<std::mutex> lock(timersLock);
+  if (!timer->due)
+    return ESP_ERR_INVALID_STATE;
+  timer->due = 0;
+  return ESP_OK;
+}
+
+/*
+ * lwIP
+ */
+
+struct pbuf *pbuf_alloc_host(const void *data, uint16_t len) {
+  struct pbuf *p = (struct pbuf *)poolAlloc(sizeof(struct pbuf) + len);
+  p->next = NULL;
+  p->payload = p + 1;
+  p->tot_len = p->len = len;
+  memcpy(p->payload, data, len);
+  hostPbufs++;
+  return p;
+}
+
+uint8_t pbuf_free(struct pbuf *p) {
+  uint8_t n = 0;
+  while (p) {
+    struct pbuf *next = p->next;
+    free(p);
+    hostPbufs--;
+    n++;
+    p = next;
+  }
+  return n;
+}
+
+struct tcp_pcb *tcp_new_ip_type(uint8_t) {
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  tcp_pcb *pcb = (tcp_pcb *)poolAlloc(sizeof(tcp_pcb));
+  memset(pcb, 0, sizeof(*pcb));
+  pcb->mss = 1436;
+  pcb->snd_buf = 5744;
+  hostPcbs.push_back(pcb);
+  return pcb;
+}
+
+void tcp_arg(struct tcp_pcb *pcb, void *arg) {
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  pcb->callback_arg = arg;
+}
+void tcp_recv(struct tcp_pcb *pcb, tcp_recv_fn recv) {
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  pcb->recv = recv;
+}
+void tcp_sent(struct tcp_pcb *pcb, tcp_sent_fn sent) {
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  pcb->sent = sent;
+}
+void tcp_poll(struct tcp_pcb *pcb, tcp_poll_fn poll, uint8_t) {
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  pcb->poll = poll;
+}
+void tcp_err(struct tcp_pcb *pcb, tcp_err_fn err) {
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  pcb->errf = err;
+}
+void tcp_accept(struct tcp_pcb *pcb, tcp_accept_fn accept) {
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  pcb->accept = accept;
+}
+
+err_t tcp_bind(struct tcp_pcb *pcb, const ip_addr_t *ipaddr, uint16_t port) {
+  pcb->local_ip = *ipaddr;
+  pcb->local_port = port;
+  return ERR_OK;
+}
+
+struct tcp_pcb *tcp_listen_with_backlog(struct tcp_pcb *pcb, uint8_t) {
+  pcb->state = LISTEN;
+  return pcb;
+}
+
+err_t tcp_connect(struct tcp_pcb *pcb, const ip_addr_t *ipaddr, uint16_t port, tcp_connected_fn connected) {
+  pcb->remote_ip = *ipaddr;
+  pcb->remote_port = port;
+  pcb->connected = connected;
+  pcb->state = SYN_SENT;
+  return ERR_OK;
+}
+
+err_t tcp_write(struct tcp_pcb *pcb, const void *data, uint16_t len, uint8_t) {
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  if (pcb->closed)
+    return ERR_CONN;
+  if (len > tcp_sndbuf(pcb))
+    return ERR_MEM;
+  memcpy(pcb->unsent + pcb->unsent_len, data, len);
+  pcb->unsent_len += len;
+  pcb->written += len;
+  return ERR_OK;
+}
+
+err_t tcp_output(struct tcp_pcb *pcb) {
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  if (pcb->closed)
+    return ERR_CONN;
+  pcb->outputs++;
+  if (!pcb->unsent_len)
+    return ERR_OK;
+  pcb->segments += (pcb->unsent_len + pcb->mss - 1) / pcb->mss;
+  if (pcb->output)
+    pcb->output(pcb, pcb->unsent, pcb->unsent_len);
+  pcb->unsent_len = 0;
+  return ERR_OK;
+}
+
+void tcp_recved(struct tcp_pcb *pcb, uint16_t len) {
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  pcb->recved += len;
+  pcb->recved_calls++;
+}
+
+// The pcb is not freed: the test keeps using it to see it closed
+err_t tcp_close(struct tcp_pcb *pcb) {
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  pcb->closed = 1;
+  pcb->state = CLOSED;
+  return ERR_OK;
+}
+
+void tcp_abort(struct tcp_pcb *pcb) {
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  pcb->closed = pcb->aborted = 1;
+  pcb->state = CLOSED;
+  if (pcb->errf)
+    pcb->errf(pcb->callback_arg, ERR_ABRT);
+}
+
+err_t dns_gethostbyname(const char *, ip_addr_t *addr, dns_found_callback, void *) {
+  addr->u_addr.ip4.addr = 0x0100007F;
+  addr->type = IPADDR_TYPE_V4;
+  return ERR_OK;
+}
+
+err_t tcpip_api_call(tcpip_api_call_fn fn, struct tcpip_api_call_data *call) {
+  std::lock_guard<std::recursive_mutex> lock(hostLwipLock);
+  return fn(call);
+}
@@ -0,0 +1,19 @@
+// Test helpers of asynctcp_host
+
+#ifndef ASYNCTCP_HOST_HOST_H
+#define ASYNCTCP_HOST_HOST_H
+
+#include <Arduino.h>
+#include <AsyncTCP.h>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include "lwip/tcp.h"
+
+extern std::atomic<unsigned long> hostAllocations; // operator new and malloc calls so far, not counting pbufs and pcbs
+extern std::atomic<long> hostPbufs;                // pbufs not freed yet
+extern std::recursive_mutex hostLwipLock;          // held by "the lwIP thread"
+extern std::vector<tcp_pcb *> hostPcbs;            // every pcb created, the first listening one is the server
+extern std::atomic<unsigned> hostTimerCalls;       // esp_timer callbacks returned so far
+
+#endif // ASYNCTCP_HOST_HOST_H
@@ -0,0 +1,26 @@
+// Host (Linux) stand-in for the ESP32 Arduino core, used by asynctcp_host.
+// Only what AsyncTCP uses is provided.
+
+#ifndef ASYNCTCP_HOST_ARDUINO_H
+#define ASYNCTCP_HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "IPAddress.h"
+extern "C" {
+#include "semphr.h"
+}
+
+unsigned long millis();
+
+// Library errors are counted, not printed
+extern int hostDiagnostics;
+#define log_e(...) (hostDiagnostics++)
+#define log_w(...) ((void)0)
+#define log_i(...) ((void)0)
+
+#endif // ASYNCTCP_HOST_ARDUINO_H
@@ -0,0 +1,17 @@
+// Host stand-in for the Arduino IPAddress.
+
+#ifndef ASYNCTCP_HOST_IPADDRESS_H
+#define ASYNCTCP_HOST_IPADDRESS_H
+
+#include <stdint.h>
+
+class IPAddress {
+public:
+  IPAddress(uint32_t address = 0) : _address(address) {}
+  operator uint32_t() const { return _address; }
+
+private:
+  uint32_t _address;
+};
+
+#endif // ASYNCTCP_HOST_IPADDRESS_H
@@ -0,0 +1,11 @@
+/* Host stand-in for the ESP-IDF error codes */
+
+#ifndef ASYNCTCP_HOST_ESP_ERR_H
+#define ASYNCTCP_HOST_ESP_ERR_H
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_INVALID_STATE 0x103
+
+#endif /* ASYNCTCP_HOST_ESP_ERR_H */
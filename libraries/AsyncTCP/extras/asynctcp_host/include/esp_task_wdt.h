@@ -0,0 +1,12 @@
+/* Host stand-in for the ESP-IDF task watchdog: nothing to watch. */
+
+#ifndef ASYNCTCP_HOST_ESP_TASK_WDT_H
+#define ASYNCTCP_HOST_ESP_TASK_WDT_H
+
+#include "esp_err.h"
+#include "semphr.h"
+
+static inline esp_err_t esp_task_wdt_add(TaskHandle_t) { return ESP_OK; }
+static inline esp_err_t esp_task_wdt_delete(TaskHandle_t) { return ESP_OK; }
+
+#endif /* ASYNCTCP_HOST_ESP_TASK_WDT_H */
@@ -0,0 +1 @@
+/* Host stand-in for lwIP, see tcp.h */
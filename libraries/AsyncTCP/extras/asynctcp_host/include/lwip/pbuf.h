@@ -0,0 +1,26 @@
+/* Host stand-in for lwIP packet buffers: one malloc'd block each, counted */
+
+#ifndef ASYNCTCP_HOST_LWIP_PBUF_H
+#define ASYNCTCP_HOST_LWIP_PBUF_H
+
+#include <stdint.h>
+
+struct pbuf {
+  struct pbuf *next;
+  void *payload;
+  uint16_t tot_len;
+  uint16_t len;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct pbuf *pbuf_alloc_host(const void *data, uint16_t len);
+uint8_t pbuf_free(struct pbuf *p);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ASYNCTCP_HOST_LWIP_PBUF_H */
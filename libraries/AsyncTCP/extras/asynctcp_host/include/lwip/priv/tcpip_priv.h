@@ -0,0 +1,15 @@
+/* Host stand-in for the lwIP thread API: the call runs under the lwIP lock */
+
+#ifndef ASYNCTCP_HOST_LWIP_TCPIP_PRIV_H
+#define ASYNCTCP_HOST_LWIP_TCPIP_PRIV_H
+
+#include "lwip/err.h"
+
+struct tcpip_api_call_data {
+  int unused;
+};
+typedef err_t (*tcpip_api_call_fn)(struct tcpip_api_call_data *call);
+
+extern "C" err_t tcpip_api_call(tcpip_api_call_fn fn, struct tcpip_api_call_data *call);
+
+#endif /* ASYNCTCP_HOST_LWIP_TCPIP_PRIV_H */
@@ -0,0 +1,88 @@
+/* Host stand-in for the lwIP raw TCP API. A pcb keeps the callbacks the
+ * library sets; the test plays the lwIP thread and calls them with
+ * hostLwipLock held, as lwIP calls them from its thread. tcp_* calls made by
+ * the library take the same lock.
+ * Written data waits in the pcb until tcp_output() hands it to output(), then
+ * counts as acked at once (the send buffer is free again). */
+
+#ifndef ASYNCTCP_HOST_LWIP_TCP_H
+#define ASYNCTCP_HOST_LWIP_TCP_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "lwip/err.h"
+#include "lwip/pbuf.h"
+
+typedef struct {
+  uint32_t addr;
+} ip4_addr_t;
+
+typedef struct ip_addr {
+  union {
+    ip4_addr_t ip4;
+    uint32_t ip6[4];
+  } u_addr;
+  uint8_t type;
+} ip_addr_t;
+
+#define IPADDR_TYPE_V4 0
+#define IPADDR_ANY 0
+
+enum tcp_state { CLOSED = 0, LISTEN = 1, SYN_SENT = 2, SYN_RCVD = 3, ESTABLISHED = 4, CLOSE_WAIT = 7 };
+
+struct tcp_pcb;
+typedef err_t (*tcp_recv_fn)(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err);
+typedef err_t (*tcp_sent_fn)(void *arg, struct tcp_pcb *tpcb, uint16_t len);
+typedef err_t (*tcp_poll_fn)(void *arg, struct tcp_pcb *tpcb);
+typedef void (*tcp_err_fn)(void *arg, err_t err);
+typedef err_t (*tcp_accept_fn)(void *arg, struct tcp_pcb *newpcb, err_t err);
+typedef err_t (*tcp_connected_fn)(void *arg, struct tcp_pcb *tpcb, err_t err);
+
+struct tcp_pcb {
+  void *callback_arg;
+  tcp_recv_fn recv;
+  tcp_sent_fn sent;
+  tcp_poll_fn poll;
+  tcp_err_fn errf;
+  tcp_accept_fn accept;
+  tcp_connected_fn connected;
+  enum tcp_state state;
+  ip_addr_t local_ip, remote_ip;
+  uint16_t local_port, remote_port;
+  uint16_t mss;
+  uint16_t snd_buf;
+  uint8_t nodelay;
+  /* host side */
+  size_t recved, written;
+  unsigned recved_calls, outputs, segments;
+  uint8_t unsent[8192];
+  size_t unsent_len;
+  void (*output)(struct tcp_pcb *pcb, const uint8_t *data, size_t len);
+  int closed, aborted;
+};
+
+#define tcp_sndbuf(pcb) ((pcb)->snd_buf - (pcb)->unsent_len)
+#define tcp_mss(pcb) ((pcb)->mss)
+#define tcp_nagle_disable(pcb) ((pcb)->nodelay = 1)
+#define tcp_nagle_enable(pcb) ((pcb)->nodelay = 0)
+#define tcp_nagle_disabled(pcb) ((pcb)->nodelay != 0)
+
+extern "C" {
+struct tcp_pcb *tcp_new_ip_type(uint8_t type);
+void tcp_arg(struct tcp_pcb *pcb, void *arg);
+void tcp_recv(struct tcp_pcb *pcb, tcp_recv_fn recv);
+void tcp_sent(struct tcp_pcb *pcb, tcp_sent_fn sent);
+void tcp_poll(struct tcp_pcb *pcb, tcp_poll_fn poll, uint8_t interval);
+void tcp_err(struct tcp_pcb *pcb, tcp_err_fn err);
+void tcp_accept(struct tcp_pcb *pcb, tcp_accept_fn accept);
+err_t tcp_bind(struct tcp_pcb *pcb, const ip_addr_t *ipaddr, uint16_t port);
+struct tcp_pcb *tcp_listen_with_backlog(struct tcp_pcb *pcb, uint8_t backlog);
+err_t tcp_connect(struct tcp_pcb *pcb, const ip_addr_t *ipaddr, uint16_t port, tcp_connected_fn connected);
+err_t tcp_write(struct tcp_pcb *pcb, const void *dataptr, uint16_t len, uint8_t apiflags);
+err_t tcp_output(struct tcp_pcb *pcb);
+void tcp_recved(struct tcp_pcb *pcb, uint16_t len);
+err_t tcp_close(struct tcp_pcb *pcb);
+void tcp_abort(struct tcp_pcb *pcb);
+}
+
+#endif /* ASYNCTCP_HOST_LWIP_TCP_H */
@@ -0,0 +1,8 @@
+// Host stand-in for the ESP-IDF configuration, the values of the Arduino core
+
+#ifndef ASYNCTCP_HOST_SDKCONFIG_H
+#define ASYNCTCP_HOST_SDKCONFIG_H
+
+#define CONFIG_LWIP_MAX_ACTIVE_TCP 16
+
+#endif // ASYNCTCP_HOST_SDKCONFIG_H
@@ -0,0 +1,46 @@
+/* Host stand-in for FreeRTOS: tasks are threads, semaphores, queues and task
+ * notifications block on condition variables (host.cpp). One tick is 1 ms. */
+
+#ifndef ASYNCTCP_HOST_SEMPHR_H
+#define ASYNCTCP_HOST_SEMPHR_H
+
+#include <stdint.h>
+
+typedef struct HostSemaphore *SemaphoreHandle_t;
+typedef struct HostQueue *xQueueHandle;
+typedef struct HostTask *TaskHandle_t;
+typedef int BaseType_t;
+typedef uint32_t TickType_t;
+typedef void (*TaskFunction_t)(void *);
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFF
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+
+xQueueHandle xQueueCreate(uint32_t length, uint32_t size);
+BaseType_t xQueueSend(xQueueHandle queue, const void *item, TickType_t ticks);
+BaseType_t xQueueSendToFront(xQueueHandle queue, const void *item, TickType_t ticks);
+BaseType_t xQueueReceive(xQueueHandle queue, void *item, TickType_t ticks);
+BaseType_t xQueuePeek(xQueueHandle queue, void *item, TickType_t ticks);
+
+BaseType_t xTaskCreateUniversal(TaskFunction_t code, const char *name, uint32_t stack, void *arg, int priority,
+                                TaskHandle_t *handle, int core);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ASYNCTCP_HOST_SEMPHR_H */
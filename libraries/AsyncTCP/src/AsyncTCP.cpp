@@ -30,18 +30,21 @@ extern "C"{
 #include "lwip/err.h"
 }
 #include "esp_task_wdt.h"
+#include "esp_timer.h"
 
 /*
  * TCP/IP Event Task
  * */
 
 typedef enum {
-    LWIP_TCP_SENT, LWIP_TCP_RECV, LWIP_TCP_FIN, LWIP_TCP_ERROR, LWIP_TCP_POLL, LWIP_TCP_CLEAR, LWIP_TCP_ACCEPT, LWIP_TCP_CONNECTED, LWIP_TCP_DNS
+    LWIP_TCP_SENT, LWIP_TCP_RECV, LWIP_TCP_FIN, LWIP_TCP_ERROR, LWIP_TCP_POLL, LWIP_TCP_ACCEPT, LWIP_TCP_CONNECTED, LWIP_TCP_DNS, LWIP_TCP_FLUSH
 } lwip_event_t;
 
 typedef struct {
         lwip_event_t event;
         void *arg;
+        int8_t owner;
+        uint32_t generation;
         union {
                 struct {
                         void * pcb;
@@ -52,7 +55,6 @@ typedef struct {
                 } error;
                 struct {
                         tcp_pcb * pcb;
-                        uint16_t len;
                 } sent;
                 struct {
                         tcp_pcb * pcb;
@@ -76,9 +78,50 @@ typedef struct {
         };
 } lwip_event_packet_t;
 
-static xQueueHandle _async_queue;
+/*
+ * Events are written in place into a fixed ring of slots: the LwIP callbacks
+ * claim a slot with a compare and swap on the tail and publish it through the
+ * slot sequence, the async task handles the slots in order and wakes up with a
+ * task notification. Nothing is allocated per event.
+ * */
+
+typedef struct {
+        uint32_t sequence;
+        lwip_event_packet_t packet;
+} async_event_slot_t;
+
+static_assert((CONFIG_ASYNC_TCP_QUEUE_SIZE & (CONFIG_ASYNC_TCP_QUEUE_SIZE - 1)) == 0, "CONFIG_ASYNC_TCP_QUEUE_SIZE must be a power of 2");
+
+static async_event_slot_t _async_events[CONFIG_ASYNC_TCP_QUEUE_SIZE];
+static uint32_t _async_events_head;
+static uint32_t _async_events_tail;
+static bool _async_events_ready = false;
+static bool _async_events_waiting = false;
+static SemaphoreHandle_t _async_events_space;
 static TaskHandle_t _async_service_task_handle = NULL;
 
+/*
+ * The events of a client are tagged with its owner slot and the generation of
+ * that slot. Closing the client bumps the generation: the events still queued
+ * for it are dropped when they come out, without searching the queue.
+ * An odd generation is a slot in use.
+ * */
+
+#define ASYNC_EVENT_OWNERS (CONFIG_LWIP_MAX_ACTIVE_TCP * 2)
+static uint32_t _event_owners[ASYNC_EVENT_OWNERS];
+static uint32_t _event_owners_next;
+
+/*
+ * The deadline of coalesced writes is a timer of the owner slot, not of the
+ * client: a timer that fires late tags its event with the generation it was
+ * started for, and the event is dropped if the client is gone.
+ * */
+
+static esp_timer_handle_t _flush_timers[ASYNC_EVENT_OWNERS];
+static AsyncClient * _flush_clients[ASYNC_EVENT_OWNERS];
+static uint32_t _flush_generations[ASYNC_EVENT_OWNERS];
+#define ASYNC_FLUSH_RETRY_US 1000 //the queue was full when the deadline passed
+
 
 SemaphoreHandle_t _slots_lock;
 const int _number_of_closed_slots = CONFIG_LWIP_MAX_ACTIVE_TCP;
@@ -94,69 +137,91 @@ static uint32_t _closed_index = []() {
 
 
 static inline bool _init_async_event_queue(){
-    if(!_async_queue){
-        _async_queue = xQueueCreate(32, sizeof(lwip_event_packet_t *));
-        if(!_async_queue){
+    if(!_async_events_ready){
+        _async_events_space = xSemaphoreCreateBinary();
+        if(!_async_events_space){
             return false;
         }
+        for(uint32_t i = 0; i < CONFIG_ASYNC_TCP_QUEUE_SIZE; i++){
+            _async_events[i].sequence = i;
+        }
+        _async_events_head = 0;
+        _async_events_tail = 0;
+        __atomic_store_n(&_async_events_ready, true, __ATOMIC_RELEASE);
     }
     return true;
 }
 
-static inline bool _send_async_event(lwip_event_packet_t ** e){
-    return _async_queue && xQueueSend(_async_queue, e, portMAX_DELAY) == pdPASS;
-}
-
-static inline bool _prepend_async_event(lwip_event_packet_t ** e){
-    return _async_queue && xQueueSendToFront(_async_queue, e, portMAX_DELAY) == pdPASS;
+//Claims the next slot, waiting for the async task when the queue is full.
+//Data (recv and poll) and the flush timer only get the first half of the queue and fail instead: the other events
+//are few per connection, so LwIP does not wait for the async task while it waits for LwIP
+static lwip_event_packet_t * _claim_async_event(uint32_t * position, bool data){
+    uint32_t pos = __atomic_load_n(&_async_events_tail, __ATOMIC_RELAXED);
+    for(;;){
+        if(data && pos - __atomic_load_n(&_async_events_head, __ATOMIC_RELAXED) >= CONFIG_ASYNC_TCP_QUEUE_SIZE / 2){
+            return NULL;
+        }
+        async_event_slot_t * slot = &_async_events[pos & (CONFIG_ASYNC_TCP_QUEUE_SIZE - 1)];
+        int32_t diff = (int32_t)(__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) - pos);
+        if(diff == 0){
+            if(__atomic_compare_exchange_n(&_async_events_tail, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)){
+                *position = pos;
+                return &slot->packet;
+            }
+        } else if(diff < 0){
+            __atomic_store_n(&_async_events_waiting, true, __ATOMIC_SEQ_CST);
+            if((int32_t)(__atomic_load_n(&slot->sequence, __ATOMIC_SEQ_CST) - pos) < 0){
+                xSemaphoreTake(_async_events_space, 1);
+            }
+            __atomic_store_n(&_async_events_waiting, false, __ATOMIC_RELAXED);
+            pos = __atomic_load_n(&_async_events_tail, __ATOMIC_RELAXED);
+        } else {
+            pos = __atomic_load_n(&_async_events_tail, __ATOMIC_RELAXED);
+        }
+    }
 }
 
-static inline bool _get_async_event(lwip_event_packet_t ** e){
-    return _async_queue && xQueueReceive(_async_queue, e, portMAX_DELAY) == pdPASS;
+static void _send_async_event(uint32_t position){
+    async_event_slot_t * slot = &_async_events[position & (CONFIG_ASYNC_TCP_QUEUE_SIZE - 1)];
+    __atomic_store_n(&slot->sequence, position + 1, __ATOMIC_RELEASE);
+    xTaskNotifyGive(_async_service_task_handle);
 }
 
-static bool _remove_events_with_arg(void * arg){
-    lwip_event_packet_t * first_packet = NULL;
-    lwip_event_packet_t * packet = NULL;
-
-    if(!_async_queue){
-        return false;
+//Copies the next event out, so the slot is free again while the event is handled
+static void _get_async_event(lwip_event_packet_t * e){
+    async_event_slot_t * slot = &_async_events[_async_events_head & (CONFIG_ASYNC_TCP_QUEUE_SIZE - 1)];
+    while(__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) != _async_events_head + 1){
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
     }
-    //figure out which is the first packet so we can keep the order
-    while(!first_packet){
-        if(xQueueReceive(_async_queue, &first_packet, 0) != pdPASS){
-            return false;
-        }
-        //discard packet if matching
-        if((int)first_packet->arg == (int)arg){
-            free(first_packet);
-            first_packet = NULL;
-        //return first packet to the back of the queue
-        } else if(xQueueSend(_async_queue, &first_packet, portMAX_DELAY) != pdPASS){
-            return false;
-        }
+    *e = slot->packet;
+    __atomic_store_n(&slot->sequence, _async_events_head + CONFIG_ASYNC_TCP_QUEUE_SIZE, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&_async_events_head, _async_events_head + 1, __ATOMIC_RELAXED);
+    if(__atomic_load_n(&_async_events_waiting, __ATOMIC_SEQ_CST)){
+        xSemaphoreGive(_async_events_space);
     }
+}
 
-    while(xQueuePeek(_async_queue, &packet, 0) == pdPASS && packet != first_packet){
-        if(xQueueReceive(_async_queue, &packet, 0) != pdPASS){
-            return false;
-        }
-        if((int)packet->arg == (int)arg){
-            free(packet);
-            packet = NULL;
-        } else if(xQueueSend(_async_queue, &packet, portMAX_DELAY) != pdPASS){
-            return false;
-        }
-    }
-    return true;
+static void _tag_async_event(lwip_event_packet_t * e, AsyncClient * client){
+    e->owner = client ? client->_event_owner() : -1;
+    e->generation = client ? client->_event_generation() : 0;
+}
+
+static bool _is_live_async_event(lwip_event_packet_t * e){
+    return e->owner < 0 || __atomic_load_n(&_event_owners[e->owner], __ATOMIC_ACQUIRE) == e->generation;
 }
 
 static void _handle_async_event(lwip_event_packet_t * e){
     if(e->arg == NULL){
         // do nothing when arg is NULL
         //ets_printf("event arg == NULL: 0x%08x\n", e->recv.pcb);
-    } else if(e->event == LWIP_TCP_CLEAR){
-        _remove_events_with_arg(e->arg);
+        if(e->event == LWIP_TCP_RECV){
+            pbuf_free(e->recv.pb);
+        }
+    } else if(!_is_live_async_event(e)){
+        // the client was closed after the event was queued
+        if(e->event == LWIP_TCP_RECV){
+            pbuf_free(e->recv.pb);
+        }
     } else if(e->event == LWIP_TCP_RECV){
         //ets_printf("-R: 0x%08x\n", e->recv.pcb);
         AsyncClient::_s_recv(e->arg, e->recv.pcb, e->recv.pb, e->recv.err);
@@ -165,7 +230,7 @@ static void _handle_async_event(lwip_event_packet_t * e){
         AsyncClient::_s_fin(e->arg, e->fin.pcb, e->fin.err);
     } else if(e->event == LWIP_TCP_SENT){
         //ets_printf("-S: 0x%08x\n", e->sent.pcb);
-        AsyncClient::_s_sent(e->arg, e->sent.pcb, e->sent.len);
+        AsyncClient::_s_sent(e->arg, e->sent.pcb, reinterpret_cast<AsyncClient*>(e->arg)->_take_sent());
     } else if(e->event == LWIP_TCP_POLL){
         //ets_printf("-P: 0x%08x\n", e->poll.pcb);
         AsyncClient::_s_poll(e->arg, e->poll.pcb);
@@ -181,26 +246,26 @@ static void _handle_async_event(lwip_event_packet_t * e){
     } else if(e->event == LWIP_TCP_DNS){
         //ets_printf("D: 0x%08x %s = %s\n", e->arg, e->dns.name, ipaddr_ntoa(&e->dns.addr));
         AsyncClient::_s_dns_found(e->dns.name, &e->dns.addr, e->arg);
+    } else if(e->event == LWIP_TCP_FLUSH){
+        AsyncClient::_s_flush(e->arg);
     }
-    free((void*)(e));
 }
 
 static void _async_service_task(void *pvParameters){
-    lwip_event_packet_t * packet = NULL;
+    lwip_event_packet_t packet;
     for (;;) {
-        if(_get_async_event(&packet)){
+        _get_async_event(&packet);
 #if CONFIG_ASYNC_TCP_USE_WDT
-            if(esp_task_wdt_add(NULL) != ESP_OK){
-                log_e("Failed to add async task to WDT");
-            }
+        if(esp_task_wdt_add(NULL) != ESP_OK){
+            log_e("Failed to add async task to WDT");
+        }
 #endif
-            _handle_async_event(packet);
+        _handle_async_event(&packet);
 #if CONFIG_ASYNC_TCP_USE_WDT
-            if(esp_task_wdt_delete(NULL) != ESP_OK){
-                log_e("Failed to remove loop task from WDT");
-            }
-#endif
+        if(esp_task_wdt_delete(NULL) != ESP_OK){
+            log_e("Failed to remove loop task from WDT");
         }
+#endif
     }
     vTaskDelete(NULL);
     _async_service_task_handle = NULL;
@@ -230,44 +295,44 @@ static bool _start_async_task(){
  * LwIP Callbacks
  * */
 
-static int8_t _tcp_clear_events(void * arg) {
-    lwip_event_packet_t * e = (lwip_event_packet_t *)malloc(sizeof(lwip_event_packet_t));
-    e->event = LWIP_TCP_CLEAR;
-    e->arg = arg;
-    if (!_prepend_async_event(&e)) {
-        free((void*)(e));
-    }
-    return ERR_OK;
-}
-
 static int8_t _tcp_connected(void * arg, tcp_pcb * pcb, int8_t err) {
     //ets_printf("+C: 0x%08x\n", pcb);
-    lwip_event_packet_t * e = (lwip_event_packet_t *)malloc(sizeof(lwip_event_packet_t));
+    uint32_t position;
+    lwip_event_packet_t * e = _claim_async_event(&position, false);
     e->event = LWIP_TCP_CONNECTED;
     e->arg = arg;
+    _tag_async_event(e, (AsyncClient *)arg);
     e->connected.pcb = pcb;
     e->connected.err = err;
-    if (!_prepend_async_event(&e)) {
-        free((void*)(e));
-    }
+    _send_async_event(position);
     return ERR_OK;
 }
 
 static int8_t _tcp_poll(void * arg, struct tcp_pcb * pcb) {
     //ets_printf("+P: 0x%08x\n", pcb);
-    lwip_event_packet_t * e = (lwip_event_packet_t *)malloc(sizeof(lwip_event_packet_t));
+    //polls come again, drop one rather than fill the queue
+    uint32_t position;
+    lwip_event_packet_t * e = _claim_async_event(&position, true);
+    if(!e){
+        return ERR_OK;
+    }
     e->event = LWIP_TCP_POLL;
     e->arg = arg;
+    _tag_async_event(e, (AsyncClient *)arg);
     e->poll.pcb = pcb;
-    if (!_send_async_event(&e)) {
-        free((void*)(e));
-    }
+    _send_async_event(position);
     return ERR_OK;
 }
 
 static int8_t _tcp_recv(void * arg, struct tcp_pcb * pcb, struct pbuf *pb, int8_t err) {
-    lwip_event_packet_t * e = (lwip_event_packet_t *)malloc(sizeof(lwip_event_packet_t));
+    //refused data stays in LwIP, which delivers it again later
+    uint32_t position;
+    lwip_event_packet_t * e = _claim_async_event(&position, pb != NULL);
+    if(!e){
+        return ERR_MEM;
+    }
     e->arg = arg;
+    _tag_async_event(e, (AsyncClient *)arg);
     if(pb){
         //ets_printf("+R: 0x%08x\n", pcb);
         e->event = LWIP_TCP_RECV;
@@ -282,61 +347,79 @@ static int8_t _tcp_recv(void * arg, struct tcp_pcb * pcb, struct pbuf *pb, int8_
         //close the PCB in LwIP thread
         AsyncClient::_s_lwip_fin(e->arg, e->fin.pcb, e->fin.err);
     }
-    if (!_send_async_event(&e)) {
-        free((void*)(e));
-    }
+    _send_async_event(position);
     return ERR_OK;
 }
 
 static int8_t _tcp_sent(void * arg, struct tcp_pcb * pcb, uint16_t len) {
     //ets_printf("+S: 0x%08x\n", pcb);
-    lwip_event_packet_t * e = (lwip_event_packet_t *)malloc(sizeof(lwip_event_packet_t));
+    //one event per client at a time, the acked lengths add up until it is handled
+    if(!arg || !reinterpret_cast<AsyncClient*>(arg)->_add_sent(len)){
+        return ERR_OK;
+    }
+    uint32_t position;
+    lwip_event_packet_t * e = _claim_async_event(&position, false);
     e->event = LWIP_TCP_SENT;
     e->arg = arg;
+    _tag_async_event(e, (AsyncClient *)arg);
     e->sent.pcb = pcb;
-    e->sent.len = len;
-    if (!_send_async_event(&e)) {
-        free((void*)(e));
-    }
+    _send_async_event(position);
     return ERR_OK;
 }
 
 static void _tcp_error(void * arg, int8_t err) {
     //ets_printf("+E: 0x%08x\n", arg);
-    lwip_event_packet_t * e = (lwip_event_packet_t *)malloc(sizeof(lwip_event_packet_t));
+    uint32_t position;
+    lwip_event_packet_t * e = _claim_async_event(&position, false);
     e->event = LWIP_TCP_ERROR;
     e->arg = arg;
+    _tag_async_event(e, (AsyncClient *)arg);
     e->error.err = err;
-    if (!_send_async_event(&e)) {
-        free((void*)(e));
-    }
+    _send_async_event(position);
 }
 
 static void _tcp_dns_found(const char * name, struct ip_addr * ipaddr, void * arg) {
-    lwip_event_packet_t * e = (lwip_event_packet_t *)malloc(sizeof(lwip_event_packet_t));
+    uint32_t position;
+    lwip_event_packet_t * e = _claim_async_event(&position, false);
     //ets_printf("+DNS: name=%s ipaddr=0x%08x arg=%x\n", name, ipaddr, arg);
     e->event = LWIP_TCP_DNS;
     e->arg = arg;
+    _tag_async_event(e, (AsyncClient *)arg);
     e->dns.name = name;
     if (ipaddr) {
         memcpy(&e->dns.addr, ipaddr, sizeof(struct ip_addr));
     } else {
         memset(&e->dns.addr, 0, sizeof(e->dns.addr));
     }
-    if (!_send_async_event(&e)) {
-        free((void*)(e));
+    _send_async_event(position);
+}
+
+//In esp_timer task: the deadline of coalesced writes passed. It must not wait for the async task,
+//the other timers of the system would wait with it: with the queue full, try again a bit later
+static void _tcp_flush_timer(void * arg) {
+    int owner = (int)(intptr_t)arg;
+    uint32_t position;
+    lwip_event_packet_t * e = _claim_async_event(&position, true);
+    if(!e){
+        esp_timer_start_once(_flush_timers[owner], ASYNC_FLUSH_RETRY_US);
+        return;
     }
+    e->event = LWIP_TCP_FLUSH;
+    e->arg = _flush_clients[owner];
+    e->owner = owner;
+    e->generation = _flush_generations[owner];
+    _send_async_event(position);
 }
 
 //Used to switch out from LwIP thread
 static int8_t _tcp_accept(void * arg, AsyncClient * client) {
-    lwip_event_packet_t * e = (lwip_event_packet_t *)malloc(sizeof(lwip_event_packet_t));
+    uint32_t position;
+    lwip_event_packet_t * e = _claim_async_event(&position, false);
     e->event = LWIP_TCP_ACCEPT;
     e->arg = arg;
+    _tag_async_event(e, NULL);
     e->accept.client = client;
-    if (!_prepend_async_event(&e)) {
-        free((void*)(e));
-    }
+    _send_async_event(position);
     return ERR_OK;
 }
 
@@ -375,18 +458,23 @@ static err_t _tcp_output_api(struct tcpip_api_call_data *api_call_msg){
     tcp_api_call_t * msg = (tcp_api_call_t *)api_call_msg;
     msg->err = ERR_CONN;
     if(msg->closed_slot == -1 || !_closed_slots[msg->closed_slot]) {
+        if(msg->received){
+            tcp_recved(msg->pcb, msg->received);
+        }
         msg->err = tcp_output(msg->pcb);
     }
     return msg->err;
 }
 
-static esp_err_t _tcp_output(tcp_pcb * pcb, int8_t closed_slot) {
+//received: window update to send along
+static esp_err_t _tcp_output(tcp_pcb * pcb, int8_t closed_slot, size_t received) {
     if(!pcb){
         return ERR_CONN;
     }
     tcp_api_call_t msg;
     msg.pcb = pcb;
     msg.closed_slot = closed_slot;
+    msg.received = received;
     tcpip_api_call(_tcp_output_api, (struct tcpip_api_call_data*)&msg);
     return msg.err;
 }
@@ -562,13 +650,22 @@ AsyncClient::AsyncClient(tcp_pcb* pcb)
 , _rx_since_timeout(0)
 , _ack_timeout(ASYNC_MAX_ACK_TIME)
 , _connect_port(0)
+, _tx_coalesce_bytes(0)
+, _tx_coalesce_deadline(1000)
+, _tx_unsent(0)
+, _rx_unreported(0)
+, _tx_flush_armed(false)
 , prev(NULL)
 , next(NULL)
 {
     _pcb = pcb;
     _closed_slot = -1;
+    _owner = -1;
+    _owner_generation = 0;
+    _sent_pending = 0;
     if(_pcb){
         _allocate_closed_slot();
+        _acquire_event_owner();
         _rx_last_packet = millis();
         tcp_arg(_pcb, this);
         tcp_recv(_pcb, &_tcp_recv);
@@ -583,6 +680,7 @@ AsyncClient::~AsyncClient(){
         _close();
     }
     _free_closed_slot();
+    _release_event_owner();
 }
 
 /*
@@ -597,6 +695,7 @@ AsyncClient& AsyncClient::operator=(const AsyncClient& other){
     _pcb = other._pcb;
     _closed_slot = other._closed_slot;
     if (_pcb) {
+        _acquire_event_owner();
         _rx_last_packet = millis();
         tcp_arg(_pcb, this);
         tcp_recv(_pcb, &_tcp_recv);
@@ -694,6 +793,7 @@ bool AsyncClient::connect(IPAddress ip, uint16_t port){
         return false;
     }
 
+    _acquire_event_owner();
     tcp_arg(pcb, this);
     tcp_err(pcb, &_tcp_error);
     tcp_recv(pcb, &_tcp_recv);
@@ -712,6 +812,7 @@ bool AsyncClient::connect(const char* host, uint16_t port){
       return false;
     }
     
+    _acquire_event_owner();
     err_t err = dns_gethostbyname(host, &addr, (dns_found_callback)&_tcp_dns_found, this);
     if(err == ERR_OK) {
         return connect(IPAddress(addr.u_addr.ip4.addr), port);
@@ -759,15 +860,31 @@ size_t AsyncClient::add(const char* data, size_t size, uint8_t apiflags) {
     if(err != ERR_OK) {
         return 0;
     }
+    __atomic_fetch_add(&_tx_unsent, will_send, __ATOMIC_RELAXED);
     return will_send;
 }
 
 bool AsyncClient::send(){
+    if(_tx_coalesce_bytes && __atomic_load_n(&_tx_unsent, __ATOMIC_RELAXED) < _tx_coalesce_bytes){
+        return _arm_flush() || flush();
+    }
+    return flush();
+}
+
+//The counters are also updated by the async task (_recv) and the flush timer: taken with one exchange,
+//so a write or a receive that comes meanwhile is either sent now or left for the next flush
+bool AsyncClient::flush(){
+    _disarm_flush();
+    size_t unsent = __atomic_exchange_n(&_tx_unsent, 0, __ATOMIC_ACQ_REL);
+    size_t received = __atomic_exchange_n(&_rx_unreported, 0, __ATOMIC_ACQ_REL);
+    bool sending = !_tx_coalesce_bytes || unsent;
     int8_t err = ERR_OK;
-    err = _tcp_output(_pcb, _closed_slot);
+    err = _tcp_output(_pcb, _closed_slot, received);
     if(err == ERR_OK){
-        _pcb_busy = true;
-        _pcb_sent_at = millis();
+        if(sending){
+            _pcb_busy = true;
+            _pcb_sent_at = millis();
+        }
         return true;
     }
     return false;
@@ -805,7 +922,7 @@ int8_t AsyncClient::_close(){
         tcp_recv(_pcb, NULL);
         tcp_err(_pcb, NULL);
         tcp_poll(_pcb, NULL, 0);
-        _tcp_clear_events(this);
+        _release_event_owner();
         err = _tcp_close(_pcb, _closed_slot);
         if(err != ERR_OK) {
             err = abort();
@@ -841,6 +958,71 @@ void AsyncClient::_free_closed_slot(){
     }
 }
 
+void AsyncClient::_acquire_event_owner(){
+    if(_owner != -1){
+        return;
+    }
+    _sent_pending = 0;
+    for(int n = 0; n < ASYNC_EVENT_OWNERS; ++ n){
+        int i = (_event_owners_next + n) % ASYNC_EVENT_OWNERS;
+        uint32_t generation = __atomic_load_n(&_event_owners[i], __ATOMIC_RELAXED);
+        if(!(generation & 1) && __atomic_compare_exchange_n(&_event_owners[i], &generation, generation + 1, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)){
+            _event_owners_next = i + 1;
+            _owner = i;
+            _owner_generation = generation + 1;
+            return;
+        }
+    }
+    log_e("no event owner left");
+}
+
+//Drops the events still queued for the client
+void AsyncClient::_release_event_owner(){
+    _disarm_flush();
+    if(_owner != -1){
+        __atomic_add_fetch(&_event_owners[_owner], 1, __ATOMIC_ACQ_REL);
+        _owner = -1;
+    }
+}
+
+//Starts the deadline of the data held back, if not started yet. The user task (send) and the async
+//task (_recv) can both get here: only the one that sets the armed flag starts the timer.
+//Returns false when the data has no deadline running, the caller must flush it
+bool AsyncClient::_arm_flush(){
+    bool armed = false;
+    if(_owner == -1 || (!__atomic_load_n(&_tx_unsent, __ATOMIC_RELAXED) && !__atomic_load_n(&_rx_unreported, __ATOMIC_RELAXED))){
+        return false;
+    }
+    if(!__atomic_compare_exchange_n(&_tx_flush_armed, &armed, true, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)){
+        return true;
+    }
+    if(!_flush_timers[_owner]){
+        esp_timer_create_args_t args = {};
+        args.callback = &_tcp_flush_timer;
+        args.arg = (void *)(intptr_t)_owner;
+        args.name = "async_tcp_flush";
+        if(esp_timer_create(&args, &_flush_timers[_owner]) != ESP_OK){
+            log_e("failed to create flush timer");
+            __atomic_store_n(&_tx_flush_armed, false, __ATOMIC_RELEASE);
+            return false;
+        }
+    }
+    _flush_clients[_owner] = this;
+    _flush_generations[_owner] = _owner_generation;
+    //fails when a disarm has not stopped the timer yet: that stop would drop this deadline
+    if(esp_timer_start_once(_flush_timers[_owner], _tx_coalesce_deadline) != ESP_OK){
+        __atomic_store_n(&_tx_flush_armed, false, __ATOMIC_RELEASE);
+        return false;
+    }
+    return true;
+}
+
+void AsyncClient::_disarm_flush(){
+    if(__atomic_exchange_n(&_tx_flush_armed, false, __ATOMIC_ACQ_REL)){
+        esp_timer_stop(_flush_timers[_owner]);
+    }
+}
+
 /*
  * Private Callbacks
  * */
@@ -902,14 +1084,14 @@ int8_t AsyncClient::_lwip_fin(tcp_pcb* pcb, int8_t err) {
 
 //In Async Thread
 int8_t AsyncClient::_fin(tcp_pcb* pcb, int8_t err) {
-    _tcp_clear_events(this);
+    _release_event_owner();
     if(_discard_cb) {
         _discard_cb(_discard_cb_arg, this);
     }
     return ERR_OK;
 }
 
-int8_t AsyncClient::_sent(tcp_pcb* pcb, uint16_t len) {
+int8_t AsyncClient::_sent(tcp_pcb* pcb, uint32_t len) {
     _rx_last_packet = millis();
     //log_i("%u", len);
     _pcb_busy = false;
@@ -920,6 +1102,7 @@ int8_t AsyncClient::_sent(tcp_pcb* pcb, uint16_t len) {
 }
 
 int8_t AsyncClient::_recv(tcp_pcb* pcb, pbuf* pb, int8_t err) {
+    size_t received = 0;
     while(pb != NULL) {
         _rx_last_packet = millis();
         //we should not ack before we assimilate the data
@@ -936,11 +1119,22 @@ int8_t AsyncClient::_recv(tcp_pcb* pcb, pbuf* pb, int8_t err) {
             if(!_ack_pcb) {
                 _rx_ack_len += b->len;
             } else if(_pcb) {
-                _tcp_recved(_pcb, _closed_slot, b->len);
+                received += b->len;
             }
             pbuf_free(b);
         }
     }
+    //one window update for the whole chain, held back with the writes when they are coalesced
+    if(received && _pcb){
+        if(!_tx_coalesce_bytes){
+            _tcp_recved(_pcb, _closed_slot, received);
+        } else {
+            size_t unreported = __atomic_add_fetch(&_rx_unreported, received, __ATOMIC_ACQ_REL);
+            if(unreported >= _tx_coalesce_bytes || unreported >= tcp_mss(_pcb) || !_arm_flush()){
+                flush();
+            }
+        }
+    }
     return ERR_OK;
 }
 
@@ -1057,6 +1251,21 @@ bool AsyncClient::getNoDelay(){
     return tcp_nagle_disabled(_pcb);
 }
 
+void AsyncClient::setWriteCoalescing(size_t bytes, uint32_t deadline){
+    if(_tx_coalesce_bytes && !bytes){
+        flush();
+    }
+    _tx_coalesce_bytes = bytes;
+    _tx_coalesce_deadline = deadline;
+    if(bytes){
+        setNoDelay(true);
+    }
+}
+
+size_t AsyncClient::getWriteCoalescing(){
+    return _tx_coalesce_bytes;
+}
+
 uint16_t AsyncClient::getMss(){
     if(!_pcb) {
         return 0;
@@ -1218,7 +1427,7 @@ int8_t AsyncClient::_s_lwip_fin(void * arg, struct tcp_pcb * pcb, int8_t err) {
     return reinterpret_cast<AsyncClient*>(arg)->_lwip_fin(pcb, err);
 }
 
-int8_t AsyncClient::_s_sent(void * arg, struct tcp_pcb * pcb, uint16_t len) {
+int8_t AsyncClient::_s_sent(void * arg, struct tcp_pcb * pcb, uint32_t len) {
     return reinterpret_cast<AsyncClient*>(arg)->_sent(pcb, len);
 }
 
@@ -1230,6 +1439,15 @@ int8_t AsyncClient::_s_connected(void * arg, void * pcb, int8_t err){
     return reinterpret_cast<AsyncClient*>(arg)->_connected(pcb, err);
 }
 
+void AsyncClient::_s_flush(void * arg){
+    AsyncClient * client = reinterpret_cast<AsyncClient*>(arg);
+    if(__atomic_load_n(&client->_tx_unsent, __ATOMIC_RELAXED) || __atomic_load_n(&client->_rx_unreported, __ATOMIC_RELAXED)){
+        client->flush();
+    } else {
+        client->_disarm_flush();
+    }
+}
+
 /*
   Async TCP Server
  */
@@ -36,6 +36,10 @@ extern "C" {
 #define CONFIG_ASYNC_TCP_USE_WDT 1 //if enabled, adds between 33us and 200us per event
 #endif
 
+#ifndef CONFIG_ASYNC_TCP_QUEUE_SIZE
+#define CONFIG_ASYNC_TCP_QUEUE_SIZE 64 //events waiting for the async task, a power of 2
+#endif
+
 class AsyncClient;
 
 #define ASYNC_MAX_ACK_TIME 5000
@@ -76,6 +80,7 @@ class AsyncClient {
     size_t space();//space available in the TCP window
     size_t add(const char* data, size_t size, uint8_t apiflags=ASYNC_WRITE_FLAG_COPY);//add for sending
     bool send();//send all data added with the method above
+    bool flush();//send now what send() held back while coalescing
 
     //write equals add()+send()
     size_t write(const char* data);
@@ -99,6 +104,12 @@ class AsyncClient {
     void setNoDelay(bool nodelay);
     bool getNoDelay();
 
+    //coalesce small writes: send() holds the data back until bytes are waiting or the oldest waited
+    //deadline microseconds, and so do the window updates of received data. Disables Nagle, the
+    //deadline bounds the delay instead. 0 bytes (the default) sends at once
+    void setWriteCoalescing(size_t bytes, uint32_t deadline = 1000);
+    size_t getWriteCoalescing();
+
     uint32_t getRemoteAddress();
     uint16_t getRemotePort();
     uint32_t getLocalAddress();
@@ -132,16 +143,24 @@ class AsyncClient {
     static int8_t _s_fin(void *arg, struct tcp_pcb *tpcb, int8_t err);
     static int8_t _s_lwip_fin(void *arg, struct tcp_pcb *tpcb, int8_t err);
     static void _s_error(void *arg, int8_t err);
-    static int8_t _s_sent(void *arg, struct tcp_pcb *tpcb, uint16_t len);
+    static int8_t _s_sent(void *arg, struct tcp_pcb *tpcb, uint32_t len);
     static int8_t _s_connected(void* arg, void* tpcb, int8_t err);
     static void _s_dns_found(const char *name, struct ip_addr *ipaddr, void *arg);
+    static void _s_flush(void *arg);
 
     int8_t _recv(tcp_pcb* pcb, pbuf* pb, int8_t err);
     tcp_pcb * pcb(){ return _pcb; }
+    int8_t _event_owner(){ return _owner; }
+    uint32_t _event_generation(){ return _owner_generation; }
+    bool _add_sent(uint16_t len){ return __atomic_fetch_add(&_sent_pending, len, __ATOMIC_ACQ_REL) == 0; }
+    uint32_t _take_sent(){ return __atomic_exchange_n(&_sent_pending, 0, __ATOMIC_ACQ_REL); }
 
   protected:
     tcp_pcb* _pcb;
     int8_t  _closed_slot;
+    int8_t  _owner;
+    uint32_t _owner_generation;
+    uint32_t _sent_pending;
 
     AcConnectHandler _connect_cb;
     void* _connect_cb_arg;
@@ -169,16 +188,26 @@ class AsyncClient {
     uint32_t _ack_timeout;
     uint16_t _connect_port;
 
+    size_t _tx_coalesce_bytes;
+    uint32_t _tx_coalesce_deadline;
+    size_t _tx_unsent;
+    size_t _rx_unreported;
+    bool _tx_flush_armed;
+
     int8_t _close();
     void _free_closed_slot();
     void _allocate_closed_slot();
+    void _acquire_event_owner();
+    void _release_event_owner();
     int8_t _connected(void* pcb, int8_t err);
     void _error(int8_t err);
     int8_t _poll(tcp_pcb* pcb);
-    int8_t _sent(tcp_pcb* pcb, uint16_t len);
+    int8_t _sent(tcp_pcb* pcb, uint32_t len);
     int8_t _fin(tcp_pcb* pcb, int8_t err);
     int8_t _lwip_fin(tcp_pcb* pcb, int8_t err);
     void _dns_found(struct ip_addr *ipaddr);
+    bool _arm_flush();
+    void _disarm_flush();
 
   public:
     AsyncClient* prev;
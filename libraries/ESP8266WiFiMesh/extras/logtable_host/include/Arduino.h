@@ -0,0 +1,12 @@
+// Host stand-in for the Arduino core: only the clock used by TimeTracker.
+
+#ifndef LOGTABLE_HOST_ARDUINO_H
+#define LOGTABLE_HOST_ARDUINO_H
+
+#include <stdint.h>
+
+extern uint32_t hostMs; // Virtual clock, advanced by the test
+
+inline uint32_t millis() { return hostMs; }
+
+#endif // LOGTABLE_HOST_ARDUINO_H
@@ -0,0 +1,443 @@
+// ESP8266WiFiMesh ExpiringLogTable - host tests
+//
+// Random insertions, lookups, removals, expiry, capacity changes and clears
+// are applied to an ExpiringLogTable and to a std::map + insertion order list
+// model; contents and order must agree after every step. Values hold a heap
+// string, so 'make asan' catches entries that are not destroyed or are used
+// after removal. The FloodingMesh duplicate detection (messageID log with
+// reception redundancy) must give the same answers as the previous
+// std::map + std::queue of iterators implementation. In a busy mesh, the
+// EspnowDatabase sentRequests log at its default capacity must keep every
+// request until it is answered or expires.
+//
+// Then reports the host time per received message for the FloodingMesh
+// messageID log and for an EspnowDatabase request log (insert, duplicate check
+// and expiry every 500 ms), against the std::map versions.
+//
+// Usage: logtable_host [-n random operations] [-s seed]
+
+#include <Arduino.h>
+#include <ExpiringLogTable.h>
+#include <TimeTracker.h>
+#include <unistd.h>
+#include <chrono>
+#include <list>
+#include <map>
+#include <queue>
+#include <string>
+#include <vector>
+
+uint32_t hostMs;
+
+static int failures;
+
+#define CHECK(cond, ...)                                                                                               \
+  do {                                                                                                                 \
+    if (!(cond)) {                                                                                                     \
+      if (failures++ < 10) {                                                                                           \
+        printf("FAIL: " __VA_ARGS__);                                                                                  \
+        printf("\n");                                                                                                  \
+      }                                                                                                                \
+    }                                                                                                                  \
+  } while (0)
+
+static uint32_t rndState = 1;
+static uint32_t rnd(uint32_t n) {
+  rndState = rndState * 1103515245 + 12345;
+  return (rndState >> 8) % n;
+}
+
+/*
+ * Model test
+ */
+
+enum class macAndType_td : uint64_t {};
+typedef std::pair<macAndType_td, uint64_t> Key;
+
+struct Value {
+  Value(const std::string &text, uint32_t creationTimeMs) : text(text), timeTracker(creationTimeMs) {}
+  const TimeTracker &getTimeTracker() const { return timeTracker; }
+
+  std::string text;
+  TimeTracker timeTracker;
+};
+
+// Like RequestData: not assignable
+struct Request {
+  explicit Request(int &owner) : owner(owner), timeTracker(millis()) {}
+
+  int &owner;
+  TimeTracker timeTracker;
+};
+
+static std::string text(const Key &key) {
+  // Longer than the small string buffer, so every value owns heap memory
+  return "message " + std::to_string(static_cast<uint64_t>(key.first)) + "/" + std::to_string(key.second) +
+         " with some padding";
+}
+
+struct Model {
+  std::map<Key, std::string> entries;
+  std::list<std::pair<Key, uint32_t>> order; // key, creation time
+
+  void eraseOldest() {
+    entries.erase(order.front().first);
+    order.pop_front();
+  }
+  void erase(const Key &key) {
+    entries.erase(key);
+    for (auto it = order.begin(); it != order.end(); ++it)
+      if (it->first == key) {
+        order.erase(it);
+        break;
+      }
+  }
+};
+
+static bool same(ExpiringLogTable<Key, Value> &table, const Model &model) {
+  if (table.size() != model.entries.size())
+    return false;
+  std::vector<Key> keys;
+  table.eraseIf([&keys](const Key &key, const Value &) {
+    keys.push_back(key);
+    return false;
+  });
+  if (keys.size() != model.order.size())
+    return false;
+  auto it = model.order.begin();
+  for (const Key &key : keys) {
+    const Value *value = table.find(key);
+    if (key != it->first || !value || value->text != text(key) || value->timeTracker.creationTimeMs() != it->second)
+      return false;
+    ++it;
+  }
+  return true;
+}
+
+static void testModel(unsigned count) {
+  ExpiringLogTable<Key, Value> table(16);
+  Model model;
+  const uint32_t lifetimeMs = 300;
+
+  CHECK(!table.find(Key(macAndType_td(1), 1)) && table.empty(), "empty table");
+
+  for (unsigned n = 0; n < count; n++) {
+    Key key(macAndType_td(rnd(12)), rnd(40));
+    unsigned op = rnd(1000);
+    if (op < 600) {
+      hostMs += rnd(10);
+      auto result = table.emplace(key, text(key), hostMs);
+      bool existed = model.entries.count(key);
+      CHECK(result.first && result.second == !existed, "emplace %u", n);
+      if (!existed) {
+        if (model.entries.size() == table.capacity())
+          model.eraseOldest();
+        model.entries[key] = text(key);
+        model.order.emplace_back(key, hostMs);
+      }
+    } else if (op < 800) {
+      CHECK(table.count(key) == model.entries.count(key), "count %u", n);
+    } else if (op < 900) {
+      CHECK(table.erase(key) == model.entries.count(key), "erase %u", n);
+      model.erase(key);
+    } else if (op < 960) {
+      size_t erased = table.eraseExpired([lifetimeMs](const Key &, const Value &value) {
+        return value.getTimeTracker().timeSinceCreation() > lifetimeMs;
+      });
+      size_t expected = 0;
+      while (!model.order.empty() && hostMs - model.order.front().second > lifetimeMs) {
+        model.eraseOldest();
+        expected++;
+      }
+      CHECK(erased == expected, "eraseExpired %u: %zu, expected %zu", n, erased, expected);
+    } else if (op < 985) {
+      uint64_t mac = rnd(12);
+      table.eraseIf([mac](const Key &key, const Value &) { return static_cast<uint64_t>(key.first) == mac; });
+      for (auto it = model.order.begin(); it != model.order.end();) {
+        if (static_cast<uint64_t>(it->first.first) == mac) {
+          model.entries.erase(it->first);
+          it = model.order.erase(it);
+        } else
+          ++it;
+      }
+    } else if (op < 998) {
+      uint16_t capacity = 1 + rnd(40);
+      table.setCapacity(capacity);
+      while (model.entries.size() > capacity)
+        model.eraseOldest();
+    } else {
+      table.clear();
+      model.entries.clear();
+      model.order.clear();
+    }
+    CHECK(same(table, model), "table differs from the model after operation %u (%u)", n, op);
+  }
+
+  // Values which are only move/copy constructible
+  int owner = 0;
+  ExpiringLogTable<std::pair<uint64_t, uint64_t>, Request> requests(4);
+  for (uint64_t id = 0; id < 10; id++)
+    requests.emplace(std::make_pair(id % 3, id), owner);
+  requests.setCapacity(2);
+  CHECK(requests.size() == 2 && requests.find(std::make_pair(uint64_t(0), uint64_t(9))) &&
+            &requests.find(std::make_pair(uint64_t(0), uint64_t(9)))->owner == &owner,
+        "Request table");
+  CHECK(requests.eraseIf([](const std::pair<uint64_t, uint64_t> &, const Request &) { return true; }) == 2 &&
+            requests.empty(),
+        "Request eraseIf");
+}
+
+/*
+ * FloodingMesh messageID log
+ */
+
+static const uint8_t MESSAGE_COMPLETE = 255;
+
+// Previous implementation
+struct MapMessageLog {
+  explicit MapMessageLog(uint16_t size) : size(size) {}
+
+  bool insert(uint64_t messageID, uint8_t value, uint8_t redundancy) {
+    auto insertionResult = ids.emplace(messageID, value);
+    if (insertionResult.second) {
+      order.emplace(insertionResult.first);
+      if (ids.size() > size) {
+        ids.erase(order.front());
+        order.pop();
+      }
+    } else if (value == MESSAGE_COMPLETE && insertionResult.first->second < MESSAGE_COMPLETE)
+      insertionResult.first->second = MESSAGE_COMPLETE;
+    else if (value != MESSAGE_COMPLETE && insertionResult.first->second < redundancy)
+      insertionResult.first->second++;
+    else
+      return false;
+    return true;
+  }
+
+  std::map<uint64_t, uint8_t> ids;
+  std::queue<std::map<uint64_t, uint8_t>::iterator> order;
+  uint16_t size;
+};
+
+// As in FloodingMesh::insertPreliminaryMessageID and insertCompletedMessageID
+struct TableMessageLog {
+  explicit TableMessageLog(uint16_t size) : ids(size) {}
+
+  bool insert(uint64_t messageID, uint8_t value, uint8_t redundancy) {
+    auto insertionResult = ids.emplace(messageID, value);
+    if (insertionResult.second)
+      return true;
+    else if (value == MESSAGE_COMPLETE && *insertionResult.first < MESSAGE_COMPLETE)
+      *insertionResult.first = MESSAGE_COMPLETE;
+    else if (value != MESSAGE_COMPLETE && *insertionResult.first < redundancy)
+      (*insertionResult.first)++;
+    else
+      return false;
+    return true;
+  }
+
+  ExpiringLogTable<uint64_t, uint8_t> ids;
+};
+
+// Receptions of flooded messages: half of them new, the others repeats of recent ones
+struct Traffic {
+  explicit Traffic(unsigned nodes) : nodes(nodes), counters(nodes) {}
+
+  uint64_t next() {
+    if (recent.empty() || rnd(2)) {
+      unsigned origin = rnd(nodes);
+      uint64_t messageID = (uint64_t(0x5ccf7f000000 + origin) << 16) | counters[origin]++;
+      recent.push_back(messageID);
+      if (recent.size() > 3 * nodes)
+        recent.erase(recent.begin());
+      return messageID;
+    }
+    return recent[rnd(recent.size())];
+  }
+
+  unsigned nodes;
+  std::vector<uint16_t> counters;
+  std::vector<uint64_t> recent;
+};
+
+static void testMessageLog(unsigned count) {
+  for (uint16_t size : {1, 7, 100}) {
+    MapMessageLog before(size);
+    TableMessageLog after(size);
+    Traffic traffic(50);
+    for (unsigned n = 0; n < count; n++) {
+      uint64_t messageID = traffic.next();
+      uint8_t value = rnd(4) ? 0 : MESSAGE_COMPLETE;
+      bool expected = before.insert(messageID, value, 2);
+      CHECK(after.insert(messageID, value, 2) == expected, "message log (%u) differs at %u", size, n);
+    }
+    CHECK(after.ids.size() == before.ids.size(), "message log size");
+  }
+}
+
+/*
+ * Benchmarks
+ */
+
+template <typename Log> static double timeMessageLog(unsigned nodes, uint16_t size, unsigned count) {
+  Log log(size);
+  Traffic traffic(nodes);
+  std::vector<uint64_t> messageIDs;
+  for (unsigned n = 0; n < count; n++)
+    messageIDs.push_back(traffic.next());
+  auto start = std::chrono::steady_clock::now();
+  unsigned accepted = 0;
+  for (uint64_t messageID : messageIDs)
+    accepted += log.insert(messageID, 0, 2);
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  CHECK(accepted, "nothing accepted");
+  return ns / count;
+}
+
+// Requests from nodes * 4 per second, kept 2500 ms, cleared every 500 ms
+struct MapRequestLog {
+  explicit MapRequestLog(uint16_t) {}
+  bool receive(uint64_t mac, uint64_t messageID) {
+    if (entries.count(std::make_pair(mac, messageID)))
+      return false;
+    entries.insert(std::make_pair(std::make_pair(mac, messageID), TimeTracker(millis())));
+    return true;
+  }
+  void expire() {
+    for (auto it = entries.begin(); it != entries.end();) {
+      if (it->second.timeSinceCreation() > 2500)
+        it = entries.erase(it);
+      else
+        ++it;
+    }
+  }
+  std::map<std::pair<uint64_t, uint64_t>, TimeTracker> entries;
+};
+
+struct TableRequestLog {
+  explicit TableRequestLog(uint16_t capacity) : entries(capacity) {}
+  bool receive(uint64_t mac, uint64_t messageID) {
+    if (entries.count(std::make_pair(mac, messageID)))
+      return false;
+    entries.emplace(std::make_pair(mac, messageID), TimeTracker(millis()));
+    return true;
+  }
+  void expire() {
+    entries.eraseExpired([](const std::pair<uint64_t, uint64_t> &, const TimeTracker &entry) {
+      return entry.timeSinceCreation() > 2500;
+    });
+  }
+  ExpiringLogTable<std::pair<uint64_t, uint64_t>, TimeTracker> entries;
+};
+
+template <typename Log> static double timeRequestLog(unsigned nodes, unsigned count) {
+  Log log(nodes * 4 * 3);
+  std::vector<uint64_t> counters(nodes);
+  hostMs = 0;
+  uint32_t lastClearing = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned n = 0; n < count; n++) {
+    hostMs = uint64_t(n) * 1000 / (nodes * 4);
+    unsigned node = rnd(nodes);
+    log.receive(0x5ccf7f000000 + node, counters[node]++);
+    if (hostMs - lastClearing >= 500) {
+      log.expire();
+      lastClearing = hostMs;
+    }
+  }
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / count;
+}
+
+/*
+ * Busy mesh
+ */
+
+static const uint16_t espnowLogCapacity = 100; // defaultLogCapacity in EspnowDatabase.cpp
+static const uint64_t broadcastMac = 0xFFFFFFFFFFFF;
+
+// The sentRequests log of a node sending 20 requests per second, the rate logEntryLifetimeMs is based on
+// (40 transmissions in 2000 ms), one in four broadcast. Three peers answer a broadcast within the
+// broadcastResponseTimeoutMs of 1000 ms; one unicast request in four is never answered, the others within
+// 2400 ms, and the answer deletes the request. The log is cleared every 500 ms like
+// EspnowDatabase::clearOldLogEntries(). Returns the answers that did not find their request.
+static unsigned busyMeshLost(uint16_t capacity, unsigned seconds, uint16_t *peak) {
+  ExpiringLogTable<std::pair<uint64_t, uint64_t>, TimeTracker> sentRequests(capacity);
+  std::multimap<uint32_t, std::pair<uint64_t, uint64_t>> answers; // arrival time, request
+  uint64_t messageID = 0;
+  unsigned lost = 0;
+  *peak = 0;
+
+  for (hostMs = 0; hostMs < seconds * 1000; hostMs++) {
+    if (hostMs % 50 == 0) {
+      bool broadcast = messageID % 4 == 0;
+      std::pair<uint64_t, uint64_t> key(broadcast ? broadcastMac : 0x5ccf7f000000 + rnd(20), messageID++);
+      sentRequests.emplace(key, TimeTracker(millis()));
+      if (broadcast) {
+        for (int peer = 0; peer < 3; peer++)
+          answers.emplace(hostMs + 1 + rnd(999), key);
+      } else if (rnd(4)) {
+        answers.emplace(hostMs + 1 + rnd(2399), key);
+      }
+    }
+    for (auto it = answers.begin(); it != answers.end() && it->first == hostMs; it = answers.erase(it)) {
+      const TimeTracker *request = sentRequests.find(it->second);
+      if (!request) {
+        lost++;
+        continue;
+      }
+      if (it->second.first != broadcastMac)
+        sentRequests.erase(it->second);
+    }
+    if (hostMs % 500 == 0) {
+      sentRequests.eraseExpired([](const std::pair<uint64_t, uint64_t> &key, const TimeTracker &entry) {
+        return entry.timeSinceCreation() > (key.first == broadcastMac ? 1000 : 2500);
+      });
+    }
+    *peak = std::max(*peak, sentRequests.size());
+  }
+  return lost;
+}
+
+static void testBusyMesh() {
+  uint16_t peak, oldPeak;
+  unsigned lost = busyMeshLost(espnowLogCapacity, 600, &peak);
+  unsigned oldLost = busyMeshLost(32, 600, &oldPeak);
+  CHECK(lost == 0, "busy mesh: %u answers lost their request at capacity %u", lost, espnowLogCapacity);
+  CHECK(oldLost > 0, "busy mesh: no answer lost at capacity 32");
+  printf("busy mesh: %u answers lost at capacity %u (peak %u entries), %u at capacity 32\n", lost, espnowLogCapacity,
+         peak, oldLost);
+}
+
+int main(int argc, char **argv) {
+  unsigned count = 100000;
+  int opt;
+  while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+    if (opt == 'n')
+      count = strtoul(optarg, NULL, 0);
+    else if (opt == 's')
+      rndState = strtoul(optarg, NULL, 0);
+  }
+
+  testModel(count);
+  testMessageLog(count);
+  testBusyMesh();
+
+  printf("%-36s %10s %10s\n", "ns per received message", "std::map", "table");
+  for (unsigned nodes : {10, 50, 200}) {
+    for (uint16_t size : {100, 1000}) {
+      char what[64];
+      snprintf(what, sizeof(what), "messageID log %u, %u nodes", size, nodes);
+      double before = timeMessageLog<MapMessageLog>(nodes, size, 1000000);
+      printf("%-36s %10.1f %10.1f\n", what, before, timeMessageLog<TableMessageLog>(nodes, size, 1000000));
+    }
+  }
+  for (unsigned nodes : {10, 50, 200}) {
+    char what[64];
+    snprintf(what, sizeof(what), "request log, %u nodes", nodes);
+    double before = timeRequestLog<MapRequestLog>(nodes, 1000000);
+    printf("%-36s %10.1f %10.1f\n", what, before, timeRequestLog<TableRequestLog>(nodes, 1000000));
+  }
+
+  printf(failures ? "%d FAILED\n" : "all passed\n", failures);
+  return failures ? 1 : 0;
+}
@@ -41,9 +41,14 @@ namespace
   std::list<ResponseData> _responsesToSend = {};
   std::list<PeerRequestLog> _peerRequestConfirmationsToSend = {};
 
-  std::map<std::pair<macAndType_td, messageID_td>, MessageData> _receivedEspnowTransmissions = {};
-  std::map<std::pair<peerMac_td, messageID_td>, RequestData> _sentRequests = {};
-  std::map<std::pair<peerMac_td, messageID_td>, TimeTracker> _receivedRequests = {};
+  // Fixed capacity logs, see setLogCapacity(). The storage of a log is only allocated when it is used.
+  // The capacity must hold every entry of _logEntryLifetimeMs plus the clearing cooldown: 100 holds 3000 ms
+  // of 33 transmissions per second, above the rate _logEntryLifetimeMs is based on. Same as the FloodingMesh messageLogSize.
+  // All entries of a log are allocated at once: about 13 kB of ESP8266 heap for the three logs (see EspnowMeshBackend::setLogCapacity()).
+  constexpr uint16_t defaultLogCapacity = 100;
+  EspnowDatabase::transmissionLog_td _receivedEspnowTransmissions(defaultLogCapacity);
+  EspnowDatabase::sentRequestLog_td _sentRequests(defaultLogCapacity);
+  EspnowDatabase::receivedRequestLog_td _receivedRequests(defaultLogCapacity);
 
   std::shared_ptr<bool> _espnowConnectionQueueMutex = std::make_shared<bool>(false);
   std::shared_ptr<bool> _responsesToSendMutex = std::make_shared<bool>(false);
@@ -93,51 +98,36 @@ uint32_t EspnowDatabase::criticalHeapLevel()
 }
 
 template <typename T, typename U>
-void EspnowDatabase::deleteExpiredLogEntries(std::map<std::pair<U, uint64_t>, T> &logEntries, const uint32_t maxEntryLifetimeMs)
+void EspnowDatabase::deleteExpiredLogEntries(ExpiringLogTable<std::pair<U, uint64_t>, T> &logEntries, const uint32_t maxEntryLifetimeMs)
 {
-  for(typename std::map<std::pair<U, uint64_t>, T>::iterator entryIterator = logEntries.begin(); 
-      entryIterator != logEntries.end(); )
+  // Entries are stored in creation order, so only the expired ones are visited.
+  logEntries.eraseExpired([maxEntryLifetimeMs](const std::pair<U, uint64_t> &, const T &entry)
   {
-    if(entryIterator->second.getTimeTracker().timeSinceCreation() > maxEntryLifetimeMs)
-    {
-      entryIterator = logEntries.erase(entryIterator);
-    }
-    else
-      ++entryIterator;
-  }
+    return entry.getTimeTracker().timeSinceCreation() > maxEntryLifetimeMs;
+  });
 }
 
 template <typename U>
-void EspnowDatabase::deleteExpiredLogEntries(std::map<std::pair<U, uint64_t>, TimeTracker> &logEntries, const uint32_t maxEntryLifetimeMs)
+void EspnowDatabase::deleteExpiredLogEntries(ExpiringLogTable<std::pair<U, uint64_t>, TimeTracker> &logEntries, const uint32_t maxEntryLifetimeMs)
 {
-  for(typename std::map<std::pair<U, uint64_t>, TimeTracker>::iterator entryIterator = logEntries.begin(); 
-      entryIterator != logEntries.end(); )
+  logEntries.eraseExpired([maxEntryLifetimeMs](const std::pair<U, uint64_t> &, const TimeTracker &entry)
   {
-    if(entryIterator->second.timeSinceCreation() > maxEntryLifetimeMs)
-    {
-      entryIterator = logEntries.erase(entryIterator);
-    }
-    else
-      ++entryIterator;
-  }
+    return entry.timeSinceCreation() > maxEntryLifetimeMs;
+  });
 }
 
-void EspnowDatabase::deleteExpiredLogEntries(std::map<std::pair<peerMac_td, messageID_td>, RequestData> &logEntries, const uint32_t requestLifetimeMs, const uint32_t broadcastLifetimeMs)
+void EspnowDatabase::deleteExpiredLogEntries(sentRequestLog_td &logEntries, const uint32_t requestLifetimeMs, const uint32_t broadcastLifetimeMs)
 {
-  for(typename std::map<std::pair<peerMac_td, messageID_td>, RequestData>::iterator entryIterator = logEntries.begin(); 
-      entryIterator != logEntries.end(); )
+  // An expired broadcast entry behind a request which has not expired yet stays until that request expires, 
+  // but getOwnerOfSentRequest() no longer accepts it.
+  logEntries.eraseExpired([requestLifetimeMs, broadcastLifetimeMs](const std::pair<peerMac_td, messageID_td> &key, const RequestData &entry)
   {
-    bool broadcast = entryIterator->first.first == EspnowProtocolInterpreter::uint64BroadcastMac;
-    uint32_t timeSinceCreation = entryIterator->second.getTimeTracker().timeSinceCreation();
+    bool broadcast = key.first == EspnowProtocolInterpreter::uint64BroadcastMac;
+    uint32_t timeSinceCreation = entry.getTimeTracker().timeSinceCreation();
     
-    if((!broadcast && timeSinceCreation > requestLifetimeMs) 
-        || (broadcast && timeSinceCreation > broadcastLifetimeMs))
-    {
-      entryIterator = logEntries.erase(entryIterator);
-    }
-    else
-      ++entryIterator;
-  }
+    return (!broadcast && timeSinceCreation > requestLifetimeMs) 
+           || (broadcast && timeSinceCreation > broadcastLifetimeMs);
+  });
 }
 
 template <typename T>
@@ -183,6 +173,14 @@ void EspnowDatabase::setBroadcastResponseTimeoutMs(const uint32_t broadcastRespo
 }
 uint32_t EspnowDatabase::broadcastResponseTimeoutMs() { return _broadcastResponseTimeoutMs; }
 
+void EspnowDatabase::setLogCapacity(const uint16_t logCapacity)
+{
+  receivedEspnowTransmissions().setCapacity(logCapacity);
+  sentRequests().setCapacity(logCapacity);
+  receivedRequests().setCapacity(logCapacity);
+}
+uint16_t EspnowDatabase::logCapacity() { return receivedRequests().capacity(); }
+
 String EspnowDatabase::getScheduledResponseMessage(const uint32_t responseIndex)
 {
   return getScheduledResponse(responseIndex)->getMessage();
@@ -332,21 +330,22 @@ MutexTracker EspnowDatabase::captureResponsesToSendMutex(const std::function<voi
 
 void EspnowDatabase::storeSentRequest(const uint64_t targetBSSID, const uint64_t messageID, const RequestData &requestData)
 {
-  sentRequests().insert(std::make_pair(std::make_pair(targetBSSID, messageID), requestData));
+  sentRequests().emplace(std::make_pair(targetBSSID, messageID), requestData);
 }
 
 void EspnowDatabase::storeReceivedRequest(const uint64_t senderBSSID, const uint64_t messageID, const TimeTracker &timeTracker)
 {
-  receivedRequests().insert(std::make_pair(std::make_pair(senderBSSID, messageID), timeTracker));
+  receivedRequests().emplace(std::make_pair(senderBSSID, messageID), timeTracker);
 }
 
 EspnowMeshBackend *EspnowDatabase::getOwnerOfSentRequest(const uint64_t requestMac, const uint64_t requestID)
 {
-  std::map<std::pair<peerMac_td, messageID_td>, RequestData>::iterator sentRequest = sentRequests().find(std::make_pair(requestMac, requestID));
+  const RequestData *sentRequest = sentRequests().find(std::make_pair(requestMac, requestID));
   
-  if(sentRequest != sentRequests().end())
+  if(sentRequest && (requestMac != EspnowProtocolInterpreter::uint64BroadcastMac 
+                     || sentRequest->getTimeTracker().timeSinceCreation() <= broadcastResponseTimeoutMs()))
   {
-    return &sentRequest->second.getMeshInstance();
+    return &sentRequest->getMeshInstance();
   }
   
   return nullptr;
@@ -359,25 +358,14 @@ size_t EspnowDatabase::deleteSentRequest(const uint64_t requestMac, const uint64
 
 size_t EspnowDatabase::deleteSentRequestsByOwner(const EspnowMeshBackend *instancePointer)
 {
-  size_t numberDeleted = 0;
-  
-  for(std::map<std::pair<peerMac_td, messageID_td>, RequestData>::iterator requestIterator = sentRequests().begin(); 
-      requestIterator != sentRequests().end(); )
+  return sentRequests().eraseIf([instancePointer](const std::pair<peerMac_td, messageID_td> &, const RequestData &request)
   {
-    if(&requestIterator->second.getMeshInstance() == instancePointer) // If instance at instancePointer made the request
-    {
-      requestIterator = sentRequests().erase(requestIterator);
-      numberDeleted++;
-    }
-    else
-      ++requestIterator;
-  }
-
-  return numberDeleted;
+    return &request.getMeshInstance() == instancePointer; // If instance at instancePointer made the request
+  });
 }
 
 std::list<ResponseData> & EspnowDatabase::responsesToSend() { return _responsesToSend; }
 std::list<PeerRequestLog> & EspnowDatabase::peerRequestConfirmationsToSend() { return _peerRequestConfirmationsToSend; }
-std::map<std::pair<macAndType_td, messageID_td>, MessageData> & EspnowDatabase::receivedEspnowTransmissions() { return _receivedEspnowTransmissions; }
-std::map<std::pair<peerMac_td, messageID_td>, RequestData> & EspnowDatabase::sentRequests() { return _sentRequests; }
-std::map<std::pair<peerMac_td, messageID_td>, TimeTracker> & EspnowDatabase::receivedRequests() { return _receivedRequests; }
+EspnowDatabase::transmissionLog_td & EspnowDatabase::receivedEspnowTransmissions() { return _receivedEspnowTransmissions; }
+EspnowDatabase::sentRequestLog_td & EspnowDatabase::sentRequests() { return _sentRequests; }
+EspnowDatabase::receivedRequestLog_td & EspnowDatabase::receivedRequests() { return _receivedRequests; }
@@ -24,7 +24,7 @@
 #include "RequestData.h"
 #include "EspnowProtocolInterpreter.h"
 #include <list>
-#include <map>
+#include "ExpiringLogTable.h"
 #include "MessageData.h"
 #include "MutexTracker.h"
 #include "PeerRequestLog.h"
@@ -50,6 +50,13 @@ public:
   static uint32_t logEntryLifetimeMs();
   static void setBroadcastResponseTimeoutMs(const uint32_t broadcastResponseTimeoutMs);
   static uint32_t broadcastResponseTimeoutMs();
+
+  /**
+   * Set the maximum number of entries in each of the receivedEspnowTransmissions, sentRequests and receivedRequests logs. Defaults to 100,
+   * about 13 kB of heap once all three logs are used. Also see EspnowMeshBackend::setLogCapacity() for the RAM cost per entry.
+   */
+  static void setLogCapacity(const uint16_t logCapacity);
+  static uint16_t logCapacity();
   static String getScheduledResponseMessage(const uint32_t responseIndex);
   static const uint8_t *getScheduledResponseRecipient(const uint32_t responseIndex);
   static uint32_t numberOfScheduledResponses();
@@ -69,12 +76,16 @@ public:
   using messageID_td = EspnowProtocolInterpreter::messageID_td;
   using peerMac_td = EspnowProtocolInterpreter::peerMac_td;
 
+  using transmissionLog_td = ExpiringLogTable<std::pair<macAndType_td, messageID_td>, MessageData>;
+  using sentRequestLog_td = ExpiringLogTable<std::pair<peerMac_td, messageID_td>, RequestData>;
+  using receivedRequestLog_td = ExpiringLogTable<std::pair<peerMac_td, messageID_td>, TimeTracker>;
+
   static size_t deleteSentRequestsByOwner(const EspnowMeshBackend *instancePointer);
   static std::list<ResponseData> & responsesToSend();
   static std::list<PeerRequestLog> & peerRequestConfirmationsToSend();
-  static std::map<std::pair<macAndType_td, messageID_td>, MessageData> & receivedEspnowTransmissions();
-  static std::map<std::pair<peerMac_td, messageID_td>, RequestData> & sentRequests();
-  static std::map<std::pair<peerMac_td, messageID_td>, TimeTracker> & receivedRequests();
+  static transmissionLog_td & receivedEspnowTransmissions();
+  static sentRequestLog_td & sentRequests();
+  static receivedRequestLog_td & receivedRequests();
   
   static bool requestReceived(const uint64_t requestMac, const uint64_t requestID);
 
@@ -127,67 +138,33 @@ public:
   uint8 getWiFiChannel() const;
   
   /**
-   * Remove all entries which target peerMac in the logEntries map.
+   * Remove all entries which target peerMac in the logEntries table.
    * Optionally deletes only entries sent/received by encrypted transmissions.
    * 
-   * @param logEntries The map to process.
+   * @param logEntries The table to process.
    * @param peerMac The MAC address of the peer node.
    * @param encryptedOnly If true, only entries sent/received by encrypted transmissions will be deleted.
    */
   template <typename T>
-  static void deleteEntriesByMac(std::map<std::pair<macAndType_td, uint64_t>, T> &logEntries, const uint8_t *peerMac, const bool encryptedOnly)
-  {    
-    bool macFound = false;
+  static void deleteEntriesByMac(ExpiringLogTable<std::pair<macAndType_td, uint64_t>, T> &logEntries, const uint8_t *peerMac, const bool encryptedOnly)
+  {
+    uint64_t uint64PeerMac = MeshTypeConversionFunctions::macToUint64(peerMac);
     
-    for(typename std::map<std::pair<macAndType_td, uint64_t>, T>::iterator entryIterator = logEntries.begin(); 
-        entryIterator != logEntries.end(); )
+    logEntries.eraseIf([uint64PeerMac, encryptedOnly](const std::pair<macAndType_td, uint64_t> &key, const T &)
     {
-      if(macAndTypeToUint64Mac(entryIterator->first.first) == MeshTypeConversionFunctions::macToUint64(peerMac))
-      {
-        macFound = true;
-           
-        if(!encryptedOnly || EspnowProtocolInterpreter::usesEncryption(entryIterator->first.second))
-        {
-          entryIterator = logEntries.erase(entryIterator);
-          continue;
-        }
-      }
-      else if(macFound)
-      {
-        // Since the map is sorted by MAC, we know here that no more matching MAC will be found.
-        return;
-      }
-  
-      ++entryIterator;
-    }
+      return EspnowProtocolInterpreter::macAndTypeToUint64Mac(key.first) == uint64PeerMac && (!encryptedOnly || EspnowProtocolInterpreter::usesEncryption(key.second));
+    });
   }
   
   template <typename T>
-  static void deleteEntriesByMac(std::map<std::pair<uint64_t, uint64_t>, T> &logEntries, const uint8_t *peerMac, const bool encryptedOnly)
-  {    
-    bool macFound = false;
+  static void deleteEntriesByMac(ExpiringLogTable<std::pair<uint64_t, uint64_t>, T> &logEntries, const uint8_t *peerMac, const bool encryptedOnly)
+  {
+    uint64_t uint64PeerMac = MeshTypeConversionFunctions::macToUint64(peerMac);
     
-    for(typename std::map<std::pair<uint64_t, uint64_t>, T>::iterator entryIterator = logEntries.begin(); 
-        entryIterator != logEntries.end(); )
+    logEntries.eraseIf([uint64PeerMac, encryptedOnly](const std::pair<uint64_t, uint64_t> &key, const T &)
     {
-      if(entryIterator->first.first == MeshTypeConversionFunctions::macToUint64(peerMac))
-      {
-        macFound = true;
-           
-        if(!encryptedOnly || EspnowProtocolInterpreter::usesEncryption(entryIterator->first.second))
-        {
-          entryIterator = logEntries.erase(entryIterator);
-          continue;
-        }
-      }
-      else if(macFound)
-      {
-        // Since the map is sorted by MAC, we know here that no more matching MAC will be found.
-        return;
-      }
-  
-      ++entryIterator;
-    }
+      return key.first == uint64PeerMac && (!encryptedOnly || EspnowProtocolInterpreter::usesEncryption(key.second));
+    });
   }
 
 protected:
@@ -204,12 +181,12 @@ private:
   uint32_t _autoEncryptionDuration = 50;
   
   template <typename T, typename U>
-  static void deleteExpiredLogEntries(std::map<std::pair<U, uint64_t>, T> &logEntries, const uint32_t maxEntryLifetimeMs);
+  static void deleteExpiredLogEntries(ExpiringLogTable<std::pair<U, uint64_t>, T> &logEntries, const uint32_t maxEntryLifetimeMs);
 
   template <typename U>
-  static void deleteExpiredLogEntries(std::map<std::pair<U, uint64_t>, TimeTracker> &logEntries, const uint32_t maxEntryLifetimeMs);
+  static void deleteExpiredLogEntries(ExpiringLogTable<std::pair<U, uint64_t>, TimeTracker> &logEntries, const uint32_t maxEntryLifetimeMs);
 
-  static void deleteExpiredLogEntries(std::map<std::pair<peerMac_td, messageID_td>, RequestData> &logEntries, const uint32_t requestLifetimeMs, const uint32_t broadcastLifetimeMs);
+  static void deleteExpiredLogEntries(sentRequestLog_td &logEntries, const uint32_t requestLifetimeMs, const uint32_t broadcastLifetimeMs);
 
   template <typename T>
   static void deleteExpiredLogEntries(std::list<T> &logEntries, const uint32_t maxEntryLifetimeMs);
@@ -492,8 +492,7 @@ bool EspnowEncryptionBroker::verifyPeerSessionKey(const uint64_t sessionKey, con
   if(usesEncryption(sessionKey))
   {
     if(sessionKey == encryptedConnection.getPeerSessionKey() 
-       || EspnowDatabase::receivedEspnowTransmissions().find(std::make_pair(createMacAndTypeValue(uint64PeerMac, messageType), sessionKey)) 
-          != EspnowDatabase::receivedEspnowTransmissions().end())
+       || EspnowDatabase::receivedEspnowTransmissions().count(std::make_pair(createMacAndTypeValue(uint64PeerMac, messageType), sessionKey)))
     {
       // If sessionKey is correct or sessionKey is one part of a multi-part transmission.
       return true;
@@ -390,7 +390,7 @@ void EspnowMeshBackend::espnowReceiveCallback(const uint8_t *macaddr, uint8_t *d
     if(messageType == 'B')
     {
       auto key = std::make_pair(macAndType, messageID);
-      if(EspnowDatabase::receivedEspnowTransmissions().find(key) != EspnowDatabase::receivedEspnowTransmissions().end())
+      if(EspnowDatabase::receivedEspnowTransmissions().count(key))
         return; // Should not call BroadcastFilter more than once for an accepted message
       
       String message = getHashKeyLength(dataArray, len);
@@ -402,7 +402,7 @@ void EspnowMeshBackend::espnowReceiveCallback(const uint8_t *macaddr, uint8_t *d
       if(acceptBroadcast)
       {
         // Does nothing if key already in receivedEspnowTransmissions
-        EspnowDatabase::receivedEspnowTransmissions().insert(std::make_pair(key, MessageData(message, getTransmissionsRemaining(dataArray))));
+        EspnowDatabase::receivedEspnowTransmissions().emplace(key, message, getTransmissionsRemaining(dataArray));
       }
       else
       {
@@ -412,28 +412,28 @@ void EspnowMeshBackend::espnowReceiveCallback(const uint8_t *macaddr, uint8_t *d
     else
     {  
       // Does nothing if key already in receivedEspnowTransmissions
-      EspnowDatabase::receivedEspnowTransmissions().insert(std::make_pair(std::make_pair(macAndType, messageID), MessageData(dataArray, len)));
+      EspnowDatabase::receivedEspnowTransmissions().emplace(std::make_pair(macAndType, messageID), dataArray, len);
     }
   }
   else
   {
-    std::map<std::pair<macAndType_td, messageID_td>, MessageData>::iterator storedMessageIterator = EspnowDatabase::receivedEspnowTransmissions().find(std::make_pair(macAndType, messageID));
+    MessageData *storedMessage = EspnowDatabase::receivedEspnowTransmissions().find(std::make_pair(macAndType, messageID));
 
-    if(storedMessageIterator == EspnowDatabase::receivedEspnowTransmissions().end()) // If we have not stored the key already, we missed the first message part.
+    if(!storedMessage) // If we have not stored the key already, we missed the first message part.
     {
       return;
     }
     
-    if(!storedMessageIterator->second.addToMessage(dataArray, len))
+    if(!storedMessage->addToMessage(dataArray, len))
     {
       // If we received the wrong message part, remove the whole message if we have missed a part.
       // Otherwise just ignore the received part since it has already been stored.
       
-      uint8_t transmissionsRemainingExpected = storedMessageIterator->second.getTransmissionsRemaining() - 1;
+      uint8_t transmissionsRemainingExpected = storedMessage->getTransmissionsRemaining() - 1;
       
       if(transmissionsRemaining < transmissionsRemainingExpected)
       {
-        EspnowDatabase::receivedEspnowTransmissions().erase(storedMessageIterator);
+        EspnowDatabase::receivedEspnowTransmissions().erase(std::make_pair(macAndType, messageID));
         return;
       }
     }
@@ -446,13 +446,13 @@ void EspnowMeshBackend::espnowReceiveCallback(const uint8_t *macaddr, uint8_t *d
     return;
   }
 
-  std::map<std::pair<macAndType_td, messageID_td>, MessageData>::iterator storedMessageIterator = EspnowDatabase::receivedEspnowTransmissions().find(std::make_pair(macAndType, messageID));
-  assert(storedMessageIterator != EspnowDatabase::receivedEspnowTransmissions().end());
+  MessageData *storedMessage = EspnowDatabase::receivedEspnowTransmissions().find(std::make_pair(macAndType, messageID));
+  assert(storedMessage);
 
   // Copy totalMessage in case user callbacks (request/responseHandler) do something odd with receivedEspnowTransmissions list.
-  String totalMessage = storedMessageIterator->second.getTotalMessage(); // https://stackoverflow.com/questions/134731/returning-a-const-reference-to-an-object-instead-of-a-copy It is likely that most compilers will perform Named Value Return Value Optimisation in this case
+  String totalMessage = storedMessage->getTotalMessage(); // https://stackoverflow.com/questions/134731/returning-a-const-reference-to-an-object-instead-of-a-copy It is likely that most compilers will perform Named Value Return Value Optimisation in this case
 
-  EspnowDatabase::receivedEspnowTransmissions().erase(storedMessageIterator); // Erase the extra copy of the totalMessage, to save RAM. 
+  EspnowDatabase::receivedEspnowTransmissions().erase(std::make_pair(macAndType, messageID)); // Erase the extra copy of the totalMessage, to save RAM. 
    
   //Serial.println("methodStart erase done " + String(millis() - methodStart));
   
@@ -528,6 +528,12 @@ void EspnowMeshBackend::setBroadcastResponseTimeoutMs(const uint32_t broadcastRe
 }
 uint32_t EspnowMeshBackend::broadcastResponseTimeoutMs() { return EspnowDatabase::broadcastResponseTimeoutMs(); }
 
+void EspnowMeshBackend::setLogCapacity(const uint16_t logCapacity)
+{
+  EspnowDatabase::setLogCapacity(logCapacity);
+}
+uint16_t EspnowMeshBackend::logCapacity() { return EspnowDatabase::logCapacity(); }
+
 void EspnowMeshBackend::setCriticalHeapLevelBuffer(const uint32_t bufferInBytes)
 {
   EspnowDatabase::setCriticalHeapLevelBuffer(bufferInBytes);
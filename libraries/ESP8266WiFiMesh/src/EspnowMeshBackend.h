@@ -355,6 +355,25 @@ public:
   static void setBroadcastResponseTimeoutMs(const uint32_t broadcastResponseTimeoutMs);
   static uint32_t broadcastResponseTimeoutMs();
 
+  /**
+   * Set the maximum number of entries in each of the logs of received transmissions, sent requests and received requests.
+   * The memory of a log is reserved when it is first used. When a log is full, a new entry replaces the oldest one.
+   * Setting the capacity too high wastes RAM.
+   * Setting the capacity too low may cause ESP-NOW transmissions to stop working, or make the node receive the same transmission multiple times,
+   * if the peers send more transmissions than that during logEntryLifetimeMs().
+   * 
+   * RAM cost on the ESP8266: all entries of a log are allocated at once, about 48 bytes per entry for the received transmissions log,
+   * 40 for the sent requests log and 32 for the received requests log, plus 2 bytes per hash slot (a power of two at least twice the capacity).
+   * At the default capacity that is about 5.3 kB, 4.5 kB and 3.7 kB, so about 13 kB of heap once all three logs are used.
+   * Nodes with little traffic can save most of it with a smaller capacity.
+   * 
+   * Set to 100 by default.
+   * 
+   * @param logCapacity The maximum number of entries per log. Valid values are 1 to 65534.
+   */
+  static void setLogCapacity(const uint16_t logCapacity);
+  static uint16_t logCapacity();
+
   /** 
    * Change the key used by this EspnowMeshBackend instance for creating encrypted ESP-NOW connections.
    * Will apply to any new received requests for encrypted connection if this EspnowMeshBackend instance is the current request manager. 
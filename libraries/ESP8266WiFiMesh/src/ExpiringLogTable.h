@@ -0,0 +1,376 @@
+/*
+  ExpiringLogTable - fixed capacity log of keyed entries, for duplicate detection and expiry of mesh transmissions.
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#ifndef __EXPIRINGLOGTABLE_H__
+#define __EXPIRINGLOGTABLE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * A hash table with a fixed number of entries, which also keeps the entries in insertion order.
+ *
+ * Lookup, insertion and removal are O(1): the keys are found by open addressing (linear probing, removal by backward shift)
+ * in an index which is at most half full. The entries are linked from the oldest to the newest, so when all entries of a log
+ * live equally long the expired ones are always at the old end and eraseExpired() only touches those. When the table is full,
+ * inserting a new entry drops the oldest one.
+ *
+ * The storage for all entries is allocated on the first insertion (or by setCapacity() when entries exist),
+ * there are no allocations per entry. Pointers to values stay valid until the entry is removed.
+ *
+ * K must be an integer, an enum or a std::pair of those. V needs to be move constructible only if setCapacity() is used with entries in the table.
+ */
+template <typename K, typename V>
+class ExpiringLogTable {
+
+public:
+
+  static constexpr uint16_t maxCapacity = 0xFFFE;
+
+  /**
+   * @param capacity The maximum number of entries. Valid values are 1 to maxCapacity.
+   */
+  explicit ExpiringLogTable(const uint16_t capacity) : _capacity(limitCapacity(capacity)) {}
+
+  ~ExpiringLogTable()
+  {
+    clear();
+    delete[] _nodes;
+    delete[] _slots;
+  }
+
+  ExpiringLogTable(const ExpiringLogTable &) = delete;
+  ExpiringLogTable &operator=(const ExpiringLogTable &) = delete;
+
+  uint16_t capacity() const { return _capacity; }
+  uint16_t size() const { return _size; }
+  bool empty() const { return _size == 0; }
+
+  /**
+   * Change the maximum number of entries. The newest entries are kept.
+   */
+  void setCapacity(const uint16_t capacity)
+  {
+    uint16_t newCapacity = limitCapacity(capacity);
+
+    if(!_nodes)
+    {
+      _capacity = newCapacity;
+      return;
+    }
+
+    Node *oldNodes = _nodes;
+    uint16_t *oldSlots = _slots;
+    uint16_t oldest = _oldest;
+    uint16_t oldSize = _size;
+
+    _nodes = nullptr;
+    _slots = nullptr;
+    _capacity = newCapacity;
+    reset();
+    allocate();
+
+    for(uint16_t nodeIndex = oldest; nodeIndex != none; )
+    {
+      Entry &entry = oldNodes[nodeIndex].entry();
+      uint16_t newer = oldNodes[nodeIndex].newer;
+
+      if(oldSize-- <= _capacity)
+        insertEntry(std::move(entry.key), std::move(entry.value));
+
+      entry.~Entry();
+      nodeIndex = newer;
+    }
+
+    delete[] oldNodes;
+    delete[] oldSlots;
+  }
+
+  /**
+   * @return A pointer to the value stored for key, or nullptr if there is none.
+   */
+  V *find(const K &key)
+  {
+    uint32_t slot = findSlot(key);
+    return slot == noSlot ? nullptr : &_nodes[_slots[slot] - 1].entry().value;
+  }
+
+  const V *find(const K &key) const
+  {
+    uint32_t slot = findSlot(key);
+    return slot == noSlot ? nullptr : &_nodes[_slots[slot] - 1].entry().value;
+  }
+
+  size_t count(const K &key) const { return findSlot(key) == noSlot ? 0 : 1; }
+
+  /**
+   * Store a value constructed from valueArguments for key, unless key is already in the table. Drops the oldest entry if the table is full.
+   *
+   * @return A pointer to the value stored for key and true if the value was inserted, false if key already existed.
+   */
+  template <typename... Args>
+  std::pair<V *, bool> emplace(const K &key, Args&&... valueArguments)
+  {
+    if(V *value = find(key))
+      return std::make_pair(value, false);
+
+    if(!_nodes)
+      allocate();
+
+    return std::make_pair(insertEntry(key, std::forward<Args>(valueArguments)...), true);
+  }
+
+  /**
+   * @return The number of entries removed (0 or 1).
+   */
+  size_t erase(const K &key)
+  {
+    uint32_t slot = findSlot(key);
+    if(slot == noSlot)
+      return 0;
+
+    eraseNode(_slots[slot] - 1, slot);
+    return 1;
+  }
+
+  void clear()
+  {
+    for(uint16_t nodeIndex = _oldest; nodeIndex != none; nodeIndex = _nodes[nodeIndex].newer)
+      _nodes[nodeIndex].entry().~Entry();
+
+    if(_nodes)
+      reset();
+  }
+
+  /**
+   * Remove entries from the oldest one on, until isExpired(key, value) returns false for an entry.
+   *
+   * @return The number of entries removed.
+   */
+  template <typename F>
+  size_t eraseExpired(F isExpired)
+  {
+    size_t numberDeleted = 0;
+
+    while(_oldest != none && isExpired(_nodes[_oldest].entry().key, _nodes[_oldest].entry().value))
+    {
+      eraseNode(_oldest);
+      numberDeleted++;
+    }
+
+    return numberDeleted;
+  }
+
+  /**
+   * Remove all entries for which shouldErase(key, value) returns true. Visits every entry.
+   *
+   * @return The number of entries removed.
+   */
+  template <typename F>
+  size_t eraseIf(F shouldErase)
+  {
+    size_t numberDeleted = 0;
+
+    for(uint16_t nodeIndex = _oldest; nodeIndex != none; )
+    {
+      uint16_t newer = _nodes[nodeIndex].newer;
+
+      if(shouldErase(_nodes[nodeIndex].entry().key, _nodes[nodeIndex].entry().value))
+      {
+        eraseNode(nodeIndex);
+        numberDeleted++;
+      }
+
+      nodeIndex = newer;
+    }
+
+    return numberDeleted;
+  }
+
+private:
+
+  struct Entry {
+    template <typename KeyType, typename... Args>
+    Entry(KeyType &&entryKey, Args&&... valueArguments) : key(std::forward<KeyType>(entryKey)), value(std::forward<Args>(valueArguments)...) {}
+
+    K key;
+    V value;
+  };
+
+  // Entries are constructed in place when inserted. Free nodes are linked through newer.
+  struct Node {
+    Entry &entry() { return *reinterpret_cast<Entry *>(&storage); }
+    const Entry &entry() const { return *reinterpret_cast<const Entry *>(&storage); }
+
+    typename std::aligned_storage<sizeof(Entry), alignof(Entry)>::type storage;
+    uint16_t older;
+    uint16_t newer;
+  };
+
+  static constexpr uint16_t none = 0xFFFF;
+  static constexpr uint32_t noSlot = 0xFFFFFFFF;
+
+  static uint16_t limitCapacity(const uint16_t capacity)
+  {
+    if(capacity < 1)
+      return 1;
+    if(capacity > maxCapacity)
+      return maxCapacity;
+
+    return capacity;
+  }
+
+  // MurmurHash3 finalizer
+  static uint32_t hashValue(uint64_t value)
+  {
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDULL;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ULL;
+    value ^= value >> 33;
+    return static_cast<uint32_t>(value);
+  }
+
+  template <typename T>
+  static uint32_t hashKey(const T &key) { return hashValue(static_cast<uint64_t>(key)); }
+
+  template <typename T, typename U>
+  static uint32_t hashKey(const std::pair<T, U> &key) { return hashValue(static_cast<uint64_t>(key.first) ^ (static_cast<uint64_t>(key.second) * 0x9E3779B97F4A7C15ULL)); }
+
+  void allocate()
+  {
+    _slotMask = 1;
+    while(_slotMask < 2 * static_cast<uint32_t>(_capacity))
+      _slotMask <<= 1;
+
+    _nodes = new Node[_capacity];
+    _slots = new uint16_t[_slotMask]; // Holds node index + 1, 0 when empty
+    _slotMask--;
+    reset();
+  }
+
+  void reset()
+  {
+    _size = 0;
+    _oldest = none;
+    _newest = none;
+
+    if(!_nodes)
+      return;
+
+    for(uint32_t slot = 0; slot <= _slotMask; slot++)
+      _slots[slot] = 0;
+
+    for(uint16_t nodeIndex = 0; nodeIndex < _capacity; nodeIndex++)
+      _nodes[nodeIndex].newer = nodeIndex + 1 < _capacity ? nodeIndex + 1 : none;
+    _free = 0;
+  }
+
+  uint32_t findSlot(const K &key) const
+  {
+    if(!_size)
+      return noSlot;
+
+    for(uint32_t slot = hashKey(key) & _slotMask; _slots[slot]; slot = (slot + 1) & _slotMask)
+    {
+      if(_nodes[_slots[slot] - 1].entry().key == key)
+        return slot;
+    }
+
+    return noSlot;
+  }
+
+  template <typename KeyType, typename... Args>
+  V *insertEntry(KeyType &&key, Args&&... valueArguments)
+  {
+    if(_size == _capacity)
+      eraseNode(_oldest);
+
+    uint16_t nodeIndex = _free;
+    Node &node = _nodes[nodeIndex];
+    _free = node.newer;
+    new (&node.storage) Entry(std::forward<KeyType>(key), std::forward<Args>(valueArguments)...);
+
+    node.older = _newest;
+    node.newer = none;
+    if(_newest != none)
+      _nodes[_newest].newer = nodeIndex;
+    else
+      _oldest = nodeIndex;
+    _newest = nodeIndex;
+
+    uint32_t slot = hashKey(node.entry().key) & _slotMask;
+    while(_slots[slot])
+      slot = (slot + 1) & _slotMask;
+    _slots[slot] = nodeIndex + 1;
+
+    _size++;
+    return &node.entry().value;
+  }
+
+  void eraseNode(const uint16_t nodeIndex)
+  {
+    uint32_t slot = hashKey(_nodes[nodeIndex].entry().key) & _slotMask;
+    while(_slots[slot] != nodeIndex + 1)
+      slot = (slot + 1) & _slotMask;
+
+    eraseNode(nodeIndex, slot);
+  }
+
+  void eraseNode(const uint16_t nodeIndex, uint32_t slot)
+  {
+    // Backward shift: move later entries of the probe sequence into the hole, so lookups never need tombstones.
+    for(uint32_t next = (slot + 1) & _slotMask; _slots[next]; next = (next + 1) & _slotMask)
+    {
+      uint32_t home = hashKey(_nodes[_slots[next] - 1].entry().key) & _slotMask;
+      if(((next - home) & _slotMask) >= ((next - slot) & _slotMask))
+      {
+        _slots[slot] = _slots[next];
+        slot = next;
+      }
+    }
+    _slots[slot] = 0;
+
+    Node &node = _nodes[nodeIndex];
+    if(node.older != none)
+      _nodes[node.older].newer = node.newer;
+    else
+      _oldest = node.newer;
+    if(node.newer != none)
+      _nodes[node.newer].older = node.older;
+    else
+      _newest = node.older;
+
+    node.entry().~Entry();
+    node.newer = _free;
+    _free = nodeIndex;
+    _size--;
+  }
+
+  Node *_nodes = nullptr;
+  uint16_t *_slots = nullptr;
+  uint32_t _slotMask = 0;
+  uint16_t _capacity;
+  uint16_t _size = 0;
+  uint16_t _oldest = none;
+  uint16_t _newest = none;
+  uint16_t _free = none;
+};
+
+#endif
@@ -224,7 +224,6 @@ void FloodingMesh::encryptedBroadcastKernel(const String &message)
 void FloodingMesh::clearMessageLogs()
 {
   _messageIDs.clear();
-  std::queue<messageQueueElementType>().swap(_messageIdOrder);
 }
 
 void FloodingMesh::clearForwardingBacklog()
@@ -265,9 +264,9 @@ uint32_t FloodingMesh::maxEncryptedMessageLength() const
 void FloodingMesh::setMessageLogSize(const uint16_t messageLogSize) 
 { 
   assert(messageLogSize >= 1);
-  _messageLogSize = messageLogSize; 
+  _messageIDs.setCapacity(messageLogSize); // Keeps the most recent messageIDs
 }
-uint16_t FloodingMesh::messageLogSize() const { return _messageLogSize; }
+uint16_t FloodingMesh::messageLogSize() const { return _messageIDs.capacity(); }
 
 void FloodingMesh::setMetadataDelimiter(const char metadataDelimiter) 
 { 
@@ -300,12 +299,12 @@ bool FloodingMesh::insertPreliminaryMessageID(const uint64_t messageID)
   if(messageID >> 16 == TypeCast::macToUint64(WiFi.softAPmacAddress(apMacArray)))
     return false; // The node should not receive its own messages.
   
-  auto insertionResult = _messageIDs.emplace(messageID, 0); // Returns std::pair<iterator,bool>
+  auto insertionResult = _messageIDs.emplace(messageID, 0); // Returns std::pair<uint8_t *,bool>. Drops the oldest messageID if the log is full.
 
   if(insertionResult.second) // Insertion succeeded.
-    updateMessageQueue(insertionResult.first);
-  else if(insertionResult.first->second < getBroadcastReceptionRedundancy()) // messageID exists but not with desired redundancy
-    insertionResult.first->second++;
+    return true;
+  else if(*insertionResult.first < getBroadcastReceptionRedundancy()) // messageID exists but not with desired redundancy
+    (*insertionResult.first)++;
   else
     return false; // messageID already existed in _messageIDs with desired redundancy
 
@@ -318,31 +317,18 @@ bool FloodingMesh::insertCompletedMessageID(const uint64_t messageID)
   if(messageID >> 16 == TypeCast::macToUint64(WiFi.softAPmacAddress(apMacArray)))
     return false; // The node should not receive its own messages.
   
-  auto insertionResult = _messageIDs.emplace(messageID, MESSAGE_COMPLETE); // Returns std::pair<iterator,bool>
+  auto insertionResult = _messageIDs.emplace(messageID, MESSAGE_COMPLETE); // Returns std::pair<uint8_t *,bool>. Drops the oldest messageID if the log is full.
 
   if(insertionResult.second) // Insertion succeeded.
-    updateMessageQueue(insertionResult.first);
-  else if(insertionResult.first->second < MESSAGE_COMPLETE) // messageID exists but is not complete
-    insertionResult.first->second = MESSAGE_COMPLETE;
+    return true;
+  else if(*insertionResult.first < MESSAGE_COMPLETE) // messageID exists but is not complete
+    *insertionResult.first = MESSAGE_COMPLETE;
   else
     return false; // messageID already existed in _messageIDs and is complete
 
   return true;
 }
 
-void FloodingMesh::updateMessageQueue(const messageQueueElementType messageIterator)
-{
-  _messageIdOrder.emplace(messageIterator);
-  
-  if(_messageIDs.size() > messageLogSize())
-  {
-    _messageIDs.erase(_messageIdOrder.front());
-    _messageIdOrder.pop();
-    assert(_messageIDs.size() == messageLogSize()); // If this is false we either have too many elements in messageIDs or we deleted too many elements.
-    assert(_messageIDs.size() == _messageIdOrder.size()); // The containers should always be in sync
-  }
-}
-
 void FloodingMesh::restoreDefaultRequestHandler()
 {
   getEspnowMeshBackend().setRequestHandler([this](const String &request, MeshBackendBase &meshInstance){ return _defaultRequestHandler(request, meshInstance); });
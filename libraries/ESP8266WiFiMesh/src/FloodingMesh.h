@@ -26,8 +26,8 @@
 #define __FLOODINGMESH_H__
 
 #include "EspnowMeshBackend.h"
+#include "ExpiringLogTable.h"
 #include <set>
-#include <queue>
 
 /**
  * An alternative to standard delay(). Will continuously call performMeshMaintenance() during the waiting time, so that the FloodingMesh node remains responsive.
@@ -234,7 +234,7 @@ public:
  * 
  * Defaults to 100.
  * 
- * @param messageLogSize The size of the message log for this FloodingMesh instance. Valid values are 1 to 65535 (uint16_t_max).
+ * @param messageLogSize The size of the message log for this FloodingMesh instance. Valid values are 1 to 65534.
  *                       If a value close to the maximum is chosen, there is a high risk the node will ignore transmissions on messageID rollover if they are sent only by one node 
  *                       (especially if some transmissions are missed), since the messageID also uses uint16_t.
  */
@@ -286,8 +286,6 @@ public:
 
 protected:
 
-  using messageQueueElementType = std::map<uint64_t, uint8_t>::iterator;
-
   static std::set<FloodingMesh *> availableFloodingMeshes;
   
   String generateMessageID();
@@ -298,7 +296,6 @@ protected:
 
   bool insertPreliminaryMessageID(const uint64_t messageID);
   bool insertCompletedMessageID(const uint64_t messageID);
-  void updateMessageQueue(const messageQueueElementType messageIterator);
   
   void loadMeshState(const String &serializedMeshState);
 
@@ -319,8 +316,7 @@ private:
 
   messageHandlerType _messageHandler;
 
-  std::map<uint64_t, uint8_t> _messageIDs = {};
-  std::queue<messageQueueElementType> _messageIdOrder = {};
+  ExpiringLogTable<uint64_t, uint8_t> _messageIDs{100}; // messageID and number of receptions, the capacity is the messageLogSize.
   std::list<std::pair<String, bool>> _forwardingBacklog = {};
 
   String _macIgnoreList;
@@ -335,7 +331,6 @@ private:
   uint8_t _originMac[6] = {0};
   
   uint16_t _messageCount = 0;
-  uint16_t _messageLogSize = 100;
 
   uint8_t _broadcastReceptionRedundancy = 2;
 };
@@ -0,0 +1,170 @@
+// Host (Linux) stand-in for the ESP8266 Arduino core and lwIP, used by
+// mdns_host. Only the API used by LEAmDNS is provided: one lwIP netif list
+// the test sets up, IPv4 only. Time is virtual: millis() returns hostMs.
+
+#ifndef MDNS_HOST_ARDUINO_H
+#define MDNS_HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include <functional>
+#include <string>
+#include <algorithm>
+
+extern uint32_t hostMs;
+inline unsigned long millis() { return hostMs; }
+inline void esp_suspend() {}
+inline void delay(unsigned long ms) { hostMs += ms; }
+inline void yield() {}
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define F(s) (s)
+#define printf_P printf
+#define os_strlen strlen
+#define os_strchr strchr
+#define os_strncpy strncpy
+
+inline char *itoa(int value, char *s, int radix) {
+  snprintf(s, 12, radix == 16 ? "%x" : "%d", value);
+  return s;
+}
+
+inline const char *strrstr(const char *haystack, const char *needle) {
+  const char *found = 0;
+  for (const char *p = haystack; (p = strstr(p, needle)); ++p)
+    found = p;
+  return found;
+}
+
+class String {
+public:
+  String(const char *s = "") : _s(s ? s : "") {}
+  const char *c_str() const { return _s.c_str(); }
+  unsigned length() const { return _s.length(); }
+
+private:
+  std::string _s;
+};
+
+/*
+ * lwIP
+ */
+
+typedef int8_t err_t;
+#define ERR_OK 0
+
+struct ip4_addr {
+  uint32_t addr;
+};
+typedef ip4_addr ip4_addr_t;
+typedef ip4_addr ip_addr_t;
+#define ip_2_ip4(p) (p)
+#define ip4_addr_netcmp(a, b, mask) ((((a)->addr ^ (b)->addr) & (mask)->addr) == 0)
+#define IP4_ADDR_ANY ((const ip_addr_t *)0)
+#define LWIP_IPV6 0
+#define lwip_htons __builtin_bswap16
+#define lwip_htonl __builtin_bswap32
+#define lwip_ntohs __builtin_bswap16
+#define lwip_ntohl __builtin_bswap32
+
+struct netif {
+  netif *next;
+  ip_addr_t ip_addr;
+  ip_addr_t netmask;
+  bool up;
+  uint8_t flags;
+  char name[2];
+  uint8_t num;
+};
+#define NETIF_FLAG_IGMP 0x80
+extern netif *netif_list;
+inline bool netif_is_up(const netif *n) { return n->up; }
+
+inline err_t igmp_start(netif *) { return ERR_OK; }
+inline err_t igmp_joingroup_netif(netif *, const ip4_addr_t *) { return ERR_OK; }
+inline err_t igmp_leavegroup_netif(netif *, const ip4_addr_t *) { return ERR_OK; }
+
+// lwip/prot/dns.h
+#define DNS_MQUERY_PORT 5353
+#define DNS_MQUERY_IPV4_GROUP_INIT (ip_addr_t{0xfb0000e0})  // 224.0.0.251
+#define DNS_RRTYPE_A 1
+#define DNS_RRTYPE_PTR 12
+#define DNS_RRTYPE_TXT 16
+#define DNS_RRTYPE_AAAA 28
+#define DNS_RRTYPE_SRV 33
+#define DNS_RRTYPE_NSEC 47
+#define DNS_RRTYPE_ANY 255
+#define DNS_RRCLASS_IN 1
+#define DNS_RRCLASS_ANY 255
+#define DNS_RRCLASS_FLUSH 0x800
+
+/*
+ * Core
+ */
+
+class IPAddress {
+public:
+  IPAddress() : _address(0) {}
+  IPAddress(uint32_t address) : _address(address) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _address(a | b << 8 | c << 16 | (uint32_t)d << 24) {}
+  IPAddress(const ip_addr_t &address) : _address(address.addr) {}
+  IPAddress(const ip_addr_t *address) : _address(address ? address->addr : 0) {}
+  operator uint32_t() const { return _address; }
+  uint8_t operator[](int index) const { return _address >> (8 * index); }
+  uint8_t &operator[](int index) { return ((uint8_t *)&_address)[index]; }
+  bool operator==(const ip_addr_t &address) const { return _address == address.addr; }
+  bool isSet() const { return _address != 0; }
+  bool isV4() const { return true; }
+  String toString() const {
+    char s[16];
+    snprintf(s, sizeof(s), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+    return String(s);
+  }
+
+private:
+  uint32_t _address;
+};
+#define INADDR_ANY IPAddress(0u)
+
+struct ip_info {
+  ip4_addr ip;
+  ip4_addr netmask;
+  ip4_addr gw;
+};
+#define STATION_IF 0
+#define SOFTAP_IF 1
+bool wifi_get_ip_info(uint8_t if_index, ip_info *info);
+
+bool schedule_function(const std::function<void(void)> &fn);
+
+namespace LwipIntf {
+inline bool statusChangeCB(const std::function<void(netif *)> &) { return true; }
+}
+
+namespace esp8266 {
+namespace polledTimeout {
+// oneShotMs on the virtual clock
+class oneShotMs {
+public:
+  typedef uint32_t timeType;
+  static constexpr uint32_t neverExpires = 0xFFFFFFFF;
+  oneShotMs(uint32_t timeout) { reset(timeout); }
+  void reset(uint32_t timeout) { _start = hostMs; _timeout = timeout; }
+  void reset() { _start = hostMs; }
+  void resetToNeverExpires() { _timeout = neverExpires; }
+  bool expired() const { return _timeout != neverExpires && hostMs - _start >= _timeout; }
+  uint32_t getTimeout() const { return _timeout; }
+
+private:
+  uint32_t _start, _timeout;
+};
+} // namespace polledTimeout
+} // namespace esp8266
+
+#endif // MDNS_HOST_ARDUINO_H
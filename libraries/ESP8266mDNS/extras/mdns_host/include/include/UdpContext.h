@@ -0,0 +1,84 @@
+// Host stand-in for the ESP8266 UdpContext: the test sets the received
+// datagram (receive()), what the responder sends is kept in 'sent'.
+
+#ifndef MDNS_HOST_UDPCONTEXT_H
+#define MDNS_HOST_UDPCONTEXT_H
+
+#include <Arduino.h>
+#include <vector>
+
+class UdpContext {
+public:
+  struct Datagram {
+    IPAddress to;
+    uint16_t port;
+    std::vector<uint8_t> data;
+  };
+
+  void ref() { _refcnt++; }
+  void unref() {
+    if (--_refcnt == 0)
+      delete this;
+  }
+  bool listen(const ip_addr_t *, uint16_t) { return true; }
+  void setMulticastTTL(int) {}
+  void setMulticastInterface(const IPAddress &) {}
+  void onRx(const std::function<void(void)> &) {}
+
+  // Makes 'data' the current datagram, as if received from 'from'
+  void receive(const uint8_t *data, size_t size, IPAddress from, uint16_t port, netif *input) {
+    _rx.assign(data, data + size);
+    _pos = 0;
+    _pending = true;
+    _from = from;
+    _fromPort = port;
+    _input = input;
+  }
+
+  bool next() {
+    bool pending = _pending;
+    _pending = false;
+    return pending;
+  }
+  void flush() { _pos = _rx.size(); }
+  size_t getSize() const { return _rx.size() - _pos; }
+  size_t tell() const { return _pos; }
+  bool isValidOffset(size_t pos) const { return pos <= _rx.size(); }
+  void seek(size_t pos) { _pos = pos; }
+  int peek() const { return _pos < _rx.size() ? _rx[_pos] : -1; }
+  size_t read(char *dst, size_t size) {
+    size = std::min(size, _rx.size() - _pos);
+    memcpy(dst, &_rx[_pos], size);
+    _pos += size;
+    return size;
+  }
+
+  IPAddress getRemoteAddress() const { return _from; }
+  uint16_t getRemotePort() const { return _fromPort; }
+  IPAddress getDestAddress() const { return IPAddress(224, 0, 0, 251); }
+  uint16_t getLocalPort() const { return DNS_MQUERY_PORT; }
+  netif *getInputNetif() const { return _input; }
+
+  size_t append(const char *data, size_t size) {
+    _tx.insert(_tx.end(), data, data + size);
+    return size;
+  }
+  bool sendTimeout(const IPAddress &to, uint16_t port, uint32_t) {
+    sent.push_back(Datagram{to, port, _tx});
+    _tx.clear();
+    return true;
+  }
+
+  std::vector<Datagram> sent;
+
+private:
+  int _refcnt = 0;
+  std::vector<uint8_t> _rx, _tx;
+  size_t _pos = 0;
+  bool _pending = false;
+  IPAddress _from;
+  uint16_t _fromPort = 0;
+  netif *_input = 0;
+};
+
+#endif // MDNS_HOST_UDPCONTEXT_H
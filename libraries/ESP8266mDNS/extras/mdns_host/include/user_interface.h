@@ -0,0 +1,4 @@
+// Host stand-in, see Arduino.h (included in extern "C" blocks)
+extern "C++" {
+#include <Arduino.h>
+}
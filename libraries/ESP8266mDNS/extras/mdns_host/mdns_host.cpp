@@ -0,0 +1,508 @@
+// ESP8266mDNS (LEAmDNS) - host tests
+// The responder runs on a mock UdpContext (include/): the test plays the
+// other hosts on the LAN, sends it queries and reads what it multicasts.
+//
+// Compiled responses: random sets of questions for the own names (any case)
+// are asked twice and once more after dropping the compiled responses. The
+// three responses must be equal. Changes of TXT items, service names, the
+// interface IP address and dynamic TXT items must show in the next response.
+// Questions for foreign names must not be answered.
+//
+// Received messages: a second responder (robot2) announces its service, a
+// service query of robot1 must decode the answers. Handcrafted messages use
+// compressed names, malformed ones (pointer loops, forward pointers, labels
+// and TXT items past the end) must be dropped. Everything sent and received
+// so far (plus the UDP 5353 datagrams of a pcap capture, if given) is the
+// corpus for the fuzzer: bit flips, truncation, random compression pointers,
+// label and count bytes. Build with 'make asan' to catch out of bounds reads.
+//
+// Before fuzzing, reports the host time per query: foreign names (a discovery
+// storm of other robots) and own names, and per message of the corpus.
+//
+// Usage: mdns_host [-n random queries] [-f fuzzed messages] [-s seed] [-p capture.pcap]
+
+#include <ESP8266mDNS.h>
+#include <unistd.h>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+uint32_t hostMs;
+netif *netif_list;
+
+bool wifi_get_ip_info(uint8_t, ip_info *) { return false; }
+
+bool schedule_function(const std::function<void(void)> &fn) {
+  fn();
+  return true;
+}
+
+static int failures;
+
+#define CHECK(cond, ...)                                                                                               \
+  do {                                                                                                                 \
+    if (!(cond)) {                                                                                                     \
+      if (failures++ < 10) {                                                                                           \
+        printf("FAIL: " __VA_ARGS__);                                                                                  \
+        printf("\n");                                                                                                  \
+      }                                                                                                                \
+    }                                                                                                                  \
+  } while (0)
+
+static uint32_t rndState = 1;
+static uint32_t rnd(uint32_t n) {
+  rndState = rndState * 1103515245 + 12345;
+  return (rndState >> 8) % n;
+}
+
+/*
+ * The responder, with access to its UDP context
+ */
+
+class HostResponder : public esp8266::MDNSImplementation::MDNSResponder {
+public:
+  UdpContext &udp() { return *m_pUDPContext; }
+
+  // Runs probing and announcing on the virtual clock, keeps what was sent
+  bool settle() {
+    for (int n = 0; n < 400; n++) {
+      hostMs += 50;
+      update();
+    }
+    for (auto &d : udp().sent)
+      traffic.push_back(d.data);
+    udp().sent.clear();
+    bool done = (ProbingStatus_Done == m_HostProbeInformation.m_ProbingStatus);
+    for (stcMDNSService *s = m_pServices; s; s = s->m_pNext)
+      done = done && (ProbingStatus_Done == s->m_ProbeInformation.m_ProbingStatus);
+    return done;
+  }
+
+  // Delivers a datagram from another host, returns what the responder sent
+  std::vector<std::vector<uint8_t>> deliver(const std::vector<uint8_t> &packet) {
+    udp().sent.clear();
+    udp().receive(packet.data(), packet.size(), IPAddress(192, 168, 1, 77), DNS_MQUERY_PORT, netif_list);
+    _process(false);
+    std::vector<std::vector<uint8_t>> sent;
+    for (auto &d : udp().sent)
+      sent.push_back(d.data);
+    udp().sent.clear();
+    return sent;
+  }
+
+  void process() { _process(false); }
+  void dropCompiledResponses() { _invalidateAnswers(); }
+
+  std::vector<std::vector<uint8_t>> traffic;
+};
+
+static netif wlan;
+
+/*
+ * DNS messages
+ */
+
+struct Question {
+  std::string name; // dotted
+  uint16_t type;
+};
+
+static void put16(std::vector<uint8_t> &p, uint16_t v) {
+  p.push_back(v >> 8);
+  p.push_back(v);
+}
+
+static void putName(std::vector<uint8_t> &p, const std::string &name) {
+  size_t start = 0;
+  while (start < name.size()) {
+    size_t dot = name.find('.', start);
+    if (dot == std::string::npos)
+      dot = name.size();
+    p.push_back(dot - start);
+    p.insert(p.end(), name.begin() + start, name.begin() + dot);
+    start = dot + 1;
+  }
+  p.push_back(0);
+}
+
+static std::vector<uint8_t> query(const std::vector<Question> &questions) {
+  std::vector<uint8_t> p;
+  put16(p, 0);                // ID
+  put16(p, 0);                // standard query
+  put16(p, questions.size()); // QD
+  put16(p, 0);
+  put16(p, 0);
+  put16(p, 0);
+  for (const Question &q : questions) {
+    putName(p, q.name);
+    put16(p, q.type);
+    put16(p, DNS_RRCLASS_IN);
+  }
+  return p;
+}
+
+static bool contains(const std::vector<uint8_t> &p, const std::string &s) {
+  return std::search(p.begin(), p.end(), s.begin(), s.end(),
+                     [](uint8_t a, char b) { return a == (uint8_t)b; }) != p.end();
+}
+
+static std::string randomCase(std::string s) {
+  for (char &c : s)
+    if (rnd(2))
+      c = toupper(c);
+  return s;
+}
+
+/*
+ * Tests
+ */
+
+static HostResponder mdns;
+static HostResponder peer; // robot2, 192.168.1.51
+static MDNSResponder::hMDNSService http, ota;
+static std::vector<std::vector<uint8_t>> corpus;
+
+static const Question own[] = {
+    {"_http._tcp.local", DNS_RRTYPE_PTR},        {"_services._dns-sd._udp.local", DNS_RRTYPE_PTR},
+    {"robot1._http._tcp.local", DNS_RRTYPE_SRV}, {"robot1._http._tcp.local", DNS_RRTYPE_TXT},
+    {"robot1._http._tcp.local", DNS_RRTYPE_ANY}, {"robot1.local", DNS_RRTYPE_A},
+    {"robot1.local", DNS_RRTYPE_ANY},            {"_arduino._tcp.local", DNS_RRTYPE_PTR},
+    {"robot1._arduino._tcp.local", DNS_RRTYPE_SRV}, {"50.1.168.192.in-addr.arpa", DNS_RRTYPE_PTR},
+};
+
+static const Question foreign[] = {
+    {"_googlecast._tcp.local", DNS_RRTYPE_PTR},  {"robot2._http._tcp.local", DNS_RRTYPE_SRV},
+    {"robot2.local", DNS_RRTYPE_A},              {"robot1.lan", DNS_RRTYPE_A},
+    {"_http._udp.local", DNS_RRTYPE_PTR},        {"51.1.168.192.in-addr.arpa", DNS_RRTYPE_PTR},
+    {"robot1.local.local", DNS_RRTYPE_A},        {"robot12.local", DNS_RRTYPE_A},
+};
+
+// One response, or an empty packet
+static std::vector<uint8_t> ask(const std::vector<Question> &questions) {
+  std::vector<std::vector<uint8_t>> sent = mdns.deliver(query(questions));
+  CHECK(sent.size() <= 1, "%zu responses", sent.size());
+  return sent.empty() ? std::vector<uint8_t>() : sent[0];
+}
+
+static std::vector<uint8_t> askRaw(const std::vector<uint8_t> &packet) {
+  corpus.push_back(packet);
+  std::vector<std::vector<uint8_t>> sent = mdns.deliver(packet);
+  return sent.empty() ? std::vector<uint8_t>() : sent[0];
+}
+
+static void testCompiled(unsigned count) {
+  for (unsigned n = 0; n < count; n++) {
+    std::vector<Question> questions;
+    for (unsigned q = 1 + rnd(3); q--;) {
+      Question question = own[rnd(sizeof(own) / sizeof(own[0]))];
+      question.name = randomCase(question.name);
+      questions.push_back(question);
+    }
+    std::vector<uint8_t> first = ask(questions), second = ask(questions);
+    mdns.dropCompiledResponses();
+    std::vector<uint8_t> fresh = ask(questions);
+    CHECK(!first.empty(), "no response to %s", questions[0].name.c_str());
+    CHECK(first == second && first == fresh, "compiled response differs (%s, %zu questions)",
+          questions[0].name.c_str(), questions.size());
+  }
+
+  for (const Question &q : foreign)
+    CHECK(ask({q}).empty(), "answered %s", q.name.c_str());
+}
+
+static void testChanges() {
+  std::vector<Question> txt = {{"robot1._http._tcp.local", DNS_RRTYPE_TXT}};
+  ask(txt);
+  mdns.addServiceTxt(http, "mode", "balance");
+  CHECK(contains(ask(txt), "mode=balance"), "new TXT item missing");
+  mdns.addServiceTxt(http, "mode", "drive");
+  std::vector<uint8_t> r = ask(txt);
+  CHECK(contains(r, "mode=drive") && !contains(r, "mode=balance"), "changed TXT item missing");
+
+  std::vector<Question> a = {{"robot1.local", DNS_RRTYPE_A}};
+  ask(a);
+  wlan.ip_addr.addr = IPAddress(192, 168, 1, 60);
+  CHECK(contains(ask(a), std::string("\xc0\xa8\x01\x3c", 4)), "changed IP address missing");
+  CHECK(ask({{"60.1.168.192.in-addr.arpa", DNS_RRTYPE_PTR}}).size(), "no reverse answer for the new IP");
+  wlan.ip_addr.addr = IPAddress(192, 168, 1, 50);
+
+  std::vector<Question> ptr = {{"_arduino._tcp.local", DNS_RRTYPE_PTR}};
+  ask(ptr);
+  mdns.setServiceName(ota, "robot1-ota");
+  CHECK(mdns.settle(), "probing after the rename");
+  CHECK(contains(ask(ptr), "robot1-ota"), "new service name missing");
+  CHECK(ask({{"robot1-ota._arduino._tcp.local", DNS_RRTYPE_SRV}}).size(), "no answer for the new name");
+  CHECK(ask({{"robot1._arduino._tcp.local", DNS_RRTYPE_SRV}}).empty(), "answer for the old name");
+
+  static int battery = 90;
+  mdns.setDynamicServiceTxtCallback(http, [](const MDNSResponder::hMDNSService s) {
+    mdns.addDynamicServiceTxt(s, "battery", battery--);
+  });
+  CHECK(contains(ask(txt), "battery=90") && contains(ask(txt), "battery=89"), "dynamic TXT item not updated");
+  mdns.setDynamicServiceTxtCallback(http, nullptr);
+  CHECK(!contains(ask(txt), "battery="), "dynamic TXT item left");
+}
+
+static void testServiceQuery() {
+  static unsigned callbacks;
+  MDNSResponder::hMDNSServiceQuery q = mdns.installServiceQuery(
+      "http", "tcp", [](const MDNSResponder::MDNSServiceInfo &, MDNSResponder::AnswerType, bool) { callbacks++; });
+  CHECK(q, "installServiceQuery");
+  for (auto &d : mdns.udp().sent)
+    corpus.push_back(d.data);
+  mdns.udp().sent.clear();
+
+  for (const std::vector<uint8_t> &announcement : peer.traffic)
+    mdns.deliver(announcement);
+  corpus.insert(corpus.end(), peer.traffic.begin(), peer.traffic.end());
+
+  CHECK(callbacks, "no service query callback");
+  CHECK(mdns.answerCount(q) == 1, "%u service answers", mdns.answerCount(q));
+  if (mdns.answerCount(q) == 1) {
+    CHECK(!strcmp(mdns.answerServiceDomain(q, 0), "robot2._http._tcp.local"), "service domain %s",
+          mdns.answerServiceDomain(q, 0));
+    CHECK(mdns.hasAnswerHostDomain(q, 0) && !strcmp(mdns.answerHostDomain(q, 0), "robot2.local"),
+          "host domain");
+    CHECK(mdns.hasAnswerPort(q, 0) && mdns.answerPort(q, 0) == 8080, "port");
+    CHECK(mdns.hasAnswerIP4Address(q, 0) && mdns.answerIP4Address(q, 0, 0) == IPAddress(192, 168, 1, 51),
+          "IP address");
+    CHECK(mdns.hasAnswerTxts(q, 0) && strstr(mdns.answerTxts(q, 0), "board=esp32") &&
+              strstr(mdns.answerTxts(q, 0), "path=/api"),
+          "TXT items %s", mdns.hasAnswerTxts(q, 0) ? mdns.answerTxts(q, 0) : "");
+  }
+}
+
+// Queries with compressed names, valid and not
+static void testCompression() {
+  // robot1.local A, then _http._tcp + pointer to "local" (offset 19)
+  std::vector<uint8_t> p = query({{"robot1.local", DNS_RRTYPE_A}});
+  p[5] = 2;
+  std::vector<uint8_t> http = {5, '_', 'h', 't', 't', 'p', 4, '_', 't', 'c', 'p', 0xc0, 19, 0, DNS_RRTYPE_PTR, 0, 1};
+  p.insert(p.end(), http.begin(), http.end());
+  std::vector<uint8_t> r = askRaw(p);
+  CHECK(contains(r, "\xc0\xa8\x01\x32") && contains(r, "_http"), "compressed query not answered");
+
+  // Pointer to a pointer: x.local (12) A, _http._tcp + pointer to "local" (25) A,
+  // robot1 + pointer to _http._tcp.local SRV
+  p = query({{"x.local", DNS_RRTYPE_A}});
+  p[5] = 3;
+  std::vector<uint8_t> twice = {5, '_', 'h', 't', 't', 'p', 4, '_', 't', 'c', 'p', 0xc0, 14, 0, DNS_RRTYPE_A, 0, 1,
+                                6, 'r', 'o', 'b', 'o', 't', '1', 0xc0, 25, 0, DNS_RRTYPE_SRV, 0, 1};
+  p.insert(p.end(), twice.begin(), twice.end());
+  r = askRaw(p);
+  CHECK(contains(r, std::string("\0\0\0\0\0\x50", 6)), "SRV for a twice compressed name missing");
+
+  // Malformed: self loop, forward pointer, loop through two names, backward pointer into
+  // its own name (a loop of backward pointers), reserved label type, label past the end,
+  // pointer cut off
+  const std::vector<std::vector<uint8_t>> names = {
+      {0xc0, 12},       {0xc0, 14, 0, 1, 0, 1, 0}, {1, 'a', 0xc0, 14}, {1, 'a', 0xc0, 12}, {0x40, 'a', 0},
+      {20, 'r', 'o', 'b'}, {6, 'r', 'o', 'b', 'o', 't', '1', 0xc0},
+  };
+  for (const std::vector<uint8_t> &name : names) {
+    std::vector<uint8_t> bad = query({});
+    bad[5] = 1;
+    bad.insert(bad.end(), name.begin(), name.end());
+    CHECK(askRaw(bad).empty(), "answered a malformed name");
+  }
+
+  // Loop between two names: the second name points to the first, which points
+  // forward to the second
+  std::vector<uint8_t> loop = query({});
+  loop[5] = 2;
+  std::vector<uint8_t> names2 = {1, 'a', 0xc0, 16, 0, 1, 0, 1, 0xc0, 12, 0, 1, 0, 1};
+  loop.insert(loop.end(), names2.begin(), names2.end());
+  CHECK(askRaw(loop).empty(), "answered a pointer loop");
+
+  CHECK(ask({own[5]}).size(), "no answer after malformed messages");
+}
+
+/*
+ * Fuzzer
+ */
+
+static std::vector<uint8_t> mutate(std::vector<uint8_t> p) {
+  for (unsigned n = 1 + rnd(4); n-- && p.size() > 12;) {
+    size_t at = rnd(p.size());
+    switch (rnd(6)) {
+    case 0: // bit flip
+      p[at] ^= 1 << rnd(8);
+      break;
+    case 1: // truncation
+      p.resize(at);
+      break;
+    case 2: // compression pointer anywhere, also forward and to itself
+      if (at + 1 < p.size()) {
+        uint16_t to = rnd(p.size() + 16);
+        p[at] = 0xc0 | (to >> 8);
+        p[at + 1] = to;
+      }
+      break;
+    case 3: // label or TXT item length
+      p[at] = rnd(4) ? rnd(64) : 0xff;
+      break;
+    case 4: // section counts
+      p[4 + rnd(8)] = rnd(4) ? rnd(8) : 0xff;
+      break;
+    default: // random bytes
+      for (unsigned k = rnd(8); k--;)
+        p.insert(p.begin() + rnd(p.size()), rnd(256));
+      break;
+    }
+  }
+  return p;
+}
+
+static void fuzz(unsigned count) {
+  for (unsigned n = 0; n < count && corpus.size(); n++) {
+    std::vector<uint8_t> p = mutate(corpus[rnd(corpus.size())]);
+    mdns.deliver(p);
+    if (!rnd(256)) {
+      hostMs += 1000; // let the service query and the responder run
+      mdns.update();
+      mdns.udp().sent.clear();
+    }
+  }
+  CHECK(ask({own[5]}).size() && ask({own[2]}).size(), "no answers after fuzzing");
+}
+
+/*
+ * Captures: UDP port 5353 datagrams of a pcap file (Ethernet, raw IP or Linux cooked)
+ */
+
+static uint32_t get32(const uint8_t *p, bool swap) {
+  uint32_t v;
+  memcpy(&v, p, 4);
+  return swap ? __builtin_bswap32(v) : v;
+}
+
+static size_t readCapture(const char *path) {
+  std::ifstream f(path, std::ios::binary);
+  std::vector<uint8_t> file((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+  if (file.size() < 24)
+    return 0;
+  uint32_t magic = get32(&file[0], false);
+  bool swap = (magic == 0xd4c3b2a1 || magic == 0x4d3cb2a1);
+  if (!swap && magic != 0xa1b2c3d4 && magic != 0xa1b23c4d)
+    return 0;
+  uint32_t link = get32(&file[20], swap);
+  size_t l2 = (link == 1 ? 14 : link == 113 ? 16 : link == 101 ? 0 : SIZE_MAX);
+  size_t count = 0;
+  for (size_t at = 24; l2 != SIZE_MAX && at + 16 <= file.size();) {
+    size_t len = get32(&file[at + 8], swap);
+    const uint8_t *frame = &file[at + 16];
+    at += 16 + len;
+    if (at > file.size())
+      break;
+    if (len < l2 + 28 || (frame[l2] >> 4) != 4)
+      continue;
+    const uint8_t *ip = frame + l2;
+    size_t ihl = (ip[0] & 0x0f) * 4;
+    const uint8_t *udp = ip + ihl;
+    if (ip[9] != 17 || len < l2 + ihl + 8 || ((udp[0] << 8 | udp[1]) != DNS_MQUERY_PORT &&
+                                              (udp[2] << 8 | udp[3]) != DNS_MQUERY_PORT))
+      continue;
+    size_t size = std::min<size_t>((udp[4] << 8 | udp[5]), len - l2 - ihl);
+    if (size > 8 + 12) {
+      corpus.emplace_back(udp + 8, udp + size);
+      count++;
+    }
+  }
+  return count;
+}
+
+/*
+ * Benchmark
+ */
+
+static void reportQueries(const char *what, const std::vector<Question> &questions, bool answered) {
+  std::vector<uint8_t> packet = query(questions);
+  const unsigned count = 50000;
+  auto start = std::chrono::steady_clock::now();
+  size_t responses = 0;
+  for (unsigned n = 0; n < count; n++) {
+    mdns.udp().receive(packet.data(), packet.size(), IPAddress(192, 168, 1, 77), DNS_MQUERY_PORT, &wlan);
+    mdns.process();
+    responses += mdns.udp().sent.size();
+    mdns.udp().sent.clear();
+  }
+  double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  CHECK(responses == (answered ? count : 0), "%s: %zu responses", what, responses);
+  printf("%-28s %6.2f us/query\n", what, us / count);
+}
+
+static void reportCorpus() {
+  const unsigned rounds = 2000;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned n = 0; n < rounds; n++)
+    for (const std::vector<uint8_t> &p : corpus) {
+      mdns.udp().receive(p.data(), p.size(), IPAddress(192, 168, 1, 77), DNS_MQUERY_PORT, &wlan);
+      mdns.process();
+      mdns.udp().sent.clear();
+    }
+  double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+  printf("%-28s %6.2f us/message\n", ("corpus (" + std::to_string(corpus.size()) + " messages)").c_str(),
+         us / rounds / corpus.size());
+}
+
+int main(int argc, char **argv) {
+  unsigned count = 2000, fuzzCount = 200000;
+  const char *capture = 0;
+  int opt;
+  while ((opt = getopt(argc, argv, "n:f:s:p:")) != -1) {
+    if (opt == 'n')
+      count = strtoul(optarg, NULL, 0);
+    else if (opt == 'f')
+      fuzzCount = strtoul(optarg, NULL, 0);
+    else if (opt == 's')
+      rndState = strtoul(optarg, NULL, 0);
+    else if (opt == 'p')
+      capture = optarg;
+  }
+
+  wlan.ip_addr.addr = IPAddress(192, 168, 1, 51);
+  wlan.netmask.addr = IPAddress(255, 255, 255, 0);
+  wlan.up = true;
+  wlan.flags = NETIF_FLAG_IGMP;
+  netif_list = &wlan;
+
+  CHECK(peer.begin("robot2"), "begin robot2");
+  MDNSResponder::hMDNSService peerHttp = peer.addService(0, "http", "tcp", 8080);
+  peer.addServiceTxt(peerHttp, "board", "esp32");
+  peer.addServiceTxt(peerHttp, "path", "/api");
+  CHECK(peer.settle(), "probing robot2");
+  wlan.ip_addr.addr = IPAddress(192, 168, 1, 50);
+
+  CHECK(mdns.begin("robot1"), "begin");
+  http = mdns.addService(0, "http", "tcp", 80);
+  mdns.addServiceTxt(http, "path", "/");
+  mdns.addServiceTxt(http, "board", "esp8266");
+  ota = mdns.enableArduino(8266);
+  CHECK(mdns.settle(), "probing");
+
+  testCompiled(count);
+  testChanges();
+  testServiceQuery();
+  testCompression();
+  for (const Question &q : own)
+    corpus.push_back(ask({q}));
+  corpus.push_back(query({own[0], own[2], own[5], foreign[0]}));
+  if (capture) {
+    size_t captured = readCapture(capture);
+    CHECK(captured, "no mDNS messages in %s", capture);
+    printf("%zu messages from %s\n", captured, capture);
+  }
+
+  reportQueries("foreign PTR", {foreign[0]}, false);
+  reportQueries("foreign SRV+A", {foreign[1], foreign[2]}, false);
+  reportQueries("own PTR", {own[0]}, true);
+  reportQueries("own SRV+TXT", {own[2], own[3]}, true);
+  reportQueries("own A", {own[5]}, true);
+  reportCorpus();
+
+  fuzz(fuzzCount);
+
+  printf(failures ? "%d FAILED\n" : "all passed\n", failures);
+  return failures ? 1 : 0;
+}
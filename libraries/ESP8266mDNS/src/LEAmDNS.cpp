@@ -54,7 +54,9 @@ namespace MDNSImplementation
     */
     MDNSResponder::MDNSResponder(void) :
         m_pServices(0), m_pUDPContext(0), m_pcHostname(0), m_pServiceQueries(0),
-        m_fnServiceTxtCallback(0), m_bLwipCb(false), m_bRestarting(false)
+        m_fnServiceTxtCallback(0), m_bLwipCb(false), m_bRestarting(false), m_pAnswerCache(0),
+        m_pAnswerCapture(0), m_bDomainHashesValid(false), m_u32HostDomainHash(0),
+        m_u32DNSSDDomainHash(0), m_pucRXBuffer(0), m_u16RXLength(0), m_u16RXOffset(0)
     {
     }
 
@@ -307,7 +309,8 @@ namespace MDNSImplementation
         bool            bResult
             = (((!p_pcInstanceName) || (MDNS_DOMAIN_LABEL_MAXLENGTH >= os_strlen(p_pcInstanceName)))
                && ((pService = _findService(p_hService))) && (pService->setName(p_pcInstanceName))
-               && ((pService->m_ProbeInformation.m_ProbingStatus = ProbingStatus_ReadyToStart)));
+               && ((pService->m_ProbeInformation.m_ProbingStatus = ProbingStatus_ReadyToStart))
+               && (_invalidateAnswers()));
         DEBUG_EX_ERR(if (!bResult) {
             DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] setServiceName: FAILED for '%s'!\n"),
                                   (p_pcInstanceName ?: "-"));
@@ -532,6 +535,7 @@ namespace MDNSImplementation
         MDNSResponder::MDNSDynamicServiceTxtCallbackFunc p_fnCallback)
     {
         m_fnServiceTxtCallback = p_fnCallback;
+        _invalidateAnswers();
 
         return true;
     }
@@ -553,6 +557,7 @@ namespace MDNSImplementation
         if (pService)
         {
             pService->m_fnTxtCallback = p_fnCallback;
+            _invalidateAnswers();
 
             bResult = true;
         }
@@ -173,6 +173,18 @@ namespace MDNSImplementation
 */
 #define MDNS_UDPCONTEXT_TIMEOUT 50
 
+/*
+    Number of compiled response packets kept (see _prepareMDNSMessage), 0 disables the cache
+*/
+#ifndef MDNS_ANSWER_CACHE_SIZE
+#define MDNS_ANSWER_CACHE_SIZE 4
+#endif
+/*
+    Maximum key length of a compiled response: flags, host reply mask, IP address and
+    one reply mask per service (responses of hosts with more services are not cached)
+*/
+#define MDNS_ANSWER_CACHE_KEYLENGTH 32
+
     /**
         MDNSResponder
     */
@@ -733,6 +745,9 @@ namespace MDNSImplementation
             bool operator!=(const stcMDNS_RRDomain& p_Other) const;
             bool operator>(const stcMDNS_RRDomain& p_Other) const;
 
+            uint32_t hash(void) const;
+            bool     hasSuffix(const char* p_pcSuffix, uint16_t p_u16Length) const;
+
             size_t c_strLength(void) const;
             bool   c_str(char* p_pcBuffer);
         };
@@ -759,6 +774,7 @@ namespace MDNSImplementation
         {
             stcMDNS_RRDomain     m_Domain;
             stcMDNS_RRAttributes m_Attributes;
+            uint32_t             m_u32DomainHash;  // m_Domain.hash(), set by _readRRHeader
 
             stcMDNS_RRHeader(void);
             stcMDNS_RRHeader(const stcMDNS_RRHeader& p_Other);
@@ -947,6 +963,8 @@ namespace MDNSImplementation
             stcMDNSServiceTxts                m_Txts;
             MDNSDynamicServiceTxtCallbackFunc m_fnTxtCallback;
             stcProbeInformation               m_ProbeInformation;
+            uint32_t m_u32TypeDomainHash;  // Hash of eg. _http._tcp.local (see _updateDomainHashes)
+            uint32_t m_u32NameDomainHash;  // Hash of eg. MyESP._http._tcp.local
 
             stcMDNSService(const char* p_pcName = 0, const char* p_pcService = 0,
                            const char* p_pcProtocol = 0);
@@ -1167,6 +1185,28 @@ namespace MDNSImplementation
                                             bool        p_bAdditionalData) const;
         };
 
+        /**
+            stcMDNSAnswerCacheItem
+
+            A response packet as written by _prepareMDNSMessage, ready to be sent again
+            for the same key (see _answerCacheKey)
+        */
+        struct stcMDNSAnswerCacheItem
+        {
+            stcMDNSAnswerCacheItem* m_pNext;
+            uint8_t                 m_au8Key[MDNS_ANSWER_CACHE_KEYLENGTH];
+            uint8_t                 m_u8KeyLength;
+            unsigned char*          m_pucPacket;
+            uint16_t                m_u16Length;
+            uint16_t                m_u16Capacity;
+
+            stcMDNSAnswerCacheItem(const uint8_t* p_pu8Key, uint8_t p_u8KeyLength);
+            ~stcMDNSAnswerCacheItem(void);
+
+            bool append(const unsigned char* p_pcBuffer, size_t p_stLength);
+            bool compact(void);
+        };
+
         // Instance variables
         stcMDNSService*                   m_pServices;
         UdpContext*                       m_pUDPContext;
@@ -1176,6 +1216,14 @@ namespace MDNSImplementation
         stcProbeInformation               m_HostProbeInformation;
         bool                              m_bLwipCb;
         bool                              m_bRestarting;
+        stcMDNSAnswerCacheItem*           m_pAnswerCache;    // Most recently used first
+        stcMDNSAnswerCacheItem*           m_pAnswerCapture;  // Response being compiled
+        bool                              m_bDomainHashesValid;
+        uint32_t                          m_u32HostDomainHash;
+        uint32_t                          m_u32DNSSDDomainHash;
+        unsigned char*                    m_pucRXBuffer;  // Received message (see _udpLoadMessage)
+        uint16_t                          m_u16RXLength;
+        uint16_t                          m_u16RXOffset;  // Read position in m_pucRXBuffer
 
         /** CONTROL **/
         /* MAINTENANCE */
@@ -1249,7 +1297,6 @@ namespace MDNSImplementation
 
         bool _readRRHeader(stcMDNS_RRHeader& p_rHeader);
         bool _readRRDomain(stcMDNS_RRDomain& p_rRRDomain);
-        bool _readRRDomain_Loop(stcMDNS_RRDomain& p_rRRDomain, uint8_t p_u8Depth);
         bool _readRRAttributes(stcMDNS_RRAttributes& p_rAttributes);
 
         /* DOMAIN NAMES */
@@ -1269,6 +1316,8 @@ namespace MDNSImplementation
 #endif
 
         /* UDP */
+        bool _udpLoadMessage(void);
+        bool _udpReleaseMessage(void);
         bool _udpReadBuffer(unsigned char* p_pBuffer, size_t p_stLength);
         bool _udpRead8(uint8_t& p_ru8Value);
         bool _udpRead16(uint16_t& p_ru16Value);
@@ -1358,6 +1407,14 @@ namespace MDNSImplementation
 
         size_t _countServices(void) const;
 
+        /* ANSWER CACHE */
+        uint8_t                 _answerCacheKey(const stcMDNSSendParameter& p_SendParameter,
+                                                IPAddress p_IPAddress, uint8_t* p_pu8Key) const;
+        stcMDNSAnswerCacheItem* _findCachedAnswer(const uint8_t* p_pu8Key, uint8_t p_u8KeyLength);
+        bool                    _addCachedAnswer(stcMDNSAnswerCacheItem* p_pAnswer);
+        bool                    _invalidateAnswers(void);
+        bool                    _updateDomainHashes(void);
+
         /* SERVICE TXT */
         stcMDNSServiceTxt* _allocServiceTxt(stcMDNSService* p_pService, const char* p_pcKey,
                                             const char* p_pcValue, bool p_bTemp);
@@ -50,6 +50,11 @@ namespace esp8266
 namespace MDNSImplementation
 {
 
+#ifdef MDNS_IP4_SUPPORT
+    // Encoded tail of every reverse IP4 domain (eg. 120.2.168.192.in-addr.arpa)
+    static const char scacReverseIP4Suffix[] = "\x07" "in-addr" "\x04" "arpa";
+#endif
+
     /**
         CONTROL
     */
@@ -122,7 +127,8 @@ namespace MDNSImplementation
         bool bResult = false;
 
         stcMDNS_MsgHeader header;
-        if (_readMDNSMsgHeader(header))
+        if ((_udpLoadMessage()) &&  // Copy the datagram into the RX buffer
+            (_readMDNSMsgHeader(header)))
         {
             if (0 == header.m_4bOpcode)  // A standard query
             {
@@ -158,6 +164,7 @@ namespace MDNSImplementation
                 PSTR("[MDNSResponder] _parseMessage: FAILED to read header\n")););
             m_pUDPContext->flush();
         }
+        _udpReleaseMessage();
         DEBUG_EX_INFO(unsigned uFreeHeap = ESP.getFreeHeap(); DEBUG_OUTPUT.printf_P(
             PSTR("[MDNSResponder] _parseMessage: Done (%s after %lu ms, ate %i bytes, remaining "
                  "%u)\n\n"),
@@ -188,6 +195,8 @@ namespace MDNSImplementation
     {
         bool bResult = true;
 
+        _updateDomainHashes();  // For the fast paths in _replyMaskForHost/_replyMaskForService
+
         stcMDNSSendParameter sendParameter;
         uint8_t              u8HostOrServiceReplies = 0;
         for (uint16_t qd = 0; ((bResult) && (qd < p_MsgHeader.m_u16QDCount)); ++qd)
@@ -2208,6 +2217,9 @@ namespace MDNSImplementation
        PTR_IP4 (eg. esp8266.local) reply.
 
         In addition, a full name match (question domain == host domain) is marked.
+
+        Domains are only built and compared, if the domain hash (see _updateDomainHashes)
+        matches; questions for foreign names are rejected without building any domain.
     */
     uint8_t MDNSResponder::_replyMaskForHost(const MDNSResponder::stcMDNS_RRHeader& p_RRHeader,
                                              bool* p_pbFullNameMatch /*= 0*/) const
@@ -2216,6 +2228,7 @@ namespace MDNSImplementation
 
         uint8_t u8ReplyMask = 0;
         (p_pbFullNameMatch ? * p_pbFullNameMatch = false : 0);
+        bool bHashes = ((m_bDomainHashesValid) && (p_RRHeader.m_u32DomainHash));
 
         if ((DNS_RRCLASS_IN == p_RRHeader.m_Attributes.m_u16Class)
             || (DNS_RRCLASS_ANY == p_RRHeader.m_Attributes.m_u16Class))
@@ -2226,7 +2239,11 @@ namespace MDNSImplementation
                 // PTR request
 #ifdef MDNS_IP4_SUPPORT
                 stcMDNS_RRDomain reverseIP4Domain;
-                for (netif* pNetIf = netif_list; pNetIf; pNetIf = pNetIf->next)
+                for (netif* pNetIf = netif_list;
+                     ((pNetIf)
+                      && (p_RRHeader.m_Domain.hasSuffix(scacReverseIP4Suffix,
+                                                        sizeof(scacReverseIP4Suffix))));
+                     pNetIf = pNetIf->next)
                 {
                     if (netif_is_up(pNetIf) && IPAddress(pNetIf->ip_addr).isSet())
                     {
@@ -2245,7 +2262,8 @@ namespace MDNSImplementation
             }  // Address qeuest
 
             stcMDNS_RRDomain hostDomain;
-            if ((_buildDomainForHost(m_pcHostname, hostDomain))
+            if (((!bHashes) || (p_RRHeader.m_u32DomainHash == m_u32HostDomainHash))
+                && (_buildDomainForHost(m_pcHostname, hostDomain))
                 && (p_RRHeader.m_Domain == hostDomain))  // Host domain match
             {
                 (p_pbFullNameMatch ? (*p_pbFullNameMatch = true) : (0));
@@ -2295,6 +2313,7 @@ namespace MDNSImplementation
        c#=1) answer
 
         In addition, a full name match (question domain == service instance domain) is marked.
+        As in _replyMaskForHost, domains are only built for matching domain hashes.
     */
     uint8_t MDNSResponder::_replyMaskForService(const MDNSResponder::stcMDNS_RRHeader& p_RRHeader,
                                                 const MDNSResponder::stcMDNSService&   p_Service,
@@ -2302,12 +2321,14 @@ namespace MDNSImplementation
     {
         uint8_t u8ReplyMask = 0;
         (p_pbFullNameMatch ? * p_pbFullNameMatch = false : 0);
+        bool bHashes = ((m_bDomainHashesValid) && (p_RRHeader.m_u32DomainHash));
 
         if ((DNS_RRCLASS_IN == p_RRHeader.m_Attributes.m_u16Class)
             || (DNS_RRCLASS_ANY == p_RRHeader.m_Attributes.m_u16Class))
         {
             stcMDNS_RRDomain DNSSDDomain;
-            if ((_buildDomainForDNSSD(DNSSDDomain)) &&  // _services._dns-sd._udp.local
+            if (((!bHashes) || (p_RRHeader.m_u32DomainHash == m_u32DNSSDDomainHash))
+                && (_buildDomainForDNSSD(DNSSDDomain)) &&  // _services._dns-sd._udp.local
                 (p_RRHeader.m_Domain == DNSSDDomain)
                 && ((DNS_RRTYPE_PTR == p_RRHeader.m_Attributes.m_u16Type)
                     || (DNS_RRTYPE_ANY == p_RRHeader.m_Attributes.m_u16Type)))
@@ -2317,7 +2338,8 @@ namespace MDNSImplementation
             }
 
             stcMDNS_RRDomain serviceDomain;
-            if ((_buildDomainForService(p_Service, false, serviceDomain))
+            if (((!bHashes) || (p_RRHeader.m_u32DomainHash == p_Service.m_u32TypeDomainHash))
+                && (_buildDomainForService(p_Service, false, serviceDomain))
                 &&  // eg. _http._tcp.local
                 (p_RRHeader.m_Domain == serviceDomain)
                 && ((DNS_RRTYPE_PTR == p_RRHeader.m_Attributes.m_u16Type)
@@ -2327,7 +2349,8 @@ namespace MDNSImplementation
                 u8ReplyMask |= ContentFlag_PTR_NAME;
             }
 
-            if ((_buildDomainForService(p_Service, true, serviceDomain))
+            if (((!bHashes) || (p_RRHeader.m_u32DomainHash == p_Service.m_u32NameDomainHash))
+                && (_buildDomainForService(p_Service, true, serviceDomain))
                 &&  // eg. MyESP._http._tcp.local
                 (p_RRHeader.m_Domain == serviceDomain))
             {
@@ -397,6 +397,7 @@ namespace MDNSImplementation
             delete[] m_pcHostname;
             m_pcHostname = 0;
         }
+        _invalidateAnswers();
         return true;
     }
 
@@ -426,6 +427,8 @@ namespace MDNSImplementation
             // Add to list (or start list)
             pService->m_pNext = m_pServices;
             m_pServices       = pService;
+
+            _invalidateAnswers();
         }
         return pService;
     }
@@ -439,6 +442,8 @@ namespace MDNSImplementation
 
         if (p_pService)
         {
+            _invalidateAnswers();
+
             stcMDNSService* pPred = m_pServices;
             while ((pPred) && (pPred->m_pNext != p_pService))
             {
@@ -521,6 +526,157 @@ namespace MDNSImplementation
         return pService;
     }
 
+    /*
+        ANSWER CACHE
+    */
+
+    /*
+        MDNSResponder::_answerCacheKey
+
+        A response packet only depends on the requested answers (host and service reply masks),
+        the authoritative and cache flush flags and the interface IP address, as long as the
+        host and services don't change (see _invalidateAnswers). These make the key of a
+        compiled response.
+        Returns the key length, or 0 if the response can't be cached (queries, probes, legacy
+        responses, unannouncements and dynamic TXT items).
+    */
+    uint8_t MDNSResponder::_answerCacheKey(const MDNSResponder::stcMDNSSendParameter& p_SendParameter,
+                                           IPAddress p_IPAddress, uint8_t* p_pu8Key) const
+    {
+        uint8_t u8KeyLength = 0;
+
+        if ((MDNS_ANSWER_CACHE_SIZE) && (p_SendParameter.m_bResponse)
+            && (!p_SendParameter.m_bLegacyQuery) && (!p_SendParameter.m_bUnannounce)
+            && (!p_SendParameter.m_pQuestions) && (!p_SendParameter.m_u16ID))
+        {
+            p_pu8Key[u8KeyLength++] = ((p_SendParameter.m_bAuthorative ? 0x01 : 0)
+                                       | (p_SendParameter.m_bCacheFlush ? 0x02 : 0));
+            p_pu8Key[u8KeyLength++] = p_SendParameter.m_u8HostReplyMask;
+            for (uint8_t u = 0; u < 4; ++u)
+            {
+                p_pu8Key[u8KeyLength++] = p_IPAddress[u];
+            }
+            for (stcMDNSService* pService = m_pServices; ((u8KeyLength) && (pService));
+                 pService                 = pService->m_pNext)
+            {
+                if ((MDNS_ANSWER_CACHE_KEYLENGTH == u8KeyLength)
+                    || ((pService->m_u8ReplyMask & (ContentFlag_PTR_NAME | ContentFlag_TXT))
+                        &&  // TXT items are written
+                        ((m_fnServiceTxtCallback) || (pService->m_fnTxtCallback))))
+                {
+                    u8KeyLength = 0;
+                }
+                else
+                {
+                    p_pu8Key[u8KeyLength++] = pService->m_u8ReplyMask;
+                }
+            }
+        }
+        return u8KeyLength;
+    }
+
+    /*
+        MDNSResponder::_findCachedAnswer
+
+        A found answer is moved to the front of the list (least recently used last).
+    */
+    MDNSResponder::stcMDNSAnswerCacheItem*
+    MDNSResponder::_findCachedAnswer(const uint8_t* p_pu8Key, uint8_t p_u8KeyLength)
+    {
+        stcMDNSAnswerCacheItem* pPred   = 0;
+        stcMDNSAnswerCacheItem* pAnswer = m_pAnswerCache;
+        while ((pAnswer)
+               && ((p_u8KeyLength != pAnswer->m_u8KeyLength)
+                   || (0 != memcmp(p_pu8Key, pAnswer->m_au8Key, p_u8KeyLength))))
+        {
+            pPred   = pAnswer;
+            pAnswer = pAnswer->m_pNext;
+        }
+        if ((pAnswer) && (pPred))
+        {
+            pPred->m_pNext   = pAnswer->m_pNext;
+            pAnswer->m_pNext = m_pAnswerCache;
+            m_pAnswerCache   = pAnswer;
+        }
+        return pAnswer;
+    }
+
+    /*
+        MDNSResponder::_addCachedAnswer
+
+        Adds the answer to the front of the list and drops the least recently used answers
+        beyond MDNS_ANSWER_CACHE_SIZE.
+    */
+    bool MDNSResponder::_addCachedAnswer(MDNSResponder::stcMDNSAnswerCacheItem* p_pAnswer)
+    {
+        bool bResult = false;
+
+        if ((MDNS_ANSWER_CACHE_SIZE) && (p_pAnswer))
+        {
+            p_pAnswer->m_pNext = m_pAnswerCache;
+            m_pAnswerCache     = p_pAnswer;
+
+            stcMDNSAnswerCacheItem* pLast = m_pAnswerCache;
+            for (uint32_t u = 1; ((pLast) && (u < MDNS_ANSWER_CACHE_SIZE)); ++u)
+            {
+                pLast = pLast->m_pNext;
+            }
+            while ((pLast) && (pLast->m_pNext))
+            {
+                stcMDNSAnswerCacheItem* pNext = pLast->m_pNext->m_pNext;
+                delete pLast->m_pNext;
+                pLast->m_pNext = pNext;
+            }
+            bResult = true;
+        }
+        return bResult;
+    }
+
+    /*
+        MDNSResponder::_invalidateAnswers
+
+        Drops all compiled responses and the domain hashes. Needs to be called, whenever the
+        host or service domains or static TXT items change.
+    */
+    bool MDNSResponder::_invalidateAnswers(void)
+    {
+        while (m_pAnswerCache)
+        {
+            stcMDNSAnswerCacheItem* pNext = m_pAnswerCache->m_pNext;
+            delete m_pAnswerCache;
+            m_pAnswerCache = pNext;
+        }
+        m_bDomainHashesValid = false;
+        return true;
+    }
+
+    /*
+        MDNSResponder::_updateDomainHashes
+
+        (Re-)Builds the hashes of the host, DNS-SD and service domains, if invalid.
+        A missing domain (eg. no hostname) gets the hash 0, which never matches (see
+        _replyMaskForHost).
+    */
+    bool MDNSResponder::_updateDomainHashes(void)
+    {
+        if (!m_bDomainHashesValid)
+        {
+            stcMDNS_RRDomain domain;
+            m_u32HostDomainHash
+                = (_buildDomainForHost(m_pcHostname, domain) ? domain.hash() : 0);
+            m_u32DNSSDDomainHash = (_buildDomainForDNSSD(domain) ? domain.hash() : 0);
+            for (stcMDNSService* pService = m_pServices; pService; pService = pService->m_pNext)
+            {
+                pService->m_u32TypeDomainHash
+                    = (_buildDomainForService(*pService, false, domain) ? domain.hash() : 0);
+                pService->m_u32NameDomainHash
+                    = (_buildDomainForService(*pService, true, domain) ? domain.hash() : 0);
+            }
+            m_bDomainHashesValid = true;
+        }
+        return true;
+    }
+
     /*
         SERVICE TXT
     */
@@ -564,6 +720,11 @@ namespace MDNSImplementation
 
                 // Add to list (or start list)
                 p_pService->m_Txts.add(pTxt);
+
+                if (!p_bTemp)  // Temporary (dynamic) TXTs are never part of compiled responses
+                {
+                    _invalidateAnswers();
+                }
             }
         }
         return pTxt;
@@ -575,7 +736,8 @@ namespace MDNSImplementation
     bool MDNSResponder::_releaseServiceTxt(MDNSResponder::stcMDNSService*    p_pService,
                                            MDNSResponder::stcMDNSServiceTxt* p_pTxt)
     {
-        return ((p_pService) && (p_pTxt) && (p_pService->m_Txts.remove(p_pTxt)));
+        return ((p_pService) && (p_pTxt) && ((p_pTxt->m_bTemp) || (_invalidateAnswers()))
+                && (p_pService->m_Txts.remove(p_pTxt)));
     }
 
     /*
@@ -593,6 +755,10 @@ namespace MDNSImplementation
         {
             p_pTxt->update(p_pcValue);
             p_pTxt->m_bTemp = p_bTemp;
+            if (!p_bTemp)
+            {
+                _invalidateAnswers();
+            }
         }
         return p_pTxt;
     }
@@ -745,6 +745,37 @@ namespace MDNSImplementation
         return compare(p_Other);
     }
 
+    /*
+        MDNSResponder::stcMDNS_RRDomain::hash
+
+        FNV-1a hash of the encoded name, case insensitive like 'compare': equal domains
+        have equal hashes.
+    */
+    uint32_t MDNSResponder::stcMDNS_RRDomain::hash(void) const
+    {
+        uint32_t u32Hash = 2166136261UL;
+        for (uint16_t u = 0; u < m_u16NameLength; ++u)
+        {
+            u32Hash = ((u32Hash ^ (uint8_t)tolower((unsigned char)m_acName[u])) * 16777619UL);
+        }
+        return u32Hash;
+    }
+
+    /*
+        MDNSResponder::stcMDNS_RRDomain::hasSuffix
+
+        Checks (case insensitive) if the encoded name ends with p_pcSuffix (an encoded
+        name of p_u16Length bytes, incl. '\0').
+    */
+    bool MDNSResponder::stcMDNS_RRDomain::hasSuffix(const char* p_pcSuffix,
+                                                    uint16_t    p_u16Length) const
+    {
+        return ((p_u16Length <= m_u16NameLength)
+                && (0
+                    == strncasecmp(&m_acName[m_u16NameLength - p_u16Length], p_pcSuffix,
+                                   p_u16Length)));
+    }
+
     /*
         MDNSResponder::stcMDNS_RRDomain::operator !=
     */
@@ -851,7 +882,7 @@ namespace MDNSImplementation
     /*
         MDNSResponder::stcMDNS_RRHeader::stcMDNS_RRHeader constructor
     */
-    MDNSResponder::stcMDNS_RRHeader::stcMDNS_RRHeader(void) { }
+    MDNSResponder::stcMDNS_RRHeader::stcMDNS_RRHeader(void) : m_u32DomainHash(0) { }
 
     /*
         MDNSResponder::stcMDNS_RRHeader::stcMDNS_RRHeader copy-constructor
@@ -869,8 +900,9 @@ namespace MDNSImplementation
     {
         if (&p_Other != this)
         {
-            m_Domain     = p_Other.m_Domain;
-            m_Attributes = p_Other.m_Attributes;
+            m_Domain        = p_Other.m_Domain;
+            m_Attributes    = p_Other.m_Attributes;
+            m_u32DomainHash = p_Other.m_u32DomainHash;
         }
         return *this;
     }
@@ -881,6 +913,7 @@ namespace MDNSImplementation
     bool MDNSResponder::stcMDNS_RRHeader::clear(void)
     {
         m_Domain.clear();
+        m_u32DomainHash = 0;
         return true;
     }
 
@@ -1214,7 +1247,7 @@ namespace MDNSImplementation
                                                   const char* p_pcProtocol /*= 0*/) :
         m_pNext(0),
         m_pcName(0), m_bAutoName(false), m_pcService(0), m_pcProtocol(0), m_u16Port(0),
-        m_u8ReplyMask(0), m_fnTxtCallback(0)
+        m_u8ReplyMask(0), m_fnTxtCallback(0), m_u32TypeDomainHash(0), m_u32NameDomainHash(0)
     {
         setName(p_pcName);
         setService(p_pcService);
@@ -2293,6 +2326,96 @@ namespace MDNSImplementation
         return (pCacheItem ? pCacheItem->m_u16Offset : 0);
     }
 
+    /**
+        MDNSResponder::stcMDNSAnswerCacheItem
+
+        A compiled response packet. The packet is collected while it is written
+        (see _udpAppendBuffer) and compacted once complete.
+    */
+
+    /*
+        MDNSResponder::stcMDNSAnswerCacheItem::stcMDNSAnswerCacheItem constructor
+    */
+    MDNSResponder::stcMDNSAnswerCacheItem::stcMDNSAnswerCacheItem(const uint8_t* p_pu8Key,
+                                                                  uint8_t        p_u8KeyLength) :
+        m_pNext(0),
+        m_u8KeyLength(p_u8KeyLength), m_pucPacket(0), m_u16Length(0), m_u16Capacity(0)
+    {
+        memcpy(m_au8Key, p_pu8Key, p_u8KeyLength);
+    }
+
+    /*
+        MDNSResponder::stcMDNSAnswerCacheItem::~stcMDNSAnswerCacheItem destructor
+    */
+    MDNSResponder::stcMDNSAnswerCacheItem::~stcMDNSAnswerCacheItem(void)
+    {
+        if (m_pucPacket)
+        {
+            delete[] m_pucPacket;
+        }
+    }
+
+    /*
+        MDNSResponder::stcMDNSAnswerCacheItem::append
+    */
+    bool MDNSResponder::stcMDNSAnswerCacheItem::append(const unsigned char* p_pcBuffer,
+                                                       size_t               p_stLength)
+    {
+        bool bResult = (std::numeric_limits<uint16_t>::max() >= (m_u16Length + p_stLength));
+
+        if ((bResult) && (m_u16Capacity < (m_u16Length + p_stLength)))
+        {
+            // Grow by doubling, the packet is written in many small pieces
+            size_t stCapacity = (m_u16Capacity ? (2 * m_u16Capacity) : 256);
+            while (stCapacity < (m_u16Length + p_stLength))
+            {
+                stCapacity *= 2;
+            }
+            stCapacity = std::min(stCapacity, (size_t)std::numeric_limits<uint16_t>::max());
+
+            unsigned char* pucPacket = new unsigned char[stCapacity];
+            if ((bResult = (0 != pucPacket)))
+            {
+                if (m_pucPacket)
+                {
+                    memcpy(pucPacket, m_pucPacket, m_u16Length);
+                    delete[] m_pucPacket;
+                }
+                m_pucPacket   = pucPacket;
+                m_u16Capacity = stCapacity;
+            }
+        }
+        if (bResult)
+        {
+            memcpy(&m_pucPacket[m_u16Length], p_pcBuffer, p_stLength);
+            m_u16Length += p_stLength;
+        }
+        return bResult;
+    }
+
+    /*
+        MDNSResponder::stcMDNSAnswerCacheItem::compact
+
+        Releases the unused capacity
+    */
+    bool MDNSResponder::stcMDNSAnswerCacheItem::compact(void)
+    {
+        bool bResult = true;
+
+        if ((m_u16Length) && (m_u16Length < m_u16Capacity))
+        {
+            unsigned char* pucPacket = new unsigned char[m_u16Length];
+            if ((bResult = (0 != pucPacket)))
+            {
+                memcpy(pucPacket, m_pucPacket, m_u16Length);
+                delete[] m_pucPacket;
+                m_pucPacket   = pucPacket;
+                m_u16Capacity = m_u16Length;
+            }
+        }
+        return bResult;
+    }
+
 }  // namespace MDNSImplementation
 
 }  // namespace esp8266
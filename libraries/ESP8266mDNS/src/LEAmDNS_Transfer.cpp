@@ -160,6 +160,9 @@ namespace MDNSImplementation
         while in the seconds loop, the header and all queries and answers are written to the UDP
         output buffer.
 
+        Responses are compiled: the written packet is kept (see _answerCacheKey), and sent
+        as is when the same answers are asked for again.
+
     */
     bool MDNSResponder::_prepareMDNSMessage(MDNSResponder::stcMDNSSendParameter& p_rSendParameter,
                                             IPAddress                            p_IPAddress)
@@ -169,6 +172,21 @@ namespace MDNSImplementation
         p_rSendParameter.clearCachedNames();  // Need to remove cached names, p_SendParameter might
                                               // have been used before on other interface
 
+        uint8_t au8Key[MDNS_ANSWER_CACHE_KEYLENGTH];
+        uint8_t u8KeyLength = _answerCacheKey(p_rSendParameter, p_IPAddress, au8Key);
+        if (u8KeyLength)
+        {
+            stcMDNSAnswerCacheItem* pCachedAnswer = _findCachedAnswer(au8Key, u8KeyLength);
+            if (pCachedAnswer)
+            {
+                DEBUG_EX_INFO(DEBUG_OUTPUT.printf_P(
+                    PSTR("[MDNSResponder] _prepareMDNSMessage: Compiled response (%u bytes)\n"),
+                    pCachedAnswer->m_u16Length););
+                return _udpAppendBuffer(pCachedAnswer->m_pucPacket, pCachedAnswer->m_u16Length);
+            }
+            m_pAnswerCapture = new stcMDNSAnswerCacheItem(au8Key, u8KeyLength);
+        }
+
         // Prepare header; count answers
         stcMDNS_MsgHeader msgHeader(p_rSendParameter.m_u16ID, p_rSendParameter.m_bResponse, 0,
                                     p_rSendParameter.m_bAuthorative);
@@ -381,6 +399,16 @@ namespace MDNSImplementation
             DEBUG_EX_ERR(if (!bResult) DEBUG_OUTPUT.printf_P(
                 PSTR("[MDNSResponder] _prepareMDNSMessage: Loop %i FAILED!\n"), sequence););
         }  // for sequence
+
+        if (m_pAnswerCapture)  // Might have been dropped (out of memory)
+        {
+            if ((!bResult) || (!m_pAnswerCapture->compact())
+                || (!_addCachedAnswer(m_pAnswerCapture)))
+            {
+                delete m_pAnswerCapture;
+            }
+            m_pAnswerCapture = 0;
+        }
         DEBUG_EX_ERR(if (!bResult) DEBUG_OUTPUT.printf_P(
             PSTR("[MDNSResponder] _prepareMDNSMessage: FAILED!\n")););
         return bResult;
@@ -479,6 +507,7 @@ namespace MDNSImplementation
         is transferred the answer specific reading functions.
         Unknown answer types are processed by the generic answer reader (to remove them
         from the input buffer).
+        Reading continues behind the RData, even if the specific reader didn't use all of it.
 
     */
     bool MDNSResponder::_readRRAnswer(MDNSResponder::stcMDNS_RRAnswer*& p_rpRRAnswer)
@@ -490,8 +519,10 @@ namespace MDNSImplementation
         stcMDNS_RRHeader header;
         uint32_t         u32TTL;
         uint16_t         u16RDLength;
-        if ((_readRRHeader(header)) && (_udpRead32(u32TTL)) && (_udpRead16(u16RDLength)))
+        if ((_readRRHeader(header)) && (_udpRead32(u32TTL)) && (_udpRead16(u16RDLength))
+            && (u16RDLength <= (m_u16RXLength - m_u16RXOffset)))  // RData in message
         {
+            uint16_t u16RDEnd = (m_u16RXOffset + u16RDLength);
             /*  DEBUG_EX_INFO(
                     DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRAnswer: Reading 0x%04X answer
                (class:0x%04X, TTL:%u, RDLength:%u) for "), header.m_Attributes.m_u16Type,
@@ -533,6 +564,8 @@ namespace MDNSImplementation
                     = _readRRAnswerGeneric(*(stcMDNS_RRAnswerGeneric*&)p_rpRRAnswer, u16RDLength);
                 break;
             }
+            bResult       = ((bResult) && (m_u16RXOffset <= u16RDEnd));
+            m_u16RXOffset = u16RDEnd;
             DEBUG_EX_INFO(
                 if ((bResult) && (p_rpRRAnswer)) {
                     DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRAnswer: "));
@@ -629,6 +662,7 @@ namespace MDNSImplementation
         MDNSResponder::_readRRAnswerTXT
 
         Read TXT items from a buffer like 4c#=15ff=20
+        The items are parsed in place, in the receive buffer.
     */
     bool MDNSResponder::_readRRAnswerTXT(MDNSResponder::stcMDNS_RRAnswerTXT& p_rRRAnswerTXT,
                                          uint16_t                            p_u16RDLength)
@@ -642,106 +676,106 @@ namespace MDNSImplementation
         {
             bResult = false;
 
-            unsigned char* pucBuffer = new unsigned char[p_u16RDLength];
+            const unsigned char* pucBuffer
+                = ((m_pucRXBuffer) && (p_u16RDLength <= (m_u16RXLength - m_u16RXOffset))
+                       ? &m_pucRXBuffer[m_u16RXOffset]
+                       : 0);
             if (pucBuffer)
             {
-                if (_udpReadBuffer(pucBuffer, p_u16RDLength))
+                m_u16RXOffset += p_u16RDLength;
+                bResult = true;
+
+                const unsigned char* pucEnd    = (pucBuffer + p_u16RDLength);
+                const unsigned char* pucCursor = pucBuffer;
+                while ((pucCursor < pucEnd) && (bResult))
                 {
-                    bResult = true;
+                    bResult = false;
 
-                    const unsigned char* pucCursor = pucBuffer;
-                    while ((pucCursor < (pucBuffer + p_u16RDLength)) && (bResult))
+                    stcMDNSServiceTxt* pTxt     = 0;
+                    unsigned char      ucLength = *pucCursor++;  // Length of the next txt item
+                    if (ucLength > (pucEnd - pucCursor))
                     {
-                        bResult = false;
-
-                        stcMDNSServiceTxt* pTxt     = 0;
-                        unsigned char      ucLength = *pucCursor++;  // Length of the next txt item
-                        if (ucLength)
+                        DEBUG_EX_ERR(
+                            DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRAnswerTXT: "
+                                                       "INVALID TXT item length!\n")););
+                    }
+                    else if (ucLength)
+                    {
+                        DEBUG_EX_INFO(
+                            static char sacBuffer[64]; *sacBuffer = 0;
+                            uint8_t     u8MaxLength
+                            = ((ucLength > (sizeof(sacBuffer) - 1)) ? (sizeof(sacBuffer) - 1)
+                                                                    : ucLength);
+                            os_strncpy(sacBuffer, (const char*)pucCursor, u8MaxLength);
+                            sacBuffer[u8MaxLength] = 0; DEBUG_OUTPUT.printf_P(
+                                PSTR("[MDNSResponder] _readRRAnswerTXT: Item(%u): %s\n"),
+                                ucLength, sacBuffer););
+
+                        const unsigned char* pucEqualSign = (const unsigned char*)memchr(
+                            pucCursor, '=', ucLength);  // Position of the '=' sign
+                        unsigned char ucKeyLength;
+                        if ((pucEqualSign) && ((ucKeyLength = (pucEqualSign - pucCursor))))
                         {
-                            DEBUG_EX_INFO(
-                                static char sacBuffer[64]; *sacBuffer = 0;
-                                uint8_t     u8MaxLength
-                                = ((ucLength > (sizeof(sacBuffer) - 1)) ? (sizeof(sacBuffer) - 1)
-                                                                        : ucLength);
-                                os_strncpy(sacBuffer, (const char*)pucCursor, u8MaxLength);
-                                sacBuffer[u8MaxLength] = 0; DEBUG_OUTPUT.printf_P(
-                                    PSTR("[MDNSResponder] _readRRAnswerTXT: Item(%u): %s\n"),
-                                    ucLength, sacBuffer););
-
-                            unsigned char* pucEqualSign = (unsigned char*)os_strchr(
-                                (const char*)pucCursor, '=');  // Position of the '=' sign
-                            unsigned char ucKeyLength;
-                            if ((pucEqualSign) && ((ucKeyLength = (pucEqualSign - pucCursor))))
-                            {
-                                unsigned char ucValueLength
-                                    = (ucLength - (pucEqualSign - pucCursor + 1));
-                                bResult = (((pTxt = new stcMDNSServiceTxt))
-                                           && (pTxt->setKey((const char*)pucCursor, ucKeyLength))
-                                           && (pTxt->setValue((const char*)(pucEqualSign + 1),
-                                                              ucValueLength)));
-                            }
-                            else
-                            {
-                                DEBUG_EX_ERR(
-                                    DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRAnswerTXT: "
-                                                               "INVALID TXT format (No '=')!\n")););
-                            }
-                            pucCursor += ucLength;
+                            unsigned char ucValueLength
+                                = (ucLength - (pucEqualSign - pucCursor + 1));
+                            bResult = (((pTxt = new stcMDNSServiceTxt))
+                                       && (pTxt->setKey((const char*)pucCursor, ucKeyLength))
+                                       && (pTxt->setValue((const char*)(pucEqualSign + 1),
+                                                          ucValueLength)));
                         }
-                        else  // no/zero length TXT
+                        else
                         {
-                            DEBUG_EX_INFO(
-                                DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRAnswerTXT: TXT "
-                                                           "answer contains no items.\n")););
-                            bResult = true;
+                            DEBUG_EX_ERR(
+                                DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRAnswerTXT: "
+                                                           "INVALID TXT format (No '=')!\n")););
                         }
+                        pucCursor += ucLength;
+                    }
+                    else  // no/zero length TXT
+                    {
+                        DEBUG_EX_INFO(
+                            DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRAnswerTXT: TXT "
+                                                       "answer contains no items.\n")););
+                        bResult = true;
+                    }
 
-                        if ((bResult) && (pTxt))  // Everything is fine so far
+                    if ((bResult) && (pTxt))  // Everything is fine so far
+                    {
+                        // Link TXT item to answer TXTs
+                        pTxt->m_pNext                 = p_rRRAnswerTXT.m_Txts.m_pTxts;
+                        p_rRRAnswerTXT.m_Txts.m_pTxts = pTxt;
+                    }
+                    else  // At least no TXT (might be OK, if length was 0) OR an error
+                    {
+                        if (!bResult)
                         {
-                            // Link TXT item to answer TXTs
-                            pTxt->m_pNext                 = p_rRRAnswerTXT.m_Txts.m_pTxts;
-                            p_rRRAnswerTXT.m_Txts.m_pTxts = pTxt;
+                            DEBUG_EX_ERR(
+                                DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRAnswerTXT: "
+                                                           "FAILED to read TXT item!\n"));
+                                DEBUG_OUTPUT.printf_P(PSTR("RData dump:\n")); _udpDump(
+                                    (m_u16RXOffset - p_u16RDLength), p_u16RDLength);
+                                DEBUG_OUTPUT.printf_P(PSTR("\n")););
                         }
-                        else  // At least no TXT (might be OK, if length was 0) OR an error
+                        if (pTxt)
                         {
-                            if (!bResult)
-                            {
-                                DEBUG_EX_ERR(
-                                    DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRAnswerTXT: "
-                                                               "FAILED to read TXT item!\n"));
-                                    DEBUG_OUTPUT.printf_P(PSTR("RData dump:\n")); _udpDump(
-                                        (m_pUDPContext->tell() - p_u16RDLength), p_u16RDLength);
-                                    DEBUG_OUTPUT.printf_P(PSTR("\n")););
-                            }
-                            if (pTxt)
-                            {
-                                delete pTxt;
-                                pTxt = 0;
-                            }
-                            p_rRRAnswerTXT.clear();
+                            delete pTxt;
+                            pTxt = 0;
                         }
-                    }  // while
-
-                    DEBUG_EX_ERR(if (!bResult)  // Some failure
-                                 {
-                                     DEBUG_OUTPUT.printf_P(PSTR("RData dump:\n"));
-                                     _udpDump((m_pUDPContext->tell() - p_u16RDLength),
-                                              p_u16RDLength);
-                                     DEBUG_OUTPUT.printf_P(PSTR("\n"));
-                                 });
-                }
-                else
-                {
-                    DEBUG_EX_ERR(DEBUG_OUTPUT.printf_P(
-                        PSTR("[MDNSResponder] _readRRAnswerTXT: FAILED to read TXT content!\n")););
-                }
-                // Clean up
-                delete[] pucBuffer;
+                        p_rRRAnswerTXT.clear();
+                    }
+                }  // while
+
+                DEBUG_EX_ERR(if (!bResult)  // Some failure
+                             {
+                                 DEBUG_OUTPUT.printf_P(PSTR("RData dump:\n"));
+                                 _udpDump((m_u16RXOffset - p_u16RDLength), p_u16RDLength);
+                                 DEBUG_OUTPUT.printf_P(PSTR("\n"));
+                             });
             }
             else
             {
-                DEBUG_EX_ERR(DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRAnswerTXT: FAILED "
-                                                        "to alloc buffer for TXT content!\n")););
+                DEBUG_EX_ERR(DEBUG_OUTPUT.printf_P(
+                    PSTR("[MDNSResponder] _readRRAnswerTXT: FAILED to read TXT content!\n")););
             }
         }
         else
@@ -811,6 +845,7 @@ namespace MDNSImplementation
 
         bool bResult = ((_readRRDomain(p_rRRHeader.m_Domain))
                         && (_readRRAttributes(p_rRRHeader.m_Attributes)));
+        p_rRRHeader.m_u32DomainHash = (bResult ? p_rRRHeader.m_Domain.hash() : 0);
         DEBUG_EX_ERR(if (!bResult)
                          DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRHeader: FAILED!\n")););
         return bResult;
@@ -819,139 +854,85 @@ namespace MDNSImplementation
     /*
         MDNSResponder::_readRRDomain
 
-        Reads a (maybe multilevel compressed) domain from the UDP input buffer.
+        Reads a (maybe multilevel compressed) domain from the receive buffer.
+        Compressed labels are followed in the buffer, without moving the read position:
+        after the domain, reading continues behind the first compression pointer (or the
+        closing '\0'). The first pointer must point backwards, every further one below the
+        target of the previous one: the targets strictly decrease, so the labels read can not
+        loop. A pointer back into its own name (like 'a' + pointer to the 'a') is refused too.
+        The number of redirections is limited by MDNS_DOMAIN_MAX_REDIRCTION in addition.
 
     */
     bool MDNSResponder::_readRRDomain(MDNSResponder::stcMDNS_RRDomain& p_rRRDomain)
     {
         // DEBUG_EX_INFO(DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRDomain\n")););
 
-        bool bResult = ((p_rRRDomain.clear()) && (_readRRDomain_Loop(p_rRRDomain, 0)));
-        DEBUG_EX_ERR(if (!bResult)
-                         DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRDomain: FAILED!\n")););
-        return bResult;
-    }
-
-    /*
-        MDNSResponder::_readRRDomain_Loop
-
-        Reads a domain from the UDP input buffer. For every compression level, the functions
-        calls itself recursively. To avoid endless recursion because of malformed MDNS records,
-        the maximum recursion depth is set by MDNS_DOMAIN_MAX_REDIRCTION.
-
-    */
-    bool MDNSResponder::_readRRDomain_Loop(MDNSResponder::stcMDNS_RRDomain& p_rRRDomain,
-                                           uint8_t                          p_u8Depth)
-    {
-        // DEBUG_EX_INFO(DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRDomain_Loop(%u)\n"),
-        // p_u8Depth););
-
-        bool bResult = false;
-
-        if (MDNS_DOMAIN_MAX_REDIRCTION >= p_u8Depth)
+        bool     bResult     = ((m_pucRXBuffer) && (p_rRRDomain.clear()));
+        uint16_t u16Offset   = m_u16RXOffset;  // Label cursor
+        uint16_t u16Continue = 0;              // Read position behind the first pointer
+        uint16_t u16Target   = 0;              // Target of the last pointer
+        uint8_t  u8Redirections = 0;
+        uint8_t  u8Len          = 0;
+        do
         {
-            bResult = true;
-
-            uint8_t u8Len = 0;
-            do
+            bResult = ((bResult) && (u16Offset < m_u16RXLength));
+            if (bResult)
             {
-                // DEBUG_EX_INFO(DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRDomain_Loop(%u):
-                // Offset:%u p0:%02x\n"), p_u8Depth, m_pUDPContext->tell(),
-                // m_pUDPContext->peek()););
-                _udpRead8(u8Len);
-
-                if (u8Len & MDNS_DOMAIN_COMPRESS_MARK)
+                u8Len = m_pucRXBuffer[u16Offset];
+                if (MDNS_DOMAIN_COMPRESS_MARK == (u8Len & MDNS_DOMAIN_COMPRESS_MARK))
                 {
                     // Compressed label(s)
-                    uint16_t u16Offset = ((u8Len & ~MDNS_DOMAIN_COMPRESS_MARK)
-                                          << 8);  // Implicit BE to LE conversion!
-                    _udpRead8(u8Len);
-                    u16Offset |= u8Len;
-
-                    if (m_pUDPContext->isValidOffset(u16Offset))
+                    uint16_t u16Pointer = 0;
+                    if (((u16Offset + 1) < m_u16RXLength)
+                        && (MDNS_DOMAIN_MAX_REDIRCTION > u8Redirections++)
+                        && ((u16Pointer = (((u8Len & ~MDNS_DOMAIN_COMPRESS_MARK) << 8)
+                                           | m_pucRXBuffer[u16Offset + 1]))
+                            < (u16Continue ? u16Target : u16Offset)))
                     {
-                        size_t stCurrentPosition
-                            = m_pUDPContext->tell();  // Prepare return from recursion
-
                         // DEBUG_EX_RX(DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder]
-                        // _readRRDomain_Loop(%u): Redirecting from %u to %u!\n"), p_u8Depth,
-                        // stCurrentPosition, u16Offset););
-                        m_pUDPContext->seek(u16Offset);
-                        if (_readRRDomain_Loop(p_rRRDomain, p_u8Depth + 1))  // Do recursion
+                        // _readRRDomain: Redirecting from %u to %u!\n"), u16Offset,
+                        // u16Pointer););
+                        if (!u16Continue)
                         {
-                            // DEBUG_EX_RX(DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder]
-                            // _readRRDomain_Loop(%u): Succeeded to read redirected label! Returning
-                            // to %u\n"), p_u8Depth, stCurrentPosition););
-                            m_pUDPContext->seek(stCurrentPosition);  // Restore after recursion
-                        }
-                        else
-                        {
-                            DEBUG_EX_ERR(DEBUG_OUTPUT.printf_P(
-                                PSTR("[MDNSResponder] _readRRDomain_Loop(%u): FAILED to read "
-                                     "redirected label!\n"),
-                                p_u8Depth););
-                            bResult = false;
+                            u16Continue = (u16Offset + 2);
                         }
+                        u16Offset = u16Target = u16Pointer;
                     }
                     else
                     {
-                        DEBUG_EX_ERR(
-                            DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRDomain_Loop(%u): "
-                                                       "INVALID offset in redirection!\n"),
-                                                  p_u8Depth););
+                        DEBUG_EX_ERR(DEBUG_OUTPUT.printf_P(
+                            PSTR("[MDNSResponder] _readRRDomain: INVALID redirection at %u!\n"),
+                            u16Offset););
                         bResult = false;
                     }
-                    break;
+                }
+                else if ((u8Len & MDNS_DOMAIN_COMPRESS_MARK)
+                         ||  // Reserved label types
+                         (MDNS_DOMAIN_MAXLENGTH <= (p_rRRDomain.m_u16NameLength + u8Len))
+                         || ((u16Offset + 1 + u8Len) > m_u16RXLength))
+                {
+                    DEBUG_EX_ERR(
+                        DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRDomain: INVALID label "
+                                                   "(%u + %u) at %u!\n"),
+                                              p_rRRDomain.m_u16NameLength, u8Len, u16Offset););
+                    bResult = false;
                 }
                 else
                 {
-                    // Normal (uncompressed) label (maybe '\0' only)
-                    if (MDNS_DOMAIN_MAXLENGTH > (p_rRRDomain.m_u16NameLength + u8Len))
+                    // Normal (uncompressed) label (maybe '\0' only): length byte and name
+                    memcpy(&(p_rRRDomain.m_acName[p_rRRDomain.m_u16NameLength]),
+                           &m_pucRXBuffer[u16Offset], 1 + u8Len);
+                    p_rRRDomain.m_u16NameLength += (1 + u8Len);
+                    u16Offset += (1 + u8Len);
+                    if (!u8Len)
                     {
-                        // Add length byte
-                        p_rRRDomain.m_acName[p_rRRDomain.m_u16NameLength] = u8Len;
-                        ++(p_rRRDomain.m_u16NameLength);
-                        if (u8Len)  // Add name
-                        {
-                            if ((bResult = _udpReadBuffer(
-                                     (unsigned char*)&(
-                                         p_rRRDomain.m_acName[p_rRRDomain.m_u16NameLength]),
-                                     u8Len)))
-                            {
-                                /*  DEBUG_EX_INFO(
-                                        p_rRRDomain.m_acName[p_rRRDomain.m_u16NameLength + u8Len] =
-                                   0;  // Closing '\0' for printing
-                                        DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder]
-                                   _readRRDomain_Loop(%u): Domain label (%u): %s\n"), p_u8Depth,
-                                   (unsigned)(p_rRRDomain.m_acName[p_rRRDomain.m_u16NameLength -
-                                   1]), &(p_rRRDomain.m_acName[p_rRRDomain.m_u16NameLength]));
-                                        );*/
-
-                                p_rRRDomain.m_u16NameLength += u8Len;
-                            }
-                        }
-                        // DEBUG_EX_INFO(DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder]
-                        // _readRRDomain_Loop(2) offset:%u p0:%x\n"), m_pUDPContext->tell(),
-                        // m_pUDPContext->peek()););
-                    }
-                    else
-                    {
-                        DEBUG_EX_ERR(
-                            DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRDomain_Loop(%u): "
-                                                       "ERROR! Domain name too long (%u + %u)!\n"),
-                                                  p_u8Depth, p_rRRDomain.m_u16NameLength, u8Len););
-                        bResult = false;
-                        break;
+                        m_u16RXOffset = (u16Continue ? u16Continue : u16Offset);
                     }
                 }
-            } while ((bResult) && (0 != u8Len));
-        }
-        else
-        {
-            DEBUG_EX_ERR(DEBUG_OUTPUT.printf_P(
-                PSTR("[MDNSResponder] _readRRDomain_Loop(%u): ERROR! Too many redirections!\n"),
-                p_u8Depth););
-        }
+            }
+        } while ((bResult) && (0 != u8Len));
+        DEBUG_EX_ERR(if (!bResult)
+                         DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _readRRDomain: FAILED!\n")););
         return bResult;
     }
 
@@ -1103,14 +1084,64 @@ namespace MDNSImplementation
         UDP
     */
 
+    /*
+        MDNSResponder::_udpLoadMessage
+
+        Copies the (rest of the) current UDP message into the receive buffer at once.
+        All reading (_udpRead..., _readRRDomain) is done from the buffer, bounds checked
+        against m_u16RXLength, instead of through the UDP context.
+        The buffer is released by _udpReleaseMessage after the message is parsed.
+    */
+    bool MDNSResponder::_udpLoadMessage(void)
+    {
+        _udpReleaseMessage();
+
+        size_t stLength = (m_pUDPContext ? m_pUDPContext->getSize() : 0);
+        bool   bResult  = ((stLength) && (0xFFFF >= stLength)
+                        && (0 != (m_pucRXBuffer = new unsigned char[stLength]))
+                        && (stLength == m_pUDPContext->read((char*)m_pucRXBuffer, stLength)));
+        if (bResult)
+        {
+            m_u16RXLength = stLength;
+        }
+        else
+        {
+            _udpReleaseMessage();
+        }
+        DEBUG_EX_ERR(if (!bResult) {
+            DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _udpLoadMessage: FAILED (%u bytes)!\n"),
+                                  (unsigned)stLength);
+        });
+        return bResult;
+    }
+
+    /*
+        MDNSResponder::_udpReleaseMessage
+    */
+    bool MDNSResponder::_udpReleaseMessage(void)
+    {
+        if (m_pucRXBuffer)
+        {
+            delete[] m_pucRXBuffer;
+            m_pucRXBuffer = 0;
+        }
+        m_u16RXLength = 0;
+        m_u16RXOffset = 0;
+        return true;
+    }
+
     /*
         MDNSResponder::_udpReadBuffer
     */
     bool MDNSResponder::_udpReadBuffer(unsigned char* p_pBuffer, size_t p_stLength)
     {
-        bool bResult = ((m_pUDPContext) && (true /*m_pUDPContext->getSize() > p_stLength*/)
-                        && (p_pBuffer) && (p_stLength)
-                        && ((p_stLength == m_pUDPContext->read((char*)p_pBuffer, p_stLength))));
+        bool bResult = ((m_pucRXBuffer) && (p_pBuffer) && (p_stLength)
+                        && (p_stLength <= (size_t)(m_u16RXLength - m_u16RXOffset)));
+        if (bResult)
+        {
+            memcpy(p_pBuffer, &m_pucRXBuffer[m_u16RXOffset], p_stLength);
+            m_u16RXOffset += p_stLength;
+        }
         DEBUG_EX_ERR(if (!bResult) {
             DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _udpReadBuffer: FAILED!\n"));
         });
@@ -1122,35 +1153,45 @@ namespace MDNSImplementation
     */
     bool MDNSResponder::_udpRead8(uint8_t& p_ru8Value)
     {
-        return _udpReadBuffer((unsigned char*)&p_ru8Value, sizeof(p_ru8Value));
+        bool bResult = ((m_pucRXBuffer) && (m_u16RXOffset < m_u16RXLength));
+        if (bResult)
+        {
+            p_ru8Value = m_pucRXBuffer[m_u16RXOffset++];
+        }
+        return bResult;
     }
 
     /*
         MDNSResponder::_udpRead16
+
+        Reads a 16-bit value in network byte order.
     */
     bool MDNSResponder::_udpRead16(uint16_t& p_ru16Value)
     {
-        bool bResult = false;
-
-        if (_udpReadBuffer((unsigned char*)&p_ru16Value, sizeof(p_ru16Value)))
+        bool bResult = ((m_pucRXBuffer) && (2 <= (m_u16RXLength - m_u16RXOffset)));
+        if (bResult)
         {
-            p_ru16Value = lwip_ntohs(p_ru16Value);
-            bResult     = true;
+            const unsigned char* pucCursor = &m_pucRXBuffer[m_u16RXOffset];
+            p_ru16Value = ((pucCursor[0] << 8) | pucCursor[1]);
+            m_u16RXOffset += 2;
         }
         return bResult;
     }
 
     /*
         MDNSResponder::_udpRead32
+
+        Reads a 32-bit value in network byte order.
     */
     bool MDNSResponder::_udpRead32(uint32_t& p_ru32Value)
     {
-        bool bResult = false;
-
-        if (_udpReadBuffer((unsigned char*)&p_ru32Value, sizeof(p_ru32Value)))
+        bool bResult = ((m_pucRXBuffer) && (4 <= (m_u16RXLength - m_u16RXOffset)));
+        if (bResult)
         {
-            p_ru32Value = lwip_ntohl(p_ru32Value);
-            bResult     = true;
+            const unsigned char* pucCursor = &m_pucRXBuffer[m_u16RXOffset];
+            p_ru32Value = (((uint32_t)pucCursor[0] << 24) | ((uint32_t)pucCursor[1] << 16)
+                           | ((uint32_t)pucCursor[2] << 8) | pucCursor[3]);
+            m_u16RXOffset += 4;
         }
         return bResult;
     }
@@ -1163,6 +1204,13 @@ namespace MDNSImplementation
         bool bResult
             = ((m_pUDPContext) && (p_pcBuffer) && (p_stLength)
                && (p_stLength == m_pUDPContext->append((const char*)p_pcBuffer, p_stLength)));
+        if ((bResult) && (m_pAnswerCapture)
+            && (!m_pAnswerCapture->append(p_pcBuffer, p_stLength)))
+        {
+            // Out of memory: the response is sent, but not compiled
+            delete m_pAnswerCapture;
+            m_pAnswerCapture = 0;
+        }
         DEBUG_EX_ERR(if (!bResult) {
             DEBUG_OUTPUT.printf_P(PSTR("[MDNSResponder] _udpAppendBuffer: FAILED!\n"));
         });
@@ -1203,8 +1251,8 @@ namespace MDNSImplementation
     {
         const uint8_t cu8BytesPerLine = 16;
 
-        uint32_t u32StartPosition = m_pUDPContext->tell();
-        DEBUG_OUTPUT.println("UDP Context Dump:");
+        uint16_t u16StartPosition = m_u16RXOffset;
+        DEBUG_OUTPUT.println("UDP Message Dump:");
         uint32_t u32Counter = 0;
         uint8_t  u8Byte     = 0;
 
@@ -1219,7 +1267,7 @@ namespace MDNSImplementation
 
         if (!p_bMovePointer)  // Restore
         {
-            m_pUDPContext->seek(u32StartPosition);
+            m_u16RXOffset = u16StartPosition;
         }
         return true;
     }
@@ -1229,18 +1277,9 @@ namespace MDNSImplementation
     */
     bool MDNSResponder::_udpDump(unsigned p_uOffset, unsigned p_uLength)
     {
-        if ((m_pUDPContext) && (m_pUDPContext->isValidOffset(p_uOffset)))
+        for (unsigned u = p_uOffset; ((u < (p_uOffset + p_uLength)) && (u < m_u16RXLength)); ++u)
         {
-            unsigned uCurrentPosition = m_pUDPContext->tell();  // Remember start position
-
-            m_pUDPContext->seek(p_uOffset);
-            uint8_t u8Byte;
-            for (unsigned u = 0; ((u < p_uLength) && (_udpRead8(u8Byte))); ++u)
-            {
-                DEBUG_OUTPUT.printf_P(PSTR("%02x "), u8Byte);
-            }
-            // Return to start position
-            m_pUDPContext->seek(uCurrentPosition);
+            DEBUG_OUTPUT.printf_P(PSTR("%02x "), m_pucRXBuffer[u]);
         }
         return true;
     }
@@ -1714,22 +1753,23 @@ namespace MDNSImplementation
                  pTxt                    = pTxt->m_pNext)
             {
                 unsigned char ucLengthByte = pTxt->length();
+                size_t        stKeyLength  = os_strlen(pTxt->m_pcKey);
+                size_t        stValueLength = (pTxt->m_pcValue ? os_strlen(pTxt->m_pcValue) : 0);
                 bResult = ((_udpAppendBuffer((unsigned char*)&ucLengthByte, sizeof(ucLengthByte)))
                            &&  // Length
                            (p_rSendParameter.shiftOffset(sizeof(ucLengthByte)))
-                           && ((size_t)os_strlen(pTxt->m_pcKey)
-                               == m_pUDPContext->append(pTxt->m_pcKey, os_strlen(pTxt->m_pcKey)))
+                           && ((!stKeyLength)
+                               || (_udpAppendBuffer((const unsigned char*)pTxt->m_pcKey,
+                                                    stKeyLength)))
                            &&  // Key
-                           (p_rSendParameter.shiftOffset((size_t)os_strlen(pTxt->m_pcKey)))
-                           && (1 == m_pUDPContext->append("=", 1)) &&  // =
+                           (p_rSendParameter.shiftOffset(stKeyLength))
+                           && (_udpAppendBuffer((const unsigned char*)"=", 1)) &&  // =
                            (p_rSendParameter.shiftOffset(1))
-                           && ((!pTxt->m_pcValue)
-                               || (((size_t)os_strlen(pTxt->m_pcValue)
-                                    == m_pUDPContext->append(pTxt->m_pcValue,
-                                                             os_strlen(pTxt->m_pcValue)))
-                                   &&  // Value
-                                   (p_rSendParameter.shiftOffset(
-                                       (size_t)os_strlen(pTxt->m_pcValue))))));
+                           && ((!stValueLength)
+                               || (_udpAppendBuffer((const unsigned char*)pTxt->m_pcValue,
+                                                    stValueLength)))
+                           &&  // Value
+                           (p_rSendParameter.shiftOffset(stValueLength)));
 
                 DEBUG_EX_ERR(if (!bResult) {
                     DEBUG_OUTPUT.printf_P(
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+# Bundles a web interface directory into a header of gzipped PROGMEM blobs
+# for AsyncWebServer::serveAssets().
+#
+# Every file gets a hash named copy ("css/style.css" -> "css/style.1f0e3dad.css")
+# and a strong ETag, both from the hash of its content. References to the other
+# files in html and css files are rewritten to the hash named paths, so a
+# browser can keep them forever and only revalidates the pages.
+#
+# Usage: bundle_assets.py <directory> <header> [name]
+
+import gzip
+import hashlib
+import os
+import posixpath
+import re
+import sys
+
+CONTENT_TYPES = {
+  '.html': 'text/html', '.htm': 'text/html', '.css': 'text/css', '.json': 'application/json',
+  '.js': 'application/javascript', '.png': 'image/png', '.gif': 'image/gif', '.jpg': 'image/jpeg',
+  '.ico': 'image/x-icon', '.svg': 'image/svg+xml', '.eot': 'font/eot', '.woff': 'font/woff',
+  '.woff2': 'font/woff2', '.ttf': 'font/ttf', '.xml': 'text/xml', '.pdf': 'application/pdf',
+  '.zip': 'application/zip', '.txt': 'text/plain',
+}
+
+# Files that may reference others, in the order they are hashed: what they
+# reference must be hashed before them
+REWRITTEN = {'.css': 1, '.html': 2, '.htm': 2}
+
+def hashed_path(path, digest):
+  directory, name = posixpath.split(path)
+  base, ext = posixpath.splitext(name)
+  return posixpath.join(directory, '{}.{}{}'.format(base, digest[:8], ext))
+
+def rewrite(path, content, hashed):
+  text = content.decode('utf-8')
+  directory = posixpath.dirname(path)
+  for target, new in hashed.items():
+    relative = posixpath.relpath(target, directory)
+    for old, replacement in ((target, new), (relative, posixpath.relpath(new, directory))):
+      # Only whole references: quoted or in url()
+      text = re.sub(r'(["\'(])' + re.escape(old) + r'(?=["\')?#])', lambda m: m.group(1) + replacement, text)
+  return text.encode('utf-8')
+
+def main(root, header, name):
+  files = []
+  for directory, _, names in os.walk(root):
+    for n in names:
+      full = os.path.join(directory, n)
+      files.append('/' + os.path.relpath(full, root).replace(os.sep, '/'))
+
+  assets = {}
+  hashed = {}
+  for path in sorted(files, key=lambda p: (REWRITTEN.get(posixpath.splitext(p)[1].lower(), 0), p)):
+    ext = posixpath.splitext(path)[1].lower()
+    with open(os.path.join(root, path[1:]), 'rb') as f:
+      content = f.read()
+    if ext in REWRITTEN:
+      content = rewrite(path, content, hashed)
+    digest = hashlib.sha256(content).hexdigest()
+    data = gzip.compress(content, 9, mtime=0)
+    assets[path] = (hashed_path(path, digest), CONTENT_TYPES.get(ext, 'application/octet-stream'),
+                    '"' + digest[:16] + '"', data, len(content))
+    hashed[path] = assets[path][0]
+
+  guard = re.sub(r'\W', '_', os.path.basename(header)).upper()
+  out = ['// Generated by bundle_assets.py from {}, do not edit'.format(os.path.basename(os.path.normpath(root))),
+         '', '#ifndef ' + guard, '#define ' + guard, '', '#include <ESPAsyncWebSrv.h>', '']
+  # The index is searched by path: sorted the way strcmp() does
+  paths = sorted(assets, key=lambda p: p.encode('utf-8'))
+  for i, path in enumerate(paths):
+    data = assets[path][3]
+    out.append('// {}, {} bytes, {} gzipped'.format(path, assets[path][4], len(data)))
+    out.append('static const uint8_t {}_{}[] PROGMEM = {{'.format(name, i))
+    for n in range(0, len(data), 16):
+      out.append('  ' + ','.join('0x{:02x}'.format(b) for b in data[n:n + 16]) + ',')
+    out.append('};')
+    out.append('')
+  out.append('static const AsyncWebAsset {}[] = {{'.format(name))
+  for i, path in enumerate(paths):
+    hashed_name, content_type, etag, data, _ = assets[path]
+    out.append('  {{"{}", "{}", "{}", "{}", {}_{}, {}}},'.format(
+        path, hashed_name, content_type, etag.replace('"', '\\"'), name, i, len(data)))
+  out += ['};', '', '#endif // ' + guard, '']
+  with open(header, 'w') as f:
+    f.write('\n'.join(out))
+
+if __name__ == '__main__':
+  if len(sys.argv) < 3:
+    print('Usage: {} <directory> <header> [name]'.format(sys.argv[0]), file=sys.stderr)
+    sys.exit(1)
+  main(sys.argv[1], sys.argv[2], sys.argv[3] if len(sys.argv) > 3 else 'webAssets')
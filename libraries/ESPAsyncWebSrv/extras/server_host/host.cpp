@@ -0,0 +1,87 @@
+// Definitions behind the mock headers of server_host: globals, base64,
+// and an allocation counter (operator new and malloc).
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <libb64/cencode.h>
+#include <new>
+#include "host.h"
+
+uint32_t hostMs;
+int hostDiagnostics;
+WiFiClass WiFi;
+static int hostTask;
+void *pxCurrentTCB = &hostTask;
+
+unsigned long hostAllocations;
+
+#ifndef HOST_SANITIZE // the sanitizers have their own allocator
+extern "C" void *__libc_malloc(size_t size);
+
+extern "C" void *malloc(size_t size) {
+  hostAllocations++;
+  return __libc_malloc(size);
+}
+
+void *operator new(size_t size) {
+  hostAllocations++;
+  void *p = __libc_malloc(size ? size : 1);
+  if (!p)
+    throw std::bad_alloc();
+  return p;
+}
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+#endif
+
+static const char base64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+void base64_init_encodestate(base64_encodestate *state) {
+  state->step = 0;
+  state->result = 0;
+}
+
+int base64_encode_block(const char *in, int length, char *out, base64_encodestate *state) {
+  char *start = out;
+  for (int i = 0; i < length; i++) {
+    uint8_t c = in[i];
+    switch (state->step) {
+    case 0:
+      *out++ = base64Chars[c >> 2];
+      state->result = (c & 0x03) << 4;
+      break;
+    case 1:
+      *out++ = base64Chars[state->result | (c >> 4)];
+      state->result = (c & 0x0F) << 2;
+      break;
+    case 2:
+      *out++ = base64Chars[state->result | (c >> 6)];
+      *out++ = base64Chars[c & 0x3F];
+      break;
+    }
+    state->step = (state->step + 1) % 3;
+  }
+  return out - start;
+}
+
+int base64_encode_blockend(char *out, base64_encodestate *state) {
+  char *start = out;
+  if (state->step) {
+    *out++ = base64Chars[(uint8_t)state->result];
+    *out++ = '=';
+    if (state->step == 1)
+      *out++ = '=';
+  }
+  *out = 0;
+  return out - start;
+}
+
+int base64_encode_chars(const char *in, int length, char *out) {
+  base64_encodestate state;
+  base64_init_encodestate(&state);
+  int len = base64_encode_block(in, length, out, &state);
+  return len + base64_encode_blockend(out + len, &state);
+}
@@ -0,0 +1,21 @@
+// Test helpers of server_host
+
+#ifndef SERVER_HOST_HOST_H
+#define SERVER_HOST_HOST_H
+
+#include <ESPAsyncWebSrv.h>
+
+extern unsigned long hostAllocations; // operator new and malloc calls so far
+
+// Lets the test open connections
+class HostServer : public AsyncWebServer {
+public:
+  HostServer() : AsyncWebServer(80) {}
+  AsyncClient *connect(size_t window = 5744) {
+    AsyncClient *c = new AsyncClient(window);
+    _server.accept(c);
+    return c;
+  }
+};
+
+#endif // SERVER_HOST_HOST_H
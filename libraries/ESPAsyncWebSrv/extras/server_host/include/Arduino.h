@@ -0,0 +1,100 @@
+// Host (Linux) stand-in for the ESP32 Arduino core, used by server_host.
+// Only the API used by ESPAsyncWebSrv is provided. Time is virtual: millis()
+// returns hostMs, advanced by the test.
+
+#ifndef SERVER_HOST_ARDUINO_H
+#define SERVER_HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <functional>
+#include <algorithm>
+
+#include "WString.h"
+
+// size_t is unsigned int on the ESP32: std::min(size_t, unsigned int) compiles there
+namespace std {
+inline size_t min(size_t a, unsigned int b) { return a < b ? a : b; }
+}
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+extern uint32_t hostMs;
+inline unsigned long millis() { return hostMs; }
+inline unsigned long micros() { return hostMs * 1000UL; }
+
+// Library diagnostics (queue full...) are counted, not printed
+extern int hostDiagnostics;
+inline int ets_printf(const char *, ...) { hostDiagnostics++; return 0; }
+#define log_e(...) ets_printf(__VA_ARGS__)
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define strlen_P strlen
+#define strcpy_P strcpy
+#define memcpy_P memcpy
+#define vsnprintf_P vsnprintf
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--)
+      n += write(*buffer++);
+    return n;
+  }
+  size_t print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+  size_t print(const String &s) { return write((const uint8_t *)s.c_str(), s.length()); }
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3))) {
+    char buf[256];
+    va_list arg;
+    va_start(arg, format);
+    int len = vsnprintf(buf, sizeof(buf), format, arg);
+    va_end(arg);
+    return write((const uint8_t *)buf, std::min(len, (int)sizeof(buf) - 1));
+  }
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  size_t readBytes(uint8_t *buffer, size_t length) {
+    size_t n = 0;
+    while (n < length && available())
+      buffer[n++] = read();
+    return n;
+  }
+};
+
+class IPAddress {
+public:
+  IPAddress(uint32_t address = 0) : _address(address) {}
+  operator uint32_t() const { return _address; }
+  bool operator==(const IPAddress &a) const { return _address == a._address; }
+  bool operator!=(const IPAddress &a) const { return _address != a._address; }
+
+private:
+  uint32_t _address;
+};
+
+// FreeRTOS, for AsyncWebLock (a single thread here)
+typedef int *SemaphoreHandle_t;
+#define portMAX_DELAY 0xFFFFFFFF
+inline SemaphoreHandle_t xSemaphoreCreateBinary() { return new int(0); }
+inline void vSemaphoreDelete(SemaphoreHandle_t s) { delete s; }
+inline int xSemaphoreTake(SemaphoreHandle_t s, uint32_t) { (*s)--; return 1; }
+inline int xSemaphoreGive(SemaphoreHandle_t s) { (*s)++; return 1; }
+
+#endif // SERVER_HOST_ARDUINO_H
@@ -0,0 +1,150 @@
+// Host stand-in for AsyncTCP. An AsyncClient is one end of a connection
+// driven by the test: the bytes the server sends are appended to wire, the
+// test plays the peer with receive(), acknowledge() and disconnect(). The
+// TCP window (space()) is window minus the bytes sent and not acked yet.
+// Sent data is cut in segments of at most mss bytes, a peer acks whole segments.
+
+#ifndef SERVER_HOST_ASYNCTCP_H
+#define SERVER_HOST_ASYNCTCP_H
+
+#include <Arduino.h>
+#include <vector>
+#include <string>
+
+#define ASYNC_WRITE_FLAG_COPY 0x01
+#define ASYNC_WRITE_FLAG_MORE 0x02
+
+class AsyncClient;
+
+typedef std::function<void(void *, AsyncClient *)> AcConnectHandler;
+typedef std::function<void(void *, AsyncClient *, size_t len, uint32_t time)> AcAckHandler;
+typedef std::function<void(void *, AsyncClient *, int8_t error)> AcErrorHandler;
+typedef std::function<void(void *, AsyncClient *, void *data, size_t len)> AcDataHandler;
+typedef std::function<void(void *, AsyncClient *, uint32_t time)> AcTimeoutHandler;
+
+class AsyncClient {
+public:
+  AsyncClient(size_t window = 5744) : window(window) {
+    pending.reserve(window);
+    wire.reserve(1 << 20);
+    segments.reserve(4096);
+  }
+  virtual ~AsyncClient() {}
+
+  bool canSend() { return space() > 0; }
+  size_t space() { return closed ? 0 : window - unacked - queued; }
+  size_t add(const char *data, size_t size, uint8_t apiflags = ASYNC_WRITE_FLAG_COPY) {
+    (void)apiflags;
+    size = std::min(size, space());
+    pending.append(data, size);
+    queued += size;
+    return size;
+  }
+  bool send() {
+    if (!queued)
+      return false;
+    wire += pending;
+    pending.clear();
+    for (size_t n = 0; n < queued; n += mss)
+      segments.push_back(std::min(mss, queued - n));
+    unacked += queued;
+    queued = 0;
+    sends++;
+    return true;
+  }
+  size_t write(const char *data) { return write(data, strlen(data)); }
+  size_t write(const char *data, size_t size, uint8_t apiflags = ASYNC_WRITE_FLAG_COPY) {
+    size_t n = add(data, size, apiflags);
+    if (n)
+      send();
+    return n;
+  }
+
+  void close(bool now = false) { (void)now; closed = true; }
+  void stop() { close(); }
+  bool free() { return true; }
+  bool connected() { return !closed; }
+  bool disconnected() { return closed; }
+  void ackLater() {}
+  void setRxTimeout(uint32_t) {}
+  void setNoDelay(bool) {}
+  const char *stateToString() { return closed ? "Closed" : "Established"; }
+  IPAddress remoteIP() { return IPAddress(0x0201A8C0); }
+  uint16_t remotePort() { return 50000; }
+  IPAddress localIP() { return IPAddress(0x0101A8C0); }
+  uint16_t localPort() { return 80; }
+
+  void onDisconnect(AcConnectHandler cb, void *arg = 0) { _discard = cb; _discardArg = arg; }
+  void onAck(AcAckHandler cb, void *arg = 0) { _sent = cb; _sentArg = arg; }
+  void onError(AcErrorHandler cb, void *arg = 0) { _error = cb; _errorArg = arg; }
+  void onData(AcDataHandler cb, void *arg = 0) { _recv = cb; _recvArg = arg; }
+  void onTimeout(AcTimeoutHandler cb, void *arg = 0) { _timeout = cb; _timeoutArg = arg; }
+  void onPoll(AcConnectHandler cb, void *arg = 0) { _poll = cb; _pollArg = arg; }
+
+  // Peer side, called by the test
+  void receive(const void *data, size_t len) {
+    std::string copy((const char *)data, len); // the library writes into received data
+    copy.push_back(0);
+    if (_recv)
+      _recv(_recvArg, this, &copy[0], len);
+  }
+  // Ack the first count segments in flight
+  void acknowledge(size_t count) {
+    size_t len = 0;
+    for (; count && acked < segments.size(); count--)
+      len += segments[acked++];
+    if (acked == segments.size()) {
+      segments.clear();
+      acked = 0;
+    }
+    if (!len)
+      return;
+    unacked -= len;
+    if (_sent)
+      _sent(_sentArg, this, len, 1);
+  }
+  void acknowledgeAll() { acknowledge(inFlight()); }
+  size_t inFlight() const { return segments.size() - acked; }
+  void poll() { if (_poll) _poll(_pollArg, this); }
+  // Deletes the client, as AsyncTCP does after the disconnect handler
+  void disconnect() {
+    closed = true;
+    if (_discard)
+      _discard(_discardArg, this);
+  }
+
+  size_t window, mss = 1436;
+  size_t unacked = 0, queued = 0;
+  std::vector<size_t> segments; // sizes of the segments sent, from segments[acked] not acked yet
+  size_t acked = 0;
+  unsigned sends = 0;
+  bool closed = false;
+  std::string pending, wire;
+
+private:
+  AcConnectHandler _discard, _poll;
+  AcAckHandler _sent;
+  AcErrorHandler _error;
+  AcDataHandler _recv;
+  AcTimeoutHandler _timeout;
+  void *_discardArg = 0, *_pollArg = 0, *_sentArg = 0, *_errorArg = 0, *_recvArg = 0, *_timeoutArg = 0;
+};
+
+class AsyncServer {
+public:
+  AsyncServer(uint16_t port) : port(port) {}
+  void onClient(AcConnectHandler cb, void *arg) { _connect = cb; _connectArg = arg; }
+  void begin() {}
+  void end() {}
+  void setNoDelay(bool) {}
+  // A new connection, called by the test
+  void accept(AsyncClient *c) { _connect(_connectArg, c); }
+
+  uint16_t port;
+
+private:
+  AcConnectHandler _connect;
+  void *_connectArg = 0;
+};
+
+#endif // SERVER_HOST_ASYNCTCP_H
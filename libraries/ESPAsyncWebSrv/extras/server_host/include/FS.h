@@ -0,0 +1,78 @@
+// Host stand-in for the Arduino FS: files in memory, added by the test.
+
+#ifndef SERVER_HOST_FS_H
+#define SERVER_HOST_FS_H
+
+#include <Arduino.h>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace fs {
+
+struct FileData {
+  std::string name;
+  std::string content;
+  time_t lastWrite;
+};
+
+class File : public Stream {
+public:
+  File() {}
+  File(std::shared_ptr<FileData> data) : _data(data) {}
+  operator bool() const { return (bool)_data; }
+  size_t write(uint8_t) override { return 0; }
+  int available() override { return _data ? _data->content.size() - _pos : 0; }
+  int read() override { return available() ? (uint8_t)_data->content[_pos++] : -1; }
+  int peek() override { return available() ? (uint8_t)_data->content[_pos] : -1; }
+  size_t read(uint8_t *buffer, size_t size) {
+    size_t n = std::min(size, (size_t)available());
+    if (n)
+      memcpy(buffer, _data->content.data() + _pos, n);
+    _pos += n;
+    return n;
+  }
+  bool seek(uint32_t pos) { if (!_data || pos > _data->content.size()) return false; _pos = pos; return true; }
+  size_t position() const { return _pos; }
+  size_t size() const { return _data ? _data->content.size() : 0; }
+  time_t getLastWrite() { return _data ? _data->lastWrite : 0; }
+  void close() { _data.reset(); _pos = 0; }
+  const char *name() const { return _data ? _data->name.c_str() : ""; }
+  bool isDirectory() { return false; }
+  File openNextFile() { return File(); }
+
+private:
+  std::shared_ptr<FileData> _data;
+  size_t _pos = 0;
+};
+
+class FS {
+public:
+  void add(const char *path, const std::string &content, time_t lastWrite = 0) {
+    _files[path] = std::make_shared<FileData>(FileData{path, content, lastWrite});
+    opened.erase(path);
+  }
+  File open(const String &path, const char *mode = "r") {
+    (void)mode;
+    auto f = _files.find(path.c_str());
+    if (f == _files.end())
+      return File();
+    opened[path.c_str()]++;
+    return File(f->second);
+  }
+  File open(const char *path, const char *mode = "r") { return open(String(path), mode); }
+  bool exists(const String &path) { return _files.count(path.c_str()) != 0; }
+  bool exists(const char *path) { return exists(String(path)); }
+
+  std::map<std::string, int> opened; // open() calls per path
+
+private:
+  std::map<std::string, std::shared_ptr<FileData>> _files;
+};
+
+} // namespace fs
+
+using fs::File;
+using fs::FS;
+
+#endif // SERVER_HOST_FS_H
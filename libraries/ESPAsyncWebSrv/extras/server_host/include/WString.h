@@ -0,0 +1,124 @@
+// Host stand-in for the Arduino String, on top of std::string.
+// Only the members used by ESPAsyncWebSrv are provided.
+
+#ifndef SERVER_HOST_WSTRING_H
+#define SERVER_HOST_WSTRING_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <string>
+
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper *>(s))
+
+class String {
+public:
+  String() {}
+  String(const char *s) { if (s) _s = s; }
+  String(const String &s) : _s(s._s) {}
+  String(const __FlashStringHelper *s) { if (s) _s = reinterpret_cast<const char *>(s); }
+  explicit String(char c) : _s(1, c) {}
+  explicit String(int v) : _s(std::to_string(v)) {}
+  explicit String(unsigned int v) : _s(std::to_string(v)) {}
+  explicit String(long v) : _s(std::to_string(v)) {}
+  explicit String(unsigned long v) : _s(std::to_string(v)) {}
+  explicit String(unsigned char v) : _s(std::to_string(v)) {}
+
+  String &operator=(const String &s) { _s = s._s; return *this; }
+  String &operator=(const char *s) { _s = s ? s : ""; return *this; }
+
+  unsigned int length() const { return _s.length(); }
+  const char *c_str() const { return _s.c_str(); }
+  char *begin() { return &_s[0]; }
+  char *end() { return &_s[0] + _s.length(); }
+  bool reserve(unsigned int size) { _s.reserve(size); return true; }
+  operator bool() const { return true; }
+
+  char charAt(unsigned int i) const { return i < _s.length() ? _s[i] : 0; }
+  char operator[](unsigned int i) const { return charAt(i); }
+  char &operator[](unsigned int i) { return _s[i]; }
+
+  bool concat(const String &s) { _s += s._s; return true; }
+  bool concat(const char *s) { if (s) _s += s; return true; }
+  bool concat(const char *s, unsigned int n) { _s.append(s, n); return true; }
+  bool concat(char c) { _s += c; return true; }
+  bool concat(int v) { _s += std::to_string(v); return true; }
+  bool concat(unsigned int v) { _s += std::to_string(v); return true; }
+  bool concat(unsigned long v) { _s += std::to_string(v); return true; }
+  String &operator+=(const String &s) { concat(s); return *this; }
+  String &operator+=(const char *s) { concat(s); return *this; }
+  String &operator+=(char c) { concat(c); return *this; }
+  String &operator+=(int v) { concat(v); return *this; }
+  String &operator+=(unsigned int v) { concat(v); return *this; }
+  String &operator+=(unsigned long v) { concat(v); return *this; }
+
+  friend String operator+(const String &a, const String &b) { String r(a); r += b; return r; }
+  friend String operator+(const String &a, const char *b) { String r(a); r += b; return r; }
+  friend String operator+(const char *a, const String &b) { String r(a); r += b; return r; }
+  friend String operator+(const String &a, char b) { String r(a); r += b; return r; }
+  friend String operator+(const String &a, int b) { String r(a); r += b; return r; }
+  friend String operator+(const String &a, unsigned int b) { String r(a); r += b; return r; }
+  friend String operator+(const String &a, unsigned long b) { String r(a); r += b; return r; }
+
+  int compareTo(const String &s) const { return _s.compare(s._s); }
+  bool equals(const String &s) const { return _s == s._s; }
+  bool equals(const char *s) const { return _s == (s ? s : ""); }
+  bool equalsIgnoreCase(const String &s) const {
+    return _s.length() == s._s.length() && strcasecmp(_s.c_str(), s._s.c_str()) == 0;
+  }
+  bool operator==(const String &s) const { return equals(s); }
+  bool operator==(const char *s) const { return equals(s); }
+  bool operator!=(const String &s) const { return !equals(s); }
+  bool operator!=(const char *s) const { return !equals(s); }
+  bool operator<(const String &s) const { return _s < s._s; }
+  bool startsWith(const String &s) const { return _s.compare(0, s._s.length(), s._s) == 0; }
+  bool startsWith(const String &s, unsigned int offset) const {
+    return offset <= _s.length() && _s.compare(offset, s._s.length(), s._s) == 0;
+  }
+  bool endsWith(const String &s) const {
+    return _s.length() >= s._s.length() &&
+           _s.compare(_s.length() - s._s.length(), s._s.length(), s._s) == 0;
+  }
+
+  int indexOf(char c) const { return find(_s.find(c)); }
+  int indexOf(char c, unsigned int from) const { return find(_s.find(c, from)); }
+  int indexOf(const String &s) const { return find(_s.find(s._s)); }
+  int indexOf(const String &s, unsigned int from) const { return find(_s.find(s._s, from)); }
+  int lastIndexOf(char c) const { return find(_s.rfind(c)); }
+  int lastIndexOf(const String &s) const { return find(_s.rfind(s._s)); }
+  String substring(unsigned int from) const { return from < _s.length() ? String(_s.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) { unsigned int t = from; from = to; to = t; }
+    if (from >= _s.length()) return String();
+    return String(_s.substr(from, to - from));
+  }
+
+  void replace(const String &from, const String &to) {
+    if (!from._s.length()) return;
+    size_t i = 0;
+    while ((i = _s.find(from._s, i)) != std::string::npos) {
+      _s.replace(i, from._s.length(), to._s);
+      i += to._s.length();
+    }
+  }
+  void remove(unsigned int index) { if (index < _s.length()) _s.erase(index); }
+  void remove(unsigned int index, unsigned int count) { if (index < _s.length()) _s.erase(index, count); }
+  void toLowerCase() { for (auto &c : _s) c = tolower(c); }
+  void toUpperCase() { for (auto &c : _s) c = toupper(c); }
+  void trim() {
+    size_t b = _s.find_first_not_of(" \t\r\n");
+    if (b == std::string::npos) { _s.clear(); return; }
+    _s = _s.substr(b, _s.find_last_not_of(" \t\r\n") - b + 1);
+  }
+  long toInt() const { return atol(_s.c_str()); }
+
+private:
+  explicit String(const std::string &s) : _s(s) {}
+  static int find(size_t i) { return i == std::string::npos ? -1 : (int)i; }
+  std::string _s;
+};
+
+#endif // SERVER_HOST_WSTRING_H
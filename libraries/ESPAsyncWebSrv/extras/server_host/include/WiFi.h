@@ -0,0 +1,14 @@
+// Host stand-in for the ESP32 WiFi object, used by ON_STA_FILTER/ON_AP_FILTER.
+
+#ifndef SERVER_HOST_WIFI_H
+#define SERVER_HOST_WIFI_H
+
+#include <Arduino.h>
+
+class WiFiClass {
+public:
+  IPAddress localIP() { return IPAddress(0x0101A8C0); }
+};
+extern WiFiClass WiFi;
+
+#endif // SERVER_HOST_WIFI_H
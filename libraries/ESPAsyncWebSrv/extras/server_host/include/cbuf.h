@@ -0,0 +1,33 @@
+// Host stand-in for the Arduino cbuf, used by AsyncResponseStream.
+
+#ifndef SERVER_HOST_CBUF_H
+#define SERVER_HOST_CBUF_H
+
+#include <string>
+#include <stddef.h>
+
+class cbuf {
+public:
+  cbuf(size_t size) : _size(size) {}
+  size_t room() const { return _size - _data.size(); }
+  size_t available() const { return _data.size(); }
+  size_t resizeAdd(size_t add) { _size += add; return _size; }
+  size_t write(const char *data, size_t size) {
+    size = std::min(size, room());
+    _data.append(data, size);
+    return size;
+  }
+  size_t write(char c) { return write(&c, 1); }
+  size_t read(char *dst, size_t size) {
+    size = std::min(size, _data.size());
+    _data.copy(dst, size);
+    _data.erase(0, size);
+    return size;
+  }
+
+private:
+  size_t _size;
+  std::string _data;
+};
+
+#endif // SERVER_HOST_CBUF_H
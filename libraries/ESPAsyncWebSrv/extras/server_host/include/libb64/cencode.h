@@ -0,0 +1,18 @@
+// Host stand-in for libb64 (base64 encoder of the Arduino cores).
+
+#ifndef SERVER_HOST_CENCODE_H
+#define SERVER_HOST_CENCODE_H
+
+#define base64_encode_expected_len(n) ((((4 * (n)) / 3) + 3) & ~3)
+
+typedef struct {
+  int step;
+  char result;
+} base64_encodestate;
+
+void base64_init_encodestate(base64_encodestate *state);
+int base64_encode_block(const char *plaintext_in, int length_in, char *code_out, base64_encodestate *state);
+int base64_encode_blockend(char *code_out, base64_encodestate *state);
+int base64_encode_chars(const char *plaintext_in, int length_in, char *code_out);
+
+#endif // SERVER_HOST_CENCODE_H
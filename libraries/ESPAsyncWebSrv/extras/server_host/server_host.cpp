@@ -0,0 +1,1058 @@
+// ESPAsyncWebSrv - host tests
+// The library runs on mock AsyncTCP connections (include/): the test plays
+// the browsers, decodes what the server sends and acks it in segments.
+//
+// WebSocket: clients with different TCP windows receive random broadcasts
+// (textAll/binaryAll/printfAll, a buffer sent as text and binary),
+// per client messages and pings, acked in random order. Each client must
+// decode exactly the messages that were queued for it, as whole frames with
+// control frames only between them. Latest value messages of conflated
+// channels ("#channel:sequence...") must arrive in order, ending with the last
+// one, and a backlog of them must not grow the queues. Then reports the heap
+// allocations of a telemetry broadcast to 8 clients.
+//
+// HTTP requests: random requests (query strings with escapes, browser and odd
+// header lines, form bodies) arrive split at random points. What a handler
+// sees must match a reference parse of the text. Mutated requests must not
+// crash the server. Then reports the heap allocations and host time of
+// recorded browser requests.
+//
+// Assets: the robot web interface, bundled by ../bundle_assets.py, is served
+// from memory under its paths and hash named paths, gzipped, with 304 answers
+// to a matching If-None-Match. Then reports a page load and a reload against
+// the same files served by serveStatic().
+//
+// Usage: server_host [-n random operations] [-s seed]
+
+#include <ESPAsyncWebSrv.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <zlib.h>
+#include "host.h"
+#include "assets.h"
+
+static int failures;
+
+static void fail(const char *what) {
+  if (failures < 10)
+    printf("FAIL: %s\n", what);
+  failures++;
+}
+
+/*
+ * WebSocket peer: decodes the frames the server sent on its connection
+ */
+
+struct WsMessage {
+  uint8_t opcode;
+  std::string payload;
+  bool operator==(const WsMessage &m) const { return opcode == m.opcode && payload == m.payload; }
+};
+
+struct WsPeer {
+  AsyncClient *tcp;
+  uint32_t id;
+  size_t parsed = 0;
+  std::vector<WsMessage> received, expected;
+  unsigned pings = 0, expectedPings = 0;
+  std::string partial;
+  uint8_t partialOpcode = 0;
+  bool error = false;
+  std::vector<long> latest[4]; // sequences received on the conflated channels
+
+  void parse() {
+    const std::string &w = tcp->wire;
+    while (!error && w.size() - parsed >= 2) {
+      const uint8_t *h = (const uint8_t *)w.data() + parsed;
+      size_t avail = w.size() - parsed, head = 2;
+      uint64_t len = h[1] & 0x7F;
+      if (h[1] & 0x80) {
+        error = true; // server frames are not masked
+        break;
+      }
+      if (len == 126) {
+        if (avail < 4)
+          break;
+        len = (h[2] << 8) | h[3];
+        head = 4;
+      } else if (len == 127) {
+        if (avail < 10)
+          break;
+        len = 0;
+        for (int i = 2; i < 10; i++)
+          len = (len << 8) | h[i];
+        head = 10;
+      }
+      if (avail < head + len)
+        break;
+      bool fin = h[0] & 0x80;
+      uint8_t opcode = h[0] & 0x0F;
+      std::string data(w, parsed + head, len);
+      parsed += head + len;
+      if (opcode >= 8) {
+        if (!fin || len > 125)
+          error = true;
+        else if (opcode == WS_PING)
+          pings++;
+        continue;
+      }
+      if (opcode == WS_CONTINUATION) {
+        if (!partialOpcode) {
+          error = true;
+          break;
+        }
+        partial += data;
+      } else {
+        if (partialOpcode) {
+          error = true;
+          break;
+        }
+        partialOpcode = opcode;
+        partial = data;
+      }
+      if (fin && partial[0] == '#') {
+        int channel;
+        long sequence;
+        if (sscanf(partial.c_str(), "#%d:%ld", &channel, &sequence) != 2 || channel < 1 || channel > 3)
+          error = true;
+        else
+          latest[channel].push_back(sequence);
+        partialOpcode = 0;
+      } else if (fin) {
+        received.push_back({partialOpcode, partial});
+        partialOpcode = 0;
+      }
+    }
+  }
+};
+
+static const char *upgrade = "GET /ws HTTP/1.1\r\n"
+                             "Host: esp32\r\n"
+                             "Upgrade: websocket\r\n"
+                             "Connection: Upgrade\r\n"
+                             "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+                             "Sec-WebSocket-Version: 13\r\n\r\n";
+
+// Opens a connection and upgrades it, the 101 response is acked and skipped
+static bool wsConnect(HostServer &server, AsyncWebSocket &ws, WsPeer &peer, size_t window) {
+  size_t before = ws.count();
+  peer.tcp = server.connect();
+  peer.tcp->receive(upgrade, strlen(upgrade));
+  if (peer.tcp->wire.compare(0, 12, "HTTP/1.1 101") != 0)
+    return false;
+  peer.tcp->acknowledgeAll();
+  peer.tcp->window = window;
+  peer.parsed = peer.tcp->wire.size();
+  if (ws.count() != before + 1)
+    return false;
+  peer.id = 0;
+  for (const auto &c : ws.getClients())
+    if (c->client() == peer.tcp)
+      peer.id = c->id();
+  return peer.id != 0;
+}
+
+static std::string randomPayload(size_t len) {
+  std::string s(len, 0);
+  for (auto &c : s)
+    c = 'a' + rand() % 26;
+  return s;
+}
+
+static size_t randomLength() {
+  switch (rand() % 8) {
+  case 0: return rand() % 4;
+  case 1: return 120 + rand() % 10;       // around the 7 bit length limit
+  case 2: return 1000 + rand() % 3000;    // several segments
+  case 3: return rand() % 50 == 0 ? 65530 + rand() % 20 : 500; // 16 bit limit
+  default: return 10 + rand() % 300;
+  }
+}
+
+// Expect a broadcast on the clients whose queue has room
+static void expectAll(AsyncWebSocket &ws, std::vector<WsPeer> &peers, uint8_t opcode, const std::string &payload) {
+  for (auto &p : peers)
+    if (!ws.client(p.id)->queueIsFull())
+      p.expected.push_back({opcode, payload});
+}
+
+// A latest value message on a conflated channel
+static std::string latestPayload(int channel, long sequence) {
+  char s[32];
+  snprintf(s, sizeof(s), "#%d:%ld ", channel, sequence);
+  return s + randomPayload(randomLength());
+}
+
+// Ack everything until nothing is left to send
+static void drain(std::vector<WsPeer> &peers) {
+  for (int round = 0; round < 10000; round++) {
+    bool busy = false;
+    for (auto &p : peers) {
+      if (p.tcp->inFlight()) {
+        busy = true;
+        p.tcp->acknowledgeAll();
+      } else {
+        p.tcp->poll();
+      }
+    }
+    if (!busy)
+      break;
+  }
+  for (auto &p : peers)
+    p.parse();
+}
+
+static void testWebSocket(long operations) {
+  HostServer server;
+  AsyncWebSocket &ws = *new AsyncWebSocket("/ws"); // owned by the server
+  server.addHandler(&ws);
+  server.begin();
+
+  // Windows from less than a frame header to more than the largest message
+  static const size_t windows[] = {5744, 200, 1436, 64, 65536 + 1024, 3000};
+  std::vector<WsPeer> peers(sizeof(windows) / sizeof(windows[0]));
+  for (size_t i = 0; i < peers.size(); i++)
+    if (!wsConnect(server, ws, peers[i], windows[i]))
+      fail("websocket upgrade");
+  if (failures)
+    return;
+
+  for (long n = 0; n < operations; n++) {
+    WsPeer &p = peers[rand() % peers.size()];
+    AsyncWebSocketClient *c = ws.client(p.id);
+    int op = rand() % 16;
+    if (op < 3) {
+      std::string s = randomPayload(randomLength());
+      expectAll(ws, peers, WS_TEXT, s);
+      ws.textAll(s.c_str(), s.size());
+    } else if (op < 4) {
+      std::string s = randomPayload(randomLength());
+      expectAll(ws, peers, WS_BINARY, s);
+      ws.binaryAll(s.c_str(), s.size());
+    } else if (op < 5) {
+      char s[32];
+      snprintf(s, sizeof(s), "t=%ld", n);
+      expectAll(ws, peers, WS_TEXT, s);
+      ws.printfAll("t=%ld", n);
+    } else if (op < 6) {
+      // A buffer of the application sent as text, then possibly as binary while
+      // the clients still send it as text (as a message object, which does not
+      // send empty messages)
+      std::string s = randomPayload(1 + randomLength());
+      AsyncWebSocketMessageBuffer *buffer = ws.makeBuffer((uint8_t *)s.data(), s.size());
+      expectAll(ws, peers, WS_TEXT, s);
+      ws.textAll(buffer);
+      if (rand() % 2) {
+        expectAll(ws, peers, WS_BINARY, s);
+        ws.binaryAll(buffer);
+      }
+    } else if (op < 8) {
+      std::string s = randomPayload(1 + randomLength());
+      if (!c->queueIsFull())
+        p.expected.push_back({WS_TEXT, s});
+      c->text(s.c_str(), s.size());
+    } else if (op < 9) {
+      p.expectedPings++;
+      c->ping();
+    } else if (op < 10) {
+      int channel = 1 + rand() % 3;
+      std::string s = latestPayload(channel, n);
+      if (rand() % 4) {
+        ws.textAll(s.c_str(), s.size(), channel);
+      } else {
+        // As text then binary: the second one is a separate message replacing the first
+        AsyncWebSocketMessageBuffer *buffer = ws.makeBuffer((uint8_t *)s.data(), s.size());
+        ws.textAll(buffer, channel);
+        ws.binaryAll(buffer, channel);
+      }
+    } else if (op < 15) {
+      p.tcp->acknowledge(1 + rand() % 4);
+    } else {
+      p.tcp->poll();
+    }
+    for (auto &q : peers)
+      q.parse();
+  }
+
+  drain(peers);
+
+  // A backlog of latest values: each queue keeps at most the one being sent and the
+  // newest one, and the newest one arrives last
+  long last = operations;
+  for (int i = 0; i < 1000; i++) {
+    std::string s = latestPayload(1 + i % 3, ++last);
+    ws.binaryAll(s.c_str(), s.size(), 1 + i % 3);
+    if (i % 100 == 0)
+      peers[i / 100 % peers.size()].tcp->acknowledge(1);
+  }
+  if (ws._buffers.length() > peers.size() + 3)
+    fail("websocket conflated backlog");
+  drain(peers);
+  for (int channel = 1; channel <= 3; channel++) {
+    std::string s = latestPayload(channel, ++last);
+    ws.textAll(s.c_str(), s.size(), channel);
+  }
+  drain(peers);
+
+  for (auto &p : peers) {
+    for (int channel = 1; channel <= 3; channel++) {
+      const std::vector<long> &l = p.latest[channel];
+      if (l.empty() || l.back() != last - 3 + channel || !std::is_sorted(l.begin(), l.end()) ||
+          std::adjacent_find(l.begin(), l.end()) != l.end()) {
+        printf("client %u window %zu: channel %d, %zu values, last %ld\n", p.id, p.tcp->window, channel,
+               l.size(), l.empty() ? -1 : l.back());
+        fail("websocket conflated channel");
+      }
+    }
+    if (p.error) {
+      printf("client %u window %zu: bad frame at %zu of %zu, message %zu\n", p.id, p.tcp->window, p.parsed,
+             p.tcp->wire.size(), p.received.size());
+      fail("websocket frame structure");
+    }
+    else if (p.parsed != p.tcp->wire.size() || p.partialOpcode)
+      fail("websocket truncated frame");
+    else if (p.received != p.expected) {
+      size_t i = 0;
+      while (i < p.received.size() && i < p.expected.size() && p.received[i] == p.expected[i])
+        i++;
+      printf("client %u window %zu: %zu messages, %zu expected, differ at %zu\n", p.id, p.tcp->window,
+             p.received.size(), p.expected.size(), i);
+      if (i < p.received.size() && i < p.expected.size())
+        printf("  got %u:%zu expected %u:%zu\n", p.received[i].opcode, p.received[i].payload.size(), p.expected[i].opcode, p.expected[i].payload.size());
+      fail("websocket messages");
+    } else if (p.pings != p.expectedPings) {
+      printf("client %u window %zu: %u pings, %u expected\n", p.id, p.tcp->window, p.pings, p.expectedPings);
+      fail("websocket pings");
+    }
+  }
+
+  if (!ws._buffers.isEmpty())
+    fail("websocket buffers not released");
+  for (auto &p : peers)
+    p.tcp->disconnect();
+  if (ws.count())
+    fail("websocket clients left");
+}
+
+// Heap allocations of a 200 byte broadcast to 8 clients, every client acking
+// it before the next one
+static void reportBroadcast() {
+  HostServer server;
+  AsyncWebSocket &ws = *new AsyncWebSocket("/ws"); // owned by the server
+  server.addHandler(&ws);
+  server.begin();
+  std::vector<WsPeer> peers(8);
+  for (auto &p : peers)
+    if (!wsConnect(server, ws, p, 5744))
+      fail("websocket upgrade");
+  if (failures)
+    return;
+
+  std::string telemetry = randomPayload(200);
+  const int frames = 50;
+  unsigned long allocations[2];
+  for (int pass = 0; pass < 2; pass++) {
+    for (int warmup = 0; warmup <= frames; warmup++) {
+      if (warmup == 1)
+        allocations[pass] = hostAllocations;
+      if (pass == 0) {
+        ws.textAll(telemetry.c_str(), telemetry.size());
+      } else {
+        for (auto &p : peers)
+          ws.text(p.id, telemetry.c_str(), telemetry.size());
+      }
+      for (auto &p : peers)
+        p.tcp->acknowledgeAll();
+    }
+    allocations[pass] = hostAllocations - allocations[pass];
+  }
+  printf("websocket 200 byte message to 8 clients, heap allocations per message:\n");
+  printf("  textAll()            %.1f\n", (double)allocations[0] / frames);
+  printf("  text() to each       %.1f\n", (double)allocations[1] / frames);
+
+  for (auto &p : peers) {
+    p.parse();
+    if (p.error || p.received.size() != 2 * (frames + 1))
+      fail("websocket telemetry");
+  }
+  for (auto &p : peers)
+    p.tcp->disconnect();
+}
+
+/*
+ * HTTP requests: what the handlers see, against a reference parse
+ */
+
+// What the handler saw: see dumpRequest()
+static std::string observed;
+// Names looked up by the handler, headers in another case
+static std::vector<std::string> probeHeaders, probeArgs;
+
+static std::string dumpRequest(AsyncWebServerRequest *request) {
+  std::string d = std::string(request->methodToString()) + " " + request->url().c_str() + " v" +
+                  std::to_string(request->version()) + "\n";
+  d += std::string("host ") + request->host().c_str() + " type " + request->contentType().c_str() + " length " +
+       std::to_string(request->contentLength()) + "\n";
+  for (size_t i = 0; i < request->params(); i++) {
+    AsyncWebParameter *p = request->getParam(i);
+    d += std::string("P ") + p->name().c_str() + "=" + p->value().c_str() + (p->isPost() ? " post" : "") + "\n";
+  }
+  for (size_t i = 0; i < request->headers(); i++)
+    d += std::string("H ") + request->headerName(i).c_str() + ": " + request->header(i).c_str() + "\n";
+  for (const auto &name : probeHeaders) {
+    d += "h " + name + (request->hasHeader(name.c_str()) ? "=" : " -");
+    d += std::string(request->header(name.c_str()).c_str()) + "\n";
+  }
+  for (const auto &name : probeArgs) {
+    d += "a " + name + (request->hasArg(name.c_str()) ? "=" : " -");
+    d += std::string(request->arg(String(name.c_str())).c_str()) + "\n";
+  }
+  return d;
+}
+
+static std::string referenceDecode(const std::string &s, bool dropNul) {
+  std::string d;
+  for (size_t i = 0; i < s.size();) {
+    char c = s[i++];
+    if (c == '%' && i + 1 < s.size()) {
+      char hex[] = {'0', 'x', s[i], s[i + 1], 0};
+      c = strtol(hex, NULL, 16);
+      i += 2;
+    } else if (c == '+') {
+      c = ' ';
+    }
+    if (c || !dropNul)
+      d += c;
+  }
+  return d;
+}
+
+static std::string referenceTrim(std::string s) {
+  s = s.substr(0, strlen(s.c_str())); // a NUL ends a line
+  size_t b = 0, e = s.size();
+  while (b < e && isspace((uint8_t)s[b]))
+    b++;
+  while (e > b && isspace((uint8_t)s[e - 1]))
+    e--;
+  return s.substr(b, e - b);
+}
+
+static bool equalsIgnoreCase(const std::string &a, const std::string &b) {
+  return a.size() == b.size() && strcasecmp(a.c_str(), b.c_str()) == 0;
+}
+
+typedef std::vector<std::pair<std::string, std::string>> Pairs;
+
+// The parse of a request, as dumpRequest() prints it
+static std::string referenceDump(const std::string &text) {
+  size_t pos = 0;
+  std::vector<std::string> lines;
+  while (true) {
+    size_t end = text.find('\n', pos);
+    std::string line = referenceTrim(text.substr(pos, end - pos));
+    pos = end + 1;
+    if (line.empty())
+      break;
+    lines.push_back(line);
+  }
+  std::string body = text.substr(pos);
+
+  // Request line
+  std::string line = lines[0];
+  size_t u = line.find(' ');
+  std::string method = line.substr(0, u);
+  std::string url = u == std::string::npos ? "" : line.substr(u + 1);
+  size_t v = url.find(' ');
+  std::string version = v == std::string::npos ? "" : url.substr(v + 1);
+  url = url.substr(0, v);
+  static const char *methods[] = {"GET", "POST", "DELETE", "PUT", "PATCH", "HEAD", "OPTIONS"};
+  std::string methodName = "ANY";
+  for (const char *m : methods)
+    if (method == m)
+      methodName = m;
+  Pairs params;
+  std::vector<bool> post;
+  size_t q = url.find('?');
+  if (q != std::string::npos && q > 0) {
+    std::string query = url.substr(q + 1);
+    url = url.substr(0, q);
+    for (size_t start = 0; start < query.size();) {
+      size_t end = std::min(query.find('&', start), query.size());
+      size_t equal = std::min(query.find('=', start), end);
+      params.push_back({referenceDecode(query.substr(start, equal - start), true),
+                        equal + 1 < end ? referenceDecode(query.substr(equal + 1, end - equal - 1), true) : ""});
+      post.push_back(false);
+      start = end + 1;
+    }
+  }
+
+  // Headers
+  Pairs headers;
+  std::string host, contentType;
+  size_t contentLength = 0;
+  for (size_t i = 1; i < lines.size(); i++) {
+    size_t colon = lines[i].find(':');
+    if (colon == std::string::npos || colon == 0)
+      continue;
+    std::string name = lines[i].substr(0, colon);
+    size_t value = lines[i].find_first_not_of(" \t", colon + 1);
+    headers.push_back({name, value == std::string::npos ? "" : lines[i].substr(value)});
+    if (equalsIgnoreCase(name, "Host"))
+      host = headers.back().second;
+    else if (equalsIgnoreCase(name, "Content-Type"))
+      contentType = headers.back().second.substr(0, headers.back().second.find(';'));
+    else if (equalsIgnoreCase(name, "Content-Length"))
+      contentLength = atoi(headers.back().second.c_str());
+  }
+
+  // A form body
+  if (contentType == "application/x-www-form-urlencoded") {
+    body = body.substr(0, contentLength);
+    for (size_t start = 0; start < body.size();) {
+      size_t end = std::min(body.find('&', start), body.size());
+      std::string item = body.substr(start, end - start);
+      size_t equal = item.find('=');
+      if (item[0] != '{' && item[0] != '[' && equal != std::string::npos && equal > 0)
+        params.push_back({referenceDecode(item.substr(0, equal), false), referenceDecode(item.substr(equal + 1), false)});
+      else
+        params.push_back({"body", referenceDecode(item, false)});
+      post.push_back(true);
+      start = end + 1;
+    }
+  }
+
+  std::string d = methodName + " " + referenceDecode(url, true) + " v" + (version.compare(0, 8, "HTTP/1.0") ? "1" : "0") + "\n";
+  d += "host " + host + " type " + contentType + " length " + std::to_string(contentLength) + "\n";
+  // The form parser keeps a decoded NUL in its Strings, dumpRequest() prints them up to it
+  for (size_t i = 0; i < params.size(); i++)
+    d += std::string("P ") + params[i].first.c_str() + "=" + params[i].second.c_str() + (post[i] ? " post" : "") + "\n";
+  for (const auto &h : headers)
+    d += "H " + h.first + ": " + h.second + "\n";
+  for (const auto &name : probeHeaders) {
+    auto h = std::find_if(headers.begin(), headers.end(), [&](const std::pair<std::string, std::string> &h) { return equalsIgnoreCase(h.first, name); });
+    d += "h " + name + (h != headers.end() ? "=" + h->second : " -") + "\n";
+  }
+  for (const auto &name : probeArgs) {
+    auto p = std::find_if(params.begin(), params.end(), [&](const std::pair<std::string, std::string> &p) { return p.first == name; });
+    d += "a " + name + (p != params.end() ? "=" + std::string(p->second.c_str()) : " -") + "\n";
+  }
+  return d;
+}
+
+static const char *browserHeaders[] = {
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/120.0.0.0 Safari/537.36",
+    "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,image/avif,image/webp,*/*;q=0.8",
+    "Accept-Language: en-US,en;q=0.9,de;q=0.8",
+    "Accept-Encoding: gzip, deflate",
+    "Connection: keep-alive",
+    "Referer: http://192.168.4.1/",
+    "Cache-Control: max-age=0",
+    "Upgrade-Insecure-Requests: 1",
+    "DNT: 1",
+    "Cookie: session=4f2a9c; theme=dark",
+    "Pragma: no-cache",
+    "Sec-GPC: 1",
+};
+
+static std::string randomComponent() {
+  static const char *pieces[] = {"a", "Kp", "throttle", "x", "0.35", "-12", "%41", "%4", "%zz", "+", "%2B", "%26",
+                                 "%3D", "%20", "%00", "%", "~", ".", "_", "%C3%A9", "{", "["};
+  std::string s;
+  for (int n = rand() % 4; n > 0; n--)
+    s += pieces[rand() % (sizeof(pieces) / sizeof(pieces[0]))];
+  return s;
+}
+
+static std::string randomQuery() {
+  std::string q;
+  for (int n = rand() % 6; n >= 0; n--) {
+    std::string name = randomComponent(), value = randomComponent();
+    switch (rand() % 6) {
+    case 0: q += name; break;
+    case 1: q += "=" + value; break;
+    case 2: q += name + "="; break;
+    case 3: break;
+    default: q += name + "=" + value;
+    }
+    if (n)
+      q += "&";
+  }
+  if (rand() % 8 == 0)
+    q += "&";
+  return q;
+}
+
+static std::string randomCase(std::string s) {
+  for (auto &c : s)
+    if (rand() % 3 == 0)
+      c = rand() % 2 ? toupper(c) : tolower(c);
+  return s;
+}
+
+// A random request, with the header names and arguments worth looking up
+static std::string randomRequest() {
+  static const char *methods[] = {"GET", "GET", "GET", "POST", "PUT", "DELETE", "PATCH", "HEAD", "OPTIONS", "BREW"};
+  const char *eol = rand() % 4 ? "\r\n" : "\n";
+  std::string url = "/";
+  for (int n = rand() % 4; n > 0; n--)
+    url += randomComponent() + (rand() % 2 ? "/" : "");
+  if (rand() % 2)
+    url += "?" + randomQuery();
+  if (rand() % 50 == 0)
+    url = "?" + randomQuery(); // not a query: the ? is first
+  std::string text = methods[rand() % (sizeof(methods) / sizeof(methods[0]))] + (" " + url);
+  switch (rand() % 5) {
+  case 0: text += " HTTP/1.0"; break;
+  case 1: break;
+  default: text += " HTTP/1.1";
+  }
+  text += eol;
+
+  std::vector<std::string> lines;
+  lines.push_back("Host: 192.168.4.1");
+  for (const char *h : browserHeaders)
+    if (rand() % 2)
+      lines.push_back(h);
+  for (int n = rand() % 5; n > 0; n--) {
+    static const char *separators[] = {": ", ":", ":   ", ":\t", " : "};
+    std::string value;
+    for (int i = rand() % 40; i > 0; i--)
+      value += (char)(' ' + rand() % 95);
+    lines.push_back("X-Fuzz-" + std::to_string(rand() % 4) + separators[rand() % 5] + value);
+  }
+  if (rand() % 10 == 0)
+    lines.push_back("a line without colon");
+  if (rand() % 10 == 0)
+    lines.push_back(": no name");
+  if (rand() % 10 == 0)
+    lines.push_back("  X-Indented: value  \t");
+  std::string body;
+  if (rand() % 3 == 0) {
+    body = randomQuery();
+    if (!body.empty()) {
+      lines.push_back("Content-Type: application/x-www-form-urlencoded");
+      lines.push_back("Content-Length: " + std::to_string(body.size()));
+    }
+  }
+  std::random_shuffle(lines.begin() + 1, lines.end());
+
+  probeHeaders.clear();
+  probeArgs.clear();
+  for (auto &l : lines) {
+    size_t colon = l.find(':');
+    if (colon == std::string::npos || colon == 0) {
+      text += l + eol;
+      continue;
+    }
+    if (rand() % 2)
+      l = randomCase(l.substr(0, colon)) + l.substr(colon);
+    text += l + eol;
+    if (rand() % 4 == 0)
+      probeHeaders.push_back(referenceTrim(randomCase(l.substr(0, colon))));
+  }
+  probeHeaders.push_back("X-Absent");
+  for (int n = rand() % 3; n > 0; n--)
+    probeArgs.push_back(referenceDecode(randomComponent(), true));
+  probeArgs.push_back("absent");
+  return text + eol + body;
+}
+
+// Sends text in random pieces, returns what the server answered
+static std::string sendRequest(HostServer &server, const std::string &text, bool split) {
+  AsyncClient *c = server.connect();
+  for (size_t pos = 0; pos < text.size() && !c->closed;) {
+    size_t n = split ? 1 + rand() % (rand() % 4 ? 16 : text.size()) : text.size();
+    n = std::min(n, text.size() - pos);
+    c->receive(text.data() + pos, n);
+    pos += n;
+  }
+  std::string response = c->wire;
+  c->acknowledgeAll();
+  c->disconnect();
+  return response;
+}
+
+// Randomly damaged request: flipped, inserted and deleted bytes, NULs, lost line ends
+static std::string mutate(std::string text) {
+  for (int n = 1 + rand() % 8; n > 0 && !text.empty(); n--) {
+    size_t at = rand() % text.size();
+    switch (rand() % 5) {
+    case 0: text[at] = rand(); break;
+    case 1: text.insert(at, 1, (char)(rand() % 3 ? rand() : 0)); break;
+    case 2: text.erase(at, 1 + rand() % 8); break;
+    case 3: text.insert(at, std::string(rand() % 3000, "a:\r\n &=?%"[rand() % 9])); break;
+    default: text.insert(at, "Content-Length: " + std::to_string(rand() % 100) + "\r\n");
+    }
+  }
+  return text;
+}
+
+// Looks a header up before the uninteresting ones are removed, lists what is left
+class InterestingHandler : public AsyncWebHandler {
+public:
+  virtual bool canHandle(AsyncWebServerRequest *request) override {
+    if (request->url() != "/interesting")
+      return false;
+    request->addInterestingHeader("cookie");
+    request->addInterestingHeader("X-Fuzz-1");
+    before = request->getHeader("User-Agent");
+    return true;
+  }
+  virtual void handleRequest(AsyncWebServerRequest *request) override {
+    observed = dumpRequest(request);
+    observed += request->getHeader("User-Agent") ? "user agent kept\n" : "";
+    request->send(200);
+  }
+  virtual bool isRequestHandlerTrivial() override { return false; }
+  AsyncWebHeader *before = nullptr;
+};
+
+static void testRequests(long operations) {
+  HostServer server;
+  fs::FS files;
+  files.add("/www/app.js", std::string(1234, 'x'));
+  server.serveStatic("/static/", files, "/www/").setCacheControl("max-age=600");
+  server.addHandler(new InterestingHandler());
+  server.onNotFound([](AsyncWebServerRequest *request) {
+    observed = dumpRequest(request);
+    request->send(200, "text/plain", "ok");
+  });
+  server.begin();
+
+  for (long n = 0; n < operations; n++) {
+    std::string text = randomRequest();
+    if (rand() % 8 == 0) {
+      sendRequest(server, mutate(text), true);
+      continue;
+    }
+    observed.clear();
+    std::string expected = referenceDump(text);
+    std::string response = sendRequest(server, text, true);
+    if (response.compare(8, 7, " 200 OK") != 0 || observed != expected) {
+      if (failures < 3) {
+        printf("request:\n%s\nresponse: %.40s\nexpected:\n%s\nobserved:\n", text.c_str(), response.c_str(), expected.c_str());
+        fwrite(observed.data(), 1, observed.size(), stdout);
+      }
+      fail("http request parse");
+    }
+  }
+
+  // Only the interesting headers are left, the handler asked for the user agent before
+  probeHeaders = {"COOKIE", "User-Agent"};
+  probeArgs.clear();
+  observed.clear();
+  std::string text = "GET /interesting HTTP/1.1\r\nHost: esp32\r\nUser-Agent: test\r\nX-Fuzz-1: a\r\n"
+                     "Cookie: id=1\r\nX-Fuzz-2: b\r\n\r\n";
+  sendRequest(server, text, true);
+  if (observed != "GET /interesting v1\nhost esp32 type  length 0\nH X-Fuzz-1: a\nH Cookie: id=1\n"
+                  "h COOKIE=id=1\nh User-Agent -\n")
+    fail("http interesting headers");
+
+  // The static handler sees its conditional header
+  text = "GET /static/app.js HTTP/1.1\r\nHost: esp32\r\nAccept: */*\r\nIf-None-Match: 1234\r\n\r\n";
+  if (sendRequest(server, text, true).compare(0, 12, "HTTP/1.1 304") != 0)
+    fail("http static not modified");
+  text = "GET /static/app.js HTTP/1.1\r\nHost: esp32\r\nIf-None-Match: 1\r\n\r\n";
+  if (sendRequest(server, text, true).compare(0, 12, "HTTP/1.1 200") != 0)
+    fail("http static");
+}
+
+// Requests of a browser to a robot, as recorded
+static const char *recordedRequests[] = {
+    "GET / HTTP/1.1\r\n"
+    "Host: 192.168.4.1\r\n"
+    "Connection: keep-alive\r\n"
+    "Cache-Control: max-age=0\r\n"
+    "Upgrade-Insecure-Requests: 1\r\n"
+    "User-Agent: Mozilla/5.0 (Linux; Android 13; Pixel 6) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/120.0.0.0 Mobile Safari/537.36\r\n"
+    "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,image/avif,image/webp,image/apng,*/*;q=0.8\r\n"
+    "Accept-Encoding: gzip, deflate\r\n"
+    "Accept-Language: en-US,en;q=0.9\r\n\r\n",
+
+    "GET /control?throttle=-35&steering=12&mode=auto HTTP/1.1\r\n"
+    "Host: 192.168.4.1\r\n"
+    "Connection: keep-alive\r\n"
+    "User-Agent: Mozilla/5.0 (Linux; Android 13; Pixel 6) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/120.0.0.0 Mobile Safari/537.36\r\n"
+    "Accept: */*\r\n"
+    "Referer: http://192.168.4.1/\r\n"
+    "Accept-Encoding: gzip, deflate\r\n"
+    "Accept-Language: en-US,en;q=0.9\r\n\r\n",
+
+    "POST /settings HTTP/1.1\r\n"
+    "Host: 192.168.4.1\r\n"
+    "Connection: keep-alive\r\n"
+    "Content-Length: 35\r\n"
+    "Cache-Control: max-age=0\r\n"
+    "Origin: http://192.168.4.1\r\n"
+    "Content-Type: application/x-www-form-urlencoded\r\n"
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64; rv:121.0) Gecko/20100101 Firefox/121.0\r\n"
+    "Accept: text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8\r\n"
+    "Referer: http://192.168.4.1/\r\n"
+    "Accept-Encoding: gzip, deflate\r\n"
+    "Accept-Language: en-US,en;q=0.5\r\n\r\n"
+    "kp=0.32&kd=0.05&name=Bal%20Bot&on=1",
+
+    "GET /static/app.js HTTP/1.1\r\n"
+    "Host: 192.168.4.1\r\n"
+    "Connection: keep-alive\r\n"
+    "User-Agent: Mozilla/5.0 (X11; Linux x86_64; rv:121.0) Gecko/20100101 Firefox/121.0\r\n"
+    "Accept: */*\r\n"
+    "Referer: http://192.168.4.1/\r\n"
+    "Accept-Encoding: gzip, deflate\r\n"
+    "If-None-Match: 1234\r\n"
+    "Cache-Control: max-age=0\r\n\r\n",
+};
+
+// Heap allocations and host time of each recorded request, with a handler that
+// reads what it needs
+static void reportRequests() {
+  HostServer server;
+  fs::FS files;
+  files.add("/www/app.js", std::string(1234, 'x'));
+  server.serveStatic("/static/", files, "/www/").setCacheControl("max-age=600");
+  int throttle = 0;
+  server.on("/", HTTP_GET, [](AsyncWebServerRequest *request) { request->send(200, "text/html", "<html></html>"); });
+  server.on("/control", HTTP_GET, [&](AsyncWebServerRequest *request) {
+    throttle = request->arg("throttle").toInt();
+    request->send(200, "text/plain", request->hasArg("mode") ? "ok" : "?");
+  });
+  server.on("/settings", HTTP_POST, [&](AsyncWebServerRequest *request) {
+    throttle = request->getParam("kp", true) ? 1 : 0;
+    request->send(200, "text/plain", "ok");
+  });
+  server.begin();
+
+  printf("recorded HTTP requests, heap allocations and host time per request:\n");
+  const int iterations = 2000;
+  for (const char *text : recordedRequests) {
+    unsigned long allocations = hostAllocations;
+    auto start = std::chrono::steady_clock::now();
+    std::string response;
+    for (int i = 0; i < iterations; i++)
+      response = sendRequest(server, text, false);
+    double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    printf("  %-32.*s %5.1f  %5.2f us\n", (int)std::min(strchr(text, '\r') - text, (long)32), text,
+           (double)(hostAllocations - allocations) / iterations, us / iterations);
+    if (response.compare(0, 12, "HTTP/1.1 200") != 0 && response.compare(0, 12, "HTTP/1.1 304") != 0)
+      fail("http recorded request");
+  }
+  (void)throttle;
+}
+
+/*
+ * Assets: the bundle of the robot web interface (assets.h)
+ */
+
+#define WEB_INTERFACE "../../../../arduino-esp8266-self-balancing-robot/web-interface"
+
+static std::string readFile(const std::string &path) {
+  std::string content;
+  FILE *f = fopen(path.c_str(), "rb");
+  if (!f)
+    return content;
+  char buffer[4096];
+  size_t n;
+  while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0)
+    content.append(buffer, n);
+  fclose(f);
+  return content;
+}
+
+static std::string gunzip(const std::string &data) {
+  std::string out;
+  z_stream z = {};
+  if (inflateInit2(&z, 16 + MAX_WBITS) != Z_OK)
+    return out;
+  z.next_in = (Bytef *)data.data();
+  z.avail_in = data.size();
+  char buffer[4096];
+  int r;
+  do {
+    z.next_out = (Bytef *)buffer;
+    z.avail_out = sizeof(buffer);
+    r = inflate(&z, Z_NO_FLUSH);
+    out.append(buffer, sizeof(buffer) - z.avail_out);
+  } while (r == Z_OK);
+  inflateEnd(&z);
+  return r == Z_STREAM_END ? out : std::string();
+}
+
+// The value of a response header, "-" without it
+static std::string responseHeader(const std::string &response, const std::string &name) {
+  size_t end = response.find("\r\n\r\n");
+  size_t at = response.find("\r\n" + name + ": ");
+  if (at == std::string::npos || at > end)
+    return "-";
+  at += name.size() + 4;
+  return response.substr(at, response.find("\r\n", at) - at);
+}
+
+static std::string responseBody(const std::string &response) {
+  size_t end = response.find("\r\n\r\n");
+  return end == std::string::npos ? std::string() : response.substr(end + 4);
+}
+
+// The whole response, acked as it comes
+static std::string fetch(HostServer &server, const std::string &text) {
+  AsyncClient *c = server.connect();
+  c->receive(text.data(), text.size());
+  while (c->inFlight())
+    c->acknowledgeAll();
+  std::string response = c->wire;
+  c->disconnect();
+  return response;
+}
+
+static std::string get(HostServer &server, const std::string &path, const std::string &headers = "") {
+  return fetch(server, "GET " + path + " HTTP/1.1\r\nHost: 192.168.4.1\r\nAccept-Encoding: gzip, deflate\r\n" + headers + "\r\n");
+}
+
+static void testAssets() {
+  HostServer server;
+  server.serveAssets("/", robotAssets);
+  server.onNotFound([](AsyncWebServerRequest *request) { request->send(404); });
+  server.begin();
+
+  std::string index;
+  for (const AsyncWebAsset &asset : robotAssets) {
+    std::string response = get(server, asset.path);
+    std::string content = gunzip(responseBody(response));
+    if (response.compare(0, 12, "HTTP/1.1 200") != 0 || responseHeader(response, "Content-Encoding") != "gzip" ||
+        responseHeader(response, "ETag") != asset.etag || responseHeader(response, "Cache-Control") != "no-cache" ||
+        responseBody(response) != std::string((const char *)asset.data, asset.length))
+      fail("asset");
+    if (!strcmp(asset.path, "/index.html"))
+      index = content;
+    else if (content != readFile(std::string(WEB_INTERFACE) + asset.path))
+      fail("asset content");
+  }
+  // The page references the hash named paths, cached for good
+  for (const AsyncWebAsset &asset : robotAssets) {
+    if (!strcmp(asset.path, "/index.html"))
+      continue;
+    std::string response = get(server, asset.hashedPath);
+    if (index.find(asset.hashedPath + 1) == std::string::npos || response.compare(0, 12, "HTTP/1.1 200") != 0 ||
+        gunzip(responseBody(response)) != readFile(std::string(WEB_INTERFACE) + asset.path) ||
+        responseHeader(response, "Cache-Control") != "public, max-age=31536000, immutable")
+      fail("hash named asset");
+  }
+  // index.html, css/style.css, js/zepto.min.js
+  if (sizeof(robotAssets) / sizeof(robotAssets[0]) != 3 ||
+      index.find("js/zepto.min.js") != std::string::npos || index.find("css/style.css") != std::string::npos)
+    fail("asset bundle");
+
+  // The default file, conditional requests
+  const AsyncWebAsset &page = *std::find_if(std::begin(robotAssets), std::end(robotAssets),
+                                            [](const AsyncWebAsset &a) { return !strcmp(a.path, "/index.html"); });
+  std::string response = get(server, "/");
+  if (responseHeader(response, "ETag") != page.etag || gunzip(responseBody(response)) != index)
+    fail("asset default file");
+  std::string etag = page.etag;
+  for (const std::string &match : {etag, "\"0\", W/" + etag, std::string("*")}) {
+    response = get(server, "/", "If-None-Match: " + match + "\r\n");
+    if (response.compare(0, 12, "HTTP/1.1 304") != 0 || responseHeader(response, "ETag") != etag ||
+        !responseBody(response).empty())
+      fail("asset not modified");
+  }
+  response = get(server, "/index.html", "If-None-Match: \"0\"\r\n");
+  if (response.compare(0, 12, "HTTP/1.1 200") != 0)
+    fail("asset modified");
+
+  // The bundle only has gzipped copies: 406 for a client that does not take gzip
+  for (const char *accept : {"", "Accept-Encoding: identity\r\n", "Accept-Encoding: gzip;q=0, deflate\r\n",
+                             "Accept-Encoding: br, gzip;q=0.0\r\n"}) {
+    response = fetch(server, std::string("GET /index.html HTTP/1.1\r\nHost: 192.168.4.1\r\n") + accept + "\r\n");
+    if (response.compare(0, 12, "HTTP/1.1 406") != 0 || responseHeader(response, "Content-Encoding") != "-" ||
+        responseHeader(response, "Vary") != "Accept-Encoding")
+      fail("asset not acceptable");
+  }
+  for (const char *accept : {"GZIP", "br;q=1.0, gzip;q=0.8", "x-gzip", "*", "identity, *;q=0.1"}) {
+    response = fetch(server, std::string("GET /index.html HTTP/1.1\r\nHost: 192.168.4.1\r\nAccept-Encoding: ") + accept + "\r\n\r\n");
+    if (response.compare(0, 12, "HTTP/1.1 200") != 0 || gunzip(responseBody(response)) != index)
+      fail("asset acceptable");
+  }
+
+  // Unknown paths and hashes are left to the other handlers
+  for (const char *path : {"/css/style.00000000.css", "/css/", "/js/zepto.min", "/index.htm", "/.1f0e3dad", "/css"}) {
+    if (get(server, path).compare(0, 12, "HTTP/1.1 404") != 0)
+      fail("asset not found");
+  }
+}
+
+// Heap allocations and host time of a page load and a reload of the web
+// interface: from the bundle, and from serveStatic() with a gzipped copy of
+// the files, as an upload of the bundle's files would give
+static void reportAssets() {
+  HostServer bundled, stored;
+  fs::FS files;
+  for (const AsyncWebAsset &asset : robotAssets)
+    files.add((std::string("/www") + asset.path + ".gz").c_str(), std::string((const char *)asset.data, asset.length));
+  bundled.serveAssets("/", robotAssets);
+  stored.serveStatic("/", files, "/www/").setDefaultFile("index.html").setCacheControl("max-age=600");
+  bundled.begin();
+  stored.begin();
+
+  printf("robot web interface, heap allocations and host time per page load:\n");
+  const int iterations = 2000;
+  for (HostServer *server : {&bundled, &stored}) {
+    for (bool reload : {false, true}) {
+      unsigned long allocations = hostAllocations;
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < iterations; i++) {
+        for (const AsyncWebAsset &asset : robotAssets) {
+          std::string path = server == &bundled && strcmp(asset.path, "/index.html") ? asset.hashedPath : asset.path;
+          std::string etag = server == &bundled ? asset.etag : std::to_string(asset.length);
+          std::string response = fetch(*server, "GET " + path + " HTTP/1.1\r\nHost: 192.168.4.1\r\nAccept-Encoding: gzip, deflate\r\n" +
+                                                    (reload ? "If-None-Match: " + etag + "\r\n" : "") + "\r\n");
+          if (response.compare(9, 3, reload ? "304" : "200") != 0)
+            fail("asset page load");
+          // A browser keeps the hash named files without asking
+          if (reload && server == &bundled)
+            break;
+        }
+      }
+      double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+      printf("  %-8s %-6s %6.1f  %7.2f us\n", server == &bundled ? "bundle" : "static", reload ? "reload" : "load",
+             (double)(hostAllocations - allocations) / iterations, us / iterations);
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  long operations = 100000;
+  unsigned seed = 1;
+  int opt;
+  while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+    switch (opt) {
+    case 'n': operations = atol(optarg); break;
+    case 's': seed = atoi(optarg); break;
+    default:
+      fprintf(stderr, "usage: %s [-n random operations] [-s seed]\n", argv[0]);
+      return 2;
+    }
+  }
+  srand(seed);
+
+  testWebSocket(operations);
+  printf("websocket: %ld random operations %s\n", operations, failures ? "FAILED" : "OK");
+  reportBroadcast();
+
+  int before = failures;
+  testRequests(operations / 5);
+  printf("http: %ld random requests %s\n", operations / 5, failures > before ? "FAILED" : "OK");
+  reportRequests();
+
+  before = failures;
+  testAssets();
+  printf("assets: %s\n", failures > before ? "FAILED" : "OK");
+  reportAssets();
+
+  if (failures) {
+    printf("%d failure(s)\n", failures);
+    return 1;
+  }
+  return 0;
+}
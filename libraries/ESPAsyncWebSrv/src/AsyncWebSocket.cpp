@@ -37,7 +37,8 @@ size_t webSocketSendFrameWindow(AsyncClient *client){
   size_t space = client->space();
   if(space < 9)
     return 0;
-  return space - 8;
+  // webSocketSendFrame() writes 16 bit frame lengths
+  return std::min(space - 8, (size_t)0xFFFF);
 }
 
 size_t webSocketSendFrame(AsyncClient *client, bool final, uint8_t opcode, bool mask, uint8_t *data, size_t len){
@@ -63,12 +64,7 @@ size_t webSocketSendFrame(AsyncClient *client, bool final, uint8_t opcode, bool
 
   if(len > space) len = space;
 
-  uint8_t *buf = (uint8_t*)malloc(headLen);
-  if(buf == NULL){
-    //os_printf("could not malloc %u bytes for frame header\n", headLen);
-    return 0;
-  }
-
+  uint8_t buf[8];
   buf[0] = opcode & 0x0F;
   if(final)
     buf[0] |= 0x80;
@@ -85,10 +81,8 @@ size_t webSocketSendFrame(AsyncClient *client, bool final, uint8_t opcode, bool
   }
   if(client->add((const char *)buf, headLen) != headLen){
     //os_printf("error adding %lu header bytes\n", headLen);
-    free(buf);
     return 0;
   }
-  free(buf);
 
   if(len){
     if(len && mask){
@@ -119,7 +113,12 @@ AsyncWebSocketMessageBuffer::AsyncWebSocketMessageBuffer()
   :_data(nullptr)
   ,_len(0)
   ,_lock(false)
+  ,_queued(false)
   ,_count(0)
+  ,_storage(nullptr)
+  ,_capacity(0)
+  ,_head(0)
+  ,_opcode(0)
 {
 
 }
@@ -128,18 +127,20 @@ AsyncWebSocketMessageBuffer::AsyncWebSocketMessageBuffer(uint8_t * data, size_t
   :_data(nullptr)
   ,_len(size)
   ,_lock(false)
+  ,_queued(false)
   ,_count(0)
+  ,_storage(nullptr)
+  ,_capacity(0)
+  ,_head(0)
+  ,_opcode(0)
 {
 
   if (!data) {
     return; 
   }
 
-  _data = new uint8_t[_len + 1];
-
-  if (_data) {
+  if (_alloc(_len)) {
     memcpy(_data, data, _len);
-    _data[_len] = 0; 
   }
 }
 
@@ -148,34 +149,33 @@ AsyncWebSocketMessageBuffer::AsyncWebSocketMessageBuffer(size_t size)
   :_data(nullptr)
   ,_len(size)
   ,_lock(false)
+  ,_queued(false)
   ,_count(0)
+  ,_storage(nullptr)
+  ,_capacity(0)
+  ,_head(0)
+  ,_opcode(0)
 {
-  _data = new uint8_t[_len + 1]; 
-
-  if (_data) {
-    _data[_len] = 0; 
-  }
-  
+  _alloc(_len);
 }
 
 AsyncWebSocketMessageBuffer::AsyncWebSocketMessageBuffer(const AsyncWebSocketMessageBuffer & copy)
   :_data(nullptr)
   ,_len(0)
   ,_lock(false)
+  ,_queued(false)
   ,_count(0)
+  ,_storage(nullptr)
+  ,_capacity(0)
+  ,_head(0)
+  ,_opcode(0)
 {
   _len = copy._len;
   _lock = copy._lock;
   _count = 0;
 
-  if (_len) {
-    _data = new uint8_t[_len + 1]; 
-    _data[_len] = 0; 
-  } 
-
-  if (_data) {
+  if (_len && copy._data && _alloc(_len)) {
     memcpy(_data, copy._data, _len);
-    _data[_len] = 0; 
   }
 
 }
@@ -184,7 +184,12 @@ AsyncWebSocketMessageBuffer::AsyncWebSocketMessageBuffer(AsyncWebSocketMessageBu
   :_data(nullptr)
   ,_len(0)
   ,_lock(false)
+  ,_queued(false)
   ,_count(0)
+  ,_storage(nullptr)
+  ,_capacity(0)
+  ,_head(0)
+  ,_opcode(0)
 {
   _len = copy._len;
   _lock = copy._lock;
@@ -192,36 +197,90 @@ AsyncWebSocketMessageBuffer::AsyncWebSocketMessageBuffer(AsyncWebSocketMessageBu
 
   if (copy._data) {
     _data = copy._data; 
+    _storage = copy._storage;
+    _capacity = copy._capacity;
+    _head = copy._head;
+    _opcode = copy._opcode;
     copy._data = nullptr; 
+    copy._storage = nullptr;
+    copy._capacity = 0;
+    copy._head = 0;
   } 
 
 }
 
 AsyncWebSocketMessageBuffer::~AsyncWebSocketMessageBuffer()
 {
-    if (_data) {
-      delete[] _data; 
+    if (_storage) {
+      delete[] _storage; 
     }
 }
 
+// Payload of size bytes after the frame headroom, and a null terminator
+bool AsyncWebSocketMessageBuffer::_alloc(size_t size)
+{
+  if (_storage) {
+    delete[] _storage;
+  }
+  _storage = new uint8_t[WS_FRAME_HEADROOM + size + 1];
+  _head = 0;
+
+  if (!_storage) {
+    _data = nullptr;
+    _capacity = 0;
+    return false;
+  }
+  _data = _storage + WS_FRAME_HEADROOM;
+  _data[size] = 0;
+  _capacity = size;
+  return true;
+}
+
 bool AsyncWebSocketMessageBuffer::reserve(size_t size) 
 {
   _len = size; 
+  return _alloc(_len);
+}
 
-  if (_data) {
-    delete[] _data;
-    _data = nullptr; 
+bool AsyncWebSocketMessageBuffer::frame(uint8_t opcode)
+{
+  if (!_data) {
+    return false;
+  }
+  opcode &= 0x0F;
+  if (_head) {
+    if (_opcode == opcode) {
+      return true;
+    }
+    if (_count) {
+      return false;
+    }
   }
 
-  _data = new uint8_t[_len + 1];
-
-  if (_data) {
-    _data[_len] = 0;
-    return true; 
+  uint8_t head[WS_FRAME_HEADROOM];
+  uint8_t headLen;
+  head[0] = 0x80 | opcode;
+  if (_len < 126) {
+    head[1] = _len;
+    headLen = 2;
+  } else if (_len < 0x10000) {
+    head[1] = 126;
+    head[2] = (uint8_t)(_len >> 8);
+    head[3] = (uint8_t)_len;
+    headLen = 4;
   } else {
-    return false; 
+    head[1] = 127;
+    uint64_t len = _len;
+    for (uint8_t i = 0; i < 8; i++) {
+      head[9 - i] = (uint8_t)len;
+      len >>= 8;
+    }
+    headLen = 10;
   }
-
+  memcpy(_data - headLen, head, headLen);
+  _head = headLen;
+  _opcode = opcode;
+  return true;
 }
 
 
@@ -465,7 +524,8 @@ AsyncWebSocketMultiMessage::~AsyncWebSocketMultiMessage() {
 
 AsyncWebSocketClient::AsyncWebSocketClient(AsyncWebServerRequest *request, AsyncWebSocket *server)
   : _controlQueue(LinkedList<AsyncWebSocketControl *>([](AsyncWebSocketControl *c){ delete  c; }))
-  , _messageQueue(LinkedList<AsyncWebSocketMessage *>([](AsyncWebSocketMessage *m){ delete  m; }))
+  , _messageHead(0)
+  , _messageCount(0)
   , _tempObject(NULL)
 {
   _client = request->client();
@@ -488,8 +548,10 @@ AsyncWebSocketClient::AsyncWebSocketClient(AsyncWebServerRequest *request, Async
 }
 
 AsyncWebSocketClient::~AsyncWebSocketClient(){
-  _messageQueue.free();
+  while(_messageCount)
+    _dequeueMessage();
   _controlQueue.free();
+  _server->_cleanBuffers();
   _server->_handleEvent(this, WS_EVT_DISCONNECT, NULL, NULL, 0);
 }
 
@@ -508,38 +570,126 @@ void AsyncWebSocketClient::_onAck(size_t len, uint32_t time){
       _controlQueue.remove(head);
     }
   }
-  if(len && !_messageQueue.isEmpty()){
-    _messageQueue.front()->ack(len, time);
+  if(len && _messageCount){
+    QueuedMessage &head = _messageQueue[_messageHead];
+    if(head.message)
+      head.message->ack(len, time);
+    else
+      head.acked += len;
   }
-  _server->_cleanBuffers(); 
   _runQueue();
+  _server->_cleanBuffers(); 
 }
 
 void AsyncWebSocketClient::_onPoll(){
-  if(_client->canSend() && (!_controlQueue.isEmpty() || !_messageQueue.isEmpty())){
+  if(_client->canSend() && (!_controlQueue.isEmpty() || _messageCount)){
     _runQueue();
-  } else if(_keepAlivePeriod > 0 && _controlQueue.isEmpty() && _messageQueue.isEmpty() && (millis() - _lastMessageTime) >= _keepAlivePeriod){
+  } else if(_keepAlivePeriod > 0 && _controlQueue.isEmpty() && !_messageCount && (millis() - _lastMessageTime) >= _keepAlivePeriod){
     ping((uint8_t *)AWSC_PING_PAYLOAD, AWSC_PING_PAYLOAD_LEN);
   }
 }
 
 void AsyncWebSocketClient::_runQueue(){
-  while(!_messageQueue.isEmpty() && _messageQueue.front()->finished()){
-    _messageQueue.remove(_messageQueue.front());
+  while(_messageCount && _messageFinished(_messageQueue[_messageHead])){
+    _dequeueMessage();
   }
 
-  if(!_controlQueue.isEmpty() && (_messageQueue.isEmpty() || _messageQueue.front()->betweenFrames()) && webSocketSendFrameWindow(_client) > (size_t)(_controlQueue.front()->len() - 1)){
+  if(!_controlQueue.isEmpty() && !_controlQueue.front()->finished() && (!_messageCount || _messageBetweenFrames(_messageQueue[_messageHead])) && webSocketSendFrameWindow(_client) > (size_t)(_controlQueue.front()->len() - 1)){
     _controlQueue.front()->send(_client);
-  } else if(!_messageQueue.isEmpty() && _messageQueue.front()->betweenFrames() && webSocketSendFrameWindow(_client)){
-    _messageQueue.front()->send(_client);
+  } else if(_messageCount && webSocketSendFrameWindow(_client)){
+    _sendMessage(_messageQueue[_messageHead]);
+  }
+}
+
+bool AsyncWebSocketClient::_messageFinished(const QueuedMessage &entry){
+  if(entry.message)
+    return entry.message->finished();
+  return entry.sent == entry.frame->frameLength() && entry.acked >= entry.sent;
+}
+
+// A control frame may go out before this message or after it, never inside a frame
+bool AsyncWebSocketClient::_messageBetweenFrames(const QueuedMessage &entry){
+  if(entry.message)
+    return entry.message->betweenFrames();
+  return entry.acked >= entry.sent && (entry.sent == 0 || entry.sent == entry.frame->frameLength());
+}
+
+// A framed buffer is already a whole frame: it goes out as it fits in the window, without
+// waiting for the previous part to be acked
+void AsyncWebSocketClient::_sendMessage(QueuedMessage &entry){
+  if(entry.message){
+    if(entry.message->betweenFrames())
+      entry.message->send(_client);
+    return;
+  }
+  size_t toSend = entry.frame->frameLength() - entry.sent;
+  size_t space = _client->space();
+  if(toSend > space)
+    toSend = space;
+  if(!toSend)
+    return;
+  size_t added = _client->add((const char *)entry.frame->frameData() + entry.sent, toSend);
+  if(added){
+    entry.sent += added;
+    _client->send();
   }
 }
 
 bool AsyncWebSocketClient::queueIsFull(){
-  if((_messageQueue.length() >= WS_MAX_QUEUED_MESSAGES) || (_status != WS_CONNECTED) ) return true;
+  if((_messageCount >= WS_MAX_QUEUED_MESSAGES) || (_status != WS_CONNECTED) ) return true;
   return false;
 }
 
+// The next free entry of the message queue (a ring of WS_MAX_QUEUED_MESSAGES), false when full
+bool AsyncWebSocketClient::_queueSlot(QueuedMessage **entry){
+  if(_messageCount >= WS_MAX_QUEUED_MESSAGES){
+    ets_printf("ERROR: Too many messages queued\n");
+    return false;
+  }
+  uint8_t tail = _messageHead + _messageCount;
+  if(tail >= WS_MAX_QUEUED_MESSAGES)
+    tail -= WS_MAX_QUEUED_MESSAGES;
+  *entry = &_messageQueue[tail];
+  (*entry)->message = NULL;
+  (*entry)->frame = NULL;
+  (*entry)->sent = 0;
+  (*entry)->acked = 0;
+  (*entry)->channel = 0;
+  _messageCount++;
+  return true;
+}
+
+// The queued message of a channel that has not started to go out, NULL if none. Only the head
+// is being sent: the last message of the channel is replaceable unless it is the started head
+AsyncWebSocketClient::QueuedMessage *AsyncWebSocketClient::_latestSlot(uint8_t channel){
+  for(uint8_t i = _messageCount; i > 0; i--){
+    uint8_t index = _messageHead + i - 1;
+    if(index >= WS_MAX_QUEUED_MESSAGES)
+      index -= WS_MAX_QUEUED_MESSAGES;
+    QueuedMessage &entry = _messageQueue[index];
+    if(entry.channel != channel)
+      continue;
+    if(i > 1 || (entry.frame && entry.sent == 0))
+      return &entry;
+    return NULL;
+  }
+  return NULL;
+}
+
+void AsyncWebSocketClient::_releaseMessage(QueuedMessage &entry){
+  if(entry.message)
+    delete entry.message;
+  else
+    (*entry.frame)--;
+}
+
+void AsyncWebSocketClient::_dequeueMessage(){
+  _releaseMessage(_messageQueue[_messageHead]);
+  if(++_messageHead == WS_MAX_QUEUED_MESSAGES)
+    _messageHead = 0;
+  _messageCount--;
+}
+
 void AsyncWebSocketClient::_queueMessage(AsyncWebSocketMessage *dataMessage){
   if(dataMessage == NULL)
     return;
@@ -547,11 +697,46 @@ void AsyncWebSocketClient::_queueMessage(AsyncWebSocketMessage *dataMessage){
     delete dataMessage;
     return;
   }
-  if(_messageQueue.length() >= WS_MAX_QUEUED_MESSAGES){
-      ets_printf("ERROR: Too many messages queued\n");
-      delete dataMessage;
+  QueuedMessage *entry;
+  if(!_queueSlot(&entry)){
+    delete dataMessage;
   } else {
-      _messageQueue.add(dataMessage);
+    entry->message = dataMessage;
+  }
+  if(_client->canSend())
+    _runQueue();
+}
+
+// Queue a buffer shared with other clients: it is framed once and referenced by each queue.
+// A buffer already queued with another opcode is sent as a separate message.
+// With a channel, it takes the place of the message of the channel that is still waiting
+void AsyncWebSocketClient::_queueFrame(AsyncWebSocketMessageBuffer *buffer, uint8_t opcode, uint8_t channel){
+  if(buffer == NULL)
+    return;
+  buffer->_queued = true;
+  if(_status != WS_CONNECTED)
+    return;
+  AsyncWebSocketMessage *message = NULL;
+  if(!buffer->frame(opcode)){
+    if(!channel){
+      _queueMessage(new AsyncWebSocketMultiMessage(buffer, opcode));
+      return;
+    }
+    message = new AsyncWebSocketMultiMessage(buffer, opcode);
+  }
+  QueuedMessage *entry = channel ? _latestSlot(channel) : NULL;
+  if(entry){
+    _releaseMessage(*entry);
+  } else if(!_queueSlot(&entry)){
+    delete message;
+    entry = NULL;
+  }
+  if(entry){
+    entry->message = message;
+    entry->frame = message ? NULL : buffer;
+    entry->channel = channel;
+    if(!message)
+      (*buffer)++;
   }
   if(_client->canSend())
     _runQueue();
@@ -793,7 +978,11 @@ void AsyncWebSocketClient::text(const __FlashStringHelper *data){
 }
 void AsyncWebSocketClient::text(AsyncWebSocketMessageBuffer * buffer)
 {
-  _queueMessage(new AsyncWebSocketMultiMessage(buffer));
+  _queueFrame(buffer, WS_TEXT);
+}
+void AsyncWebSocketClient::text(AsyncWebSocketMessageBuffer * buffer, uint8_t channel)
+{
+  _queueFrame(buffer, WS_TEXT, channel);
 }
 
 void AsyncWebSocketClient::binary(const char * message, size_t len){
@@ -824,7 +1013,11 @@ void AsyncWebSocketClient::binary(const __FlashStringHelper *data, size_t len){
 }
 void AsyncWebSocketClient::binary(AsyncWebSocketMessageBuffer * buffer)
 {
-  _queueMessage(new AsyncWebSocketMultiMessage(buffer, WS_BINARY));
+  _queueFrame(buffer, WS_BINARY);
+}
+void AsyncWebSocketClient::binary(AsyncWebSocketMessageBuffer * buffer, uint8_t channel)
+{
+  _queueFrame(buffer, WS_BINARY, channel);
 }
 
 IPAddress AsyncWebSocketClient::remoteIP() {
@@ -852,12 +1045,16 @@ AsyncWebSocket::AsyncWebSocket(const String& url)
   ,_clients(LinkedList<AsyncWebSocketClient *>([](AsyncWebSocketClient *c){ delete c; }))
   ,_cNextId(1)
   ,_enabled(true)
-  ,_buffers(LinkedList<AsyncWebSocketMessageBuffer *>([](AsyncWebSocketMessageBuffer *b){ delete b; }))
+  ,_buffers(LinkedList<AsyncWebSocketMessageBuffer *>([this](AsyncWebSocketMessageBuffer *b){ _releaseBuffer(b); }))
+  ,_pooled(0)
 {
   _eventHandler = NULL;
 }
 
-AsyncWebSocket::~AsyncWebSocket(){}
+AsyncWebSocket::~AsyncWebSocket(){
+  while(_pooled)
+    delete _pool[--_pooled];
+}
 
 void AsyncWebSocket::_handleEvent(AsyncWebSocketClient * client, AwsEventType type, void * arg, uint8_t *data, size_t len){
   if(_eventHandler != NULL){
@@ -946,17 +1143,26 @@ void AsyncWebSocket::text(uint32_t id, const char * message, size_t len){
 }
 
 void AsyncWebSocket::textAll(AsyncWebSocketMessageBuffer * buffer){
+  textAll(buffer, 0);
+}
+
+void AsyncWebSocket::textAll(AsyncWebSocketMessageBuffer * buffer, uint8_t channel){
   if (!buffer) return;
+  buffer->_queued = true;
   buffer->lock(); 
   for(const auto& c: _clients){
     if(c->status() == WS_CONNECTED){
-        c->text(buffer);
+        c->text(buffer, channel);
     }
   }
   buffer->unlock();
   _cleanBuffers(); 
 }
 
+void AsyncWebSocket::textAll(const char * message, size_t len, uint8_t channel){
+  textAll(makeBuffer((uint8_t *)message, len), channel);
+}
+
 
 void AsyncWebSocket::textAll(const char * message, size_t len){
   AsyncWebSocketMessageBuffer * WSBuffer = makeBuffer((uint8_t *)message, len); 
@@ -975,17 +1181,27 @@ void AsyncWebSocket::binaryAll(const char * message, size_t len){
 }
 
 void AsyncWebSocket::binaryAll(AsyncWebSocketMessageBuffer * buffer)
+{
+  binaryAll(buffer, 0);
+}
+
+void AsyncWebSocket::binaryAll(AsyncWebSocketMessageBuffer * buffer, uint8_t channel)
 {
   if (!buffer) return;
+  buffer->_queued = true;
   buffer->lock(); 
     for(const auto& c: _clients){
     if(c->status() == WS_CONNECTED)
-      c->binary(buffer);
+      c->binary(buffer, channel);
   }
   buffer->unlock(); 
   _cleanBuffers(); 
 }
 
+void AsyncWebSocket::binaryAll(const char * message, size_t len, uint8_t channel){
+  binaryAll(makeBuffer((uint8_t *)message, len), channel);
+}
+
 void AsyncWebSocket::message(uint32_t id, AsyncWebSocketMessage *message){
   AsyncWebSocketClient * c = client(id);
   if(c)
@@ -1061,7 +1277,7 @@ size_t AsyncWebSocket::printfAll_P(PGM_P formatP, ...) {
   va_end(arg);
   delete[] temp;
   
-  AsyncWebSocketMessageBuffer * buffer = makeBuffer(len + 1); 
+  AsyncWebSocketMessageBuffer * buffer = makeBuffer(len); 
   if (!buffer) {
     return 0;
   }
@@ -1104,10 +1320,12 @@ void AsyncWebSocket::textAll(const String &message){
   textAll(message.c_str(), message.length());
 }
 void AsyncWebSocket::textAll(const __FlashStringHelper *message){
-  for(const auto& c: _clients){
-    if(c->status() == WS_CONNECTED)
-      c->text(message);
+  PGM_P p = reinterpret_cast<PGM_P>(message);
+  AsyncWebSocketMessageBuffer * buffer = makeBuffer(strlen_P(p));
+  if (buffer && buffer->get()) {
+    memcpy_P(buffer->get(), p, buffer->length());
   }
+  textAll(buffer);
 }
 void AsyncWebSocket::binary(uint32_t id, const char * message){
   binary(id, message, strlen(message));
@@ -1139,11 +1357,12 @@ void AsyncWebSocket::binaryAll(const String &message){
   binaryAll(message.c_str(), message.length());
 }
 void AsyncWebSocket::binaryAll(const __FlashStringHelper *message, size_t len){
-  for(const auto& c: _clients){
-    if(c->status() == WS_CONNECTED)
-      c-> binary(message, len);
+  AsyncWebSocketMessageBuffer * buffer = makeBuffer(len);
+  if (buffer && buffer->get()) {
+    memcpy_P(buffer->get(), message, len);
   }
- }
+  binaryAll(buffer);
+}
 
 const char * WS_STR_CONNECTION = "Connection";
 const char * WS_STR_UPGRADE = "Upgrade";
@@ -1195,11 +1414,28 @@ void AsyncWebSocket::handleRequest(AsyncWebServerRequest *request){
   request->send(response);
 }
 
+// Reuses the smallest idle buffer that fits, so a periodic broadcast stops allocating
 AsyncWebSocketMessageBuffer * AsyncWebSocket::makeBuffer(size_t size)
 {
-  AsyncWebSocketMessageBuffer * buffer = new AsyncWebSocketMessageBuffer(size); 
+  AsyncWebLockGuard l(_lock);
+  AsyncWebSocketMessageBuffer * buffer = nullptr;
+  uint8_t best = _pooled;
+
+  for (uint8_t i = 0; i < _pooled; i++) {
+    if (_pool[i]->_capacity >= size && (best == _pooled || _pool[i]->_capacity < _pool[best]->_capacity)) {
+      best = i;
+    }
+  }
+  if (best < _pooled) {
+    buffer = _pool[best];
+    _pool[best] = _pool[--_pooled];
+    buffer->_len = size;
+    buffer->_head = 0;
+    buffer->_data[size] = 0;
+  } else {
+    buffer = new AsyncWebSocketMessageBuffer(size); 
+  }
   if (buffer) {
-    AsyncWebLockGuard l(_lock);
     _buffers.add(buffer);
   }
   return buffer; 
@@ -1207,11 +1443,10 @@ AsyncWebSocketMessageBuffer * AsyncWebSocket::makeBuffer(size_t size)
 
 AsyncWebSocketMessageBuffer * AsyncWebSocket::makeBuffer(uint8_t * data, size_t size)
 {
-  AsyncWebSocketMessageBuffer * buffer = new AsyncWebSocketMessageBuffer(data, size); 
+  AsyncWebSocketMessageBuffer * buffer = makeBuffer(size); 
   
-  if (buffer) {
-    AsyncWebLockGuard l(_lock);
-    _buffers.add(buffer);
+  if (buffer && data && buffer->get()) {
+    memcpy(buffer->get(), data, size);
   }
 
   return buffer; 
@@ -1221,11 +1456,38 @@ void AsyncWebSocket::_cleanBuffers()
 {
   AsyncWebLockGuard l(_lock);
 
-  for(AsyncWebSocketMessageBuffer * c: _buffers){
-    if(c && c->canDelete()){
-        _buffers.remove(c);
+  while (_buffers.remove_first([](AsyncWebSocketMessageBuffer * c){ return c && c->canDelete(); }));
+}
+
+// A buffer no client references any more goes back to the pool, replacing a smaller one
+// when the pool is full
+void AsyncWebSocket::_releaseBuffer(AsyncWebSocketMessageBuffer * buffer)
+{
+  if (!buffer) {
+    return;
+  }
+  buffer->_queued = false;
+  if (!buffer->_storage) {
+    delete buffer;
+    return;
+  }
+  uint8_t slot = _pooled;
+  if (_pooled == WS_MAX_POOLED_BUFFERS) {
+    slot = 0;
+    for (uint8_t i = 1; i < _pooled; i++) {
+      if (_pool[i]->_capacity < _pool[slot]->_capacity) {
+        slot = i;
+      }
     }
+    if (_pool[slot]->_capacity >= buffer->_capacity) {
+      delete buffer;
+      return;
+    }
+    delete _pool[slot];
+  } else {
+    _pooled++;
   }
+  _pool[slot] = buffer;
 }
 
 AsyncWebSocket::AsyncWebSocketClientLinkedList AsyncWebSocket::getClients() const {
@@ -46,6 +46,18 @@
 #define DEFAULT_MAX_WS_CLIENTS 4
 #endif
 
+// Idle broadcast buffers kept by each AsyncWebSocket for the next makeBuffer()
+#ifndef WS_MAX_POOLED_BUFFERS
+#ifdef ESP32
+#define WS_MAX_POOLED_BUFFERS 4
+#else
+#define WS_MAX_POOLED_BUFFERS 2
+#endif
+#endif
+
+// Room left before the payload of a message buffer for its frame header
+#define WS_FRAME_HEADROOM 10
+
 class AsyncWebSocket;
 class AsyncWebSocketResponse;
 class AsyncWebSocketClient;
@@ -85,7 +97,14 @@ class AsyncWebSocketMessageBuffer {
     uint8_t * _data;
     size_t _len;
     bool _lock; 
+    bool _queued;         // not collected before it is passed to a client, even if an ack comes first
     uint32_t _count;  
+    uint8_t * _storage;   // WS_FRAME_HEADROOM bytes, then _data
+    size_t _capacity;
+    uint8_t _head;        // length of the frame header before _data, 0 until framed
+    uint8_t _opcode;
+
+    bool _alloc(size_t size);
 
   public:
     AsyncWebSocketMessageBuffer();
@@ -94,7 +113,7 @@ class AsyncWebSocketMessageBuffer {
     AsyncWebSocketMessageBuffer(const AsyncWebSocketMessageBuffer &); 
     AsyncWebSocketMessageBuffer(AsyncWebSocketMessageBuffer &&); 
     ~AsyncWebSocketMessageBuffer(); 
-    void operator ++(int i) { (void)i; _count++; }
+    void operator ++(int i) { (void)i; _count++; _queued = true; }
     void operator --(int i) { (void)i; if (_count > 0) { _count--; } ;  }
     bool reserve(size_t size);
     void lock() { _lock = true; }
@@ -102,9 +121,17 @@ class AsyncWebSocketMessageBuffer {
     uint8_t * get() { return _data; }
     size_t length() { return _len; }
     uint32_t count() { return _count; }
-    bool canDelete() { return (!_count && !_lock); } 
+    bool canDelete() { return (!_count && !_lock && _queued); } 
+
+    // Write the header of a single unmasked frame in front of the payload, so the
+    // buffer can be sent as is to every client. False if it is already queued with
+    // another opcode
+    bool frame(uint8_t opcode);
+    uint8_t * frameData() { return _data - _head; }
+    size_t frameLength() { return _head + _len; }
 
     friend AsyncWebSocket; 
+    friend AsyncWebSocketClient;
 
 };
 
@@ -156,13 +183,24 @@ public:
 
 class AsyncWebSocketClient {
   private:
+    // Message queue entry: a message object, or a framed buffer shared with other clients
+    struct QueuedMessage {
+      AsyncWebSocketMessage *message;
+      AsyncWebSocketMessageBuffer *frame;
+      size_t sent;
+      size_t acked;
+      uint8_t channel;    // conflated channel of the message, 0 if none
+    };
+
     AsyncClient *_client;
     AsyncWebSocket *_server;
     uint32_t _clientId;
     AwsClientStatus _status;
 
     LinkedList<AsyncWebSocketControl *> _controlQueue;
-    LinkedList<AsyncWebSocketMessage *> _messageQueue;
+    QueuedMessage _messageQueue[WS_MAX_QUEUED_MESSAGES];
+    uint8_t _messageHead;
+    uint8_t _messageCount;
 
     uint8_t _pstate;
     AwsFrameInfo _pinfo;
@@ -171,9 +209,18 @@ class AsyncWebSocketClient {
     uint32_t _keepAlivePeriod;
 
     void _queueMessage(AsyncWebSocketMessage *dataMessage);
+    void _queueFrame(AsyncWebSocketMessageBuffer *buffer, uint8_t opcode, uint8_t channel = 0);
     void _queueControl(AsyncWebSocketControl *controlMessage);
     void _runQueue();
 
+    bool _queueSlot(QueuedMessage **entry);
+    QueuedMessage *_latestSlot(uint8_t channel);
+    void _releaseMessage(QueuedMessage &entry);
+    void _dequeueMessage();
+    bool _messageFinished(const QueuedMessage &entry);
+    bool _messageBetweenFrames(const QueuedMessage &entry);
+    void _sendMessage(QueuedMessage &entry);
+
   public:
     void *_tempObject;
 
@@ -217,6 +264,7 @@ class AsyncWebSocketClient {
     void text(const String &message);
     void text(const __FlashStringHelper *data);
     void text(AsyncWebSocketMessageBuffer *buffer); 
+    void text(AsyncWebSocketMessageBuffer *buffer, uint8_t channel);
 
     void binary(const char * message, size_t len);
     void binary(const char * message);
@@ -225,8 +273,9 @@ class AsyncWebSocketClient {
     void binary(const String &message);
     void binary(const __FlashStringHelper *data, size_t len);
     void binary(AsyncWebSocketMessageBuffer *buffer); 
+    void binary(AsyncWebSocketMessageBuffer *buffer, uint8_t channel);
 
-    bool canSend() { return _messageQueue.length() < WS_MAX_QUEUED_MESSAGES; }
+    bool canSend() { return _messageCount < WS_MAX_QUEUED_MESSAGES; }
 
     //system callbacks (do not call)
     void _onAck(size_t len, uint32_t time);
@@ -286,6 +335,10 @@ class AsyncWebSocket: public AsyncWebHandler {
     void textAll(const __FlashStringHelper *message); //  need to convert
     void textAll(AsyncWebSocketMessageBuffer * buffer); 
 
+    //latest value of a channel (1-255): replaces the message of the channel still waiting in a client queue
+    void textAll(const char * message, size_t len, uint8_t channel);
+    void textAll(AsyncWebSocketMessageBuffer * buffer, uint8_t channel);
+
     void binary(uint32_t id, const char * message, size_t len);
     void binary(uint32_t id, const char * message);
     void binary(uint32_t id, uint8_t * message, size_t len);
@@ -301,6 +354,9 @@ class AsyncWebSocket: public AsyncWebHandler {
     void binaryAll(const __FlashStringHelper *message, size_t len);
     void binaryAll(AsyncWebSocketMessageBuffer * buffer); 
 
+    void binaryAll(const char * message, size_t len, uint8_t channel);
+    void binaryAll(AsyncWebSocketMessageBuffer * buffer, uint8_t channel);
+
     void message(uint32_t id, AsyncWebSocketMessage *message);
     void messageAll(AsyncWebSocketMultiMessage *message);
 
@@ -330,6 +386,9 @@ class AsyncWebSocket: public AsyncWebHandler {
     AsyncWebSocketMessageBuffer * makeBuffer(uint8_t * data, size_t size); 
     LinkedList<AsyncWebSocketMessageBuffer *> _buffers;
     void _cleanBuffers(); 
+    void _releaseBuffer(AsyncWebSocketMessageBuffer * buffer);
+    AsyncWebSocketMessageBuffer * _pool[WS_MAX_POOLED_BUFFERS];
+    uint8_t _pooled;
 
     AsyncWebSocketClientLinkedList getClients() const;
 };
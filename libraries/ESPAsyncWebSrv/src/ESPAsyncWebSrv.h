@@ -54,6 +54,7 @@ class AsyncWebParameter;
 class AsyncWebRewrite;
 class AsyncWebHandler;
 class AsyncStaticWebHandler;
+class AsyncAssetWebHandler;
 class AsyncCallbackWebHandler;
 class AsyncResponseStream;
 
@@ -163,7 +164,18 @@ class AsyncWebServerRequest {
     size_t _contentLength;
     size_t _parsedLength;
 
-    LinkedList<AsyncWebHeader *> _headers;
+    // Request head arena: the query parameters then the headers, parsed in place as "name\0value\0"
+    // pairs, followed by the line being received. Header and parameter objects are made on request
+    char *_head;
+    size_t _headSize;
+    size_t _headLength;
+    size_t _lineLength;
+    size_t _headerStart;
+    size_t _headerCount;
+    size_t _queryParams;
+    mutable AsyncWebHeader **_headerObjects;
+    mutable AsyncWebParameter **_queryObjects;
+
     LinkedList<AsyncWebParameter *> _params;
     LinkedList<String *> _pathParams;
 
@@ -189,8 +201,14 @@ class AsyncWebServerRequest {
     void _addParam(AsyncWebParameter*);
     void _addPathParam(const char *param);
 
-    bool _parseReqHead();
-    bool _parseReqHeader();
+    bool _reserveHead(size_t size);
+    const char *_pair(size_t start, size_t index) const;
+    bool _findPair(size_t start, size_t count, const char *name, bool ignoreCase, size_t *index) const;
+    AsyncWebHeader *_headerObject(size_t index) const;
+    AsyncWebParameter *_queryObject(size_t index) const;
+
+    bool _parseReqHead(char *line);
+    bool _parseReqHeader(char *line);
     void _parseLine();
     void _parsePlainPostChar(uint8_t data);
     void _parseMultipartPostByte(uint8_t data, bool last);
@@ -323,6 +341,19 @@ class AsyncWebRewrite {
     virtual bool match(AsyncWebServerRequest *request) { return from() == request->url() && filter(request); }
 };
 
+/*
+ * ASSET :: A file of a bundle made at build time by extras/bundle_assets.py
+ * */
+
+typedef struct {
+  const char *path;         // "/css/style.css"
+  const char *hashedPath;   // "/css/style.1f0e3dad.css", changes with the content
+  const char *contentType;
+  const char *etag;         // strong, quoted
+  const uint8_t *data;      // gzipped, in PROGMEM
+  size_t length;
+} AsyncWebAsset;
+
 /*
  * HANDLER :: One instance can be attached to any Request (done by the Server)
  * */
@@ -426,6 +457,8 @@ class AsyncWebServer {
     AsyncCallbackWebHandler& on(const char* uri, WebRequestMethodComposite method, ArRequestHandlerFunction onRequest, ArUploadHandlerFunction onUpload, ArBodyHandlerFunction onBody);
 
     AsyncStaticWebHandler& serveStatic(const char* uri, fs::FS& fs, const char* path, const char* cache_control = NULL);
+    AsyncAssetWebHandler& serveAssets(const char* uri, const AsyncWebAsset* assets, size_t count); //assets sorted by path
+    template<size_t N> AsyncAssetWebHandler& serveAssets(const char* uri, const AsyncWebAsset (&assets)[N]){ return serveAssets(uri, assets, N); }
 
     void onNotFound(ArRequestHandlerFunction fn);  //called when handler is not assigned
     void onFileUpload(ArUploadHandlerFunction fn); //handle file uploads
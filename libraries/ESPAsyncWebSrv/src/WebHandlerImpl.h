@@ -63,6 +63,28 @@ class AsyncStaticWebHandler: public AsyncWebHandler {
     AsyncStaticWebHandler& setTemplateProcessor(AwsTemplateProcessor newCallback) {_callback = newCallback; return *this;}
 };
 
+// Serves a bundle of gzipped assets from flash (extras/bundle_assets.py): no file
+// system access, answers 304 when the browser has the same ETag. Hash named
+// paths are cached by the browser for a year, the others are revalidated.
+class AsyncAssetWebHandler: public AsyncWebHandler {
+  private:
+    const AsyncWebAsset* _find(const char* path, size_t len) const;
+    const AsyncWebAsset* _getAsset(AsyncWebServerRequest *request, bool *hashed) const;
+    bool _acceptsGzip(AsyncWebServerRequest *request) const;
+  protected:
+    String _uri;
+    const AsyncWebAsset* _assets;
+    size_t _count;
+    String _default_file;
+    String _cache_control;
+  public:
+    AsyncAssetWebHandler(const char* uri, const AsyncWebAsset* assets, size_t count);
+    virtual bool canHandle(AsyncWebServerRequest *request) override final;
+    virtual void handleRequest(AsyncWebServerRequest *request) override final;
+    AsyncAssetWebHandler& setDefaultFile(const char* filename);
+    AsyncAssetWebHandler& setCacheControl(const char* cache_control);
+};
+
 class AsyncCallbackWebHandler: public AsyncWebHandler {
   private:
   protected:
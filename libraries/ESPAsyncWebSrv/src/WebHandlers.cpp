@@ -218,3 +218,160 @@ void AsyncStaticWebHandler::handleRequest(AsyncWebServerRequest *request)
     request->send(404);
   }
 }
+
+AsyncAssetWebHandler::AsyncAssetWebHandler(const char* uri, const AsyncWebAsset* assets, size_t count)
+  : _uri(uri), _assets(assets), _count(count), _default_file("index.html"), _cache_control("no-cache")
+{
+  // Ensure leading '/' and remove the trailing one, root will be ""
+  if (_uri.length() == 0 || _uri[0] != '/') _uri = "/" + _uri;
+  if (_uri[_uri.length()-1] == '/') _uri = _uri.substring(0, _uri.length()-1);
+}
+
+AsyncAssetWebHandler& AsyncAssetWebHandler::setDefaultFile(const char* filename){
+  _default_file = String(filename);
+  return *this;
+}
+
+AsyncAssetWebHandler& AsyncAssetWebHandler::setCacheControl(const char* cache_control){
+  _cache_control = String(cache_control);
+  return *this;
+}
+
+// Binary search, the bundle is sorted by path
+const AsyncWebAsset* AsyncAssetWebHandler::_find(const char* path, size_t len) const {
+  size_t first = 0, last = _count;
+  while(first < last){
+    size_t middle = (first + last) / 2;
+    const char* name = _assets[middle].path;
+    int c = strncmp(name, path, len);
+    if(c == 0 && name[len])
+      c = 1;
+    if(c == 0)
+      return &_assets[middle];
+    if(c < 0)
+      first = middle + 1;
+    else
+      last = middle;
+  }
+  return NULL;
+}
+
+const AsyncWebAsset* AsyncAssetWebHandler::_getAsset(AsyncWebServerRequest *request, bool *hashed) const {
+  const String& url = request->url();
+  *hashed = false;
+  if(!url.startsWith(_uri))
+    return NULL;
+  const char* path = url.c_str() + _uri.length();
+  size_t len = url.length() - _uri.length();
+  if(len && path[0] != '/')
+    return NULL;
+
+  if(len == 0 || path[len-1] == '/'){
+    if(!_default_file.length())
+      return NULL;
+    String file = len ? String(path) : String("/");
+    file += _default_file;
+    return _find(file.c_str(), file.length());
+  }
+
+  const AsyncWebAsset* asset = _find(path, len);
+  if(asset)
+    return asset;
+
+  // "/css/style.1f0e3dad.css" is "/css/style.css" with its hash
+  const char* name = strrchr(path, '/');
+  const char* ext = strrchr(name, '.');
+  if(!ext || ext == name + 1)
+    return NULL;
+  const char* hash = ext - 1;
+  while(hash > name && *hash != '.')
+    hash--;
+  if(hash <= name + 1){ // no extension
+    hash = ext;
+    ext = path + len;
+  }
+  String file = url.substring(_uri.length(), _uri.length() + (hash - path));
+  file += ext;
+  asset = _find(file.c_str(), file.length());
+  if(!asset || strcmp(asset->hashedPath, path) != 0)
+    return NULL;
+  *hashed = true;
+  return asset;
+}
+
+// The assets are only stored gzipped: Accept-Encoding must list gzip (or "*") without q=0
+bool AsyncAssetWebHandler::_acceptsGzip(AsyncWebServerRequest *request) const {
+  AsyncWebHeader* accept = request->getHeader("Accept-Encoding");
+  if(!accept)
+    return false;
+  const char* p = accept->value().c_str();
+  while(*p){
+    while(*p == ' ' || *p == ',')
+      p++;
+    const char* coding = p;
+    while(*p && *p != ',' && *p != ';' && *p != ' ')
+      p++;
+    size_t len = p - coding;
+    bool gzip = (len == 4 && !strncasecmp(coding, "gzip", 4)) || (len == 6 && !strncasecmp(coding, "x-gzip", 6))
+      || (len == 1 && *coding == '*');
+    bool refused = false;
+    while(*p && *p != ','){
+      if((*p == 'q' || *p == 'Q') && p[1] == '='){
+        float q = atof(p + 2);
+        refused = q <= 0;
+      }
+      p++;
+    }
+    if(gzip && !refused)
+      return true;
+  }
+  return false;
+}
+
+bool AsyncAssetWebHandler::canHandle(AsyncWebServerRequest *request){
+  if(request->method() != HTTP_GET
+    || !request->isExpectedRequestedConnType(RCT_DEFAULT, RCT_HTTP)
+  ){
+    return false;
+  }
+  bool hashed;
+  if(!_getAsset(request, &hashed))
+    return false;
+  request->addInterestingHeader("If-None-Match");
+  request->addInterestingHeader("Accept-Encoding");
+  DEBUGF("[AsyncAssetWebHandler::canHandle] TRUE\n");
+  return true;
+}
+
+void AsyncAssetWebHandler::handleRequest(AsyncWebServerRequest *request)
+{
+  if((_username != "" && _password != "") && !request->authenticate(_username.c_str(), _password.c_str()))
+      return request->requestAuthentication();
+
+  bool hashed;
+  const AsyncWebAsset* asset = _getAsset(request, &hashed);
+  if(!asset){
+    request->send(404);
+    return;
+  }
+
+  // If-None-Match is "*" or a list of ETags, weak ones included
+  AsyncWebHeader* match = request->getHeader("If-None-Match");
+  AsyncWebServerResponse * response;
+  if(match && (match->value() == "*" || strstr(match->value().c_str(), asset->etag))){
+    response = new AsyncBasicResponse(304); // Not modified
+  } else if(!_acceptsGzip(request)){
+    response = new AsyncBasicResponse(406); // Not acceptable: no uncompressed copy
+  } else {
+    response = new AsyncProgmemResponse(200, asset->contentType, asset->data, asset->length);
+    response->addHeader("Content-Encoding", "gzip");
+  }
+  response->addHeader("ETag", asset->etag);
+  response->addHeader("Vary", "Accept-Encoding");
+  // The content behind a hash named path never changes
+  if(hashed)
+    response->addHeader("Cache-Control", "public, max-age=31536000, immutable");
+  else if(_cache_control.length())
+    response->addHeader("Cache-Control", _cache_control);
+  request->send(response);
+}
@@ -53,7 +53,15 @@ AsyncWebServerRequest::AsyncWebServerRequest(AsyncWebServer* s, AsyncClient* c)
   , _expectingContinue(false)
   , _contentLength(0)
   , _parsedLength(0)
-  , _headers(LinkedList<AsyncWebHeader *>([](AsyncWebHeader *h){ delete h; }))
+  , _head(NULL)
+  , _headSize(0)
+  , _headLength(0)
+  , _lineLength(0)
+  , _headerStart(0)
+  , _headerCount(0)
+  , _queryParams(0)
+  , _headerObjects(NULL)
+  , _queryObjects(NULL)
   , _params(LinkedList<AsyncWebParameter *>([](AsyncWebParameter *p){ delete p; }))
   , _pathParams(LinkedList<String *>([](String *p){ delete p; }))
   , _multiParseState(0)
@@ -78,7 +86,17 @@ AsyncWebServerRequest::AsyncWebServerRequest(AsyncWebServer* s, AsyncClient* c)
 }
 
 AsyncWebServerRequest::~AsyncWebServerRequest(){
-  _headers.free();
+  if(_headerObjects){
+    for(size_t i = 0; i < _headerCount; i++)
+      delete _headerObjects[i];
+    free(_headerObjects);
+  }
+  if(_queryObjects){
+    for(size_t i = 0; i < _queryParams; i++)
+      delete _queryObjects[i];
+    free(_queryObjects);
+  }
+  free(_head);
 
   _params.free();
   _pathParams.free();
@@ -110,16 +128,15 @@ void AsyncWebServerRequest::_onData(void *buf, size_t len){
         break;
       }
     }
-    if (i == len) { // No new line, just add the buffer in _temp
-      char ch = str[len-1];
-      str[len-1] = 0;
-      _temp.reserve(_temp.length()+len);
-      _temp.concat(str);
-      _temp.concat(ch);
-    } else { // Found new line - extract it and parse
-      str[i] = 0; // Terminate the string at the end of the line.
-      _temp.concat(str);
-      _temp.trim();
+    // Add the line to the head, where it is parsed. The first segment usually holds the whole head
+    if(!_reserveHead(_headLength + _lineLength + (_head ? i : len) + 1)){
+      _parseState = PARSE_REQ_FAIL;
+      _client->close();
+      break;
+    }
+    memcpy(_head + _headLength + _lineLength, str, i);
+    _lineLength += i;
+    if (i < len) { // Found new line - parse it
       _parseLine();
       if (++i < len) {
         // Still have more buffer to process
@@ -180,11 +197,33 @@ void AsyncWebServerRequest::_onData(void *buf, size_t len){
 
 void AsyncWebServerRequest::_removeNotInterestingHeaders(){
   if (_interestingHeaders.containsIgnoreCase("ANY")) return; // nothing to do
-  for(const auto& header: _headers){
-      if(!_interestingHeaders.containsIgnoreCase(header->name().c_str())){
-        _headers.remove(header);
+  // Move the interesting headers down in the head, over the others
+  char *from = _head + _headerStart;
+  char *to = from;
+  size_t kept = 0;
+  for(size_t i = 0; i < _headerCount; i++){
+    size_t length = strlen(from) + 1;
+    length += strlen(from + length) + 1;
+    bool interesting = false;
+    for(const auto& h: _interestingHeaders){
+      if(!strcasecmp(h.c_str(), from)){
+        interesting = true;
+        break;
       }
+    }
+    if(interesting){
+      memmove(to, from, length);
+      to += length;
+      if(_headerObjects)
+        _headerObjects[kept] = _headerObjects[i];
+      kept++;
+    } else if(_headerObjects){
+      delete _headerObjects[i];
+    }
+    from += length;
   }
+  _headerCount = kept;
+  _headLength = to - _head;
 }
 
 void AsyncWebServerRequest::_onPoll(){
@@ -251,103 +290,223 @@ void AsyncWebServerRequest::_addGetParams(const String& params){
   }
 }
 
-bool AsyncWebServerRequest::_parseReqHead(){
-  // Split the head into method, url and version
-  int index = _temp.indexOf(' ');
-  String m = _temp.substring(0, index);
-  index = _temp.indexOf(' ', index+1);
-  String u = _temp.substring(m.length()+1, index);
-  _temp = _temp.substring(index+1);
+// Grows the head to hold at least size bytes
+bool AsyncWebServerRequest::_reserveHead(size_t size){
+  if(size <= _headSize)
+    return true;
+  size_t headSize = _headSize + _headSize / 2;
+  if(headSize < size)
+    headSize = size;
+  char *head = (char*)realloc(_head, headSize);
+  if(head == NULL)
+    return false;
+  _head = head;
+  _headSize = headSize;
+  return true;
+}
+
+// The pair index pairs after the one at offset start of the head
+const char * AsyncWebServerRequest::_pair(size_t start, size_t index) const {
+  const char *p = _head + start;
+  while(index--){
+    p += strlen(p) + 1;
+    p += strlen(p) + 1;
+  }
+  return p;
+}
+
+bool AsyncWebServerRequest::_findPair(size_t start, size_t count, const char *name, bool ignoreCase, size_t *index) const {
+  const char *p = _head + start;
+  for(size_t i = 0; i < count; i++){
+    if(!(ignoreCase ? strcasecmp(p, name) : strcmp(p, name))){
+      *index = i;
+      return true;
+    }
+    p += strlen(p) + 1;
+    p += strlen(p) + 1;
+  }
+  return false;
+}
+
+AsyncWebHeader* AsyncWebServerRequest::_headerObject(size_t index) const {
+  if(index >= _headerCount)
+    return nullptr;
+  if(_headerObjects == NULL){
+    _headerObjects = (AsyncWebHeader **)calloc(_headerCount, sizeof(AsyncWebHeader *));
+    if(_headerObjects == NULL)
+      return nullptr;
+  }
+  if(_headerObjects[index] == NULL){
+    const char *name = _pair(_headerStart, index);
+    _headerObjects[index] = new AsyncWebHeader(name, name + strlen(name) + 1);
+  }
+  return _headerObjects[index];
+}
+
+AsyncWebParameter* AsyncWebServerRequest::_queryObject(size_t index) const {
+  if(index >= _queryParams)
+    return nullptr;
+  if(_queryObjects == NULL){
+    _queryObjects = (AsyncWebParameter **)calloc(_queryParams, sizeof(AsyncWebParameter *));
+    if(_queryObjects == NULL)
+      return nullptr;
+  }
+  if(_queryObjects[index] == NULL){
+    const char *name = _pair(0, index);
+    _queryObjects[index] = new AsyncWebParameter(name, name + strlen(name) + 1);
+  }
+  return _queryObjects[index];
+}
+
+// urlDecode() from text to out, which may be text itself. A decoded NUL is dropped
+static size_t urlDecodeTo(char *out, const char *text, size_t len){
+  char temp[] = "0x00";
+  size_t i = 0, n = 0;
+  while (i < len){
+    char decodedChar;
+    char encodedChar = text[i++];
+    if ((encodedChar == '%') && (i + 1 < len)){
+      temp[2] = text[i++];
+      temp[3] = text[i++];
+      decodedChar = strtol(temp, NULL, 16);
+    } else if (encodedChar == '+') {
+      decodedChar = ' ';
+    } else {
+      decodedChar = encodedChar;  // normal ascii char
+    }
+    if (decodedChar)
+      out[n++] = decodedChar;
+  }
+  return n;
+}
 
-  if(m == "GET"){
+bool AsyncWebServerRequest::_parseReqHead(char *line){
+  // Split the head into method, url and version
+  char *u = strchr(line, ' ');
+  if(u) *u++ = 0;
+  else u = line + strlen(line);
+  char *v = strchr(u, ' ');
+  if(v) *v++ = 0;
+  else v = u + strlen(u);
+
+  if(!strcmp(line, "GET")){
     _method = HTTP_GET;
-  } else if(m == "POST"){
+  } else if(!strcmp(line, "POST")){
     _method = HTTP_POST;
-  } else if(m == "DELETE"){
+  } else if(!strcmp(line, "DELETE")){
     _method = HTTP_DELETE;
-  } else if(m == "PUT"){
+  } else if(!strcmp(line, "PUT")){
     _method = HTTP_PUT;
-  } else if(m == "PATCH"){
+  } else if(!strcmp(line, "PATCH")){
     _method = HTTP_PATCH;
-  } else if(m == "HEAD"){
+  } else if(!strcmp(line, "HEAD")){
     _method = HTTP_HEAD;
-  } else if(m == "OPTIONS"){
+  } else if(!strcmp(line, "OPTIONS")){
     _method = HTTP_OPTIONS;
   }
 
-  String g = String();
-  index = u.indexOf('?');
-  if(index > 0){
-    g = u.substring(index +1);
-    u = u.substring(0, index);
-  }
-  _url = urlDecode(u);
-  _addGetParams(g);
-
-  if(!_temp.startsWith("HTTP/1.0"))
+  if(strncmp(v, "HTTP/1.0", 8))
     _version = 1;
 
-  _temp = String();
+  char *g = strchr(u, '?');
+  if(g && g > u) *g++ = 0;
+  else g = NULL;
+  u[urlDecodeTo(u, u, strlen(u))] = 0;
+  _url = u;
+
+  // Decode the query parameters after the line, then move them to the start of the head
+  if(g){
+    size_t query = g - _head;
+    size_t len = strlen(g);
+    size_t pairs = 1;
+    for(size_t i = 0; i < len; i++){
+      if(g[i] == '&') pairs++;
+    }
+    size_t out = query + len + 1;
+    if(!_reserveHead(out + len + 2 * pairs))
+      return false;
+    const char *params = _head + query;
+    char *p = _head + out;
+    size_t start = 0;
+    while (start < len){
+      const char *end = (const char*)memchr(params + start, '&', len - start);
+      size_t e = end ? end - params : len;
+      const char *equal = (const char*)memchr(params + start, '=', e - start);
+      size_t eq = equal ? equal - params : e;
+      p += urlDecodeTo(p, params + start, eq - start);
+      *p++ = 0;
+      if(eq + 1 < e)
+        p += urlDecodeTo(p, params + eq + 1, e - eq - 1);
+      *p++ = 0;
+      _queryParams++;
+      start = e + 1;
+    }
+    memmove(_head + _headLength, _head + out, p - (_head + out));
+    _headLength += p - (_head + out);
+  }
+  _headerStart = _headLength;
   return true;
 }
 
-bool strContains(String src, String find, bool mindcase = true) {
-  int pos=0, i=0;
-  const int slen = src.length();
-  const int flen = find.length();
-
-  if (slen < flen) return false;
-  while (pos <= (slen - flen)) {
-    for (i=0; i < flen; i++) {
-      if (mindcase) {
-        if (src[pos+i] != find[i]) i = flen + 1; // no match
-      } else if (tolower(src[pos+i]) != tolower(find[i])) i = flen + 1; // no match
-    }
-    if (i == flen) return true;
-    pos++;
+static bool strContains(const char *src, const char *find, bool mindcase = true) {
+  size_t flen = strlen(find);
+  for (; *src; src++) {
+    if (!(mindcase ? strncmp(src, find, flen) : strncasecmp(src, find, flen))) return true;
   }
   return false;
 }
 
-bool AsyncWebServerRequest::_parseReqHeader(){
-  int index = _temp.indexOf(':');
-  if(index){
-    String name = _temp.substring(0, index);
-    String value = _temp.substring(index + 2);
-    if(name.equalsIgnoreCase("Host")){
-      _host = value;
-    } else if(name.equalsIgnoreCase("Content-Type")){
-	  _contentType = value.substring(0, value.indexOf(';'));
-      if (value.startsWith("multipart/")){
-        _boundary = value.substring(value.indexOf('=')+1);
-        _boundary.replace("\"","");
-        _isMultipart = true;
-      }
-    } else if(name.equalsIgnoreCase("Content-Length")){
-      _contentLength = atoi(value.c_str());
-    } else if(name.equalsIgnoreCase("Expect") && value == "100-continue"){
-      _expectingContinue = true;
-    } else if(name.equalsIgnoreCase("Authorization")){
-      if(value.length() > 5 && value.substring(0,5).equalsIgnoreCase("Basic")){
-        _authorization = value.substring(6);
-      } else if(value.length() > 6 && value.substring(0,6).equalsIgnoreCase("Digest")){
-        _isDigest = true;
-        _authorization = value.substring(7);
-      }
+bool AsyncWebServerRequest::_parseReqHeader(char *line){
+  char *value = strchr(line, ':');
+  if(value == NULL || value == line)
+    return true;
+  *value++ = 0;
+  while(*value == ' ' || *value == '\t')
+    value++;
+  const char *name = line;
+  if(!strcasecmp(name, "Host")){
+    _host = value;
+  } else if(!strcasecmp(name, "Content-Type")){
+    char *end = strchr(value, ';');
+    if(end) *end = 0;
+    _contentType = value;
+    if(end) *end = ';';
+    if (!strncmp(value, "multipart/", 10)){
+      const char *boundary = strchr(value, '=');
+      _boundary = boundary ? boundary + 1 : value;
+      _boundary.replace("\"","");
+      _isMultipart = true;
+    }
+  } else if(!strcasecmp(name, "Content-Length")){
+    _contentLength = atoi(value);
+  } else if(!strcasecmp(name, "Expect") && !strcmp(value, "100-continue")){
+    _expectingContinue = true;
+  } else if(!strcasecmp(name, "Authorization")){
+    size_t len = strlen(value);
+    if(len > 5 && !strncasecmp(value, "Basic", 5)){
+      _authorization = value + 6;
+    } else if(len > 6 && !strncasecmp(value, "Digest", 6)){
+      _isDigest = true;
+      _authorization = value + 7;
+    }
+  } else {
+    if(!strcasecmp(name, "Upgrade") && !strcasecmp(value, "websocket")){
+      // WebSocket request can be uniquely identified by header: [Upgrade: websocket]
+      _reqconntype = RCT_WS;
     } else {
-      if(name.equalsIgnoreCase("Upgrade") && value.equalsIgnoreCase("websocket")){
-        // WebSocket request can be uniquely identified by header: [Upgrade: websocket]
-        _reqconntype = RCT_WS;
-      } else {
-        if(name.equalsIgnoreCase("Accept") && strContains(value, "text/event-stream", false)){
-          // WebEvent request can be uniquely identified by header:  [Accept: text/event-stream]
-          _reqconntype = RCT_EVENT;
-        }
+      if(!strcasecmp(name, "Accept") && strContains(value, "text/event-stream", false)){
+        // WebEvent request can be uniquely identified by header:  [Accept: text/event-stream]
+        _reqconntype = RCT_EVENT;
       }
     }
-    _headers.add(new AsyncWebHeader(name, value));
   }
-  _temp = String();
+  // Keep it as "name\0value\0", over the line
+  size_t nameLen = strlen(name) + 1;
+  size_t valueLen = strlen(value) + 1;
+  memmove(_head + _headLength, name, nameLen);
+  memmove(_head + _headLength + nameLen, value, valueLen);
+  _headLength += nameLen + valueLen;
+  _headerCount++;
   return true;
 }
 
@@ -551,24 +710,41 @@ void AsyncWebServerRequest::_parseMultipartPostByte(uint8_t data, bool last){
   }
 }
 
+// Parses the line received at the end of the head, in place. It ends at a NUL, as it did in a String
 void AsyncWebServerRequest::_parseLine(){
+  char *line = _head + _headLength;
+  line[_lineLength] = 0;
+  _lineLength = 0;
+  size_t len = strlen(line);
+  while(len && isspace((uint8_t)line[len - 1]))
+    line[--len] = 0;
+  while(isspace((uint8_t)*line)){
+    line++;
+    len--;
+  }
+
   if(_parseState == PARSE_REQ_START){
-    if(!_temp.length()){
+    if(!len || !_parseReqHead(line)){
       _parseState = PARSE_REQ_FAIL;
       _client->close();
     } else {
-      _parseReqHead();
       _parseState = PARSE_REQ_HEADERS;
     }
     return;
   }
 
   if(_parseState == PARSE_REQ_HEADERS){
-    if(!_temp.length()){
+    if(!len){
       //end of headers
       _server->_rewriteRequest(this);
       _server->_attachHandler(this);
       _removeNotInterestingHeaders();
+      // The head is complete: give back the room it was received in
+      char *head = (char*)realloc(_head, _headLength + 1);
+      if(head != NULL){
+        _head = head;
+        _headSize = _headLength + 1;
+      }
       if(_expectingContinue){
         const char * response = "HTTP/1.1 100 Continue\r\n\r\n";
         _client->write(response, os_strlen(response));
@@ -581,21 +757,17 @@ void AsyncWebServerRequest::_parseLine(){
         if(_handler) _handler->handleRequest(this);
         else send(501);
       }
-    } else _parseReqHeader();
+    } else _parseReqHeader(line);
   }
 }
 
 size_t AsyncWebServerRequest::headers() const{
-  return _headers.length();
+  return _headerCount;
 }
 
 bool AsyncWebServerRequest::hasHeader(const String& name) const {
-  for(const auto& h: _headers){
-    if(h->name().equalsIgnoreCase(name)){
-      return true;
-    }
-  }
-  return false;
+  size_t i;
+  return _findPair(_headerStart, _headerCount, name.c_str(), true, &i);
 }
 
 bool AsyncWebServerRequest::hasHeader(const __FlashStringHelper * data) const {
@@ -619,11 +791,9 @@ bool AsyncWebServerRequest::hasHeader(const __FlashStringHelper * data) const {
 }
 
 AsyncWebHeader* AsyncWebServerRequest::getHeader(const String& name) const {
-  for(const auto& h: _headers){
-    if(h->name().equalsIgnoreCase(name)){
-      return h;
-    }
-  }
+  size_t i;
+  if(_findPair(_headerStart, _headerCount, name.c_str(), true, &i))
+    return _headerObject(i);
   return nullptr;
 }
 
@@ -642,15 +812,17 @@ AsyncWebHeader* AsyncWebServerRequest::getHeader(const __FlashStringHelper * dat
 }
 
 AsyncWebHeader* AsyncWebServerRequest::getHeader(size_t num) const {
-  auto header = _headers.nth(num);
-  return header ? *header : nullptr;
+  return _headerObject(num);
 }
 
 size_t AsyncWebServerRequest::params() const {
-  return _params.length();
+  return _queryParams + _params.length();
 }
 
 bool AsyncWebServerRequest::hasParam(const String& name, bool post, bool file) const {
+  size_t i;
+  if(!post && !file && _findPair(0, _queryParams, name.c_str(), false, &i))
+    return true;
   for(const auto& p: _params){
     if(p->name() == name && p->isPost() == post && p->isFile() == file){
       return true;
@@ -676,6 +848,9 @@ bool AsyncWebServerRequest::hasParam(const __FlashStringHelper * data, bool post
 }
 
 AsyncWebParameter* AsyncWebServerRequest::getParam(const String& name, bool post, bool file) const {
+  size_t i;
+  if(!post && !file && _findPair(0, _queryParams, name.c_str(), false, &i))
+    return _queryObject(i);
   for(const auto& p: _params){
     if(p->name() == name && p->isPost() == post && p->isFile() == file){
       return p;
@@ -699,7 +874,9 @@ AsyncWebParameter* AsyncWebServerRequest::getParam(const __FlashStringHelper * d
 }
 
 AsyncWebParameter* AsyncWebServerRequest::getParam(size_t num) const {
-  auto param = _params.nth(num);
+  if(num < _queryParams)
+    return _queryObject(num);
+  auto param = _params.nth(num - _queryParams);
   return param ? *param : nullptr;
 }
 
@@ -862,6 +1039,9 @@ void AsyncWebServerRequest::requestAuthentication(const char * realm, bool isDig
 }
 
 bool AsyncWebServerRequest::hasArg(const char* name) const {
+  size_t i;
+  if(_findPair(0, _queryParams, name, false, &i))
+    return true;
   for(const auto& arg: _params){
     if(arg->name() == name){
       return true;
@@ -886,6 +1066,11 @@ bool AsyncWebServerRequest::hasArg(const __FlashStringHelper * data) const {
 
 
 const String& AsyncWebServerRequest::arg(const String& name) const {
+  size_t i;
+  if(_findPair(0, _queryParams, name.c_str(), false, &i)){
+    AsyncWebParameter* p = _queryObject(i);
+    return p ? p->value() : SharedEmptyString;
+  }
   for(const auto& arg: _params){
     if(arg->name() == name){
       return arg->value();
@@ -923,7 +1108,8 @@ const String& AsyncWebServerRequest::pathArg(size_t i) const {
 }
 
 const String& AsyncWebServerRequest::header(const char* name) const {
-  AsyncWebHeader* h = getHeader(String(name));
+  size_t i;
+  AsyncWebHeader* h = _findPair(_headerStart, _headerCount, name, true, &i) ? _headerObject(i) : nullptr;
   return h ? h->value() : SharedEmptyString;
 }
 
@@ -168,6 +168,12 @@ AsyncStaticWebHandler& AsyncWebServer::serveStatic(const char* uri, fs::FS& fs,
   return *handler;
 }
 
+AsyncAssetWebHandler& AsyncWebServer::serveAssets(const char* uri, const AsyncWebAsset* assets, size_t count){
+  AsyncAssetWebHandler* handler = new AsyncAssetWebHandler(uri, assets, count);
+  addHandler(handler);
+  return *handler;
+}
+
 void AsyncWebServer::onNotFound(ArRequestHandlerFunction fn){
   _catchAllHandler->onRequest(fn);
 }
@@ -0,0 +1,57 @@
+/* Feed MPU6050_light readings to the IMUFusion filters and print
+ * their roll/pitch side by side with the library's own angles.
+ * Any driver works the same way: fill an IMUFusionSample with the
+ * accelerations and the rates in deg/s.
+ */
+
+#include "Wire.h"
+#include <MPU6050_light.h>
+#include <IMUFusion.h>
+
+MPU6050 mpu(Wire);
+IMUFusionComplementary<float> complementary(0.98f);
+IMUFusionKalman<float> kalman;
+IMUFusionMahony<float> mahony(1.0f, 0.05f);
+unsigned long last_us;
+unsigned long print_ms;
+
+IMUFusionSample<float> readSample() {
+  IMUFusionSample<float> s;
+  mpu.update();
+  s.ax = mpu.getAccX();  s.ay = mpu.getAccY();  s.az = mpu.getAccZ();
+  s.gx = mpu.getGyroX(); s.gy = mpu.getGyroY(); s.gz = mpu.getGyroZ();
+  return s;
+}
+
+void setup() {
+  Serial.begin(115200);
+  Wire.begin();
+  while (mpu.begin() != 0) { }
+  delay(1000);
+  mpu.calcOffsets();   // do not move the MPU6050
+
+  IMUFusionSample<float> s = readSample();
+  complementary.begin(s);
+  kalman.begin(s);
+  mahony.begin(s);
+  last_us = micros();
+}
+
+void loop() {
+  IMUFusionSample<float> s = readSample();
+  unsigned long now = micros();
+  float dt = (now - last_us) * 1e-6f;
+  last_us = now;
+
+  complementary.update(s, dt);
+  kalman.update(s, dt);
+  mahony.update(s, dt);
+
+  if (millis() - print_ms > 20) {
+    print_ms = millis();
+    Serial.print(mpu.getAngleX());      Serial.print('\t');
+    Serial.print(complementary.roll()); Serial.print('\t');
+    Serial.print(kalman.roll());        Serial.print('\t');
+    Serial.println(mahony.roll());
+  }
+}
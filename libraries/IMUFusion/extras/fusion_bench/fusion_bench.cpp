@@ -0,0 +1,215 @@
+// IMUFusion - host benchmark
+// Runs every filter over an IMU trace and reports the cost (host ns per update)
+// and the tilt error against the reference angles of the trace, then names the
+// cheapest filter within the error budget.
+//
+// Usage: fusion_bench [-f trace.csv] [-r rate_hz] [-t seconds] [-b budget_deg] [-s seed]
+//   -b  tilt error budget, max over roll and pitch (default 2)
+//   -f  recorded trace, CSV with a header line: t,ax,ay,az,gx,gy,gz,roll,pitch
+//       (seconds, any acceleration unit, deg/s, reference angles in degrees)
+//   Without -f a trace is synthesised: a wobbling and accelerating robot seen by
+//   an MPU6050 (quantisation, noise, gyro bias), sampled at -r Hz for -t seconds.
+// The first second is not scored (filter convergence).
+//
+// Changelog:
+//      2026-10-18 - initial release
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+#include "../../src/IMUFusion.h"
+
+#define SETTLE_SECONDS  1.0
+#define TIMING_NS       200000000ULL    // host time spent timing each filter
+
+struct TracePoint {
+    double t;
+    IMUFusionSample<double> s;
+    double roll, pitch;
+};
+
+static std::vector<TracePoint> trace;
+
+static uint64_t hostNs() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000000000ULL + t.tv_nsec;
+}
+
+static bool loadTrace(const char *name) {
+    FILE *f = fopen(name, "r");
+    char line[256];
+    if (!f) {
+        perror(name);
+        return false;
+    }
+    if (!fgets(line, sizeof(line), f)) {    // header
+        fclose(f);
+        return false;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        TracePoint p;
+        if (sscanf(line, "%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf", &p.t, &p.s.ax, &p.s.ay, &p.s.az,
+                   &p.s.gx, &p.s.gy, &p.s.gz, &p.roll, &p.pitch) == 9)
+            trace.push_back(p);
+    }
+    fclose(f);
+    return trace.size() > 1;
+}
+
+static double gaussian() {
+    double u = (rand() + 1.0) / (RAND_MAX + 2.0), v = (rand() + 1.0) / (RAND_MAX + 2.0);
+    return sqrt(-2 * log(u)) * cos(2 * M_PI * v);
+}
+
+// Angles as a balancing robot: a slow wobble plus fast corrections on roll (the
+// balance axis), gentler pitch, turning in yaw, and forward accelerations that the
+// accelerometer cannot tell from tilt.
+static void synthesise(double rate, double seconds, unsigned seed) {
+    const double accelLsb = 16384, gyroLsb = 65.5;     // +-2g, +-500deg/s
+    const double biasX = 1.2, biasY = -0.8, biasZ = 0.5;    // deg/s
+    double dt = 1 / rate;
+    srand(seed);
+    for (double t = 0; t < seconds; t += dt) {
+        double w1 = 2 * M_PI * 0.5, w2 = 2 * M_PI * 2.3, w3 = 2 * M_PI * 0.8, w4 = 2 * M_PI * 3.1;
+        double roll = 15 * sin(w1 * t) + 4 * sin(w2 * t);
+        double pitch = 8 * sin(w3 * t + 1) + 2 * sin(w4 * t);
+        double rollDot = 15 * w1 * cos(w1 * t) + 4 * w2 * cos(w2 * t);
+        double pitchDot = 8 * w3 * cos(w3 * t + 1) + 2 * w4 * cos(w4 * t);
+        double yawDot = 20;
+        double r = roll * IMUFUSION_DEG2RAD, p = pitch * IMUFUSION_DEG2RAD;
+        double linear = 0.15 * sin(2 * M_PI * 1.7 * t);     // g, along body Y (driving direction)
+
+        TracePoint tp;
+        tp.t = t;
+        tp.roll = roll;
+        tp.pitch = pitch;
+        // Body rates from the Euler rates (ZYX)
+        tp.s.gx = rollDot - yawDot * sin(p) + biasX + 0.05 * gaussian();
+        tp.s.gy = pitchDot * cos(r) + yawDot * sin(r) * cos(p) + biasY + 0.05 * gaussian();
+        tp.s.gz = -pitchDot * sin(r) + yawDot * cos(r) * cos(p) + biasZ + 0.05 * gaussian();
+        // Gravity in the body frame, in g
+        tp.s.ax = -sin(p) + 0.004 * gaussian();
+        tp.s.ay = cos(p) * sin(r) + linear + 0.004 * gaussian();
+        tp.s.az = cos(p) * cos(r) + 0.004 * gaussian();
+        // Sensor quantisation
+        tp.s.ax = round(tp.s.ax * accelLsb) / accelLsb;
+        tp.s.ay = round(tp.s.ay * accelLsb) / accelLsb;
+        tp.s.az = round(tp.s.az * accelLsb) / accelLsb;
+        tp.s.gx = round(tp.s.gx * gyroLsb) / gyroLsb;
+        tp.s.gy = round(tp.s.gy * gyroLsb) / gyroLsb;
+        tp.s.gz = round(tp.s.gz * gyroLsb) / gyroLsb;
+        trace.push_back(tp);
+    }
+}
+
+struct Result {
+    const char *name;
+    double ns;
+    double rms, max;        // deg, worst of roll and pitch
+};
+
+template <typename T>
+static IMUFusionSample<T> sampleOf(const TracePoint &p) {
+    IMUFusionSample<T> s = { T(p.s.ax), T(p.s.ay), T(p.s.az), T(p.s.gx), T(p.s.gy), T(p.s.gz) };
+    return s;
+}
+
+template <typename T, typename Filter>
+static Result run(const char *name, Filter filter) {
+    Result r = { name, 0, 0, 0 };
+    size_t n = trace.size();
+    std::vector<IMUFusionSample<T> > samples(n);
+    std::vector<T> dts(n);
+    for (size_t i = 0; i < n; i++) {
+        samples[i] = sampleOf<T>(trace[i]);
+        dts[i] = T(i > 0 ? trace[i].t - trace[i - 1].t : trace[1].t - trace[0].t);
+    }
+
+    // Accuracy
+    Filter f = filter;
+    double sumRoll = 0, sumPitch = 0;
+    long scored = 0;
+    f.begin(samples[0]);
+    for (size_t i = 1; i < n; i++) {
+        f.update(samples[i], dts[i]);
+        if (trace[i].t - trace[0].t < SETTLE_SECONDS) continue;
+        double er = (double)f.roll() - trace[i].roll, ep = (double)f.pitch() - trace[i].pitch;
+        sumRoll += er * er;
+        sumPitch += ep * ep;
+        if (fabs(er) > r.max) r.max = fabs(er);
+        if (fabs(ep) > r.max) r.max = fabs(ep);
+        scored++;
+    }
+    if (scored) r.rms = sqrt((sumRoll > sumPitch ? sumRoll : sumPitch) / scored);
+
+    // Cost: whole passes over the trace until TIMING_NS of host time
+    volatile double sink = 0;
+    uint64_t updates = 0, start = hostNs(), elapsed;
+    do {
+        f = filter;
+        f.begin(samples[0]);
+        for (size_t i = 1; i < n; i++) f.update(samples[i], dts[i]);
+        sink = sink + (double)f.roll();
+        updates += n - 1;
+        elapsed = hostNs() - start;
+    } while (elapsed < TIMING_NS);
+    r.ns = (double)elapsed / updates;
+    return r;
+}
+
+int main(int argc, char **argv) {
+    const char *file = NULL;
+    double rate = 200, seconds = 60, budget = 2.0;
+    unsigned seed = 1;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "f:r:t:b:s:")) != -1) {
+        switch (opt) {
+            case 'f': file = optarg; break;
+            case 'r': rate = atof(optarg); break;
+            case 't': seconds = atof(optarg); break;
+            case 'b': budget = atof(optarg); break;
+            case 's': seed = strtoul(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "usage: fusion_bench [-f trace.csv] [-r rate_hz] [-t seconds] [-b budget_deg] [-s seed]\n");
+                return 2;
+        }
+    }
+    if (file ? !loadTrace(file) : (rate <= 0 || seconds <= SETTLE_SECONDS)) {
+        fprintf(stderr, "fusion_bench: no usable trace\n");
+        return 2;
+    }
+    if (!file) synthesise(rate, seconds, seed);
+
+    Result results[] = {
+        run<float>("complementary float", IMUFusionComplementary<float>(0.98f)),
+        run<double>("complementary double", IMUFusionComplementary<double>(0.98)),
+        run<float>("kalman float", IMUFusionKalman<float>()),
+        run<double>("kalman double", IMUFusionKalman<double>()),
+        run<float>("mahony float", IMUFusionMahony<float>(1.0f, 0.05f)),
+        run<double>("mahony double", IMUFusionMahony<double>(1.0, 0.05)),
+        run<float>("madgwick float", IMUFusionMadgwick<float>(0.1f)),
+        run<double>("madgwick double", IMUFusionMadgwick<double>(0.1)),
+    };
+    int count = sizeof(results) / sizeof(results[0]);
+    const Result *best = NULL;
+
+    printf("trace           %s, %zu samples, %.1f s\n", file ? file : "synthetic", trace.size(), trace.back().t - trace.front().t);
+    printf("%-22s %10s %12s %12s\n", "filter", "ns/update", "rms deg", "max deg");
+    for (int i = 0; i < count; i++) {
+        const Result &r = results[i];
+        printf("%-22s %10.1f %12.3f %12.3f\n", r.name, r.ns, r.rms, r.max);
+        if (r.max <= budget && (best == NULL || r.ns < best->ns)) best = &r;
+    }
+    if (best)
+        printf("cheapest within %.2f deg max error: %s\n", budget, best->name);
+    else
+        printf("no filter within %.2f deg max error\n", budget);
+    return 0;
+}
@@ -0,0 +1,296 @@
+// IMUFusion - attitude filters for 6-axis IMUs (MPU6050 and friends)
+// Header only. Every filter takes the same IMUFusionSample, so any driver can feed
+// any filter, and is templated on the scalar type.
+//
+// Units: accelerations in any consistent unit (g, m/s^2 or raw LSB), angular
+// rates in deg/s, angles in degrees, dt in seconds.
+// Axes: roll about X (atan2(ay, az)), pitch about Y (atan2(-ax, sqrt(ay^2 + az^2))).
+//
+// Filters, from the cheapest:
+//   IMUFusionComplementary  gyro integration pulled towards the accelerometer angle
+//   IMUFusionKalman         1-D Kalman filter per axis, angle and gyro bias states
+//   IMUFusionMahony         quaternion, PI correction of the gyro by the accelerometer
+//   IMUFusionMadgwick       quaternion, gradient descent correction
+//
+// T is float or double. Another type (fixed point) works when it has T(double),
+// + - * / and comparisons, and overloads of imuFusionSqrt/Atan2/Asin.
+//
+// Changelog:
+//      2026-10-18 - initial release
+
+#ifndef _IMUFUSION_H_
+#define _IMUFUSION_H_
+
+#include <math.h>
+
+#define IMUFUSION_DEG2RAD 0.017453292519943295
+#define IMUFUSION_RAD2DEG 57.29577951308232
+
+inline float imuFusionSqrt(float x) { return sqrtf(x); }
+inline double imuFusionSqrt(double x) { return sqrt(x); }
+inline float imuFusionAtan2(float y, float x) { return atan2f(y, x); }
+inline double imuFusionAtan2(double y, double x) { return atan2(y, x); }
+inline float imuFusionAsin(float x) { return asinf(x < -1 ? -1 : (x > 1 ? 1 : x)); }
+inline double imuFusionAsin(double x) { return asin(x < -1 ? -1 : (x > 1 ? 1 : x)); }
+
+template <typename T>
+struct IMUFusionSample {
+    T ax, ay, az;       // acceleration, any unit
+    T gx, gy, gz;       // angular rate, deg/s
+};
+
+// Tilt from the accelerometer alone, degrees
+template <typename T>
+inline T imuFusionAccelRoll(const IMUFusionSample<T> &s) {
+    return imuFusionAtan2(s.ay, s.az) * T(IMUFUSION_RAD2DEG);
+}
+
+template <typename T>
+inline T imuFusionAccelPitch(const IMUFusionSample<T> &s) {
+    return imuFusionAtan2(-s.ax, imuFusionSqrt(s.ay * s.ay + s.az * s.az)) * T(IMUFUSION_RAD2DEG);
+}
+
+/** Complementary filter.
+ * angle = gyroCoef * (angle + rate * dt) + (1 - gyroCoef) * accelAngle
+ * The time constant is about dt * gyroCoef / (1 - gyroCoef): 0.98 at 100Hz is 0.5s.
+ * No yaw (yaw() integrates the gyro).
+ */
+template <typename T>
+class IMUFusionComplementary {
+    public:
+        IMUFusionComplementary(T gyroCoef = T(0.98)) { setGyroCoef(gyroCoef); rollAngle = pitchAngle = yawAngle = T(0.0); }
+
+        void setGyroCoef(T gyroCoef) { gyro = gyroCoef; accel = T(1.0) - gyroCoef; }
+
+        void begin(const IMUFusionSample<T> &s) {
+            rollAngle = imuFusionAccelRoll(s);
+            pitchAngle = imuFusionAccelPitch(s);
+            yawAngle = T(0.0);
+        }
+
+        void update(const IMUFusionSample<T> &s, T dt) {
+            rollAngle = gyro * (rollAngle + s.gx * dt) + accel * imuFusionAccelRoll(s);
+            pitchAngle = gyro * (pitchAngle + s.gy * dt) + accel * imuFusionAccelPitch(s);
+            yawAngle = yawAngle + s.gz * dt;
+        }
+
+        T roll() const { return rollAngle; }
+        T pitch() const { return pitchAngle; }
+        T yaw() const { return yawAngle; }
+
+    private:
+        T gyro, accel;
+        T rollAngle, pitchAngle, yawAngle;
+};
+
+/** Kalman filter on one axis: states angle and gyro bias, measurement the accelerometer angle.
+ * Defaults are the usual ones for the MPU6050 at 100-1000Hz.
+ */
+template <typename T>
+class IMUFusionKalman1D {
+    public:
+        IMUFusionKalman1D(T qAngle = T(0.001), T qBias = T(0.003), T rMeasure = T(0.03))
+            : qAngle(qAngle), qBias(qBias), rMeasure(rMeasure) { begin(T(0.0)); }
+
+        void begin(T angle0) {
+            angle = angle0;
+            bias = T(0.0);
+            p00 = p01 = p10 = p11 = T(0.0);
+        }
+
+        // rate in deg/s, measured angle in degrees. Returns the new angle
+        T update(T measured, T rate, T dt) {
+            // Predict
+            angle = angle + dt * (rate - bias);
+            p00 = p00 + dt * (dt * p11 - p01 - p10 + qAngle);
+            p01 = p01 - dt * p11;
+            p10 = p10 - dt * p11;
+            p11 = p11 + qBias * dt;
+
+            // Correct
+            T s = p00 + rMeasure;
+            T k0 = p00 / s;
+            T k1 = p10 / s;
+            T y = measured - angle;
+            angle = angle + k0 * y;
+            bias = bias + k1 * y;
+            T p00_ = p00, p01_ = p01;
+            p00 = p00 - k0 * p00_;
+            p01 = p01 - k0 * p01_;
+            p10 = p10 - k1 * p00_;
+            p11 = p11 - k1 * p01_;
+            return angle;
+        }
+
+        T getAngle() const { return angle; }
+        T getBias() const { return bias; }
+
+    private:
+        T qAngle, qBias, rMeasure;
+        T angle, bias;
+        T p00, p01, p10, p11;
+};
+
+/** Roll and pitch Kalman filters, same interface as the other filters. No yaw (yaw() integrates the gyro). */
+template <typename T>
+class IMUFusionKalman {
+    public:
+        IMUFusionKalman(T qAngle = T(0.001), T qBias = T(0.003), T rMeasure = T(0.03))
+            : rollFilter(qAngle, qBias, rMeasure), pitchFilter(qAngle, qBias, rMeasure) { yawAngle = T(0.0); }
+
+        void begin(const IMUFusionSample<T> &s) {
+            rollFilter.begin(imuFusionAccelRoll(s));
+            pitchFilter.begin(imuFusionAccelPitch(s));
+            yawAngle = T(0.0);
+        }
+
+        void update(const IMUFusionSample<T> &s, T dt) {
+            rollFilter.update(imuFusionAccelRoll(s), s.gx, dt);
+            pitchFilter.update(imuFusionAccelPitch(s), s.gy, dt);
+            yawAngle = yawAngle + s.gz * dt;
+        }
+
+        T roll() const { return rollFilter.getAngle(); }
+        T pitch() const { return pitchFilter.getAngle(); }
+        T yaw() const { return yawAngle; }
+
+    private:
+        IMUFusionKalman1D<T> rollFilter, pitchFilter;
+        T yawAngle;
+};
+
+/** Orientation as a quaternion, shared by Mahony and Madgwick. */
+template <typename T>
+class IMUFusionQuaternion {
+    public:
+        IMUFusionQuaternion() { q0 = T(1.0); q1 = q2 = q3 = T(0.0); }
+
+        // Start from the accelerometer tilt instead of level (no convergence transient)
+        void begin(const IMUFusionSample<T> &s) {
+            T r = imuFusionAccelRoll(s) * T(0.5 * IMUFUSION_DEG2RAD);
+            T p = imuFusionAccelPitch(s) * T(0.5 * IMUFUSION_DEG2RAD);
+            T cr = T(cos((double)r)), sr = T(sin((double)r));
+            T cp = T(cos((double)p)), sp = T(sin((double)p));
+            q0 = cr * cp;
+            q1 = sr * cp;
+            q2 = cr * sp;
+            q3 = -sr * sp;
+        }
+
+        T roll() const { return imuFusionAtan2(q0 * q1 + q2 * q3, T(0.5) - q1 * q1 - q2 * q2) * T(IMUFUSION_RAD2DEG); }
+        T pitch() const { return imuFusionAsin(T(2.0) * (q0 * q2 - q3 * q1)) * T(IMUFUSION_RAD2DEG); }
+        T yaw() const { return imuFusionAtan2(q1 * q2 + q0 * q3, T(0.5) - q2 * q2 - q3 * q3) * T(IMUFUSION_RAD2DEG); }
+
+        T q0, q1, q2, q3;
+
+    protected:
+        // q += qDot * dt, then normalise
+        void integrate(T qDot0, T qDot1, T qDot2, T qDot3, T dt) {
+            q0 = q0 + qDot0 * dt;
+            q1 = q1 + qDot1 * dt;
+            q2 = q2 + qDot2 * dt;
+            q3 = q3 + qDot3 * dt;
+            T n = T(1.0) / imuFusionSqrt(q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3);
+            q0 = q0 * n;
+            q1 = q1 * n;
+            q2 = q2 * n;
+            q3 = q3 * n;
+        }
+};
+
+/** Mahony filter: the error between the measured and the estimated gravity
+ * drives a PI correction of the gyro rates (the I part tracks the gyro bias).
+ */
+template <typename T>
+class IMUFusionMahony : public IMUFusionQuaternion<T> {
+    public:
+        IMUFusionMahony(T kp = T(1.0), T ki = T(0.0)) : kp(kp), ki(ki) { ix = iy = iz = T(0.0); }
+
+        void update(const IMUFusionSample<T> &s, T dt) {
+            T gx = s.gx * T(IMUFUSION_DEG2RAD), gy = s.gy * T(IMUFUSION_DEG2RAD), gz = s.gz * T(IMUFUSION_DEG2RAD);
+            T &q0 = this->q0, &q1 = this->q1, &q2 = this->q2, &q3 = this->q3;
+            T norm = s.ax * s.ax + s.ay * s.ay + s.az * s.az;
+
+            if (norm > T(0.0)) {    // no correction in free fall
+                T n = T(1.0) / imuFusionSqrt(norm);
+                T ax = s.ax * n, ay = s.ay * n, az = s.az * n;
+                // Estimated gravity direction
+                T vx = q1 * q3 - q0 * q2;
+                T vy = q0 * q1 + q2 * q3;
+                T vz = q0 * q0 - T(0.5) + q3 * q3;
+                // Error: cross product of measured and estimated gravity
+                T ex = ay * vz - az * vy;
+                T ey = az * vx - ax * vz;
+                T ez = ax * vy - ay * vx;
+                if (ki > T(0.0)) {
+                    ix = ix + T(2.0) * ki * ex * dt;
+                    iy = iy + T(2.0) * ki * ey * dt;
+                    iz = iz + T(2.0) * ki * ez * dt;
+                    gx = gx + ix;
+                    gy = gy + iy;
+                    gz = gz + iz;
+                }
+                gx = gx + T(2.0) * kp * ex;
+                gy = gy + T(2.0) * kp * ey;
+                gz = gz + T(2.0) * kp * ez;
+            }
+
+            T h = T(0.5);
+            this->integrate(h * (-q1 * gx - q2 * gy - q3 * gz), h * (q0 * gx + q2 * gz - q3 * gy),
+                            h * (q0 * gy - q1 * gz + q3 * gx), h * (q0 * gz + q1 * gy - q2 * gx), dt);
+        }
+
+    private:
+        T kp, ki;
+        T ix, iy, iz;
+};
+
+/** Madgwick filter: gradient descent step towards the orientation that
+ * explains the measured gravity, weighted by beta (rad/s).
+ */
+template <typename T>
+class IMUFusionMadgwick : public IMUFusionQuaternion<T> {
+    public:
+        IMUFusionMadgwick(T beta = T(0.1)) : beta(beta) {}
+
+        void setBeta(T b) { beta = b; }
+
+        void update(const IMUFusionSample<T> &s, T dt) {
+            T gx = s.gx * T(IMUFUSION_DEG2RAD), gy = s.gy * T(IMUFUSION_DEG2RAD), gz = s.gz * T(IMUFUSION_DEG2RAD);
+            T &q0 = this->q0, &q1 = this->q1, &q2 = this->q2, &q3 = this->q3;
+            T h = T(0.5);
+            T qDot0 = h * (-q1 * gx - q2 * gy - q3 * gz);
+            T qDot1 = h * (q0 * gx + q2 * gz - q3 * gy);
+            T qDot2 = h * (q0 * gy - q1 * gz + q3 * gx);
+            T qDot3 = h * (q0 * gz + q1 * gy - q2 * gx);
+            T norm = s.ax * s.ax + s.ay * s.ay + s.az * s.az;
+
+            if (norm > T(0.0)) {    // no correction in free fall
+                T n = T(1.0) / imuFusionSqrt(norm);
+                T ax = s.ax * n, ay = s.ay * n, az = s.az * n;
+                T _2q0 = T(2.0) * q0, _2q1 = T(2.0) * q1, _2q2 = T(2.0) * q2, _2q3 = T(2.0) * q3;
+                T _4q0 = T(4.0) * q0, _4q1 = T(4.0) * q1, _4q2 = T(4.0) * q2;
+                T _8q1 = T(8.0) * q1, _8q2 = T(8.0) * q2;
+                T q0q0 = q0 * q0, q1q1 = q1 * q1, q2q2 = q2 * q2, q3q3 = q3 * q3;
+                // Gradient of the gravity error
+                T s0 = _4q0 * q2q2 + _2q2 * ax + _4q0 * q1q1 - _2q1 * ay;
+                T s1 = _4q1 * q3q3 - _2q3 * ax + T(4.0) * q0q0 * q1 - _2q0 * ay - _4q1 + _8q1 * q1q1 + _8q1 * q2q2 + _4q1 * az;
+                T s2 = T(4.0) * q0q0 * q2 + _2q0 * ax + _4q2 * q3q3 - _2q3 * ay - _4q2 + _8q2 * q1q1 + _8q2 * q2q2 + _4q2 * az;
+                T s3 = T(4.0) * q1q1 * q3 - _2q1 * ax + T(4.0) * q2q2 * q3 - _2q2 * ay;
+                T sn = s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3;
+                if (sn > T(0.0)) {
+                    sn = beta / imuFusionSqrt(sn);
+                    qDot0 = qDot0 - sn * s0;
+                    qDot1 = qDot1 - sn * s1;
+                    qDot2 = qDot2 - sn * s2;
+                    qDot3 = qDot3 - sn * s3;
+                }
+            }
+            this->integrate(qDot0, qDot1, qDot2, qDot3, dt);
+        }
+
+    private:
+        T beta;
+};
+
+#endif /* _IMUFUSION_H_ */
@@ -0,0 +1,66 @@
+//We always have to include the library
+#include "LedControl.h"
+
+/*
+ Now we need a LedControl to work with.
+ ***** These pin numbers will probably not work with your hardware *****
+ pin 12 is connected to the DataIn 
+ pin 11 is connected to the CLK 
+ pin 10 is connected to LOAD 
+ ***** Please set the number of devices you have *****
+ The matrices are side by side, device 0 on the left.
+ */
+LedControl lc=LedControl(12,11,10,8);
+
+/* With the hardware SPI of the board (DataIn on MOSI, CLK on SCK) use
+LedControl lc=LedControl(10,8);
+ */
+
+/* we wait a bit between the steps of the scrolling */
+unsigned long delaytime=30;
+
+/* an arrow, one byte per column, the top row in bit 7 */
+const byte arrow[8]={
+  B00011000,B00011000,B00011000,B00011000,B11111111,B01111110,B00111100,B00011000
+};
+
+/* the column of the arrow entering on the right */
+int column=0;
+
+void setup() {
+  int devices=lc.getDeviceCount();
+  for(int address=0;address<devices;address++) {
+    /*The MAX72XX is in power-saving mode on startup*/
+    lc.shutdown(address,false);
+    /* Set the brightness to a medium values */
+    lc.setIntensity(address,8);
+    /* and clear the display */
+    lc.clearDisplay(address);
+  }
+  /* 
+   From now on the changes only go to the buffer, and commit() sends
+   the rows that changed, one transfer per row for the whole chain.
+   */
+  lc.setBuffered(true);
+}
+
+void loop() { 
+  int devices=lc.getDeviceCount();
+  byte *buffer=lc.getBuffer();
+  byte next=(column<8) ? arrow[column] : 0;
+
+  //shift every row one led to the left, across the devices
+  for(int row=0;row<8;row++) {
+    for(int address=0;address<devices;address++) {
+      byte carry;
+      if(address<devices-1)
+        carry=buffer[(address+1)*8+row] >> 7;
+      else
+        carry=(next >> (7-row)) & 1;
+      buffer[address*8+row]=(buffer[address*8+row] << 1) | carry;
+    }
+  }
+  column=(column+1)%16;
+  lc.commit();
+  delay(delaytime);
+}
@@ -47,16 +47,30 @@ LedControl::LedControl(int dataPin, int clkPin, int csPin, int numDevices) {
     SPI_MOSI=dataPin;
     SPI_CLK=clkPin;
     SPI_CS=csPin;
+    pinMode(SPI_MOSI,OUTPUT);
+    pinMode(SPI_CLK,OUTPUT);
+    init(numDevices);
+}
+
+LedControl::LedControl(int csPin, int numDevices) {
+    SPI_MOSI=-1;
+    SPI_CLK=-1;
+    SPI_CS=csPin;
+    SPI.begin();
+    init(numDevices);
+}
+
+void LedControl::init(int numDevices) {
     if(numDevices<=0 || numDevices>8 )
         numDevices=8;
     maxDevices=numDevices;
-    pinMode(SPI_MOSI,OUTPUT);
-    pinMode(SPI_CLK,OUTPUT);
+    buffered=false;
     pinMode(SPI_CS,OUTPUT);
     digitalWrite(SPI_CS,HIGH);
-    SPI_MOSI=dataPin;
-    for(int i=0;i<64;i++) 
+    for(int i=0;i<64;i++) {
         status[i]=0x00;
+        shown[i]=0x00;
+    }
     for(int i=0;i<maxDevices;i++) {
         spiTransfer(i,OP_DISPLAYTEST,0);
         //scanlimit is set to max on startup
@@ -104,7 +118,7 @@ void LedControl::clearDisplay(int addr) {
     offset=addr*8;
     for(int i=0;i<8;i++) {
         status[offset+i]=0;
-        spiTransfer(addr, i+1,status[offset+i]);
+        update(addr,i);
     }
 }
 
@@ -124,7 +138,7 @@ void LedControl::setLed(int addr, int row, int column, boolean state) {
         val=~val;
         status[offset+row]=status[offset+row]&val;
     }
-    spiTransfer(addr, row+1,status[offset+row]);
+    update(addr,row);
 }
 
 void LedControl::setRow(int addr, int row, byte value) {
@@ -135,7 +149,7 @@ void LedControl::setRow(int addr, int row, byte value) {
         return;
     offset=addr*8;
     status[offset+row]=value;
-    spiTransfer(addr, row+1,status[offset+row]);
+    update(addr,row);
 }
 
 void LedControl::setColumn(int addr, int col, byte value) {
@@ -165,7 +179,7 @@ void LedControl::setDigit(int addr, int digit, byte value, boolean dp) {
     if(dp)
         v|=B10000000;
     status[offset+digit]=v;
-    spiTransfer(addr, digit+1,v);
+    update(addr,digit);
 }
 
 void LedControl::setChar(int addr, int digit, char value, boolean dp) {
@@ -186,7 +200,7 @@ void LedControl::setChar(int addr, int digit, char value, boolean dp) {
     if(dp)
         v|=B10000000;
     status[offset+digit]=v;
-    spiTransfer(addr, digit+1,v);
+    update(addr,digit);
 }
 
 void LedControl::spiTransfer(int addr, volatile byte opcode, volatile byte data) {
@@ -199,13 +213,67 @@ void LedControl::spiTransfer(int addr, volatile byte opcode, volatile byte data)
     //put our device data into the array
     spidata[offset+1]=opcode;
     spidata[offset]=data;
+    if(opcode>=OP_DIGIT0 && opcode<=OP_DIGIT7)
+        shown[addr*8+opcode-OP_DIGIT0]=data;
+    shiftOutData(maxbytes);
+}    
+
+void LedControl::shiftOutData(int bytes) {
+    if(SPI_MOSI<0)
+        SPI.beginTransaction(SPISettings(10000000,MSBFIRST,SPI_MODE0));
     //enable the line 
     digitalWrite(SPI_CS,LOW);
     //Now shift out the data 
-    for(int i=maxbytes;i>0;i--)
-        shiftOut(SPI_MOSI,SPI_CLK,MSBFIRST,spidata[i-1]);
+    for(int i=bytes;i>0;i--) {
+        if(SPI_MOSI<0)
+            SPI.transfer(spidata[i-1]);
+        else
+            shiftOut(SPI_MOSI,SPI_CLK,MSBFIRST,spidata[i-1]);
+    }
     //latch the data onto the display
     digitalWrite(SPI_CS,HIGH);
-}    
+    if(SPI_MOSI<0)
+        SPI.endTransaction();
+}
+
+void LedControl::update(int addr, int row) {
+    if(!buffered)
+        spiTransfer(addr, row+1,status[addr*8+row]);
+}
+
+void LedControl::setBuffered(bool b) {
+    if(buffered && !b)
+        commit();
+    buffered=b;
+}
+
+void LedControl::commit() {
+    int maxbytes=maxDevices*2;
+
+    //one transfer per changed row, down the whole chain
+    for(int row=0;row<8;row++) {
+        bool changed=false;
+        for(int addr=0;addr<maxDevices;addr++) {
+            int i=addr*8+row;
+            if(status[i]!=shown[i]) {
+                spidata[addr*2+1]=row+1;
+                spidata[addr*2]=status[i];
+                shown[i]=status[i];
+                changed=true;
+            }
+            else {
+                //this device keeps its row
+                spidata[addr*2+1]=OP_NOOP;
+                spidata[addr*2]=0;
+            }
+        }
+        if(changed)
+            shiftOutData(maxbytes);
+    }
+}
+
+byte *LedControl::getBuffer() {
+    return status;
+}
 
 
@@ -34,6 +34,7 @@
 #else
 #include <WProgram.h>
 #endif
+#include <SPI.h>
 
 /*
  * Segments to be switched on for characters and digits on
@@ -64,10 +65,20 @@ class LedControl {
         byte spidata[16];
         /* Send out a single command to the device */
         void spiTransfer(int addr, byte opcode, byte data);
+        /* Shift out spidata to the chain, last device first */
+        void shiftOutData(int bytes);
+        /* Common part of the constructors */
+        void init(int numDevices);
+        /* Send a row of the led-status, unless in buffered mode */
+        void update(int addr, int row);
 
         /* We keep track of the led-status for all 8 devices in this array */
         byte status[64];
-        /* Data is shifted out of this pin*/
+        /* The rows as last sent to the devices, for commit() */
+        byte shown[64];
+        /* If true, the led-status is only sent by commit() */
+        bool buffered;
+        /* Data is shifted out of this pin, -1 for the hardware SPI */
         int SPI_MOSI;
         /* The clock is signaled on this pin */
         int SPI_CLK;
@@ -87,6 +98,15 @@ class LedControl {
          */
         LedControl(int dataPin, int clkPin, int csPin, int numDevices=1);
 
+        /* 
+         * Create a new controler on the hardware SPI of the board
+         * (DataIn on MOSI, CLK on SCK), clocked at 10MHz.
+         * Params :
+         * csPin		pin for selecting the device 
+         * numDevices	maximum number of devices that can be controled
+         */
+        LedControl(int csPin, int numDevices=1);
+
         /*
          * Gets the number of devices attached to this LedControl.
          * Returns :
@@ -182,6 +202,31 @@ class LedControl {
          * dp	sets the decimal point.
          */
         void setChar(int addr, int digit, char value, boolean dp);
+
+        /* 
+         * Switch buffered mode on or off. In buffered mode setLed(), setRow(),
+         * setColumn(), setDigit(), setChar() and clearDisplay() only change
+         * the led-status, and commit() sends it. Switching it off commits.
+         * Params:
+         * b	true for buffered mode (default false)
+         */
+        void setBuffered(bool b);
+
+        /* 
+         * Send the rows of the led-status that differ from what the devices
+         * show. A row that changed on any device costs one transfer along
+         * the chain, with a no-op for the devices where it did not change.
+         */
+        void commit();
+
+        /* 
+         * Get the led-status of the whole chain, for changing it directly
+         * in buffered mode: 8 bytes per device, one per row, the first
+         * column in bit 7 (as setRow()).
+         * Returns :
+         * byte*	the led-status, getDeviceCount()*8 bytes
+         */
+        byte *getBuffer();
 };
 
 #endif	//LedControl.h
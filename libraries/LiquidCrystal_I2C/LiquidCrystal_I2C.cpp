@@ -2,22 +2,28 @@
 
 #include "LiquidCrystal_I2C.h"
 #include <inttypes.h>
+#include <string.h>
 #if defined(ARDUINO) && ARDUINO >= 100
 
 #include "Arduino.h"
 
 #define printIIC(args)	Wire.write(args)
 inline size_t LiquidCrystal_I2C::write(uint8_t value) {
-	send(value, Rs);
+	put(&value, 1);
 	return 1;
 }
 
+size_t LiquidCrystal_I2C::write(const uint8_t *buffer, size_t size) {
+	put(buffer, size);
+	return size;
+}
+
 #else
 #include "WProgram.h"
 
 #define printIIC(args)	Wire.send(args)
 inline void LiquidCrystal_I2C::write(uint8_t value) {
-	send(value, Rs);
+	put(&value, 1);
 }
 
 #endif
@@ -50,6 +56,14 @@ LiquidCrystal_I2C::LiquidCrystal_I2C(uint8_t lcd_Addr,uint8_t lcd_cols,uint8_t l
   _cols = lcd_cols;
   _rows = lcd_rows;
   _backlightval = LCD_NOBACKLIGHT;
+  _queued = 0;
+  _lastOut = 0xFF;	// unknown: the first nibble gets its setup write
+  _shadow = true;
+  _tracked = false;	// until clear() or home()
+  _cgram = false;
+  _increment = true;
+  _cursor = _addr = 0;
+  memset(_known, 0, sizeof(_known));
 }
 
 void LiquidCrystal_I2C::init(){
@@ -214,6 +228,19 @@ void LiquidCrystal_I2C::createChar(uint8_t location, uint8_t charmap[]) {
 	}
 }
 
+// Send every character printed, as the display may have been changed
+// behind our back
+void LiquidCrystal_I2C::noShadow(void) {
+	_shadow = false;
+}
+
+// Skip the characters that the display already shows at their position.
+// The shadow starts empty: it fills with the characters printed.
+void LiquidCrystal_I2C::shadow(void) {
+	memset(_known, 0, sizeof(_known));
+	_shadow = true;
+}
+
 // Turn the (optional) backlight off/on
 void LiquidCrystal_I2C::noBacklight(void) {
 	_backlightval=LCD_NOBACKLIGHT;
@@ -229,8 +256,48 @@ void LiquidCrystal_I2C::backlight(void) {
 
 /*********** mid level commands, for sending data/cmds */
 
-inline void LiquidCrystal_I2C::command(uint8_t value) {
-	send(value, 0);
+// Commands are followed to track the address counter and the DDRAM shadow
+void LiquidCrystal_I2C::command(uint8_t value) {
+	if (value & LCD_SETDDRAMADDR) {
+		_cursor = value & 0x7F;
+		if (_shadow && !(_displaycontrol & (LCD_CURSORON | LCD_BLINKON))) {
+			// deferred: sent with the first character that is not skipped
+			if (_cgram || !_tracked)
+				_addr = 0xFF;
+			_tracked = true;
+			_cgram = false;
+			return;
+		}
+		_addr = _cursor;
+		_tracked = true;
+		_cgram = false;
+	} else if (value & LCD_SETCGRAMADDR) {
+		_cgram = true;
+	} else if (value == LCD_CLEARDISPLAY || (value & ~1) == LCD_RETURNHOME) {
+		if (value == LCD_CLEARDISPLAY) {
+			// clear also sets the entry mode to increment
+			memset(_ddram, ' ', sizeof(_ddram));
+			memset(_known, 0xFF, sizeof(_known));
+			_increment = true;
+		}
+		_cursor = _addr = 0;
+		_tracked = true;
+		_cgram = false;
+	} else {
+		sync();	// the display must be where we think it is
+		if ((value & ~0x0F) == LCD_CURSORSHIFT) {
+			if (!(value & LCD_DISPLAYMOVE) && !_cgram) {
+				bool increment = _increment;
+				_increment = value & LCD_MOVERIGHT;
+				_cursor = _addr = step(_addr);
+				_increment = increment;
+			}
+		} else if ((value & ~0x03) == LCD_ENTRYMODESET) {
+			_increment = value & LCD_ENTRYLEFT;
+		}
+	}
+	queue(value, 0);
+	flush();
 }
 
 
@@ -238,10 +305,102 @@ inline void LiquidCrystal_I2C::command(uint8_t value) {
 
 // write either command or data
 void LiquidCrystal_I2C::send(uint8_t value, uint8_t mode) {
-	uint8_t highnib=value&0xf0;
-	uint8_t lownib=(value<<4)&0xf0;
-       write4bits((highnib)|mode);
-	write4bits((lownib)|mode); 
+	queue(value, mode);
+	flush();
+}
+
+// Write characters, skipping those the display already shows (DDRAM
+// shadow). A skipped run costs a DDRAM address command before the next
+// character sent, or nothing at the end of the string.
+void LiquidCrystal_I2C::put(const uint8_t *buffer, size_t size) {
+	for (size_t i = 0; i < size; i++) {
+		uint8_t c = buffer[i];
+		if (_cgram || !_tracked) {	// createChar() data, or unknown address
+			queue(c, Rs);
+			continue;
+		}
+		uint8_t slot = _cursor;
+		if ((_displayfunction & LCD_2LINE) && (_cursor & 0x3F) < 40)
+			slot = ((_cursor & 0x40) ? 40 : 0) + (_cursor & 0x3F);
+		else if (_displayfunction & LCD_2LINE)
+			slot = LCD_DDRAM_SIZE;
+		if (slot >= LCD_DDRAM_SIZE) {
+			queue(c, Rs);	// no such DDRAM address: stop tracking
+			_tracked = false;
+			continue;
+		}
+		// autoscroll shifts the display on every write, even of the same character
+		if (_shadow && !(_displaymode & LCD_ENTRYSHIFTINCREMENT) &&
+		    (_known[slot / 8] & (1 << (slot & 7))) && _ddram[slot] == c) {
+			_cursor = step(_cursor);
+			continue;
+		}
+		if (_addr != _cursor)
+			queue(LCD_SETDDRAMADDR | _cursor, 0);
+		queue(c, Rs);
+		_ddram[slot] = c;
+		_known[slot / 8] |= 1 << (slot & 7);
+		_cursor = _addr = step(_cursor);
+	}
+	// a visible cursor must end up after the text
+	if (_displaycontrol & (LCD_CURSORON | LCD_BLINKON))
+		sync();
+	flush();
+}
+
+// Send the deferred DDRAM address, after skipped characters
+void LiquidCrystal_I2C::sync() {
+	if (_tracked && !_cgram && _addr != _cursor) {
+		queue(LCD_SETDDRAMADDR | _cursor, 0);
+		_addr = _cursor;
+	}
+}
+
+// Next DDRAM address in the entry mode direction. With 2 lines, the first
+// is at 0x00-0x27 and the second at 0x40-0x67, one after the other.
+uint8_t LiquidCrystal_I2C::step(uint8_t addr) {
+	if (_displayfunction & LCD_2LINE) {
+		if (_increment)
+			return (addr == 0x27) ? 0x40 : (addr == 0x67) ? 0x00 : addr + 1;
+		return (addr == 0x00) ? 0x67 : (addr == 0x40) ? 0x27 : addr - 1;
+	}
+	if (_increment)
+		return (addr == 0x4F) ? 0x00 : addr + 1;
+	return (addr == 0x00) ? 0x4F : addr - 1;
+}
+
+// Queue both nibbles of a byte into the open Wire transmission. A nibble is
+// written with En high then En low: the HD44780 latches it on the falling
+// edge, the data having been stable for a whole I2C byte. Rs gets its own
+// setup write before En rises when it changes. A character is 4 expander
+// writes (~90us at 400kHz, more than the 37us it takes to execute) instead
+// of 6 separate transmissions.
+void LiquidCrystal_I2C::queue(uint8_t value, uint8_t mode) {
+	uint8_t nibble[2] = { (uint8_t)(value & 0xf0), (uint8_t)((value << 4) & 0xf0) };
+	for (uint8_t i = 0; i < 2; i++) {
+		uint8_t data = nibble[i] | mode | _backlightval;
+		bool setup = (_lastOut & (Rs | Rw)) != (data & (Rs | Rw));
+		if (_queued + (setup ? 3 : 2) > LCD_I2C_BUFFER)
+			flush();
+		if (!_queued)
+			Wire.beginTransmission(_Addr);
+		if (setup) {
+			printIIC(data);
+			_queued++;
+		}
+		printIIC(data | En);	// En high
+		printIIC(data);		// En low: latched
+		_queued += 2;
+		_lastOut = data;
+	}
+}
+
+// End the open Wire transmission
+void LiquidCrystal_I2C::flush() {
+	if (_queued) {
+		Wire.endTransmission();
+		_queued = 0;
+	}
 }
 
 void LiquidCrystal_I2C::write4bits(uint8_t value) {
@@ -250,6 +409,7 @@ void LiquidCrystal_I2C::write4bits(uint8_t value) {
 }
 
 void LiquidCrystal_I2C::expanderWrite(uint8_t _data){                                        
+	_lastOut = _data | _backlightval;
 	Wire.beginTransmission(_Addr);
 	printIIC((int)(_data) | _backlightval);
 	Wire.endTransmission();   
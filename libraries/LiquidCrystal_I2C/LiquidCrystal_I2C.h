@@ -52,6 +52,18 @@
 #define Rw B00000010  // Read/Write bit
 #define Rs B00000001  // Register select bit
 
+// Bytes of a Wire transmission: characters are queued into one up to this
+#if defined(I2C_BUFFER_LENGTH)
+#define LCD_I2C_BUFFER I2C_BUFFER_LENGTH
+#elif defined(BUFFER_LENGTH)
+#define LCD_I2C_BUFFER BUFFER_LENGTH
+#else
+#define LCD_I2C_BUFFER 32
+#endif
+
+// DDRAM of the HD44780: 80 characters (e.g. 20x4)
+#define LCD_DDRAM_SIZE 80
+
 class LiquidCrystal_I2C : public Print {
 public:
   LiquidCrystal_I2C(uint8_t lcd_Addr,uint8_t lcd_cols,uint8_t lcd_rows);
@@ -80,11 +92,15 @@ public:
   void setCursor(uint8_t, uint8_t); 
 #if defined(ARDUINO) && ARDUINO >= 100
   virtual size_t write(uint8_t);
+  virtual size_t write(const uint8_t *buffer, size_t size);
+  using Print::write;
 #else
   virtual void write(uint8_t);
 #endif
   void command(uint8_t);
   void init();
+  void noShadow();	// send every character, even if already displayed
+  void shadow();	// skip characters already displayed (default)
 
 ////compatibility API function aliases
 void blink_on();						// alias for blink()
@@ -113,6 +129,11 @@ private:
   void write4bits(uint8_t);
   void expanderWrite(uint8_t);
   void pulseEnable(uint8_t);
+  void put(const uint8_t *, size_t);
+  void queue(uint8_t, uint8_t);
+  void flush();
+  void sync();
+  uint8_t step(uint8_t);
   uint8_t _Addr;
   uint8_t _displayfunction;
   uint8_t _displaycontrol;
@@ -121,6 +142,22 @@ private:
   uint8_t _cols;
   uint8_t _rows;
   uint8_t _backlightval;
+
+  // Batched transfers: the bytes of the open Wire transmission, and the
+  // last value written to the expander
+  uint8_t _queued;
+  uint8_t _lastOut;
+
+  // DDRAM shadow, valid once the display was cleared: the characters
+  // displayed, with a bit per character telling if it is known
+  uint8_t _ddram[LCD_DDRAM_SIZE];
+  uint8_t _known[LCD_DDRAM_SIZE / 8];
+  bool _shadow;		// skip characters already displayed
+  bool _tracked;	// the address counter is known
+  bool _cgram;		// the address counter is in CGRAM (createChar())
+  bool _increment;	// entry mode: address counter increments
+  uint8_t _cursor;	// DDRAM address the next character goes to
+  uint8_t _addr;	// DDRAM address counter of the display
 };
 
 #endif
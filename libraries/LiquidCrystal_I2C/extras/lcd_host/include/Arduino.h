@@ -0,0 +1,30 @@
+// Host (Linux) stand-in for the Arduino core, used by lcd_host.
+// Only the API used by LiquidCrystal_I2C is provided. Time is virtual: it
+// is advanced by the delays and by the mock TwoWire for the bus time of
+// each transmission.
+
+#ifndef LCD_HOST_ARDUINO_H
+#define LCD_HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define B00000001 1
+#define B00000010 2
+#define B00000100 4
+
+extern uint64_t hostNs;
+
+inline unsigned long micros() { return hostNs / 1000; }
+inline void delay(unsigned long ms) { hostNs += ms * 1000000ULL; }
+inline void delayMicroseconds(unsigned int us) { hostNs += us * 1000ULL; }
+
+#include "Print.h"
+
+#endif // LCD_HOST_ARDUINO_H
@@ -0,0 +1,32 @@
+// Host stand-in for the Arduino Print class
+
+#ifndef LCD_HOST_PRINT_H
+#define LCD_HOST_PRINT_H
+
+#include <stdio.h>
+#include <string.h>
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--)
+      n += write(*buffer++);
+    return n;
+  }
+  size_t write(const char *str) {
+    return write((const uint8_t *)str, strlen(str));
+  }
+  size_t print(const char *str) { return write(str); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(long n) {
+    char s[24];
+    snprintf(s, sizeof(s), "%ld", n);
+    return write(s);
+  }
+  size_t print(int n) { return print((long)n); }
+};
+
+#endif // LCD_HOST_PRINT_H
@@ -0,0 +1,64 @@
+// Host mock of the Arduino TwoWire API, used by lcd_host.
+// The bytes of each write transmission are handed to the device attached
+// at its address, with the time each one is acknowledged (when a PCF8574
+// updates its outputs). The virtual clock advances by the bus time.
+
+#ifndef LCD_HOST_WIRE_H
+#define LCD_HOST_WIRE_H
+
+#include <Arduino.h>
+
+#define BUFFER_LENGTH 32 // as the AVR core
+
+// A device on the mock bus: receives the bytes of each write transmission,
+// byte i at startNs + (i + 2) * byteNs
+class WireDevice {
+public:
+  virtual ~WireDevice() {}
+  virtual void received(const uint8_t *data, size_t length, uint64_t startNs,
+                        uint32_t byteNs) = 0;
+};
+
+class TwoWire {
+public:
+  void begin() {}
+  void setClock(uint32_t frequency) { clock = frequency; }
+
+  void beginTransmission(uint8_t address) {
+    txAddress = address;
+    txLength = 0;
+  }
+  size_t write(uint8_t data) {
+    if (txLength >= BUFFER_LENGTH) {
+      overflows++;
+      return 0;
+    }
+    txBuffer[txLength++] = data;
+    return 1;
+  }
+  size_t write(int data) { return write((uint8_t)data); }
+  uint8_t endTransmission() {
+    uint32_t byteNs = 9 * 1000000000ULL / clock; // 8 bits and the ACK
+    if (devices[txAddress & 0x7F])
+      devices[txAddress & 0x7F]->received(txBuffer, txLength, hostNs, byteNs);
+    hostNs += (txLength + 1) * (uint64_t)byteNs + 2 * 1000000000ULL / clock;
+    transmissions++;
+    bytes += txLength + 1;
+    return 0;
+  }
+
+  void attach(uint8_t address, WireDevice *d) { devices[address & 0x7F] = d; }
+
+  uint32_t transmissions = 0, bytes = 0, overflows = 0; // address bytes included
+
+private:
+  uint32_t clock = 100000;
+  uint8_t txAddress = 0;
+  uint8_t txBuffer[BUFFER_LENGTH];
+  size_t txLength = 0;
+  WireDevice *devices[128] = {};
+};
+
+extern TwoWire Wire;
+
+#endif // LCD_HOST_WIRE_H
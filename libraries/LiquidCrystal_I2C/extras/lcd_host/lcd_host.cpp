@@ -0,0 +1,345 @@
+// LiquidCrystal_I2C - host test of the batched writes and the DDRAM shadow
+// Two displays on a mock I2C bus, each a model of a PCF8574 expander
+// driving an HD44780 in 4-bit mode. The model decodes the expander
+// outputs as the controller would (instructions latched on the falling
+// edge of E) and checks the waveform: RS and R/W set up before E rises,
+// data stable while E is high, no instruction while the previous one is
+// still executing (37us, 1.52ms for clear and home).
+// One display skips the characters it already shows (shadow, the default),
+// the other sends everything (noShadow()): after random operations, both
+// controllers must hold the same DDRAM, CGRAM and display state.
+// Then reports the bus time of a 20x4 screen update, one transmission per
+// expander write as before, batched, and batched with the shadow.
+//
+// Usage: lcd_host [-n random operations] [-s seed]
+
+#include <Arduino.h>
+#include <Wire.h>
+#include <unistd.h>
+#include "../../LiquidCrystal_I2C.h"
+
+uint64_t hostNs;
+TwoWire Wire;
+
+static int failures;
+
+static void fail(const char *what) {
+  if (failures < 10)
+    printf("FAIL: %s\n", what);
+  failures++;
+}
+
+class HD44780 : public WireDevice {
+public:
+  // PCF8574 outputs: P0 RS, P1 R/W, P2 E, P3 backlight, P4-P7 D4-D7
+  void received(const uint8_t *data, size_t length, uint64_t startNs,
+                uint32_t byteNs) {
+    for (size_t i = 0; i < length; i++)
+      output(data[i], startNs + (i + 2) * byteNs);
+  }
+
+  uint8_t ddram[80], cgram[64];
+  uint8_t ac = 0, control = 0;
+  int shift = 0;
+  bool cg = false;
+
+  HD44780() {
+    memset(ddram, ' ', sizeof(ddram));
+    memset(cgram, 0, sizeof(cgram));
+  }
+
+  // Displayed text of row r of a 20x4 display (no display shift)
+  void row(uint8_t r, char *text) {
+    static const uint8_t offset[4] = {0x00, 0x40, 0x14, 0x54};
+    for (uint8_t i = 0; i < 20; i++)
+      text[i] = ddram[slot(offset[r] + i)];
+    text[20] = 0;
+  }
+
+private:
+  uint8_t out = 0xFF; // outputs are high at power up
+  uint64_t riseNs = 0, readyNs = 0;
+  bool fourBit = false, half = false, twoLine = false;
+  bool increment = true, shiftOnWrite = false;
+  uint8_t high = 0;
+
+  void output(uint8_t v, uint64_t t) {
+    bool e = out & 0x04, eNow = v & 0x04;
+    if (!e && eNow) {
+      if ((v ^ out) & 0x03)
+        fail("RS or R/W changed as E rose");
+      riseNs = t;
+    } else if (e && !(out & 0x02) && ((v ^ out) & 0xF3)) {
+      fail("RS, R/W or data changed while E was high");
+    } else if (e && !eNow && !(out & 0x02)) { // falling edge of a write
+      if (t - riseNs < 450)
+        fail("E pulse shorter than 450ns");
+      latch(out >> 4, out & 0x01, t);
+    }
+    out = v;
+  }
+
+  void latch(uint8_t nibble, bool rs, uint64_t t) {
+    if (t < readyNs)
+      fail("instruction sent while the controller was busy");
+    if (!fourBit) { // D0-D3 are not connected: read as 0
+      execute(nibble << 4, rs, t);
+    } else if (!half) {
+      high = nibble;
+      half = true;
+    } else {
+      half = false;
+      execute((high << 4) | nibble, rs, t);
+    }
+  }
+
+  uint8_t slot(uint8_t a) {
+    if (!twoLine)
+      return a % 80;
+    return ((a & 0x40) ? 40 : 0) + (a & 0x3F) % 40;
+  }
+
+  uint8_t next(uint8_t a, bool up) {
+    if (cg)
+      return (a + (up ? 1 : -1)) & 0x3F;
+    if (!twoLine)
+      return up ? (a + 1) % 80 : (a + 79) % 80;
+    uint8_t s = (slot(a) + (up ? 1 : 79)) % 80;
+    return (s < 40) ? s : 0x40 + s - 40;
+  }
+
+  void execute(uint8_t v, bool rs, uint64_t t) {
+    readyNs = t + 37000;
+    if (rs) {
+      if (cg)
+        cgram[ac & 0x3F] = v;
+      else
+        ddram[slot(ac)] = v;
+      ac = next(ac, increment);
+      if (shiftOnWrite && !cg)
+        shift += increment ? -1 : 1;
+    } else if (v & 0x80) {
+      ac = v & 0x7F;
+      cg = false;
+    } else if (v & 0x40) {
+      ac = v & 0x3F;
+      cg = true;
+    } else if (v & 0x20) {
+      fourBit = !(v & 0x10);
+      twoLine = v & 0x08;
+    } else if (v & 0x10) {
+      if (v & 0x08)
+        shift += (v & 0x04) ? 1 : -1;
+      else
+        ac = next(ac, v & 0x04);
+    } else if (v & 0x08) {
+      control = v & 0x07;
+    } else if (v & 0x04) {
+      increment = v & 0x02;
+      shiftOnWrite = v & 0x01;
+    } else if (v & 0x03) { // home (0x02, 0x03) or clear (0x01)
+      if (v == 0x01) {
+        memset(ddram, ' ', sizeof(ddram));
+        increment = true;
+      }
+      ac = 0;
+      shift = 0;
+      cg = false;
+      readyNs = t + 1520000;
+    }
+  }
+};
+
+static HD44780 shadowModel, plainModel, oldModel;
+static LiquidCrystal_I2C shadowLcd(0x27, 20, 4), plainLcd(0x26, 20, 4);
+
+static void compare(const char *what, uint32_t i) {
+  char text[80];
+  bool same = !memcmp(shadowModel.ddram, plainModel.ddram, 80) &&
+              !memcmp(shadowModel.cgram, plainModel.cgram, 64) &&
+              shadowModel.shift == plainModel.shift &&
+              shadowModel.control == plainModel.control;
+  // the address counter only shows with a visible cursor
+  if (shadowModel.control & 0x03)
+    same = same && shadowModel.ac == plainModel.ac &&
+           shadowModel.cg == plainModel.cg;
+  if (!same) {
+    snprintf(text, sizeof(text), "%s %u: the displays differ", what, i);
+    fail(text);
+  }
+}
+
+// One random operation, on both displays
+static void randomOperation() {
+  static const char alphabet[] = "ab 01";
+  char text[26];
+  uint8_t length = rand() % 25 + 1, col = rand() % 20, row = rand() % 4;
+  uint8_t charmap[8], location = rand() % 8;
+  for (uint8_t i = 0; i < length; i++)
+    text[i] = alphabet[rand() % 5];
+  text[length] = 0;
+  for (uint8_t i = 0; i < 8; i++)
+    charmap[i] = rand() & 0x1F;
+  int op = rand() % 100, move = rand() & 1 ? LCD_MOVERIGHT : LCD_MOVELEFT;
+  bool on = rand() & 1;
+  LiquidCrystal_I2C *lcd[2] = {&shadowLcd, &plainLcd};
+
+  for (uint8_t k = 0; k < 2; k++) {
+    if (op < 30)
+      lcd[k]->setCursor(col, row);
+    else if (op < 65)
+      lcd[k]->print(text);
+    else if (op < 68)
+      lcd[k]->clear();
+    else if (op < 70)
+      lcd[k]->home();
+    else if (op < 73) {
+      lcd[k]->createChar(location, charmap);
+      if (op < 72)
+        lcd[k]->setCursor(col, row);
+    } else if (op < 76)
+      on ? lcd[k]->cursor() : lcd[k]->noCursor();
+    else if (op < 79)
+      on ? lcd[k]->blink() : lcd[k]->noBlink();
+    else if (op < 84)
+      (op & 1) ? lcd[k]->leftToRight() : lcd[k]->rightToLeft();
+    else if (op < 86)
+      (op & 1) ? lcd[k]->autoscroll() : lcd[k]->noAutoscroll();
+    else if (op < 90)
+      (op & 1) ? lcd[k]->scrollDisplayLeft() : lcd[k]->scrollDisplayRight();
+    else if (op < 96)
+      lcd[k]->command(LCD_CURSORSHIFT | LCD_CURSORMOVE | move);
+    else if (op < 98)
+      lcd[k]->write((uint8_t)location); // a custom character
+    else
+      (op & 1) ? lcd[k]->backlight() : lcd[k]->noBacklight();
+  }
+}
+
+// The previous write path: 3 transmissions per nibble, with delays
+static void oldExpanderWrite(uint8_t address, uint8_t data) {
+  Wire.beginTransmission(address);
+  Wire.write((uint8_t)(data | LCD_BACKLIGHT));
+  Wire.endTransmission();
+}
+static void oldSend(uint8_t address, uint8_t value, uint8_t mode) {
+  uint8_t nibble[2] = {(uint8_t)(value & 0xf0), (uint8_t)(value << 4)};
+  for (uint8_t i = 0; i < 2; i++) {
+    oldExpanderWrite(address, nibble[i] | mode);
+    oldExpanderWrite(address, nibble[i] | mode | En);
+    delayMicroseconds(1);
+    oldExpanderWrite(address, nibble[i] | mode);
+    delayMicroseconds(50);
+  }
+}
+
+static const uint8_t rowOffset[4] = {0x00, 0x40, 0x14, 0x54};
+
+static void screen(char lines[4][21], uint32_t frame) {
+  snprintf(lines[0], 21, "angle %6.1f deg    ", (frame % 900) / 10.0 - 45);
+  snprintf(lines[1], 21, "speed %6d        ", (int)(frame * 7 % 2000) - 1000);
+  snprintf(lines[2], 21, "Kp 0.32   Kd 0.18   ");
+  snprintf(lines[3], 21, "battery %4.1fV   WIFI", 11.1 + (frame % 10) / 10.0);
+}
+
+static double updateMs(int how, uint32_t clock) {
+  char lines[4][21];
+  Wire.setClock(clock);
+  screen(lines, 0);
+  if (how == 2) // the previous frame is on the display
+    for (uint8_t r = 0; r < 4; r++) {
+      shadowLcd.setCursor(0, r);
+      shadowLcd.print(lines[r]);
+    }
+  screen(lines, 1);
+  uint64_t start = hostNs;
+  for (uint8_t r = 0; r < 4; r++) {
+    if (how == 0) {
+      oldSend(0x25, LCD_SETDDRAMADDR | rowOffset[r], 0);
+      for (uint8_t i = 0; i < 20; i++)
+        oldSend(0x25, lines[r][i], Rs);
+    } else {
+      LiquidCrystal_I2C &lcd = (how == 1) ? plainLcd : shadowLcd;
+      lcd.setCursor(0, r);
+      lcd.print(lines[r]);
+    }
+  }
+  return (hostNs - start) / 1e6;
+}
+
+int main(int argc, char **argv) {
+  uint32_t operations = 200000;
+  unsigned seed = 1;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+    switch (opt) {
+    case 'n':
+      operations = atoi(optarg);
+      break;
+    case 's':
+      seed = atoi(optarg);
+      break;
+    default:
+      fprintf(stderr, "usage: %s [-n operations] [-s seed]\n", argv[0]);
+      return 2;
+    }
+  }
+  srand(seed);
+  Wire.attach(0x27, &shadowModel);
+  Wire.attach(0x26, &plainModel);
+  Wire.attach(0x25, &oldModel); // timing of the previous write path
+  shadowLcd.init();
+  plainLcd.init();
+  plainLcd.noShadow();
+  shadowLcd.backlight();
+  plainLcd.backlight();
+
+  // Text where it is expected
+  char lines[4][21], text[21];
+  screen(lines, 0);
+  for (uint8_t r = 0; r < 4; r++) {
+    shadowLcd.setCursor(0, r);
+    shadowLcd.print(lines[r]);
+    plainLcd.setCursor(0, r);
+    plainLcd.print(lines[r]);
+  }
+  for (uint8_t r = 0; r < 4; r++) {
+    shadowModel.row(r, text);
+    if (strcmp(text, lines[r]))
+      fail("text not where expected");
+  }
+
+  for (uint32_t i = 0; i < operations; i++) {
+    randomOperation();
+    compare("random operation", i);
+  }
+  printf("%u random operations checked\n", operations);
+
+  // Fresh displays for the timing
+  shadowLcd.clear();
+  plainLcd.clear();
+  shadowLcd.leftToRight();
+  plainLcd.leftToRight();
+  shadowLcd.noAutoscroll();
+  plainLcd.noAutoscroll();
+  shadowLcd.noCursor();
+  plainLcd.noCursor();
+  shadowLcd.noBlink();
+  plainLcd.noBlink();
+  printf("20x4 screen update (bus time)   100kHz    400kHz\n");
+  const char *name[3] = {"transmission per write", "batched",
+                         "batched + shadow"};
+  for (int how = 0; how < 3; how++)
+    printf("  %-28s %6.2fms  %6.2fms\n", name[how], updateMs(how, 100000),
+           updateMs(how, 400000));
+  if (Wire.overflows)
+    fail("Wire buffer overflow");
+
+  if (failures) {
+    printf("%d failures\n", failures);
+    return 1;
+  }
+  printf("OK\n");
+  return 0;
+}
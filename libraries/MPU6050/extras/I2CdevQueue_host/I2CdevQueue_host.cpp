@@ -0,0 +1,169 @@
+// I2Cdev library collection - I2CdevQueue host check
+// Runs the asynchronous transaction queue on Linux against a mock bus:
+// queue semantics, then a producer and a consumer thread through the
+// lock-free ring, with the latency from submit to completion.
+//
+// Usage: I2CdevQueue_host [transactions] [bus_khz]
+// Exit status is 0 when every check passed.
+//
+// Changelog:
+//      2026-10-18 - initial release
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <thread>
+#include <atomic>
+#include "../../src/I2CdevQueue.h"
+
+#define MOCK_ADDRESS    0x68
+
+// Mock bus: one device with 256 byte registers (auto increment).
+// A transfer takes the time the bytes would take on the bus (9 clocks each, with
+// the addresses and the register pointer) so the latency numbers are realistic.
+static uint8_t mockRegs[256];
+static uint32_t mockClockHz = 400000;
+
+static uint64_t hostNs() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000000000ULL + t.tv_nsec;
+}
+
+static int8_t mockBus(I2CdevTransaction *t) {
+    uint32_t bytes = t->direction == I2CDEV_READ ? 3 + t->length : 2 + t->length;
+    uint64_t end = hostNs() + (uint64_t)bytes * 9 * 1000000000ULL / mockClockHz;
+    while (hostNs() < end);     // the bus is busy: spin like the Wire driver
+    if (t->devAddr != MOCK_ADDRESS) return -1;     // NACK
+    for (uint8_t i = 0; i < t->length; i++) {
+        if (t->direction == I2CDEV_READ) t->data[i] = mockRegs[(uint8_t)(t->regAddr + i)];
+        else mockRegs[(uint8_t)(t->regAddr + i)] = t->data[i];
+    }
+    return t->length;
+}
+
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("FAILED line %d: %s\n", __LINE__, #cond); failures++; } } while (0)
+
+static int callbackOrder[I2CDEV_QUEUE_LENGTH];
+static int callbacks;
+
+static void recordCallback(I2CdevTransaction *t) {
+    callbackOrder[callbacks++] = (int)(intptr_t)t->arg;
+}
+
+// Single context: submit, poll, callbacks, full queue, errors
+static void checkSemantics() {
+    I2CdevQueue queue(mockBus);
+    I2CdevTransaction t[I2CDEV_QUEUE_LENGTH + 1];
+    uint8_t out[4] = { 0x11, 0x22, 0x33, 0x44 };
+    uint8_t in[4] = { 0 };
+
+    CHECK(queue.write(&t[0], MOCK_ADDRESS, 0x10, 4, out));
+    CHECK(!I2CdevQueue::done(&t[0]));
+    CHECK(queue.read(&t[1], MOCK_ADDRESS, 0x11, 3, in));
+    CHECK(queue.pending() == 2);
+    CHECK(queue.service(1) == 1);
+    CHECK(I2CdevQueue::done(&t[0]) && t[0].status == 4);
+    CHECK(!I2CdevQueue::done(&t[1]));
+    CHECK(queue.service() == 1);
+    CHECK(t[1].status == 3 && in[0] == 0x22 && in[1] == 0x33 && in[2] == 0x44);
+    CHECK(queue.service() == 0);
+
+    // Full queue: the extra transaction is refused and left untouched
+    callbacks = 0;
+    for (int i = 0; i < I2CDEV_QUEUE_LENGTH; i++) {
+        t[i].arg = (void *)(intptr_t)i;
+        CHECK(queue.read(&t[i], MOCK_ADDRESS, i, 1, &in[0], recordCallback));
+    }
+    t[I2CDEV_QUEUE_LENGTH].status = 99;
+    CHECK(!queue.read(&t[I2CDEV_QUEUE_LENGTH], MOCK_ADDRESS, 0, 1, &in[0]));
+    CHECK(t[I2CDEV_QUEUE_LENGTH].status == 99);
+    CHECK(queue.service() == I2CDEV_QUEUE_LENGTH);
+    CHECK(callbacks == I2CDEV_QUEUE_LENGTH);
+    for (int i = 0; i < callbacks; i++) CHECK(callbackOrder[i] == i);
+
+    // Bus error
+    CHECK(queue.read(&t[0], 0x42, 0, 1, &in[0]));
+    queue.service();
+    CHECK(t[0].status == -1);
+
+    // Lengths the status cannot hold are refused: 254 bytes would read back as I2CDEV_PENDING
+    uint8_t block[255];
+    t[0].status = 99;
+    CHECK(!queue.read(&t[0], MOCK_ADDRESS, 0, 254, block));
+    CHECK(!queue.write(&t[0], MOCK_ADDRESS, 0, 128, block));
+    CHECK(!queue.read(&t[0], MOCK_ADDRESS, 0, 255, block));
+    CHECK(t[0].status == 99 && queue.pending() == 0);
+    CHECK(queue.read(&t[0], MOCK_ADDRESS, 0, I2CDEV_MAX_LENGTH, block));
+    CHECK(queue.service() == 1);
+    CHECK(I2CdevQueue::done(&t[0]) && t[0].status == I2CDEV_MAX_LENGTH);
+}
+
+// Two threads: the producer keeps a window of descriptors in flight and reuses
+// each one when done, the consumer services the ring as the bus task would
+static void checkThreads(uint32_t transactions) {
+    I2CdevQueue queue(mockBus);
+    I2CdevTransaction t[I2CDEV_QUEUE_LENGTH];
+    uint8_t data[I2CDEV_QUEUE_LENGTH][14];
+    uint64_t submitted[I2CDEV_QUEUE_LENGTH];
+    std::atomic<bool> stop(false);
+    uint64_t latencySum = 0, latencyMax = 0;
+    uint32_t completed = 0, fullRetries = 0;
+    bool orderOk = true;
+
+    for (int i = 0; i < 256; i++) mockRegs[i] = i;
+    for (int i = 0; i < I2CDEV_QUEUE_LENGTH; i++) t[i].status = 0;
+
+    std::thread consumer([&]() {
+        while (!stop) if (queue.service() == 0) std::this_thread::yield();
+    });
+
+    uint64_t start = hostNs();
+    for (uint32_t n = 0; completed < transactions; n++) {
+        int slot = n % I2CDEV_QUEUE_LENGTH;
+        I2CdevTransaction *d = &t[slot];
+        if (n >= I2CDEV_QUEUE_LENGTH) {
+            // The slot holds transaction n - I2CDEV_QUEUE_LENGTH, the oldest in flight
+            while (!I2CdevQueue::done(d)) std::this_thread::yield();
+            if (d->status != 14 || data[slot][0] != (uint8_t)(uintptr_t)d->arg) orderOk = false;
+            uint64_t latency = hostNs() - submitted[slot];
+            latencySum += latency;
+            if (latency > latencyMax) latencyMax = latency;
+            completed++;
+        }
+        if (n < transactions) {
+            d->arg = (void *)(uintptr_t)(uint8_t)n;
+            submitted[slot] = hostNs();
+            // The consumer publishes the status just before it frees the slot
+            while (!queue.read(d, MOCK_ADDRESS, (uint8_t)n, 14, data[slot])) fullRetries++;
+        }
+    }
+    uint64_t wall = hostNs() - start;
+    stop = true;
+    consumer.join();
+
+    CHECK(orderOk);
+    CHECK(completed == transactions);
+    printf("threads         %u reads of 14 bytes at %u kHz in %.3f s (%.0f us per read on the bus)\n",
+           transactions, mockClockHz / 1000, wall * 1e-9, wall * 1e-3 / transactions);
+    printf("latency         %.0f us mean, %.0f us max (submit to done, %d in flight, %u full queue retries)\n",
+           latencySum * 1e-3 / completed, latencyMax * 1e-3, I2CDEV_QUEUE_LENGTH, fullRetries);
+}
+
+int main(int argc, char **argv) {
+    uint32_t transactions = argc > 1 ? strtoul(argv[1], NULL, 0) : 2000;
+    if (argc > 2) mockClockHz = strtoul(argv[2], NULL, 0) * 1000;
+    if (transactions == 0 || mockClockHz == 0) {
+        fprintf(stderr, "usage: I2CdevQueue_host [transactions] [bus_khz]\n");
+        return 2;
+    }
+
+    checkSemantics();
+    checkThreads(transactions);
+
+    printf("result          %s (%d failures)\n", failures ? "FAILED" : "ok", failures);
+    return failures ? 1 : 0;
+}
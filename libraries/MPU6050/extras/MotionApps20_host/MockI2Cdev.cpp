@@ -0,0 +1,149 @@
+// I2Cdev library collection - MotionApps20 host check
+// I2Cdev on a register model of one MPU6050: registers with auto increment,
+// the DMP memory banks behind BANK_SEL/MEM_START_ADDR/MEM_R_W (so the DMP
+// code upload verifies), and the FIFO with its count and reset.
+
+#include <Arduino.h>
+#include "MPU6050.h"
+#include "MockI2Cdev.h"
+
+using namespace MPU6050_IMU;
+
+#define MOCK_FIFO_SIZE  1024
+
+std::deque<uint8_t> mockFifo;
+uint32_t mockReads;
+
+static uint8_t regs[128];
+static uint8_t memory[8][256];
+
+HardwareSerial Serial;
+
+unsigned long micros() { return 0; }
+unsigned long millis() { return 0; }
+void delay(unsigned long ms) { (void)ms; }
+
+void mockReset() {
+    memset(regs, 0, sizeof(regs));
+    memset(memory, 0, sizeof(memory));
+    mockFifo.clear();
+    mockReads = 0;
+}
+
+static uint8_t readRegister(uint8_t reg) {
+    uint16_t count = mockFifo.size() < MOCK_FIFO_SIZE ? mockFifo.size() : MOCK_FIFO_SIZE;
+    uint8_t value;
+    switch (reg) {
+        case MPU6050_RA_FIFO_COUNTH: return count >> 8;
+        case MPU6050_RA_FIFO_COUNTL: return count & 0xFF;
+        case MPU6050_RA_FIFO_R_W:
+            if (mockFifo.empty()) return 0;
+            value = mockFifo.front();
+            mockFifo.pop_front();
+            return value;
+        case MPU6050_RA_MEM_R_W: return memory[regs[MPU6050_RA_BANK_SEL] & 0x07][regs[MPU6050_RA_MEM_START_ADDR]++];
+        case MPU6050_RA_WHO_AM_I: return 0x34;
+        default: return regs[reg & 0x7F];
+    }
+}
+
+static void writeRegister(uint8_t reg, uint8_t value) {
+    switch (reg) {
+        case MPU6050_RA_MEM_R_W:
+            memory[regs[MPU6050_RA_BANK_SEL] & 0x07][regs[MPU6050_RA_MEM_START_ADDR]++] = value;
+            break;
+        case MPU6050_RA_USER_CTRL:
+            if (value & (1 << MPU6050_USERCTRL_FIFO_RESET_BIT)) mockFifo.clear();
+            regs[reg] = value & 0xF0;       // the reset bits clear themselves
+            break;
+        case MPU6050_RA_PWR_MGMT_1:
+            regs[reg] = value & ~(1 << MPU6050_PWR1_DEVICE_RESET_BIT);
+            break;
+        default:
+            regs[reg & 0x7F] = value;
+    }
+}
+
+// FIFO and memory data ports do not advance the register pointer
+static uint8_t nextRegister(uint8_t reg) {
+    return reg == MPU6050_RA_FIFO_R_W || reg == MPU6050_RA_MEM_R_W ? reg : reg + 1;
+}
+
+uint16_t I2Cdev::readTimeout = I2CDEV_DEFAULT_READ_TIMEOUT;
+
+I2Cdev::I2Cdev() {
+}
+
+int8_t I2Cdev::readBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, uint16_t timeout) {
+    (void)devAddr; (void)timeout;
+    mockReads++;
+    for (uint8_t i = 0; i < length; i++, regAddr = nextRegister(regAddr)) data[i] = readRegister(regAddr);
+    return length;
+}
+
+int8_t I2Cdev::readByte(uint8_t devAddr, uint8_t regAddr, uint8_t *data, uint16_t timeout) {
+    return readBytes(devAddr, regAddr, 1, data, timeout);
+}
+
+int8_t I2Cdev::readBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t *data, uint16_t timeout) {
+    uint8_t b;
+    int8_t count = readByte(devAddr, regAddr, &b, timeout);
+    *data = b & (1 << bitNum);
+    return count;
+}
+
+int8_t I2Cdev::readBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t *data, uint16_t timeout) {
+    uint8_t b;
+    int8_t count = readByte(devAddr, regAddr, &b, timeout);
+    uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
+    *data = (b & mask) >> (bitStart - length + 1);
+    return count;
+}
+
+int8_t I2Cdev::readWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data, uint16_t timeout) {
+    uint8_t b[2];
+    for (uint8_t i = 0; i < length; i++, regAddr += 2) {
+        readBytes(devAddr, regAddr, 2, b, timeout);
+        data[i] = (b[0] << 8) | b[1];
+    }
+    return length;
+}
+
+int8_t I2Cdev::readWord(uint8_t devAddr, uint8_t regAddr, uint16_t *data, uint16_t timeout) {
+    return readWords(devAddr, regAddr, 1, data, timeout);
+}
+
+bool I2Cdev::writeBytes(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data) {
+    (void)devAddr;
+    for (uint8_t i = 0; i < length; i++, regAddr = nextRegister(regAddr)) writeRegister(regAddr, data[i]);
+    return true;
+}
+
+bool I2Cdev::writeByte(uint8_t devAddr, uint8_t regAddr, uint8_t data) {
+    return writeBytes(devAddr, regAddr, 1, &data);
+}
+
+bool I2Cdev::writeBit(uint8_t devAddr, uint8_t regAddr, uint8_t bitNum, uint8_t data) {
+    uint8_t b = readRegister(regAddr);
+    b = (data != 0) ? (b | (1 << bitNum)) : (b & ~(1 << bitNum));
+    return writeByte(devAddr, regAddr, b);
+}
+
+bool I2Cdev::writeBits(uint8_t devAddr, uint8_t regAddr, uint8_t bitStart, uint8_t length, uint8_t data) {
+    uint8_t b = readRegister(regAddr);
+    uint8_t mask = ((1 << length) - 1) << (bitStart - length + 1);
+    data <<= (bitStart - length + 1);
+    return writeByte(devAddr, regAddr, (b & ~mask) | (data & mask));
+}
+
+bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16_t *data) {
+    for (uint8_t i = 0; i < length; i++, regAddr += 2) {
+        uint8_t b[2] = { (uint8_t)(data[i] >> 8), (uint8_t)data[i] };
+        writeBytes(devAddr, regAddr, 2, b);
+    }
+    return true;
+}
+
+bool I2Cdev::writeWord(uint8_t devAddr, uint8_t regAddr, uint16_t data) {
+    return writeWords(devAddr, regAddr, 1, &data);
+}
@@ -0,0 +1,15 @@
+// I2Cdev library collection - MotionApps20 host check
+// I2Cdev on a register model of one MPU6050 instead of the bus.
+
+#ifndef _MOCKI2CDEV_H_
+#define _MOCKI2CDEV_H_
+
+#include <stdint.h>
+#include <deque>
+
+extern std::deque<uint8_t> mockFifo;   // FIFO contents, oldest first
+extern uint32_t mockReads;              // I2Cdev::readBytes() calls, one bus read each
+
+void mockReset();
+
+#endif /* _MOCKI2CDEV_H_ */
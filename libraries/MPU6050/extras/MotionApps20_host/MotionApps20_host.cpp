@@ -0,0 +1,220 @@
+// I2Cdev library collection - MotionApps20 host check
+// Runs the MotionApps 2.0 DMP code of the MPU6050 library on Linux against
+// a register model of the sensor (MockI2Cdev.cpp):
+//   - dmpDecodePacket(DMPSample *) gives exactly what dmpGetQuaternion(),
+//     dmpGetGravity() and dmpGetYawPitchRoll() give
+//   - dmpDecodePacket(DMPSampleInt *) against the float decode: same
+//     quaternion, gravity as dmpGetGravity(int16_t *), angles within the
+//     CORDIC error of the exact atan2 of the integer gravity
+//   - dmpReadFIFOSamples(): burst reads, newest packets, partial packet,
+//     overflow and empty FIFO, for both sample types
+//
+// Usage: MotionApps20_host [orientations]
+// Exit status is 0 when every check passed.
+//
+// Changelog:
+//      2026-10-18 - initial release
+
+#include "MPU6050_6Axis_MotionApps20.h"
+#include "MockI2Cdev.h"
+
+#define PACKET_SIZE     42
+
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("FAILED line %d: %s\n", __LINE__, #cond); failures++; } } while (0)
+
+static uint32_t rndState = 1;
+
+static double rnd() {
+    rndState = rndState * 1664525u + 1013904223u;
+    return (rndState >> 8) / 8388608.0 - 1.0;      // -1 to 1
+}
+
+static void put16(uint8_t *p, int16_t v) {
+    p[0] = (uint16_t)v >> 8;
+    p[1] = (uint16_t)v & 0xFF;
+}
+
+// A MotionApps 2.0 packet with the quaternion in Q30 (the decoders use the upper 16 bits)
+static void makePacket(uint8_t *packet, double w, double x, double y, double z) {
+    memset(packet, 0, PACKET_SIZE);
+    put16(packet + 0, lround(w * 16384));
+    put16(packet + 4, lround(x * 16384));
+    put16(packet + 8, lround(y * 16384));
+    put16(packet + 12, lround(z * 16384));
+}
+
+static void pushPacket(double w, double x, double y, double z) {
+    uint8_t packet[PACKET_SIZE];
+    makePacket(packet, w, x, y, z);
+    mockFifo.insert(mockFifo.end(), packet, packet + PACKET_SIZE);
+}
+
+// Angle difference in degrees, across the +-180 wrap
+static double angleError(double a, double b) {
+    double e = fabs(a - b);
+    return e > 180 ? 360 - e : e;
+}
+
+static double maxYawError, maxPitchError, maxRollError, maxPitchCordic, maxRollCordic;
+static uint32_t compared, decoded;
+
+static void checkDecode(MPU6050 &mpu, const uint8_t *packet) {
+    Quaternion q;
+    VectorFloat gravity;
+    float ypr[3];
+    int16_t gravityInt[3];
+    DMPSample sample;
+    DMPSampleInt sampleInt;
+
+    mpu.dmpGetQuaternion(&q, packet);
+    mpu.dmpGetGravity(&gravity, &q);
+    mpu.dmpGetYawPitchRoll(ypr, &q, &gravity);
+    mpu.dmpGetGravity(gravityInt, packet);
+    mpu.dmpDecodePacket(&sample, packet);
+    mpu.dmpDecodePacket(&sampleInt, packet);
+
+    CHECK(sample.q.w == q.w && sample.q.x == q.x && sample.q.y == q.y && sample.q.z == q.z);
+    CHECK(sample.gravity.x == gravity.x && sample.gravity.y == gravity.y && sample.gravity.z == gravity.z);
+    CHECK(sample.ypr[0] == ypr[0] && sample.ypr[1] == ypr[1] && sample.ypr[2] == ypr[2]);
+
+    CHECK(sampleInt.q[0] == (int16_t)((packet[0] << 8) | packet[1]));
+    CHECK(sampleInt.q[3] == (int16_t)((packet[12] << 8) | packet[13]));
+    CHECK(memcmp(sampleInt.gravity, gravityInt, sizeof(gravityInt)) == 0);
+
+    // Integer angles against the float decode, where the angles are well conditioned: away from
+    // pitch +-90 (gimbal lock: yaw and roll are undefined) and from gz = 0, where pitch folds
+    // over and the gravity rounding picks the side. The check below covers those orientations
+    if (gravityInt[2] * gravityInt[2] + gravityInt[1] * gravityInt[1] >= 256 * 256 && abs(gravityInt[2]) >= 16) {
+        maxYawError = fmax(maxYawError, angleError(sampleInt.ypr[0] / 100.0, ypr[0] * 180 / M_PI));
+        maxPitchError = fmax(maxPitchError, angleError(sampleInt.ypr[1] / 100.0, ypr[1] * 180 / M_PI));
+        maxRollError = fmax(maxRollError, angleError(sampleInt.ypr[2] / 100.0, ypr[2] * 180 / M_PI));
+        compared++;
+    }
+
+    // Pitch and roll against the exact angles of the integer gravity: only the CORDIC error is left
+    double gx = gravityInt[0], gy = gravityInt[1], gz = gravityInt[2];
+    double pitch = atan2(gx, floor(sqrt(gy * gy + gz * gz))) * 180 / M_PI;
+    if (gz < 0) pitch = (pitch > 0 ? 180 : -180) - pitch;
+    double roll = atan2(gy, gz) * 180 / M_PI;
+    maxPitchCordic = fmax(maxPitchCordic, angleError(sampleInt.ypr[1] / 100.0, pitch));
+    maxRollCordic = fmax(maxRollCordic, angleError(sampleInt.ypr[2] / 100.0, roll));
+    decoded++;
+}
+
+static void checkDecoders(MPU6050 &mpu, uint32_t orientations) {
+    static const double corners[][4] = {
+        { 1, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 0, 1, 0 }, { 0, 0, 0, 1 },        // upright, upside down
+        { M_SQRT1_2, 0, M_SQRT1_2, 0 }, { M_SQRT1_2, 0, -M_SQRT1_2, 0 },        // pitch +-90
+        { M_SQRT1_2, M_SQRT1_2, 0, 0 }, { M_SQRT1_2, 0, 0, -M_SQRT1_2 },        // roll 90, yaw 90
+        { 0.5, 0.5, 0.5, 0.5 }, { 0.5, -0.5, 0.5, -0.5 },
+    };
+    uint8_t packet[PACKET_SIZE];
+
+    for (uint8_t i = 0; i < sizeof(corners) / sizeof(corners[0]); i++) {
+        makePacket(packet, corners[i][0], corners[i][1], corners[i][2], corners[i][3]);
+        checkDecode(mpu, packet);
+    }
+    for (uint32_t n = 0; n < orientations; n++) {
+        double w = rnd(), x = rnd(), y = rnd(), z = rnd();
+        double norm = sqrt(w * w + x * x + y * y + z * z);
+        if (norm < 0.01) continue;
+        makePacket(packet, w / norm, x / norm, y / norm, z / norm);
+        checkDecode(mpu, packet);
+    }
+
+    CHECK(maxPitchCordic < 0.02);
+    CHECK(maxRollCordic < 0.02);
+    CHECK(maxYawError < 0.03);       // yaw also goes ill conditioned towards pitch +-90
+    CHECK(maxPitchError < 0.03);     // plus the 1/8192 gravity steps
+    CHECK(maxRollError < 0.3);      // the 1/8192 gravity steps, up to 1/256 of gy and gz here
+    CHECK(compared > decoded * 9 / 10);
+    printf("integer decode  pitch %.3f, roll %.3f degrees max from atan2 of the integer gravity (%u orientations)\n",
+           maxPitchCordic, maxRollCordic, decoded);
+    printf("                yaw %.3f, pitch %.3f, roll %.3f degrees max from the float decode (%u well conditioned)\n",
+           maxYawError, maxPitchError, maxRollError, compared);
+}
+
+// The batched read decodes the same packets as the per packet flow, in order
+template <typename Sample>
+static void checkBatch(MPU6050 &mpu, const char *name) {
+    Sample samples[24];
+    uint8_t packets;
+    int8_t n;
+
+    // 10 packets and the first byte of the next one
+    mockFifo.clear();
+    for (int i = 0; i < 10; i++) pushPacket(1, 0, 0, i * 0.01);
+    mockFifo.push_back(0x40);
+    mockReads = 0;
+    n = mpu.dmpReadFIFOSamples(samples, 24, &packets);
+    CHECK(n == 10 && packets == 10);
+    CHECK(mockReads == 1 + (10 + 2) / 3);     // count, then 126 byte bursts of 3 packets
+    CHECK(mockFifo.size() == 1);
+    for (int i = 0; i < n; i++) {
+        uint8_t packet[PACKET_SIZE];
+        Sample one;
+        makePacket(packet, 1, 0, 0, i * 0.01);
+        mpu.dmpDecodePacket(&one, packet);
+        CHECK(memcmp(&one, &samples[i], sizeof(one)) == 0);
+    }
+    printf("batch           %-6s 10 packets in %u reads\n", name, mockReads);
+
+    // Only the newest is decoded, all are read
+    mockFifo.clear();
+    for (int i = 0; i < 10; i++) pushPacket(1, 0, 0, i * 0.01);
+    n = mpu.dmpReadFIFOSamples(samples, 1, &packets);
+    CHECK(n == 1 && packets == 10 && mockFifo.empty());
+    Sample newest;
+    uint8_t packet[PACKET_SIZE];
+    makePacket(packet, 1, 0, 0, 0.09);
+    mpu.dmpDecodePacket(&newest, packet);
+    CHECK(memcmp(&newest, &samples[0], sizeof(newest)) == 0);
+
+    // Partial packet only
+    mockFifo.assign(PACKET_SIZE - 1, 0);
+    CHECK(mpu.dmpReadFIFOSamples(samples, 24, &packets) == 0 && packets == 0);
+    CHECK(mockFifo.size() == PACKET_SIZE - 1);
+
+    // Overflowed FIFO: reset, nothing decoded
+    mockFifo.clear();
+    for (int i = 0; i < 30; i++) pushPacket(1, 0, 0, 0);
+    CHECK(mpu.dmpReadFIFOSamples(samples, 24, &packets) == -1 && packets == 0);
+    CHECK(mockFifo.empty());
+
+    // Empty, packets optional
+    CHECK(mpu.dmpReadFIFOSamples(samples, 24) == 0);
+}
+
+// Reads the per packet loop of the examples needs for the same FIFO contents
+static uint32_t perPacketReads(MPU6050 &mpu, uint8_t count) {
+    uint8_t packet[PACKET_SIZE];
+    Quaternion q;
+
+    mockFifo.clear();
+    for (int i = 0; i < count; i++) pushPacket(1, 0, 0, 0);
+    mockReads = 0;
+    while (mpu.getFIFOCount() >= mpu.dmpGetFIFOPacketSize()) {
+        mpu.getFIFOBytes(packet, PACKET_SIZE);
+        mpu.dmpGetQuaternion(&q, packet);
+    }
+    return mockReads - 1;   // the final count read finding it empty
+}
+
+int main(int argc, char **argv) {
+    uint32_t orientations = argc > 1 ? strtoul(argv[1], NULL, 0) : 200000;
+    MPU6050 mpu;
+
+    mockReset();
+    CHECK(mpu.dmpInitialize() == 0);        // the DMP code upload verifies against the memory model
+    CHECK(mpu.dmpGetFIFOPacketSize() == PACKET_SIZE);
+
+    checkDecoders(mpu, orientations);
+    checkBatch<DMPSample>(mpu, "float");
+    checkBatch<DMPSampleInt>(mpu, "int");
+    printf("per packet loop 10 packets in %u reads\n", perPacketReads(mpu, 10));
+
+    printf("result          %s (%d failures)\n", failures ? "FAILED" : "ok", failures);
+    return failures ? 1 : 0;
+}
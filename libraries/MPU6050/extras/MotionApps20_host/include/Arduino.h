@@ -0,0 +1,51 @@
+// I2Cdev library collection - MotionApps20 host check
+// Host stand-in for the Arduino core: only what MPU6050.cpp and
+// MPU6050_6Axis_MotionApps20.h use, no output.
+
+#ifndef _MOTIONAPPS20_HOST_ARDUINO_H_
+#define _MOTIONAPPS20_HOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+#define PI 3.1415926535897932384626433832795
+#define DEC 10
+#define HEX 16
+
+// Same as the PROGMEM fallback of MPU6050_6Axis_MotionApps20.h
+#define F(x) x
+#define pgm_read_byte(addr) (*(const unsigned char *)(addr))
+
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+inline char *dtostrf(double val, signed char width, unsigned char prec, char *s) {
+    sprintf(s, "%*.*f", width, prec, val);
+    return s;
+}
+
+unsigned long micros();
+unsigned long millis();
+void delay(unsigned long ms);
+
+class HardwareSerial {
+    public:
+        template <typename T> void print(T) {}
+        template <typename T> void print(T, int) {}
+        template <typename T> void println(T) {}
+        template <typename T> void println(T, int) {}
+        void println() {}
+        template <typename T> void write(T) {}
+};
+
+extern HardwareSerial Serial;
+
+#endif /* _MOTIONAPPS20_HOST_ARDUINO_H_ */
@@ -0,0 +1,9 @@
+// I2Cdev library collection - MotionApps20 host check
+// The bus is replaced by the register model in MockI2Cdev.cpp, only the buffer size is needed.
+
+#ifndef _MOTIONAPPS20_HOST_WIRE_H_
+#define _MOTIONAPPS20_HOST_WIRE_H_
+
+#define BUFFER_LENGTH 32
+
+#endif /* _MOTIONAPPS20_HOST_WIRE_H_ */
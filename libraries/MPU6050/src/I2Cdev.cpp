@@ -3,6 +3,7 @@
 // 2013-06-05 by Jeff Rowberg <jeff@rowberg.net>
 //
 // Changelog:
+//      2026-10-18 - add I2Cdev::transfer() backend for the asynchronous I2CdevQueue
 //		2022-01-27 - workaround for the ESP32 Wire implementation (mcpicoli)
 //      2013-05-06 - add Francesco Ferrara's Fastwire v0.24 implementation with small modifications
 //      2013-05-05 - fix issue with writing bit values to words (Sasquatch/Farzanegan)
@@ -709,6 +710,16 @@ bool I2Cdev::writeWords(uint8_t devAddr, uint8_t regAddr, uint8_t length, uint16
     return status == 0;
 }
 
+/** Run one queued transaction on the bus, the I2CdevQueue backend for real hardware.
+ * Blocking: call it from the context servicing the queue (e.g. I2CdevQueue::beginTask()).
+ * @param t Transaction to run
+ * @return Number of bytes transferred (-1 indicates failure)
+ */
+int8_t I2Cdev::transfer(I2CdevTransaction *t) {
+    if (t->direction == I2CDEV_READ) return readBytes(t->devAddr, t->regAddr, t->length, t->data);
+    return writeBytes(t->devAddr, t->regAddr, t->length, t->data) ? t->length : -1;
+}
+
 /** Default timeout value for read operations.
  * Set this to 0 to disable timeout detection.
  */
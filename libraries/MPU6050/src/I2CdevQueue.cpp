@@ -0,0 +1,150 @@
+// I2Cdev library collection - Asynchronous I2C transaction queue
+// Lets the caller start a transfer and keep computing while the bus is busy
+//
+// Changelog:
+//      2026-10-18 - refuse transfers longer than I2CDEV_MAX_LENGTH
+//      2026-10-18 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#include "I2CdevQueue.h"
+
+#if (I2CDEV_QUEUE_LENGTH & (I2CDEV_QUEUE_LENGTH - 1)) != 0 || I2CDEV_QUEUE_LENGTH > 128
+    #error I2CDEV_QUEUE_LENGTH must be a power of two up to 128
+#endif
+
+// Orders the descriptor accesses against the index that publishes them (other core or task)
+#define I2CDEV_QUEUE_BARRIER()  __sync_synchronize()
+
+/** Create an empty queue.
+ * @param bus Backend running one transaction and returning its status
+ */
+I2CdevQueue::I2CdevQueue(Bus bus) : bus(bus), head(0), tail(0) {
+    #ifdef ARDUINO_ARCH_ESP32
+        task = NULL;
+    #endif
+}
+
+/** Queue a filled in transaction descriptor (producer side).
+ * @param t Transaction, must stay valid until done
+ * @return Status of operation (false = queue full or length over I2CDEV_MAX_LENGTH, nothing queued)
+ */
+bool I2CdevQueue::submit(I2CdevTransaction *t) {
+    if (t->length > I2CDEV_MAX_LENGTH) return false;
+    uint8_t h = head;
+    if ((uint8_t)(h - tail) == I2CDEV_QUEUE_LENGTH) return false;
+    t->status = I2CDEV_PENDING;
+    ring[h & (I2CDEV_QUEUE_LENGTH - 1)] = t;
+    I2CDEV_QUEUE_BARRIER();     // descriptor visible before the consumer sees the new head
+    head = h + 1;
+    #ifdef ARDUINO_ARCH_ESP32
+        if (task != NULL) xTaskNotifyGive(task);
+    #endif
+    return true;
+}
+
+/** Queue a read of multiple bytes from an 8-bit device register.
+ * @param t Transaction descriptor to fill in, must stay valid until done
+ * @param devAddr I2C slave device address
+ * @param regAddr First register regAddr to read from
+ * @param length Number of bytes to read (up to I2CDEV_MAX_LENGTH)
+ * @param data Buffer to store read data in
+ * @param callback Optional completion callback
+ * @return Status of operation (false = queue full or length too long)
+ */
+bool I2CdevQueue::read(I2CdevTransaction *t, uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void (*callback)(I2CdevTransaction *t)) {
+    t->devAddr = devAddr;
+    t->regAddr = regAddr;
+    t->length = length;
+    t->direction = I2CDEV_READ;
+    t->data = data;
+    t->callback = callback;
+    return submit(t);
+}
+
+/** Queue a write of multiple bytes to an 8-bit device register.
+ * The data is not copied: the buffer must stay unchanged until done.
+ * @param t Transaction descriptor to fill in, must stay valid until done
+ * @param devAddr I2C slave device address
+ * @param regAddr First register address to write to
+ * @param length Number of bytes to write (up to I2CDEV_MAX_LENGTH)
+ * @param data Buffer to copy new data from
+ * @param callback Optional completion callback
+ * @return Status of operation (false = queue full or length too long)
+ */
+bool I2CdevQueue::write(I2CdevTransaction *t, uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void (*callback)(I2CdevTransaction *t)) {
+    t->devAddr = devAddr;
+    t->regAddr = regAddr;
+    t->length = length;
+    t->direction = I2CDEV_WRITE;
+    t->data = data;
+    t->callback = callback;
+    return submit(t);
+}
+
+/** Run pending transactions on the bus, oldest first (consumer side).
+ * Callbacks are called from here, after the status is set.
+ * @param max Maximum number of transactions to run
+ * @return Number of transactions run
+ */
+uint8_t I2CdevQueue::service(uint8_t max) {
+    uint8_t count = 0;
+    uint8_t t0 = tail;
+    while (count < max && t0 != head) {
+        I2CDEV_QUEUE_BARRIER(); // read the descriptor after the head that published it
+        I2CdevTransaction *t = ring[t0 & (I2CDEV_QUEUE_LENGTH - 1)];
+        int8_t status = bus(t);
+        void (*callback)(I2CdevTransaction *t) = t->callback;
+        I2CDEV_QUEUE_BARRIER(); // data in place before the status says done
+        t->status = status;
+        tail = ++t0;            // the slot is free, the descriptor belongs to the caller again
+        count++;
+        if (callback != NULL) callback(t);
+    }
+    return count;
+}
+
+#ifdef ARDUINO_ARCH_ESP32
+/** Service the queue from a FreeRTOS task, so transfers run while the
+ * submitting core computes. The task sleeps while the queue is empty.
+ * Once started, the bus must only be used through this queue.
+ * @param core Core to pin the task to
+ * @param priority Task priority
+ * @param stackSize Task stack in bytes (callbacks run on it)
+ * @return Status of operation (true = task running)
+ */
+bool I2CdevQueue::beginTask(BaseType_t core, UBaseType_t priority, uint32_t stackSize) {
+    if (task != NULL) return true;
+    return xTaskCreatePinnedToCore(taskMain, "i2cdev", stackSize, this, priority, &task, core) == pdPASS;
+}
+
+void I2CdevQueue::taskMain(void *queue) {
+    I2CdevQueue *q = (I2CdevQueue *)queue;
+    for (;;) {
+        // A submit() between the empty check and the wait leaves a notification, so none is lost
+        if (q->service() == 0) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+}
+#endif
@@ -0,0 +1,108 @@
+// I2Cdev library collection - Asynchronous I2C transaction queue
+// Lets the caller start a transfer and keep computing while the bus is busy
+//
+// Changelog:
+//      2026-10-18 - add I2CDEV_MAX_LENGTH
+//      2026-10-18 - initial release
+
+/* ============================================
+I2Cdev device library code is placed under the MIT license
+Copyright (c) 2013 Jeff Rowberg
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+===============================================
+*/
+
+#ifndef _I2CDEVQUEUE_H_
+#define _I2CDEVQUEUE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef ARDUINO_ARCH_ESP32
+    #include <freertos/FreeRTOS.h>
+    #include <freertos/task.h>
+#endif
+
+// Pending transactions, must be a power of two
+#define I2CDEV_QUEUE_LENGTH     8
+
+// Transaction status while it waits in the queue or runs on the bus
+#define I2CDEV_PENDING          -2
+
+// Longest transfer: the status has to hold the byte count
+#define I2CDEV_MAX_LENGTH       127
+
+#define I2CDEV_READ             0
+#define I2CDEV_WRITE            1
+
+/** Transaction descriptor.
+ * Owned by the caller and used as the handle: it must stay valid until the
+ * transaction is done. status is I2CDEV_PENDING until then, afterwards the
+ * number of bytes transferred (-1 indicates failure), as I2Cdev::readBytes().
+ */
+struct I2CdevTransaction {
+    uint8_t devAddr;
+    uint8_t regAddr;
+    uint8_t length;             // up to I2CDEV_MAX_LENGTH
+    uint8_t direction;          // I2CDEV_READ or I2CDEV_WRITE
+    uint8_t *data;
+    void (*callback)(I2CdevTransaction *t);    // optional, called by the servicing context when done (status set);
+                                               // a descriptor with a callback is only reused once the callback returned
+    void *arg;                  // free for the callback
+    volatile int8_t status;
+};
+
+/** Fixed size queue of pending transactions.
+ * Single producer (the code calling submit()) and single consumer (the code
+ * calling service()), lock-free: each side only writes its own index.
+ * The consumer runs the transactions in order on a bus backend: I2Cdev::transfer
+ * for the real bus, or a mock on the host.
+ */
+class I2CdevQueue {
+    public:
+        typedef int8_t (*Bus)(I2CdevTransaction *t);
+
+        I2CdevQueue(Bus bus);
+
+        bool submit(I2CdevTransaction *t);
+        bool read(I2CdevTransaction *t, uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void (*callback)(I2CdevTransaction *t)=NULL);
+        bool write(I2CdevTransaction *t, uint8_t devAddr, uint8_t regAddr, uint8_t length, uint8_t *data, void (*callback)(I2CdevTransaction *t)=NULL);
+        static bool done(const I2CdevTransaction *t) { return t->status != I2CDEV_PENDING; }
+
+        uint8_t service(uint8_t max=I2CDEV_QUEUE_LENGTH);
+        uint8_t pending() const { return (uint8_t)(head - tail); }
+
+        #ifdef ARDUINO_ARCH_ESP32
+            bool beginTask(BaseType_t core, UBaseType_t priority, uint32_t stackSize=2048);
+        #endif
+
+    private:
+        Bus bus;
+        I2CdevTransaction *ring[I2CDEV_QUEUE_LENGTH];
+        volatile uint8_t head;  // written by the producer only
+        volatile uint8_t tail;  // written by the consumer only
+
+        #ifdef ARDUINO_ARCH_ESP32
+            TaskHandle_t task;
+            static void taskMain(void *queue);
+        #endif
+};
+
+#endif /* _I2CDEVQUEUE_H_ */
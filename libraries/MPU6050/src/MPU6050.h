@@ -573,6 +573,27 @@ namespace MPU6050_IMU{
 
 // note: DMP code memory blocks defined at end of header file
 
+#ifdef MPU6050_INCLUDE_DMP_MOTIONAPPS20
+/** One decoded MotionApps 2.0 packet, see MPU6050::dmpReadFIFOSamples().
+ * Same values as dmpGetQuaternion(), dmpGetGravity() and dmpGetYawPitchRoll().
+ */
+struct DMPSample {
+    Quaternion q;
+    VectorFloat gravity;
+    float ypr[3];           // yaw, pitch, roll in radians
+};
+
+/** Integer decode of a MotionApps 2.0 packet, no floating point.
+ * Quaternion in Q14 (16384 = 1.0), gravity with 8192 = 1g (as dmpGetGravity(int16_t *)),
+ * yaw, pitch, roll in hundredths of a degree.
+ */
+struct DMPSampleInt {
+    int16_t q[4];
+    int16_t gravity[3];
+    int16_t ypr[3];
+};
+#endif
+
 class MPU6050 {
     public:
         MPU6050(uint8_t address=(MPU6050_IMU::MPU6050_DEFAULT_ADDRESS));
@@ -1067,6 +1088,12 @@ class MPU6050 {
             void dmpOverrideQuaternion(long *q);
             uint16_t dmpGetFIFOPacketSize();
             uint8_t dmpGetCurrentFIFOPacket(uint8_t *data); // overflow proof
+
+            // Batched FIFO read: every complete packet in few I2C reads, decoded in one pass
+            uint8_t dmpDecodePacket(DMPSample *sample, const uint8_t *packet);
+            uint8_t dmpDecodePacket(DMPSampleInt *sample, const uint8_t *packet);
+            int8_t dmpReadFIFOSamples(DMPSample *samples, uint8_t maxSamples, uint8_t *packets=NULL);
+            int8_t dmpReadFIFOSamples(DMPSampleInt *samples, uint8_t maxSamples, uint8_t *packets=NULL);
         #endif
 
         // special methods for MotionApps 4.1 implementation
@@ -1176,6 +1203,9 @@ class MPU6050 {
         uint8_t *dmpPacketBuffer;
         uint16_t dmpPacketSize;
     #endif
+    #ifdef MPU6050_INCLUDE_DMP_MOTIONAPPS20
+        template <typename Sample> int8_t dmpReadFIFOSamplesT(Sample *samples, uint8_t maxSamples, uint8_t *packets);
+    #endif
 };
 
 #endif /* _MPU6050_H_ */
@@ -6,6 +6,8 @@
 // Changelog:
 // 2019/07/08 - merged all DMP Firmware configuration items into the dmpMemory array
 //            - Simplified dmpInitialize() to accomidate the dmpmemory array alterations
+// 2026/10/18 - added dmpReadFIFOSamples(): drain all complete packets in few I2C reads, decode
+//              quaternion, gravity and yaw/pitch/roll in one pass, with a float-free variant
 //     ... - ongoing debug release
 
 /* ============================================
@@ -121,6 +123,11 @@ THE SOFTWARE.
 #define MPU6050_DMP_CONFIG_SIZE     192     // dmpConfig[]
 #define MPU6050_DMP_UPDATES_SIZE    47      // dmpUpdates[]
 
+// Bytes per getFIFOBytes() in dmpReadFIFOSamples(): 3 default packets, and I2Cdev::readBytes()
+// counts the bytes in an int8_t (it splits the read into BUFFER_LENGTH transfers itself)
+#define MPU6050_DMP_FIFO_BURST      126
+#define MPU6050_DMP_FIFO_SIZE       1024    // a full FIFO has overflowed: the packets are no longer aligned
+
 /* ================================================================================================ *
  | Default MotionApps v2.0 42-byte FIFO packet structure:                                           |
  |                                                                                                  |
@@ -620,4 +627,142 @@ uint8_t MPU6050::dmpGetCurrentFIFOPacket(uint8_t *data) { // overflow proof
     return(GetCurrentFIFOPacket(data, dmpPacketSize));
 }
 
+/** Decode one packet into a DMPSample: the quaternion is read once, gravity and
+ * yaw/pitch/roll are computed from it as dmpGetGravity() and dmpGetYawPitchRoll() do.
+ * @param sample Decoded values
+ * @param packet Default (42 byte) MotionApps 2.0 packet
+ * @return 0
+ */
+uint8_t MPU6050::dmpDecodePacket(DMPSample *sample, const uint8_t *packet) {
+    dmpGetQuaternion(&sample -> q, packet);
+    dmpGetGravity(&sample -> gravity, &sample -> q);
+    dmpGetYawPitchRoll(sample -> ypr, &sample -> q, &sample -> gravity);
+    return 0;
+}
+
+/** Integer square root, floor(sqrt(v)). */
+static uint16_t dmpSqrtInt(uint32_t v) {
+    uint32_t root = 0, bit = 1UL << 30;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= root + bit) {
+            v -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+/** atan2(y, x) in hundredths of a degree, -18000..18000, without floating point.
+ * CORDIC in vectoring mode, 15 iterations (0.004 degree), angles kept in 1/1600 degree.
+ * |x| and |y| must stay below 2^22.
+ */
+static int16_t dmpAtan2Int(int32_t y, int32_t x) {
+    static const int32_t atanTable[15] = { 72000, 42504, 22458, 11400, 5722, 2864, 1432, 716, 358, 179, 90, 45, 22, 11, 6 };
+    int32_t angle = 0;
+    if (x == 0 && y == 0) return 0;
+    // scale up small vectors for the resolution of the last iterations
+    while (x < (1L << 21) && x > -(1L << 21) && y < (1L << 21) && y > -(1L << 21)) {
+        x <<= 1;
+        y <<= 1;
+    }
+    if (x < 0) { // rotate by 180 degrees into the right half plane
+        angle = y >= 0 ? 288000L : -288000L;
+        x = -x;
+        y = -y;
+    }
+    for (uint8_t i = 0; i < 15; i++) {
+        int32_t xi = x >> i;
+        if (y > 0) {
+            x += y >> i;
+            y -= xi;
+            angle += atanTable[i];
+        } else {
+            x -= y >> i;
+            y += xi;
+            angle -= atanTable[i];
+        }
+    }
+    if (angle > 288000L) angle -= 576000L;
+    else if (angle < -288000L) angle += 576000L;
+    return (angle + (angle >= 0 ? 8 : -8)) / 16;
+}
+
+/** Decode one packet into a DMPSampleInt, integer arithmetic only. Same formulas as
+ * dmpGetGravity(int16_t *) and dmpGetYawPitchRoll().
+ * @param sample Decoded values
+ * @param packet Default (42 byte) MotionApps 2.0 packet
+ * @return 0
+ */
+uint8_t MPU6050::dmpDecodePacket(DMPSampleInt *sample, const uint8_t *packet) {
+    int16_t *q = sample -> q;
+    int16_t *g = sample -> gravity;
+    q[0] = (packet[0] << 8) | packet[1];
+    q[1] = (packet[4] << 8) | packet[5];
+    q[2] = (packet[8] << 8) | packet[9];
+    q[3] = (packet[12] << 8) | packet[13];
+    g[0] = ((int32_t)q[1] * q[3] - (int32_t)q[0] * q[2]) / 16384;
+    g[1] = ((int32_t)q[0] * q[1] + (int32_t)q[2] * q[3]) / 16384;
+    g[2] = ((int32_t)q[0] * q[0] - (int32_t)q[1] * q[1]
+           - (int32_t)q[2] * q[2] + (int32_t)q[3] * q[3]) / (2 * 16384);
+    // yaw: atan2(2xy - 2wz, 2ww + 2xx - 1), both halved and in Q21
+    sample -> ypr[0] = dmpAtan2Int(((int32_t)q[1] * q[2] - (int32_t)q[0] * q[3]) >> 7,
+                                   (((int32_t)q[0] * q[0] + (int32_t)q[1] * q[1]) >> 7) - (1L << 20));
+    // pitch: atan2(gx, sqrt(gy^2 + gz^2)), folded when upside down
+    sample -> ypr[1] = dmpAtan2Int(g[0], dmpSqrtInt((int32_t)g[1] * g[1] + (int32_t)g[2] * g[2]));
+    // roll: atan2(gy, gz)
+    sample -> ypr[2] = dmpAtan2Int(g[1], g[2]);
+    if (g[2] < 0) {
+        if (sample -> ypr[1] > 0) sample -> ypr[1] = 18000 - sample -> ypr[1];
+        else sample -> ypr[1] = -18000 - sample -> ypr[1];
+    }
+    return 0;
+}
+
+/** Read every complete packet in the FIFO and decode the newest ones.
+ * The FIFO count is read once, then the packets are read MPU6050_DMP_FIFO_BURST bytes at a
+ * time; only the newest maxSamples packets are decoded, the older ones are read and
+ * dropped. Calling this once per loop() keeps the FIFO empty however long the loop took
+ * (up to the FIFO size: 24 packets).
+ * @param samples Decoded packets, oldest first
+ * @param maxSamples Size of samples; 1 returns the newest packet only
+ * @param packets If not NULL, number of packets read from the FIFO
+ * @return Number of samples decoded, 0 if no complete packet was there, -1 if the FIFO
+ *         had overflowed (it is reset, the next packets come at the DMP rate)
+ */
+int8_t MPU6050::dmpReadFIFOSamples(DMPSample *samples, uint8_t maxSamples, uint8_t *packets) {
+    return dmpReadFIFOSamplesT(samples, maxSamples, packets);
+}
+int8_t MPU6050::dmpReadFIFOSamples(DMPSampleInt *samples, uint8_t maxSamples, uint8_t *packets) {
+    return dmpReadFIFOSamplesT(samples, maxSamples, packets);
+}
+
+template <typename Sample>
+int8_t MPU6050::dmpReadFIFOSamplesT(Sample *samples, uint8_t maxSamples, uint8_t *packets) {
+    uint8_t burst[MPU6050_DMP_FIFO_BURST];
+    uint8_t perRead = MPU6050_DMP_FIFO_BURST / dmpPacketSize;
+    uint16_t fifoCount = getFIFOCount();
+    uint8_t available, skip, decoded = 0;
+
+    if (packets != 0) *packets = 0;
+    if (fifoCount >= MPU6050_DMP_FIFO_SIZE) {
+        resetFIFO();
+        return -1;
+    }
+    available = fifoCount / dmpPacketSize;
+    skip = available > maxSamples ? available - maxSamples : 0;
+    for (uint8_t done = 0; done < available; ) {
+        uint8_t n = min(perRead, (uint8_t)(available - done));
+        getFIFOBytes(burst, n * dmpPacketSize);
+        for (uint8_t k = 0; k < n; k++, done++) {
+            if (done >= skip) dmpDecodePacket(&samples[decoded++], burst + k * dmpPacketSize);
+        }
+    }
+    if (packets != 0) *packets = available;
+    return decoded;
+}
+
 #endif /* _MPU6050_6AXIS_MOTIONAPPS20_H_ */
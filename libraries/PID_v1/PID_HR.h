@@ -0,0 +1,247 @@
+#ifndef PID_HR_h
+#define PID_HR_h
+
+/**********************************************************************************************
+ * Arduino PID Library - high rate variant
+ *
+ * Same controller as PID_v1 (error on P and I, derivative on measurement), for loops
+ * running at hundreds of Hz up to tens of kHz:
+ *   - sample period in microseconds, scheduled with micros()
+ *   - first order low pass filter on the derivative term
+ *   - anti-windup clamping: the integral stops growing while the output is saturated
+ *   - template on the number type: float, double, or a fixed point class with
+ *     T(double), +, -, * and comparisons (e.g. Q16_16)
+ *   - N controllers sharing one sample period, stored as structure of arrays and
+ *     updated by ComputeMany() in one pass (balance + steering + position...)
+ *
+ * Inputs and outputs are passed by value/array at each call instead of linked pointers.
+ * The tunings are scaled by the sample period when they are set (as PID_v1 does), so a
+ * Compute has no division. In fixed point keep Ki*SampleTime and Kd/SampleTime within
+ * the range and resolution of T.
+ *
+ * This Library is licensed under a GPLv3 License
+ **********************************************************************************************/
+
+#if ARDUINO >= 100
+  #include "Arduino.h"
+#else
+  #include "WProgram.h"
+#endif
+
+#include <PID_v1.h>      // AUTOMATIC, MANUAL, DIRECT, REVERSE
+
+template <typename T, uint8_t N = 1>
+class PID_HR
+{
+  public:
+
+  //commonly used functions **************************************************************************
+    PID_HR(unsigned long SampleTimeUs);    // * all controllers start with zero tunings, output
+                                          //   limits 0-255, DIRECT, no derivative filter, MANUAL
+
+    void SetTunings(uint8_t i, double Kp, double Ki, double Kd);  // * per second units, like PID_v1
+    void SetOutputLimits(uint8_t i, double Min, double Max);
+    void SetControllerDirection(uint8_t i, int Direction);
+    void SetDerivativeFilter(uint8_t i, double Alpha);     // * dTerm = Alpha*dTerm + (1-Alpha)*new,
+                                                           //   0 (no filter) to <1
+    void SetSampleTime(unsigned long NewSampleTimeUs);     // * rescales the tunings
+
+    void SetMode(int Mode, const T *Input, const T *Output);  // * MANUAL to AUTOMATIC is bumpless
+                                                           //   from the current inputs and outputs
+
+    bool Compute(const T *Input, const T *Setpoint, T *Output);  // * call from loop(): runs ComputeMany()
+                                                           //   when a sample period elapsed, returns true then
+
+    void ComputeMany(const T *Input, const T *Setpoint, T *Output);  // * one update of all N controllers,
+                                                           //   for callers with their own timing (timer, IMU interrupt)
+
+    void Initialize(uint8_t i, T Input, T Output);         // * restart controller i from Output
+
+  //Display functions ****************************************************************
+    double GetKp(uint8_t i) { return dispKp[i]; }
+    double GetKi(uint8_t i) { return dispKi[i]; }
+    double GetKd(uint8_t i) { return dispKd[i]; }
+    int GetMode() { return inAuto ? AUTOMATIC : MANUAL; }
+    int GetDirection(uint8_t i) { return direction[i]; }
+    unsigned long GetSampleTime() { return sampleTime; }
+
+  private:
+    void ScaleTunings(uint8_t i);
+
+    // Hot state, one array per field: ComputeMany() walks them in order
+    T kp[N], ki[N], kd[N];        // scaled by the sample period and signed by the direction
+    T alpha[N], beta[N];          // derivative filter, beta = 1 - alpha
+    T iTerm[N], lastInput[N], dTerm[N];
+    T outMin[N], outMax[N];
+
+    double dispKp[N], dispKi[N], dispKd[N];
+    int direction[N];
+
+    unsigned long sampleTime;     // us
+    unsigned long lastTime;
+    bool inAuto;
+};
+
+/*Constructor (...)*********************************************************/
+template <typename T, uint8_t N>
+PID_HR<T, N>::PID_HR(unsigned long SampleTimeUs)
+{
+   sampleTime = SampleTimeUs > 0 ? SampleTimeUs : 1;
+   inAuto = false;
+   for (uint8_t i = 0; i < N; i++)
+   {
+      direction[i] = DIRECT;
+      outMin[i] = T(0.0);
+      outMax[i] = T(255.0);
+      SetTunings(i, 0, 0, 0);
+      SetDerivativeFilter(i, 0);
+      iTerm[i] = lastInput[i] = dTerm[i] = T(0.0);
+   }
+   lastTime = micros() - sampleTime;
+}
+
+/* Compute() **********************************************************************
+ *   The period is kept on the micros() grid: a late call does not shift the next
+ *   samples, unless more than a whole period was lost (then it restarts from now).
+ **********************************************************************************/
+template <typename T, uint8_t N>
+bool PID_HR<T, N>::Compute(const T *Input, const T *Setpoint, T *Output)
+{
+   if(!inAuto) return false;
+   unsigned long now = micros();
+   if(now - lastTime < sampleTime) return false;
+   lastTime += sampleTime;
+   if(now - lastTime >= sampleTime) lastTime = now;
+   ComputeMany(Input, Setpoint, Output);
+   return true;
+}
+
+/* ComputeMany() ******************************************************************
+ *   One pass over the N controllers, no branch on the controller index, no division.
+ *   Anti-windup: the integral is clamped to the output limits, and the step just
+ *   added is taken back if the output saturates in the same direction.
+ **********************************************************************************/
+template <typename T, uint8_t N>
+void PID_HR<T, N>::ComputeMany(const T *Input, const T *Setpoint, T *Output)
+{
+   for (uint8_t i = 0; i < N; i++)
+   {
+      T input = Input[i];
+      T error = Setpoint[i] - input;
+      T iStep = ki[i] * error;
+      T iNew = iTerm[i] + iStep;
+      if(iNew > outMax[i]) iNew = outMax[i];
+      else if(iNew < outMin[i]) iNew = outMin[i];
+
+      /*Derivative on measurement, low pass filtered*/
+      dTerm[i] = alpha[i] * dTerm[i] - beta[i] * kd[i] * (input - lastInput[i]);
+      lastInput[i] = input;
+
+      T output = kp[i] * error + iNew + dTerm[i];
+      if(output > outMax[i])
+      {
+         output = outMax[i];
+         if(iStep > T(0.0)) iNew = iTerm[i];
+      }
+      else if(output < outMin[i])
+      {
+         output = outMin[i];
+         if(iStep < T(0.0)) iNew = iTerm[i];
+      }
+      iTerm[i] = iNew;
+      Output[i] = output;
+   }
+}
+
+/* SetTunings(...)*************************************************************
+ * Gains in per second units. Negative gains are refused, as in PID_v1.
+ ******************************************************************************/
+template <typename T, uint8_t N>
+void PID_HR<T, N>::SetTunings(uint8_t i, double Kp, double Ki, double Kd)
+{
+   if (i >= N || Kp<0 || Ki<0 || Kd<0) return;
+   dispKp[i] = Kp; dispKi[i] = Ki; dispKd[i] = Kd;
+   ScaleTunings(i);
+}
+
+template <typename T, uint8_t N>
+void PID_HR<T, N>::ScaleTunings(uint8_t i)
+{
+   double SampleTimeInSec = sampleTime * 0.000001;
+   double sign = direction[i] == REVERSE ? -1.0 : 1.0;
+   kp[i] = T(sign * dispKp[i]);
+   ki[i] = T(sign * dispKi[i] * SampleTimeInSec);
+   kd[i] = T(sign * dispKd[i] / SampleTimeInSec);
+}
+
+/* SetSampleTime(...) *********************************************************
+ * sets the period, in Microseconds, at which the calculation is performed
+ ******************************************************************************/
+template <typename T, uint8_t N>
+void PID_HR<T, N>::SetSampleTime(unsigned long NewSampleTimeUs)
+{
+   if (NewSampleTimeUs == 0) return;
+   sampleTime = NewSampleTimeUs;
+   for (uint8_t i = 0; i < N; i++) ScaleTunings(i);
+}
+
+/* SetOutputLimits(...)****************************************************/
+template <typename T, uint8_t N>
+void PID_HR<T, N>::SetOutputLimits(uint8_t i, double Min, double Max)
+{
+   if(i >= N || Min >= Max) return;
+   outMin[i] = T(Min);
+   outMax[i] = T(Max);
+   if(iTerm[i] > outMax[i]) iTerm[i] = outMax[i];
+   else if(iTerm[i] < outMin[i]) iTerm[i] = outMin[i];
+}
+
+/* SetControllerDirection(...)*************************************************/
+template <typename T, uint8_t N>
+void PID_HR<T, N>::SetControllerDirection(uint8_t i, int Direction)
+{
+   if (i >= N) return;
+   direction[i] = Direction;
+   ScaleTunings(i);
+}
+
+/* SetDerivativeFilter(...)****************************************************
+ * Alpha 0 disables the filter. The time constant is about
+ * SampleTime / (1 - Alpha): the faster the loop, the closer to 1.
+ ******************************************************************************/
+template <typename T, uint8_t N>
+void PID_HR<T, N>::SetDerivativeFilter(uint8_t i, double Alpha)
+{
+   if (i >= N || Alpha < 0 || Alpha >= 1) return;
+   alpha[i] = T(Alpha);
+   beta[i] = T(1.0 - Alpha);
+}
+
+/* SetMode(...)****************************************************************/
+template <typename T, uint8_t N>
+void PID_HR<T, N>::SetMode(int Mode, const T *Input, const T *Output)
+{
+   bool newAuto = (Mode == AUTOMATIC);
+   if(newAuto && !inAuto)
+   {  /*we just went from manual to auto*/
+      for (uint8_t i = 0; i < N; i++) Initialize(i, Input[i], Output[i]);
+      lastTime = micros() - sampleTime;
+   }
+   inAuto = newAuto;
+}
+
+/* Initialize()****************************************************************
+ * bumpless transfer: the integral takes the current output, no derivative kick
+ ******************************************************************************/
+template <typename T, uint8_t N>
+void PID_HR<T, N>::Initialize(uint8_t i, T Input, T Output)
+{
+   if (i >= N) return;
+   iTerm[i] = Output;
+   lastInput[i] = Input;
+   dTerm[i] = T(0.0);
+   if(iTerm[i] > outMax[i]) iTerm[i] = outMax[i];
+   else if(iTerm[i] < outMin[i]) iTerm[i] = outMin[i];
+}
+
+#endif
@@ -0,0 +1,48 @@
+/********************************************************
+ * PID_HR Basic Example
+ * Two controllers sharing a 1kHz sample period:
+ * analog inputs 0 and 1 control PWM outputs 3 and 5
+ ********************************************************/
+
+#include <PID_HR.h>
+
+#define PIN_INPUT1 0
+#define PIN_INPUT2 1
+#define PIN_OUTPUT1 3
+#define PIN_OUTPUT2 5
+
+//Define Variables, one entry per controller
+float Setpoint[2], Input[2], Output[2];
+
+//Two float controllers, 1000us sample period
+PID_HR<float, 2> myPID(1000);
+
+void setup()
+{
+  //initialize the inputs and setpoints
+  Input[0] = analogRead(PIN_INPUT1);
+  Input[1] = analogRead(PIN_INPUT2);
+  Setpoint[0] = 100;
+  Setpoint[1] = 300;
+
+  //same tunings for both, a light filter on the derivative
+  for (uint8_t i = 0; i < 2; i++)
+  {
+    myPID.SetTunings(i, 2, 5, 0.01);
+    myPID.SetDerivativeFilter(i, 0.8);
+  }
+
+  //turn the PIDs on
+  myPID.SetMode(AUTOMATIC, Input, Output);
+}
+
+void loop()
+{
+  Input[0] = analogRead(PIN_INPUT1);
+  Input[1] = analogRead(PIN_INPUT2);
+  if (myPID.Compute(Input, Setpoint, Output))
+  {
+    analogWrite(PIN_OUTPUT1, Output[0]);
+    analogWrite(PIN_OUTPUT2, Output[1]);
+  }
+}
@@ -0,0 +1,229 @@
+/**********************************************************************************************
+ * PID_HR host check
+ *
+ * Runs PID_HR with float, double and Q16_16 against a simulated first order plant at 1kHz:
+ *   - every controller of a PID_HR<T, 3> settles on its own setpoint
+ *   - the fixed point trajectory stays close to the double one
+ *   - anti-windup: the output leaves saturation on the first sample after the setpoint
+ *     comes back into reach
+ *   - REVERSE direction, bumpless MANUAL to AUTOMATIC, and the micros() grid of Compute()
+ *
+ * Usage: PID_HR_host
+ * Exit status is 0 when every check passed.
+ **********************************************************************************************/
+
+#include <stdio.h>
+#include <math.h>
+#include <Arduino.h>
+#include <Q16_16.h>
+#include <PID_HR.h>
+
+unsigned long hostUs;
+
+static int failures;
+
+#define CHECK(cond) do { if (!(cond)) { printf("FAILED line %d: %s\n", __LINE__, #cond); failures++; } } while (0)
+
+#define SAMPLE_US   1000
+#define PLANT_TAU   0.05        // s
+
+static double toDouble(float v) { return v; }
+static double toDouble(double v) { return v; }
+static double toDouble(Q16_16 v) { return (float)v; }
+
+/* One sample of y' = (gain * u - y) / tau, integrated in double whatever T is,
+ * so the number types only differ in the controller */
+static double plant(double y, double u, double gain)
+{
+   return y + (gain * u - y) * (SAMPLE_US * 0.000001 / PLANT_TAU);
+}
+
+struct Trace
+{
+   double y[3][3000];
+};
+
+/* Three controllers with one sample period: settling on different setpoints */
+template <typename T>
+static void checkSettling(const char *name, double tolerance, Trace *trace)
+{
+   static const double setpoints[3] = { 10.0, -5.0, 50.0 };
+   PID_HR<T, 3> pid(SAMPLE_US);
+   T input[3], setpoint[3], output[3];
+   double y[3] = { 0, 0, 0 };
+
+   for (uint8_t i = 0; i < 3; i++)
+   {
+      pid.SetTunings(i, 2.0, 20.0, 0.01);
+      pid.SetOutputLimits(i, -100, 100);
+      pid.SetDerivativeFilter(i, 0.5);
+      input[i] = T(0.0);
+      output[i] = T(0.0);
+      setpoint[i] = T(setpoints[i]);
+   }
+   pid.SetMode(AUTOMATIC, input, output);
+
+   for (int k = 0; k < 3000; k++)
+   {
+      pid.ComputeMany(input, setpoint, output);
+      for (uint8_t i = 0; i < 3; i++)
+      {
+         y[i] = plant(y[i], toDouble(output[i]), 1.0);
+         input[i] = T(y[i]);
+         trace->y[i][k] = y[i];
+      }
+   }
+
+   for (uint8_t i = 0; i < 3; i++)
+   {
+      CHECK(fabs(y[i] - setpoints[i]) < tolerance);
+      if (fabs(y[i] - setpoints[i]) >= tolerance) printf("  %s controller %d at %f\n", name, i, y[i]);
+   }
+   printf("settling        %-6s %.4f %.4f %.4f (setpoints 10 -5 50)\n", name, y[0], y[1], y[2]);
+}
+
+/* Setpoint out of reach (plant gain 0.5, output limit 100) for two seconds, then back in reach */
+template <typename T>
+static void checkWindup(const char *name)
+{
+   PID_HR<T, 1> pid(SAMPLE_US);
+   T input = T(0.0), setpoint = T(80.0), output = T(0.0);
+   double y = 0;
+
+   pid.SetTunings(0, 2.0, 20.0, 0.0);
+   pid.SetOutputLimits(0, 0, 100);
+   pid.SetMode(AUTOMATIC, &input, &output);
+
+   for (int k = 0; k < 2000; k++)
+   {
+      pid.ComputeMany(&input, &setpoint, &output);
+      y = plant(y, toDouble(output), 0.5);
+      input = T(y);
+   }
+   CHECK(toDouble(output) == 100.0);
+
+   setpoint = T(20.0);
+   pid.ComputeMany(&input, &setpoint, &output);
+   CHECK(toDouble(output) < 100.0);     // no integral to unwind
+
+   for (int k = 0; k < 2000; k++)
+   {
+      y = plant(y, toDouble(output), 0.5);
+      input = T(y);
+      pid.ComputeMany(&input, &setpoint, &output);
+   }
+   CHECK(fabs(y - 20.0) < 0.05);
+   printf("anti-windup     %-6s %.4f after the setpoint came back (20)\n", name, y);
+}
+
+/* Plant with a negative gain, controlled in REVERSE */
+template <typename T>
+static void checkReverse(const char *name)
+{
+   PID_HR<T, 1> pid(SAMPLE_US);
+   T input = T(0.0), setpoint = T(-20.0), output = T(0.0);
+   double y = 0;
+
+   pid.SetTunings(0, 2.0, 20.0, 0.01);
+   pid.SetOutputLimits(0, -100, 100);
+   pid.SetControllerDirection(0, REVERSE);
+   CHECK(pid.GetDirection(0) == REVERSE);
+   pid.SetMode(AUTOMATIC, &input, &output);
+
+   for (int k = 0; k < 3000; k++)
+   {
+      pid.ComputeMany(&input, &setpoint, &output);
+      y = plant(y, toDouble(output), -1.0);
+      input = T(y);
+   }
+   CHECK(fabs(y + 20.0) < 0.05);
+   CHECK(toDouble(output) > 0);
+}
+
+/* MANUAL to AUTOMATIC at the operating point: the output carries on from where it was */
+template <typename T>
+static void checkBumpless()
+{
+   PID_HR<T, 1> pid(SAMPLE_US);
+   T input = T(10.0), setpoint = T(10.0), output = T(40.0);
+
+   pid.SetTunings(0, 2.0, 20.0, 0.5);
+   CHECK(pid.GetMode() == MANUAL);
+   pid.SetMode(AUTOMATIC, &input, &output);
+   output = T(0.0);
+   pid.ComputeMany(&input, &setpoint, &output);
+   CHECK(toDouble(output) == 40.0);
+}
+
+/* Compute() runs once per period on the micros() grid, whatever the call jitter */
+static void checkSchedule()
+{
+   PID_HR<float, 1> pid(SAMPLE_US);
+   float input = 0, setpoint = 1, output = 0;
+   uint32_t seed = 1;
+   int samples = 0;
+
+   hostUs = 0xFFFFF000UL;              // wraps during the run
+   pid.SetMode(AUTOMATIC, &input, &output);
+   unsigned long start = hostUs;
+   CHECK(pid.Compute(&input, &setpoint, &output));      // first call computes at once
+   while (hostUs - start < 1000000UL)
+   {
+      seed = seed * 1664525u + 1013904223u;
+      hostUs += (seed >> 24) % 300;
+      if (pid.Compute(&input, &setpoint, &output)) samples++;
+   }
+   CHECK(samples >= 999 && samples <= 1000);
+
+   /* A stall longer than a period restarts the grid instead of catching up */
+   hostUs += 5500;
+   CHECK(pid.Compute(&input, &setpoint, &output));
+   CHECK(!pid.Compute(&input, &setpoint, &output));
+   hostUs += SAMPLE_US - 1;
+   CHECK(!pid.Compute(&input, &setpoint, &output));
+   hostUs += 1;
+   CHECK(pid.Compute(&input, &setpoint, &output));
+
+   pid.SetSampleTime(2000);
+   CHECK(pid.GetSampleTime() == 2000);
+   printf("schedule        %d samples in 1s of jittered calls\n", samples);
+}
+
+int main()
+{
+   static Trace traceDouble, traceFloat, traceQ16;
+
+   checkSettling<double>("double", 0.01, &traceDouble);
+   checkSettling<float>("float", 0.01, &traceFloat);
+   checkSettling<Q16_16>("q16", 0.05, &traceQ16);
+
+   double floatDeviation = 0, q16Deviation = 0;
+   for (int i = 0; i < 3; i++)
+   {
+      for (int k = 0; k < 3000; k++)
+      {
+         floatDeviation = fmax(floatDeviation, fabs(traceFloat.y[i][k] - traceDouble.y[i][k]));
+         q16Deviation = fmax(q16Deviation, fabs(traceQ16.y[i][k] - traceDouble.y[i][k]));
+      }
+   }
+   CHECK(floatDeviation < 0.01);
+   CHECK(q16Deviation < 0.1);
+   printf("against double  float %.5f, q16 %.5f max deviation of the plant output\n", floatDeviation, q16Deviation);
+
+   checkWindup<double>("double");
+   checkWindup<float>("float");
+   checkWindup<Q16_16>("q16");
+
+   checkReverse<double>("double");
+   checkReverse<float>("float");
+   checkReverse<Q16_16>("q16");
+
+   checkBumpless<double>();
+   checkBumpless<float>();
+   checkBumpless<Q16_16>();
+
+   checkSchedule();
+
+   printf("result          %s (%d failures)\n", failures ? "FAILED" : "ok", failures);
+   return failures ? 1 : 0;
+}
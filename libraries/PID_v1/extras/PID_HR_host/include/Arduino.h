@@ -0,0 +1,14 @@
+// Host stand-in for the Arduino core: only the clock used by PID_HR.
+
+#ifndef PID_HR_HOST_ARDUINO_H
+#define PID_HR_HOST_ARDUINO_H
+
+#include <stdint.h>
+
+#define ARDUINO 100
+
+extern unsigned long hostUs; // Virtual clock, advanced by the test
+
+inline unsigned long micros() { return hostUs; }
+
+#endif // PID_HR_HOST_ARDUINO_H
@@ -0,0 +1,41 @@
+// Q16.16 fixed point number for the host check: the operations PID_HR needs
+// (T(double), +, -, *, comparisons). Products and conversions saturate, like
+// the fixed point types PID_HR is meant for on cores without FPU.
+
+#ifndef PID_HR_HOST_Q16_16_H
+#define PID_HR_HOST_Q16_16_H
+
+#include <stdint.h>
+#include <math.h>
+
+class Q16_16
+{
+public:
+  int32_t raw;
+
+  Q16_16() : raw(0) {}
+  Q16_16(double v) : raw(v >= 32768.0 ? INT32_MAX : (v <= -32768.0 ? INT32_MIN : saturate(lround(v * 65536.0)))) {}
+
+  explicit operator float() const { return raw * (1.0f / 65536.0f); }
+
+  Q16_16 operator-() const { return fromRaw(saturate(-(int64_t)raw)); }
+  Q16_16 operator+(Q16_16 b) const { return fromRaw(saturate((int64_t)raw + b.raw)); }
+  Q16_16 operator-(Q16_16 b) const { return fromRaw(saturate((int64_t)raw - b.raw)); }
+  Q16_16 operator*(Q16_16 b) const { return fromRaw(saturate(((int64_t)raw * b.raw) >> 16)); }
+  Q16_16 &operator+=(Q16_16 b) { return *this = *this + b; }
+  Q16_16 &operator-=(Q16_16 b) { return *this = *this - b; }
+  Q16_16 &operator*=(Q16_16 b) { return *this = *this * b; }
+
+  bool operator<(Q16_16 b) const { return raw < b.raw; }
+  bool operator>(Q16_16 b) const { return raw > b.raw; }
+  bool operator<=(Q16_16 b) const { return raw <= b.raw; }
+  bool operator>=(Q16_16 b) const { return raw >= b.raw; }
+  bool operator==(Q16_16 b) const { return raw == b.raw; }
+  bool operator!=(Q16_16 b) const { return raw != b.raw; }
+
+private:
+  static Q16_16 fromRaw(int32_t r) { Q16_16 q; q.raw = r; return q; }
+  static int32_t saturate(int64_t r) { return r > INT32_MAX ? INT32_MAX : (r < INT32_MIN ? INT32_MIN : (int32_t)r); }
+};
+
+#endif // PID_HR_HOST_Q16_16_H